@@ -3,6 +3,10 @@
 
 # Testing
 option(REALCRAFT_BUILD_TESTS "Build unit tests" ON)
+option(REALCRAFT_BUILD_BENCHMARKS "Build performance benchmarks (requires REALCRAFT_BUILD_TESTS)" ON)
+
+# Command-line tools (tools/)
+option(REALCRAFT_BUILD_TOOLS "Build command-line tools (the asset packer is always built)" ON)
 
 # Debug options
 option(REALCRAFT_ENABLE_ASAN "Enable Address Sanitizer in Debug builds" ON)
@@ -27,6 +31,9 @@ endif()
 
 # Performance/profiling
 option(REALCRAFT_ENABLE_PROFILING "Enable profiling instrumentation" OFF)
+if(REALCRAFT_ENABLE_PROFILING)
+    add_compile_definitions(REALCRAFT_ENABLE_PROFILING=1)
+endif()
 
 # Worker threads (0 = auto-detect based on hardware)
 set(REALCRAFT_WORKER_THREADS "0" CACHE STRING "Number of worker threads (0 = auto)")
@@ -34,6 +41,9 @@ set(REALCRAFT_WORKER_THREADS "0" CACHE STRING "Number of worker threads (0 = aut
 # Print build options summary
 message(STATUS "Build Options:")
 message(STATUS "  REALCRAFT_BUILD_TESTS:       ${REALCRAFT_BUILD_TESTS}")
+message(STATUS "  REALCRAFT_BUILD_TOOLS:       ${REALCRAFT_BUILD_TOOLS}")
+message(STATUS "  REALCRAFT_BUILD_BENCHMARKS:  ${REALCRAFT_BUILD_BENCHMARKS}")
 message(STATUS "  REALCRAFT_ENABLE_ASAN:       ${REALCRAFT_ENABLE_ASAN}")
 message(STATUS "  REALCRAFT_ENABLE_LTO:        ${REALCRAFT_ENABLE_LTO}")
 message(STATUS "  REALCRAFT_ENABLE_RAYTRACING: ${REALCRAFT_ENABLE_RAYTRACING}")
+message(STATUS "  REALCRAFT_ENABLE_PROFILING:  ${REALCRAFT_ENABLE_PROFILING}")
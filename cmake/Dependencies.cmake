@@ -21,6 +21,11 @@ message(STATUS "Found zstd")
 if(REALCRAFT_BUILD_TESTS)
     find_package(GTest CONFIG REQUIRED)
     message(STATUS "Found GTest")
+
+    if(REALCRAFT_BUILD_BENCHMARKS)
+        find_package(benchmark CONFIG REQUIRED)
+        message(STATUS "Found Google Benchmark")
+    endif()
 endif()
 
 # Physics (Bullet3)
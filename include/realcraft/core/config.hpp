@@ -105,6 +105,7 @@ inline constexpr const char* VIEW_DISTANCE = "view_distance";
 // Debug section
 inline constexpr const char* SHOW_FPS = "show_fps";
 inline constexpr const char* LOG_LEVEL = "log_level";
+inline constexpr const char* DETERMINISTIC_TASKS = "deterministic_tasks";
 }  // namespace config_key
 
 }  // namespace realcraft::core
@@ -15,6 +15,8 @@ class Engine;
 class GameLoop;
 class Config;
 class LinearAllocator;
+class Arena;
+class PoolAllocator;
 
 // Core types
 using Milliseconds = double;
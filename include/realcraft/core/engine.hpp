@@ -10,6 +10,7 @@
 #include <realcraft/core/game_loop.hpp>
 #include <realcraft/core/logger.hpp>
 #include <realcraft/graphics/device.hpp>
+#include <realcraft/platform/asset_archive.hpp>
 #include <realcraft/platform/window.hpp>
 #include <string>
 
@@ -33,6 +34,12 @@ struct EngineConfig {
     // Config file path (empty = use default: <user_config_dir>/config.json)
     std::filesystem::path config_path;
 
+    // Packed asset archive (empty = <executable_dir>/assets.rcpak) and the
+    // directory its paths resolve against for loose-file fallback (empty =
+    // the source tree in development builds)
+    std::filesystem::path asset_archive_path;
+    std::filesystem::path asset_root;
+
     // Game loop settings
     GameLoopConfig game_loop;
 };
@@ -67,6 +74,8 @@ public:
     [[nodiscard]] const Config* get_config() const;
     [[nodiscard]] GameLoop* get_game_loop();
     [[nodiscard]] const GameLoop* get_game_loop() const;
+    [[nodiscard]] platform::AssetStore* get_assets();
+    [[nodiscard]] const platform::AssetStore* get_assets() const;
 
     // Input access (convenience)
     [[nodiscard]] platform::Input* get_input();
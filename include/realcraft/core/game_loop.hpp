@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <realcraft/core/task_graph.hpp>
 
 namespace realcraft::core {
 
@@ -20,6 +21,8 @@ struct GameLoopConfig {
     double max_frame_time = 0.25;        // Prevent spiral of death
     double target_fps = 0.0;             // 0 = unlimited (vsync controls)
     bool vsync = true;
+    double simulated_frame_time = 0.0;   // > 0 = advance by this each frame instead of wall time (replays)
+    TaskGraphConfig tasks;               // Frame task graph workers and ordering
 };
 
 // Fixed timestep game loop with interpolated rendering
@@ -43,6 +46,10 @@ public:
     void set_update(UpdateCallback callback);
     void set_render(RenderCallback callback);
 
+    // Subsystem tasks; each phase's tasks run after the matching callback
+    [[nodiscard]] TaskGraph& get_task_graph();
+    [[nodiscard]] const TaskGraph& get_task_graph() const;
+
     // Run single frame - call this in your main loop
     void run_frame();
 
@@ -6,15 +6,27 @@
 #include <spdlog/fmt/fmt.h>
 #include <spdlog/spdlog.h>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
 
 namespace realcraft::core {
 
 // Log levels matching spdlog for easy conversion
 enum class LogLevel { Trace = 0, Debug = 1, Info = 2, Warn = 3, Error = 4, Critical = 5, Off = 6 };
 
+// What a thread does when its log buffer is full
+enum class LogOverflowPolicy : uint8_t {
+    Block,  // Wait for the backend thread to make room
+    Drop    // Discard the message (counted, and reported by the backend)
+};
+
 // Logger configuration
 struct LoggerConfig {
     LogLevel console_level = LogLevel::Info;
@@ -25,8 +37,98 @@ struct LoggerConfig {
     size_t max_files = 3;                     // Rotating backup count
     bool include_timestamps = true;
     bool colored_output = true;
+
+    // Asynchronous backend: records are copied into per-thread ring buffers
+    // and formatted/written by a background thread
+    bool async = true;
+    size_t thread_buffer_size = 256 * 1024;  // Bytes per logging thread
+    LogOverflowPolicy overflow_policy = LogOverflowPolicy::Block;
+    bool flush_on_crash = true;  // Dump unwritten records to stderr from fatal signal handlers
 };
 
+namespace detail {
+
+using LogCategoryId = uint16_t;
+
+// Backend hook that turns a record's stored format string and argument
+// bytes back into the message text
+using LogFormatFn = std::string (*)(std::string_view format, const std::byte* args);
+
+// Arithmetic and string arguments are copied into the record as bytes and
+// formatted on the backend thread. Any other argument type makes the whole
+// message format on the calling thread instead.
+template <typename T>
+inline constexpr bool is_log_string_v =
+    std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> || std::is_same_v<T, const char*> ||
+    std::is_same_v<T, char*>;
+
+template <typename T>
+inline constexpr bool is_log_encodable_v = std::is_arithmetic_v<T> || is_log_string_v<T>;
+
+template <typename T>
+using log_decoded_t = std::conditional_t<is_log_string_v<T>, std::string_view, T>;
+
+template <typename T>
+std::string_view log_string_view(const T& value) {
+    if constexpr (std::is_pointer_v<T>) {
+        return value != nullptr ? std::string_view(value) : std::string_view("(null)");
+    } else {
+        return std::string_view(value);
+    }
+}
+
+template <typename T>
+size_t log_encoded_size(const T& value) {
+    if constexpr (is_log_string_v<T>) {
+        return sizeof(uint32_t) + log_string_view(value).size();
+    } else {
+        return sizeof(T);
+    }
+}
+
+template <typename T>
+std::byte* log_encode(std::byte* out, const T& value) {
+    if constexpr (is_log_string_v<T>) {
+        const std::string_view view = log_string_view(value);
+        const auto size = static_cast<uint32_t>(view.size());
+        std::memcpy(out, &size, sizeof(size));
+        std::memcpy(out + sizeof(size), view.data(), view.size());
+        return out + sizeof(size) + view.size();
+    } else {
+        std::memcpy(out, &value, sizeof(T));
+        return out + sizeof(T);
+    }
+}
+
+template <typename T>
+log_decoded_t<T> log_decode(const std::byte*& in) {
+    if constexpr (is_log_string_v<T>) {
+        uint32_t size = 0;
+        std::memcpy(&size, in, sizeof(size));
+        std::string_view view(reinterpret_cast<const char*>(in + sizeof(size)), size);
+        in += sizeof(size) + size;
+        return view;
+    } else {
+        T value;
+        std::memcpy(&value, in, sizeof(T));
+        in += sizeof(T);
+        return value;
+    }
+}
+
+template <typename... Args>
+std::string log_format_record(std::string_view format, [[maybe_unused]] const std::byte* args) {
+    // Braced initialization decodes the arguments left to right
+    std::tuple<log_decoded_t<Args>...> values{log_decode<Args>(args)...};
+    return std::apply([format](auto&... decoded) { return fmt::vformat(format, fmt::make_format_args(decoded...)); },
+                      values);
+}
+
+// Record whose text was formatted on the calling thread (one encoded string)
+std::string log_format_preformatted(std::string_view format, const std::byte* args);
+
+}  // namespace detail
+
 // Static logging interface
 class Logger {
 public:
@@ -43,9 +145,12 @@ public:
     static void set_global_level(LogLevel level);
     [[nodiscard]] static LogLevel get_global_level();
 
-    // Force flush to file
+    // Force flush to file (waits for the backend to write queued records)
     static void flush();
 
+    // Messages discarded under LogOverflowPolicy::Drop since initialization
+    [[nodiscard]] static uint64_t dropped_message_count();
+
     // Core logging functions
     template <typename... Args>
     static void trace(std::string_view category, fmt::format_string<Args...> fmt, Args&&... args) {
@@ -82,15 +187,80 @@ private:
 
     template <typename... Args>
     static void log_impl(LogLevel level, std::string_view category, fmt::format_string<Args...> fmt, Args&&... args) {
-        if (!should_log(level, category)) {
+        // Lowest level enabled for any category; rejects most disabled calls
+        if (static_cast<int>(level) < min_level_.load(std::memory_order_relaxed)) {
             return;
         }
+        detail::LogCategoryId category_id = 0;
+        if (!should_log(level, category, category_id)) {
+            return;
+        }
+
+        if (async_.load(std::memory_order_relaxed)) {
+            const fmt::string_view format = fmt;
+            const std::string_view format_view(format.data(), format.size());
+            std::byte* out = nullptr;
+            RecordSlot slot = RecordSlot::Synchronous;
+
+            if constexpr ((detail::is_log_encodable_v<std::decay_t<Args>> && ...)) {
+                // Encode as the decayed type the decoder reads (string literals as const char*)
+                const size_t size =
+                    format_view.size() +
+                    (size_t{0} + ... + detail::log_encoded_size(static_cast<const std::decay_t<Args>&>(args)));
+                slot = begin_record(level, category_id, &detail::log_format_record<std::decay_t<Args>...>,
+                                    format_view.size(), size, out);
+                if (slot == RecordSlot::Reserved) {
+                    out = write_bytes(out, format_view);
+                    ((out = detail::log_encode(out, static_cast<const std::decay_t<Args>&>(args))), ...);
+                }
+            } else {
+                const std::string message = fmt::format(fmt, std::forward<Args>(args)...);
+                slot = begin_record(level, category_id, &detail::log_format_preformatted, 0,
+                                    detail::log_encoded_size(message), out);
+                if (slot == RecordSlot::Reserved) {
+                    detail::log_encode(out, message);
+                } else if (slot == RecordSlot::Synchronous) {
+                    log_message(level, category, message);
+                    return;
+                }
+            }
+
+            if (slot == RecordSlot::Reserved) {
+                end_record();
+            }
+            if (slot != RecordSlot::Synchronous) {
+                return;
+            }
+        }
+
         auto message = fmt::format(fmt, std::forward<Args>(args)...);
         log_message(level, category, message);
     }
 
-    [[nodiscard]] static bool should_log(LogLevel level, std::string_view category);
+    enum class RecordSlot : uint8_t {
+        Reserved,    // Payload space reserved in the thread's buffer
+        Dropped,     // Buffer full under LogOverflowPolicy::Drop
+        Synchronous  // Backend unavailable or record too large; log directly
+    };
+
+    static std::byte* write_bytes(std::byte* out, std::string_view bytes) {
+        std::memcpy(out, bytes.data(), bytes.size());
+        return out + bytes.size();
+    }
+
+    [[nodiscard]] static bool should_log(LogLevel level, std::string_view category, detail::LogCategoryId& id);
     static void log_message(LogLevel level, std::string_view category, std::string_view message);
+
+    // Reserve a record of `payload_size` bytes on the calling thread's buffer:
+    // the first `format_size` bytes hold the format string, the rest the
+    // encoded arguments
+    [[nodiscard]] static RecordSlot begin_record(LogLevel level, detail::LogCategoryId category,
+                                                 detail::LogFormatFn format, size_t format_size, size_t payload_size,
+                                                 std::byte*& out);
+    static void end_record();
+
+    inline static std::atomic<int> min_level_{0};
+    inline static std::atomic<bool> async_{false};
 };
 
 // Pre-defined log categories for consistency
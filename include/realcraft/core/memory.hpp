@@ -3,22 +3,58 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <new>
+#include <utility>
+#include <vector>
 
 namespace realcraft::core {
 
-// Memory statistics (debug builds only)
+// ============================================================================
+// Memory Tracking
+// ============================================================================
+
+// What tracked memory is used for
+enum class MemoryCategory : uint8_t {
+    General,
+    World,
+    Meshing,
+    Physics,
+    Rendering,
+    Gameplay,
+    Arena,  // Blocks owned by frame and job arenas
+    Pool,   // Slabs owned by pool allocators
+    Count
+};
+
+inline constexpr size_t MEMORY_CATEGORY_COUNT = static_cast<size_t>(MemoryCategory::Count);
+
+[[nodiscard]] const char* memory_category_name(MemoryCategory category);
+
+struct MemoryCategoryStats {
+    size_t total_allocations = 0;
+    size_t total_deallocations = 0;
+    size_t active_allocations = 0;
+    size_t active_bytes = 0;
+};
+
+// Memory statistics, summed over all categories
 struct MemoryStats {
     size_t total_allocations = 0;
     size_t total_deallocations = 0;
     size_t active_allocations = 0;
     size_t active_bytes = 0;
-    size_t peak_allocations = 0;
+    size_t peak_allocations = 0;  // Sampled by sample_peaks() and get_stats()
     size_t peak_bytes = 0;
+    std::array<MemoryCategoryStats, MEMORY_CATEGORY_COUNT> categories{};
 };
 
-// Static memory tracking interface
+// Static memory tracking interface. Counters live in per-thread blocks that
+// only their owning thread writes, so recording is a few relaxed atomic
+// stores and never takes a lock; reads sum over all blocks.
 class MemoryTracker {
 public:
     // Initialize/shutdown
@@ -31,7 +67,16 @@ public:
     static void reset_stats();
     static void log_stats();
 
-    // Manual tracking (used by custom allocators)
+    // Fold current usage into the peaks (the game loop calls this every frame)
+    static void sample_peaks();
+
+    // Sized tracking, cheap enough to leave on in release builds
+    static void record_allocation(MemoryCategory category, size_t size);
+    static void record_deallocation(MemoryCategory category, size_t size);
+
+    // Pointer tracking (used by custom allocators). Debug builds also keep a
+    // per-pointer table for leak reports; release builds cannot recover the
+    // size on deallocation, so only the counts stay exact there.
     static void track_allocation(void* ptr, size_t size, const char* tag = nullptr);
     static void track_deallocation(void* ptr);
 
@@ -42,7 +87,11 @@ private:
     MemoryTracker() = delete;  // Static-only class
 };
 
-// Linear (bump) allocator for per-frame temporary data
+// ============================================================================
+// Linear Allocator
+// ============================================================================
+
+// Linear (bump) allocator with a fixed capacity
 class LinearAllocator {
 public:
     explicit LinearAllocator(size_t capacity);
@@ -87,11 +136,244 @@ private:
     std::unique_ptr<Impl> impl_;
 };
 
-// Per-frame allocator singleton access
-LinearAllocator& get_frame_allocator();
-void initialize_frame_allocator(size_t capacity = 4 * 1024 * 1024);  // 4 MB default
-void shutdown_frame_allocator();
-void reset_frame_allocator();  // Call at start of each frame
+// ============================================================================
+// Arena
+// ============================================================================
+
+// Growable bump allocator for transient data. Memory comes from heap blocks
+// that are kept across reset(); after a reset the blocks are merged into one
+// that fits the previous high-water mark, so a warmed-up arena stops touching
+// the heap. Destructors of created objects are never run.
+//
+// Not thread-safe: use the calling thread's get_frame_arena() or
+// get_job_arena() rather than sharing one.
+class Arena {
+public:
+    struct Marker {
+        size_t block = 0;
+        size_t offset = 0;
+    };
+
+    explicit Arena(size_t block_size = 64 * 1024, MemoryCategory category = MemoryCategory::Arena);
+    ~Arena();
+
+    // Non-copyable, non-movable
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena(Arena&&) = delete;
+    Arena& operator=(Arena&&) = delete;
+
+    // Returns nullptr only if the heap is exhausted
+    [[nodiscard]] void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+        const auto current = reinterpret_cast<uintptr_t>(cursor_);
+        const uintptr_t aligned = (current + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        if (cursor_ != nullptr && aligned + size <= reinterpret_cast<uintptr_t>(limit_)) {
+            cursor_ = reinterpret_cast<std::byte*>(aligned + size);
+            return reinterpret_cast<void*>(aligned);
+        }
+        return allocate_slow(size, alignment);
+    }
+
+    template <typename T, typename... Args>
+    [[nodiscard]] T* create(Args&&... args) {
+        void* ptr = allocate(sizeof(T), alignof(T));
+        return ptr != nullptr ? new (ptr) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    template <typename T>
+    [[nodiscard]] T* allocate_array(size_t count) {
+        return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    // Rewind to an earlier mark(); everything allocated since is released
+    [[nodiscard]] Marker mark() const;
+    void release(const Marker& marker);
+
+    // Release everything
+    void reset();
+
+    // Release everything and return all blocks to the heap
+    void purge();
+
+    [[nodiscard]] size_t used() const;
+    [[nodiscard]] size_t capacity() const;
+    [[nodiscard]] size_t block_count() const { return blocks_.size(); }
+
+private:
+    struct Block {
+        std::byte* data = nullptr;
+        size_t size = 0;
+    };
+
+    void* allocate_slow(size_t size, size_t alignment);
+    void use_block(size_t index);
+
+    std::byte* cursor_ = nullptr;
+    std::byte* limit_ = nullptr;
+    size_t current_ = 0;  // Index of the block cursor_ points into
+    std::vector<Block> blocks_;
+    size_t block_size_;
+    size_t high_water_ = 0;
+    MemoryCategory category_;
+};
+
+// Releases everything allocated from an arena during the scope
+class ArenaScope {
+public:
+    explicit ArenaScope(Arena& arena) : arena_(arena), marker_(arena.mark()) {}
+    ~ArenaScope() { arena_.release(marker_); }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+    [[nodiscard]] Arena& arena() { return arena_; }
+
+private:
+    Arena& arena_;
+    Arena::Marker marker_;
+};
+
+// Standard allocator over an Arena, for containers that live no longer than
+// the arena's current frame or scope. Deallocation is a no-op.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena& arena) noexcept : arena_(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(other.arena()) {}
+
+    [[nodiscard]] T* allocate(size_t count) {
+        void* ptr = arena_->allocate(sizeof(T) * count, alignof(T));
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(ptr);
+    }
+    void deallocate(T* /*ptr*/, size_t /*count*/) noexcept {}
+
+    [[nodiscard]] Arena* arena() const noexcept { return arena_; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena_ == other.arena();
+    }
+
+private:
+    Arena* arena_;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+// The calling thread's frame arena. Its contents are released the first
+// time the thread asks for it after reset_frame_arenas(), so a task must not
+// keep pointers across frames; long-running jobs should use the job arena.
+[[nodiscard]] Arena& get_frame_arena();
+
+// The calling thread's job arena. Wrap each job in an ArenaScope.
+[[nodiscard]] Arena& get_job_arena();
+
+// Initial block size for arenas created after this call
+void initialize_frame_arenas(size_t block_size = 256 * 1024);
+void reset_frame_arenas();     // Call at start of each frame
+void shutdown_frame_arenas();  // Frees the calling thread's arenas; other threads free theirs on exit
+
+// ============================================================================
+// Pool Allocator
+// ============================================================================
+
+// Thread-safe allocator of fixed-size blocks, carved from slabs that are kept
+// until the pool is destroyed. For hot, short-lived objects of one size.
+class PoolAllocator {
+public:
+    explicit PoolAllocator(size_t block_size, size_t blocks_per_slab = 256,
+                           MemoryCategory category = MemoryCategory::Pool);
+    ~PoolAllocator();
+
+    // Non-copyable, non-movable
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+    PoolAllocator(PoolAllocator&&) = delete;
+    PoolAllocator& operator=(PoolAllocator&&) = delete;
+
+    // Blocks are aligned to alignof(std::max_align_t). Returns nullptr only
+    // if the heap is exhausted.
+    [[nodiscard]] void* allocate();
+    void deallocate(void* ptr);
+
+    template <typename T, typename... Args>
+    [[nodiscard]] T* create(Args&&... args) {
+        static_assert(alignof(T) <= alignof(std::max_align_t));
+        if (sizeof(T) > block_size()) {
+            return nullptr;
+        }
+        void* ptr = allocate();
+        return ptr != nullptr ? new (ptr) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    template <typename T>
+    void destroy(T* object) {
+        if (object != nullptr) {
+            object->~T();
+            deallocate(object);
+        }
+    }
+
+    [[nodiscard]] size_t block_size() const;
+    [[nodiscard]] size_t capacity() const;  // Blocks in all slabs
+    [[nodiscard]] size_t in_use() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+// Standard allocator that serves single objects that fit a pool's block size
+// from the pool, and everything else (arrays, hash buckets) from the heap.
+// Suited to node-based containers.
+template <typename T>
+class PoolStdAllocator {
+public:
+    using value_type = T;
+
+    explicit PoolStdAllocator(PoolAllocator& pool) noexcept : pool_(&pool) {}
+    template <typename U>
+    PoolStdAllocator(const PoolStdAllocator<U>& other) noexcept : pool_(other.pool()) {}
+
+    [[nodiscard]] T* allocate(size_t count) {
+        if (uses_pool(count)) {
+            if (void* ptr = pool_->allocate()) {
+                return static_cast<T*>(ptr);
+            }
+            throw std::bad_alloc();
+        }
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* ptr, size_t count) noexcept {
+        if (uses_pool(count)) {
+            pool_->deallocate(ptr);
+        } else {
+            std::allocator<T>().deallocate(ptr, count);
+        }
+    }
+
+    [[nodiscard]] PoolAllocator* pool() const noexcept { return pool_; }
+
+    template <typename U>
+    bool operator==(const PoolStdAllocator<U>& other) const noexcept {
+        return pool_ == other.pool();
+    }
+
+private:
+    [[nodiscard]] bool uses_pool(size_t count) const noexcept {
+        return count == 1 && sizeof(T) <= pool_->block_size() && alignof(T) <= alignof(std::max_align_t);
+    }
+
+    PoolAllocator* pool_;
+};
 
 }  // namespace realcraft::core
 
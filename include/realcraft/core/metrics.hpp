@@ -0,0 +1,207 @@
+// RealCraft Engine Core
+// metrics.hpp - Runtime metrics registry (counters, gauges, latency histograms)
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace realcraft::core {
+
+// ============================================================================
+// Metric Types
+// ============================================================================
+//
+// All updates are single relaxed atomic operations and never take a lock.
+// Metrics are owned by MetricsRegistry and live for the rest of the process,
+// so call sites may cache the returned reference (typically in a function
+// local static).
+
+// Monotonic event count
+class Counter {
+public:
+    void add(uint64_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+    void reset() { value_.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value_{0};
+};
+
+// Point-in-time level (queue depth, loaded count, ...)
+class Gauge {
+public:
+    void set(int64_t value) { value_.store(value, std::memory_order_relaxed); }
+    void add(int64_t delta) { value_.fetch_add(delta, std::memory_order_relaxed); }
+    [[nodiscard]] int64_t value() const { return value_.load(std::memory_order_relaxed); }
+    void reset() { set(0); }
+
+private:
+    std::atomic<int64_t> value_{0};
+};
+
+// Summary of a histogram at snapshot time
+struct HistogramSummary {
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t min = 0;
+    uint64_t max = 0;
+    uint64_t p50 = 0;
+    uint64_t p90 = 0;
+    uint64_t p99 = 0;
+
+    [[nodiscard]] double mean() const {
+        return count > 0 ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+    }
+};
+
+// Log-linear (HDR-style) histogram of non-negative integer samples. Values
+// below SUB_BUCKETS are exact; above that each power of two is split into
+// SUB_BUCKETS buckets, so quantiles are within 1/SUB_BUCKETS of the truth
+// over the whole uint64_t range. The unit is up to the caller (name metrics
+// with a suffix such as "_us").
+class Histogram {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 3;
+    static constexpr uint32_t SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKET_COUNT = SUB_BUCKETS + (64 - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+    void record(uint64_t value) {
+        buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+
+        uint64_t current = min_.load(std::memory_order_relaxed);
+        while (value < current && !min_.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+        current = max_.load(std::memory_order_relaxed);
+        while (value > current && !max_.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    template <typename Rep, typename Period>
+    void record_duration(std::chrono::duration<Rep, Period> duration) {
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        record(us > 0 ? static_cast<uint64_t>(us) : 0);
+    }
+
+    [[nodiscard]] uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+
+    // Quantile in [0, 1]; returns the upper bound of the containing bucket,
+    // clamped to the largest recorded value
+    [[nodiscard]] uint64_t percentile(double quantile) const;
+    [[nodiscard]] HistogramSummary summary() const;
+    void reset();
+
+    [[nodiscard]] static constexpr size_t bucket_index(uint64_t value) {
+        if (value < SUB_BUCKETS) {
+            return static_cast<size_t>(value);
+        }
+        const auto exponent = static_cast<uint32_t>(std::bit_width(value)) - 1;
+        const auto shift = exponent - SUB_BUCKET_BITS;
+        const auto sub = static_cast<size_t>((value >> shift) & (SUB_BUCKETS - 1));
+        return SUB_BUCKETS + static_cast<size_t>(shift) * SUB_BUCKETS + sub;
+    }
+
+    // Largest value that maps to the bucket
+    [[nodiscard]] static constexpr uint64_t bucket_upper_bound(size_t index) {
+        if (index < SUB_BUCKETS) {
+            return index;
+        }
+        const auto shift = static_cast<uint32_t>((index - SUB_BUCKETS) / SUB_BUCKETS);
+        const uint64_t sub = (index - SUB_BUCKETS) % SUB_BUCKETS;
+        const uint64_t lower = (SUB_BUCKETS + sub) << shift;
+        return lower + ((uint64_t{1} << shift) - 1);
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> min_{UINT64_MAX};
+    std::atomic<uint64_t> max_{0};
+};
+
+// Records the lifetime of the scope into a histogram, in microseconds
+class ScopedLatency {
+public:
+    explicit ScopedLatency(Histogram& histogram)
+        : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+    ~ScopedLatency() { histogram_.record_duration(std::chrono::steady_clock::now() - start_); }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+private:
+    Histogram& histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// ============================================================================
+// Snapshot
+// ============================================================================
+
+struct MetricsSnapshot {
+    template <typename T>
+    struct Entry {
+        std::string name;
+        T value;
+    };
+
+    // Each list is sorted by name
+    std::vector<Entry<uint64_t>> counters;
+    std::vector<Entry<int64_t>> gauges;
+    std::vector<Entry<HistogramSummary>> histograms;
+
+    [[nodiscard]] const uint64_t* find_counter(std::string_view name) const;
+    [[nodiscard]] const int64_t* find_gauge(std::string_view name) const;
+    [[nodiscard]] const HistogramSummary* find_histogram(std::string_view name) const;
+
+    // One metric per line, suitable for logs and dump files
+    [[nodiscard]] std::string to_text() const;
+};
+
+// ============================================================================
+// Metrics Registry
+// ============================================================================
+
+// Process-wide registry. Lookup by name takes a mutex, so resolve metrics
+// once and keep the reference; updating them is lock-free.
+class MetricsRegistry {
+public:
+    static MetricsRegistry& instance();
+
+    // Returns the metric with this name, creating it on first use
+    [[nodiscard]] Counter& counter(std::string_view name);
+    [[nodiscard]] Gauge& gauge(std::string_view name);
+    [[nodiscard]] Histogram& histogram(std::string_view name);
+
+    [[nodiscard]] MetricsSnapshot snapshot() const;
+
+    // Write snapshot().to_text() to a file
+    bool dump(const std::filesystem::path& path) const;
+
+    // Zero every metric (registrations and references stay valid)
+    void reset();
+
+private:
+    MetricsRegistry();
+    ~MetricsRegistry();
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace realcraft::core
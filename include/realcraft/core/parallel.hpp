@@ -0,0 +1,46 @@
+// RealCraft Engine Core
+// parallel.hpp - Fork-join helper for short CPU-bound batches
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace realcraft::core {
+
+// Run fn(i) for every i in [0, count) on up to max_threads threads (0 = all
+// hardware threads), including the caller, and return once all calls have
+// finished. Indices are handed out one at a time, so uneven work balances
+// itself. Intended for one-off startup work, not per-frame jobs.
+template <typename Fn>
+void parallel_for(size_t count, Fn&& fn, size_t max_threads = 0) {
+    if (count == 0) {
+        return;
+    }
+
+    size_t threads = max_threads != 0 ? max_threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, count);
+
+    std::atomic<size_t> next{0};
+    auto run = [&]() {
+        for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < count;
+             i = next.fetch_add(1, std::memory_order_relaxed)) {
+            fn(i);
+        }
+    };
+
+    std::vector<std::thread> helpers;
+    helpers.reserve(threads - 1);
+    for (size_t t = 1; t < threads; ++t) {
+        helpers.emplace_back(run);
+    }
+    run();
+    for (auto& helper : helpers) {
+        helper.join();
+    }
+}
+
+}  // namespace realcraft::core
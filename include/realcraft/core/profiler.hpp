@@ -0,0 +1,124 @@
+// RealCraft Engine Core
+// profiler.hpp - Scoped profiling zones with per-thread ring buffers
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace realcraft::core {
+
+// Profiler configuration
+struct ProfilerConfig {
+    size_t events_per_thread = 64 * 1024;  // Ring capacity, rounded up to a power of two
+    bool start_capturing = true;
+};
+
+// Static profiling interface
+//
+// Each thread records begin/end/counter events into its own fixed-size ring
+// buffer; recording never takes a lock (a thread registers its buffer once,
+// on its first event). When a ring wraps, the oldest events are overwritten,
+// so a capture always holds the most recent window. Event names are stored
+// by pointer and must outlive the profiler (use string literals).
+//
+// Prefer the REALCRAFT_PROFILE_* macros below, which compile out unless the
+// build enables REALCRAFT_ENABLE_PROFILING.
+class Profiler {
+public:
+    // Initialize/shutdown
+    static void initialize(const ProfilerConfig& config = {});
+    static void shutdown();
+    [[nodiscard]] static bool is_initialized();
+
+    // Capture control (events are dropped while not capturing)
+    static void set_capturing(bool capturing);
+    [[nodiscard]] static bool is_capturing();
+
+    // Event recording
+    static void begin_zone(const char* name);
+    static void end_zone(const char* name);
+    static void counter(const char* name, double value);
+    static void set_thread_name(std::string_view name);
+
+    // Discard everything recorded so far
+    static void clear();
+
+    // Events currently held across all thread buffers
+    [[nodiscard]] static size_t event_count();
+
+    // Chrome trace event format (load in chrome://tracing or ui.perfetto.dev)
+    [[nodiscard]] static std::string to_chrome_trace();
+    static bool export_chrome_trace(const std::filesystem::path& path);
+
+private:
+    Profiler() = delete;  // Static-only class
+};
+
+// RAII zone; records begin on construction and end on destruction
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : name_(name) { Profiler::begin_zone(name_); }
+    ~ProfileScope() { Profiler::end_zone(name_); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name_;
+};
+
+// Acquire a deferred lock; if it is contended, the blocking wait is recorded
+// as a zone so stalls on shared mutexes show up in traces
+template <typename Lock>
+void profiled_lock(Lock& lock, const char* wait_zone) {
+    if (lock.try_lock()) {
+        return;
+    }
+    ProfileScope scope(wait_zone);
+    lock.lock();
+}
+
+}  // namespace realcraft::core
+
+// ============================================================================
+// Instrumentation Macros
+// ============================================================================
+
+#define REALCRAFT_PROFILE_CONCAT_INNER(a, b) a##b
+#define REALCRAFT_PROFILE_CONCAT(a, b) REALCRAFT_PROFILE_CONCAT_INNER(a, b)
+
+#if defined(REALCRAFT_ENABLE_PROFILING) && REALCRAFT_ENABLE_PROFILING
+
+// Zone covering the rest of the enclosing scope
+#define REALCRAFT_PROFILE_ZONE(name) \
+    ::realcraft::core::ProfileScope REALCRAFT_PROFILE_CONCAT(realcraft_profile_zone_, __LINE__)(name)
+
+// Zone for the enclosing function
+#define REALCRAFT_PROFILE_FUNCTION() REALCRAFT_PROFILE_ZONE(__func__)
+
+// Explicit begin/end for zones that do not follow a C++ scope
+#define REALCRAFT_PROFILE_BEGIN(name) ::realcraft::core::Profiler::begin_zone(name)
+#define REALCRAFT_PROFILE_END(name) ::realcraft::core::Profiler::end_zone(name)
+
+#define REALCRAFT_PROFILE_COUNTER(name, value) \
+    ::realcraft::core::Profiler::counter(name, static_cast<double>(value))
+#define REALCRAFT_PROFILE_THREAD(name) ::realcraft::core::Profiler::set_thread_name(name)
+
+// Lock a std::defer_lock lock, recording contended waits as a zone
+#define REALCRAFT_PROFILE_LOCK(lock, wait_zone) ::realcraft::core::profiled_lock(lock, wait_zone)
+
+#else
+
+#define REALCRAFT_PROFILE_ZONE(name) ((void)0)
+#define REALCRAFT_PROFILE_FUNCTION() ((void)0)
+#define REALCRAFT_PROFILE_BEGIN(name) ((void)0)
+#define REALCRAFT_PROFILE_END(name) ((void)0)
+#define REALCRAFT_PROFILE_COUNTER(name, value) ((void)0)
+#define REALCRAFT_PROFILE_THREAD(name) ((void)0)
+#define REALCRAFT_PROFILE_LOCK(lock, wait_zone) (lock).lock()
+
+#endif
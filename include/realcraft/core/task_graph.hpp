@@ -0,0 +1,94 @@
+// RealCraft Engine Core
+// task_graph.hpp - Per-frame task graph with declared resource dependencies
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace realcraft::core {
+
+// Which part of the frame a task belongs to
+enum class TaskPhase : uint8_t {
+    FixedUpdate,  // Once per fixed step, after the fixed update callback
+    Update,       // Once per frame, after the update callback
+};
+
+// Resources are plain names ("world", "inventory", ...). A task runs after
+// every earlier-registered task of its phase that writes something it
+// touches, or touches something it writes; all other tasks may overlap.
+struct TaskDesc {
+    std::string name;
+    TaskPhase phase = TaskPhase::Update;
+    std::vector<std::string> reads{};
+    std::vector<std::string> writes{};
+    bool main_thread = false;  // Run on the thread that runs the frame (GPU, window, observers)
+};
+
+using TaskFunction = std::function<void(double delta_time)>;
+using TaskId = uint32_t;
+inline constexpr TaskId INVALID_TASK_ID = 0;
+
+struct TaskGraphConfig {
+    uint32_t worker_threads = 0;  // 0 = hardware threads - 1, at most 4
+    bool deterministic = false;   // Run every task on the frame thread in registration order
+};
+
+// Timing of one task's most recent run
+struct TaskTiming {
+    std::string name;
+    TaskPhase phase = TaskPhase::Update;
+    uint64_t last_us = 0;
+    bool ran_on_worker = false;
+};
+
+// Runs a phase's tasks as a dependency graph on a small worker pool, with the
+// frame thread taking part. Durations are also recorded into
+// MetricsRegistry histograms named "task.<name>_us".
+//
+// Registration is not thread-safe with run(); register during setup.
+class TaskGraph {
+public:
+    TaskGraph();
+    ~TaskGraph();
+
+    // Non-copyable, non-movable
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+    TaskGraph(TaskGraph&&) = delete;
+    TaskGraph& operator=(TaskGraph&&) = delete;
+
+    // Restarts the worker pool if the thread count changes
+    void configure(const TaskGraphConfig& config);
+    [[nodiscard]] const TaskGraphConfig& get_config() const;
+
+    void set_deterministic(bool deterministic);
+    [[nodiscard]] bool is_deterministic() const;
+
+    // Returns INVALID_TASK_ID if the name is empty or already taken
+    TaskId add_task(const TaskDesc& desc, TaskFunction function);
+    void remove_task(TaskId id);
+    void clear();
+
+    [[nodiscard]] size_t task_count(TaskPhase phase) const;
+    [[nodiscard]] size_t worker_count() const;
+
+    // Run all tasks of a phase and return when they have finished. A task
+    // that throws is logged and counts as finished.
+    void run(TaskPhase phase, double delta_time);
+
+    // Names of the tasks a task waits for (for debugging the declared graph)
+    [[nodiscard]] std::vector<std::string> get_dependencies(TaskId id) const;
+
+    // Per-task timings of the latest run of each phase, in registration order
+    [[nodiscard]] std::vector<TaskTiming> get_timings() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace realcraft::core
@@ -0,0 +1,95 @@
+// RealCraft Gameplay System
+// input_recording.hpp - Per-fixed-step input recording for deterministic replays
+
+#pragma once
+
+#include <glm/vec3.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace realcraft::gameplay {
+
+inline constexpr uint32_t INPUT_RECORDING_MAGIC = 0x50524352;  // "RCRP" - RealCraft Replay
+inline constexpr uint32_t INPUT_RECORDING_VERSION = 1;
+
+// ============================================================================
+// Recorded Data
+// ============================================================================
+
+// Everything a replay needs to rebuild the session's starting state. The
+// world must be regenerated from the seed, so record on worlds without saved
+// edits (the demo world never saves).
+struct RecordingHeader {
+    uint32_t world_seed = 0;
+    uint32_t gameplay_seed = 0;  // Seeds gameplay RNGs such as item drop scatter
+    int32_t view_distance = 0;
+    double fixed_timestep = 1.0 / 60.0;
+    glm::dvec3 spawn_position{0.0};
+    float camera_pitch = 0.0f;
+    float camera_yaw = 0.0f;
+};
+
+namespace input_button {
+inline constexpr uint8_t JUMP = 1 << 0;
+inline constexpr uint8_t JUMP_JUST_PRESSED = 1 << 1;
+inline constexpr uint8_t SPRINT = 1 << 2;
+inline constexpr uint8_t CROUCH = 1 << 3;
+inline constexpr uint8_t PRIMARY = 1 << 4;                  // Held (mining)
+inline constexpr uint8_t SECONDARY_JUST_PRESSED = 1 << 5;  // Placement
+}  // namespace input_button
+
+// Input consumed by one fixed step
+struct InputFrame {
+    glm::vec3 move_direction{0.0f};  // World-space, as passed to the player controller
+    float camera_pitch = 0.0f;
+    float camera_yaw = 0.0f;
+    uint8_t buttons = 0;  // input_button flags
+    uint8_t hotbar_slot = 0;
+
+    [[nodiscard]] bool has(uint8_t button) const { return (buttons & button) != 0; }
+};
+
+struct InputRecording {
+    RecordingHeader header;
+    std::vector<InputFrame> frames;
+};
+
+// ============================================================================
+// Recorder
+// ============================================================================
+
+// Streams frames to disk as they are recorded, so a crash loses at most the
+// unflushed tail. Not thread-safe; record from the fixed step.
+class InputRecorder {
+public:
+    InputRecorder();
+    ~InputRecorder();
+
+    // Non-copyable, non-movable
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+    InputRecorder(InputRecorder&&) = delete;
+    InputRecorder& operator=(InputRecorder&&) = delete;
+
+    // Truncates the file and writes the header
+    bool start(const std::filesystem::path& path, const RecordingHeader& header);
+    void stop();
+    [[nodiscard]] bool is_recording() const;
+
+    void record(const InputFrame& frame);
+    [[nodiscard]] uint64_t frame_count() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+// Returns nullopt if the file is missing, of another version, or has a torn
+// header. A torn final frame (crash while recording) is dropped.
+[[nodiscard]] std::optional<InputRecording> load_input_recording(const std::filesystem::path& path);
+
+}  // namespace realcraft::gameplay
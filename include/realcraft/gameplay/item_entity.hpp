@@ -5,28 +5,29 @@
 
 #include <glm/vec3.hpp>
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <realcraft/gameplay/inventory.hpp>
 #include <realcraft/gameplay/item.hpp>
 #include <realcraft/world/types.hpp>
+#include <realcraft/world/world_manager.hpp>
 #include <vector>
 
 namespace realcraft::physics {
 class PhysicsWorld;
 }
 
-namespace realcraft::world {
-class WorldManager;
-}
-
 namespace realcraft::gameplay {
 
 // ============================================================================
 // Item Entity (dropped item in the world)
 // ============================================================================
 
+// Snapshot of one entity. The manager stores entities as structure-of-arrays;
+// this is what queries hand out.
 struct ItemEntity {
-    uint32_t id = 0;           // Unique entity ID
+    uint32_t id = 0;           // Generation-counted entity ID (never 0)
     glm::dvec3 position{0.0};  // World position
     glm::dvec3 velocity{0.0};  // Current velocity
     ItemStack item;            // The item(s) in this entity
@@ -36,12 +37,13 @@ struct ItemEntity {
     float bob_offset = 0.0f;   // Vertical bob animation offset
     bool on_ground = false;    // Is the item resting on ground
     bool can_pickup = false;   // Can be picked up (false during pickup delay)
-    bool marked_for_removal = false;
+    bool sleeping = false;     // At rest; skipped by physics until woken
 
     // Physics constants
     static constexpr double PICKUP_DELAY = 0.5;     // Seconds before pickup is allowed
     static constexpr double PICKUP_RADIUS = 2.0;    // Distance for auto-pickup
     static constexpr double MERGE_RADIUS = 0.5;     // Distance to merge with other items
+    static constexpr double GRID_CELL_SIZE = 1.0;   // Spatial hash cell edge, at least 2 * MERGE_RADIUS
     static constexpr double GRAVITY = 20.0;         // m/s^2
     static constexpr double GROUND_FRICTION = 0.8;  // Friction when on ground
     static constexpr double AIR_RESISTANCE = 0.02;  // Air drag
@@ -62,22 +64,25 @@ struct ItemEntityConfig {
     double pickup_delay = 0.5;        // Delay before items can be picked up
     bool enable_merging = true;       // Merge nearby identical items
     bool enable_physics = true;       // Enable gravity and collisions
+    uint32_t seed = 0;                // Drop scatter RNG seed (0 = random), fixed for replays
 };
 
 // ============================================================================
 // Item Entity Manager
 // ============================================================================
 
-class ItemEntityManager {
+// Observes the world so items resting on a block wake up and fall when that
+// block is removed, whoever removed it.
+class ItemEntityManager : public world::IWorldObserver {
 public:
     ItemEntityManager();
-    ~ItemEntityManager();
+    ~ItemEntityManager() override;
 
-    // Non-copyable, movable
+    // Non-copyable, non-movable (registered with the world by address)
     ItemEntityManager(const ItemEntityManager&) = delete;
     ItemEntityManager& operator=(const ItemEntityManager&) = delete;
-    ItemEntityManager(ItemEntityManager&&) noexcept;
-    ItemEntityManager& operator=(ItemEntityManager&&) noexcept;
+    ItemEntityManager(ItemEntityManager&&) = delete;
+    ItemEntityManager& operator=(ItemEntityManager&&) = delete;
 
     // ========================================================================
     // Lifecycle
@@ -110,6 +115,17 @@ public:
     // Spawn with random velocity spread (for block breaking)
     uint32_t spawn_item_scattered(const glm::dvec3& position, const ItemStack& item);
 
+    // Wake sleeping entities within radius, e.g. after the ground under them changed
+    void wake_items_near(const glm::dvec3& position, double radius);
+
+    // ========================================================================
+    // IWorldObserver
+    // ========================================================================
+
+    // Queues a wake-up around blocks that no longer support items; handled
+    // by the next update(), so it is safe from any thread
+    void on_block_changed(const world::BlockChangeEvent& event) override;
+
     // ========================================================================
     // Queries
     // ========================================================================
@@ -117,11 +133,14 @@ public:
     // Get number of active entities
     [[nodiscard]] size_t entity_count() const;
 
-    // Get all entities (for rendering)
-    [[nodiscard]] const std::vector<ItemEntity>& get_entities() const;
+    // Get number of entities at rest (not simulated)
+    [[nodiscard]] size_t sleeping_count() const;
+
+    // Visit all entities, oldest first (for rendering)
+    void for_each_entity(const std::function<void(const ItemEntity&)>& callback) const;
 
-    // Find entity by ID
-    [[nodiscard]] const ItemEntity* find_entity(uint32_t id) const;
+    // Find entity by ID; stale IDs of removed entities return nullopt
+    [[nodiscard]] std::optional<ItemEntity> find_entity(uint32_t id) const;
 
     // ========================================================================
     // Manual Control
@@ -153,12 +172,12 @@ private:
     ItemEntityConfig config_;
     bool initialized_ = false;
 
-    // Internal methods
-    void update_physics(ItemEntity& entity, double dt);
-    void update_pickup(ItemEntity& entity, const glm::dvec3& player_position, double current_time);
+    // Internal methods (entities are addressed by storage slot)
+    void update_physics(uint32_t slot, double dt);
+    void update_pickup(const glm::dvec3& player_position);
     void update_merging();
     void cleanup_entities(double current_time);
-    [[nodiscard]] bool check_ground_collision(ItemEntity& entity);
+    [[nodiscard]] bool check_ground_collision(uint32_t slot);
     [[nodiscard]] bool is_position_solid(const glm::dvec3& position) const;
 };
 
@@ -0,0 +1,28 @@
+// RealCraft Gameplay System
+// session_config.hpp - Gameplay tuning shared by the game and the replay tool
+
+#pragma once
+
+#include "block_interaction.hpp"
+#include "inventory.hpp"
+#include "item_entity.hpp"
+
+#include <realcraft/physics/physics_world.hpp>
+#include <realcraft/physics/player_controller.hpp>
+
+namespace realcraft::gameplay {
+
+// Settings for the simulation systems of a play session. The game and
+// realcraft_replay both start from default_session_config(), so retuning it
+// changes recordings and their replays together.
+struct SessionConfig {
+    physics::PhysicsConfig physics;
+    physics::PlayerControllerConfig player;
+    BlockInteractionConfig interaction;
+    InventoryConfig inventory;
+    ItemEntityConfig item_entity;
+};
+
+[[nodiscard]] SessionConfig default_session_config();
+
+}  // namespace realcraft::gameplay
@@ -0,0 +1,73 @@
+// RealCraft Graphics Abstraction Layer
+// shader_cache.hpp - Persistent, content-addressed cache of compiled shaders
+
+#pragma once
+
+#include "shader_compiler.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace realcraft::graphics {
+
+// Bump when the entry layout or anything that feeds into compilation output
+// (but is not part of the key) changes
+inline constexpr uint32_t SHADER_CACHE_VERSION = 1;
+inline constexpr uint32_t SHADER_CACHE_MAGIC = 0x43534352;  // "RCSC" - RealCraft Shader Cache
+
+struct ShaderCacheConfig {
+    std::filesystem::path directory;
+    size_t max_size_bytes = 64 * 1024 * 1024;  // Least recently used entries are evicted beyond this
+};
+
+struct ShaderCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t stores = 0;
+    uint64_t evictions = 0;
+};
+
+// On-disk cache of SPIR-V, MSL and reflection data. Entries are keyed by a
+// hash of the source, the transitive #include closure, the compile options
+// and the compiler identity, so a stale entry can never be returned; there
+// is no invalidation beyond size-bounded eviction. Thread-safe.
+class ShaderCache {
+public:
+    ShaderCache();
+    ~ShaderCache();
+
+    ShaderCache(const ShaderCache&) = delete;
+    ShaderCache& operator=(const ShaderCache&) = delete;
+
+    // Creates the directory and scans existing entries; returns false if the
+    // directory is unusable (the cache then stays disabled)
+    bool initialize(const ShaderCacheConfig& config);
+    [[nodiscard]] bool is_enabled() const;
+
+    // 128-bit hex key. `compiler_id` identifies the toolchain and target
+    // settings that produced the output.
+    [[nodiscard]] static std::string compute_key(std::string_view source, const ShaderCompileOptions& options,
+                                                 std::string_view compiler_id);
+
+    [[nodiscard]] std::optional<CompiledShader> load(const std::string& key);
+
+    // Only successful compilations are stored. Writes go to a temporary file
+    // that is renamed into place, so readers never see partial entries.
+    bool store(const std::string& key, const CompiledShader& shader);
+
+    void clear();
+
+    [[nodiscard]] size_t size_bytes() const;
+    [[nodiscard]] size_t entry_count() const;
+    [[nodiscard]] ShaderCacheStats stats() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace realcraft::graphics
@@ -15,6 +15,10 @@
 #include <string_view>
 #include <vector>
 
+namespace realcraft::platform {
+class AssetStore;
+}
+
 namespace realcraft::graphics {
 
 // ============================================================================
@@ -44,6 +48,8 @@ struct CompiledShader {
     ShaderReflection reflection;
 };
 
+class ShaderCache;
+
 // ============================================================================
 // Shader Compiler
 // ============================================================================
@@ -69,13 +75,39 @@ public:
     // Compile GLSL source to SPIR-V
     [[nodiscard]] CompiledShader compile_glsl(std::string_view source, const ShaderCompileOptions& options);
 
-    // Compile GLSL file to SPIR-V
+    // Compile GLSL file to SPIR-V. Relative paths (e.g. "shaders/glsl/x.frag")
+    // are read through the attached asset store when there is one.
     [[nodiscard]] CompiledShader compile_glsl_file(const std::filesystem::path& path,
                                                    const ShaderCompileOptions& options);
 
-    // Async compilation
+    // Async compilation. Cache hits are returned as a ready future without
+    // starting a thread.
     [[nodiscard]] std::future<CompiledShader> compile_glsl_async(std::string source, ShaderCompileOptions options);
 
+    // ========================================================================
+    // Persistent Cache
+    // ========================================================================
+
+    // Cache consulted before compiling and filled after successful
+    // compilations (nullptr disables). New compilers start with the default.
+    void set_cache(std::shared_ptr<ShaderCache> cache);
+    [[nodiscard]] std::shared_ptr<ShaderCache> get_cache() const;
+
+    static void set_default_cache(std::shared_ptr<ShaderCache> cache);
+    [[nodiscard]] static std::shared_ptr<ShaderCache> get_default_cache();
+
+    // ========================================================================
+    // Asset Source
+    // ========================================================================
+
+    // Store that shader files are read from (nullptr reads the filesystem).
+    // Not owned; new compilers start with the default.
+    void set_assets(const platform::AssetStore* assets);
+    [[nodiscard]] const platform::AssetStore* get_assets() const;
+
+    static void set_default_assets(const platform::AssetStore* assets);
+    [[nodiscard]] static const platform::AssetStore* get_default_assets();
+
     // ========================================================================
     // Cross-Compilation
     // ========================================================================
@@ -117,6 +149,10 @@ public:
     void set_hot_reload_enabled(bool enabled);
 
 private:
+    // Cache key for the request, or empty when no usable cache is attached
+    [[nodiscard]] std::string cache_key(std::string_view source, const ShaderCompileOptions& options) const;
+    [[nodiscard]] CompiledShader compile_glsl_uncached(std::string_view source, const ShaderCompileOptions& options);
+
     struct Impl;
     std::unique_ptr<Impl> impl_;
 };
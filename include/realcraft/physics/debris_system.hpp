@@ -13,6 +13,7 @@
 #include <optional>
 #include <realcraft/world/types.hpp>
 #include <realcraft/world/world_manager.hpp>
+#include <span>
 #include <vector>
 
 namespace realcraft::physics {
@@ -198,6 +199,9 @@ public:
     void on_collision(RigidBodyHandle body_a, RigidBodyHandle body_b, const glm::dvec3& contact_point,
                       const glm::dvec3& contact_normal, double impact_velocity);
 
+    // Process the step's contacts; those without a Debris category are skipped
+    void process_contacts(std::span<const ContactRecord> contacts);
+
     // ========================================================================
     // Statistics
     // ========================================================================
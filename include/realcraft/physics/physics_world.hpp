@@ -16,6 +16,7 @@
 #include <memory>
 #include <optional>
 #include <realcraft/world/world_manager.hpp>
+#include <span>
 #include <vector>
 
 namespace realcraft::physics {
@@ -135,6 +136,10 @@ public:
 
     void set_collision_callback(CollisionCallback callback);
 
+    // Penetrating contacts from the last fixed_update, gathered in one pass.
+    // Valid until the next fixed_update.
+    [[nodiscard]] std::span<const ContactRecord> get_contacts() const;
+
     // ========================================================================
     // IWorldObserver Implementation
     // ========================================================================
@@ -162,6 +167,7 @@ public:
         size_t chunk_colliders = 0;
         size_t total_collision_shapes = 0;
         double last_step_time_ms = 0.0;
+        double last_shift_time_ms = 0.0;
     };
 
     [[nodiscard]] DebugStats get_stats() const;
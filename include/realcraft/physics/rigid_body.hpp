@@ -86,6 +86,10 @@ public:
     [[nodiscard]] MotionType get_motion_type() const { return motion_type_; }
     [[nodiscard]] ColliderType get_collider_type() const { return collider_type_; }
 
+    // BodyCategory bits reported in contacts; always includes RigidBody
+    [[nodiscard]] uint32_t get_body_categories() const;
+    void add_body_category(BodyCategory category);
+
     // ========================================================================
     // Transform
     // ========================================================================
@@ -1,5 +1,5 @@
 // RealCraft Physics Engine
-// types.hpp - Core physics types: AABB, Ray, RayHit, ColliderHandle
+// types.hpp - Core physics types: AABB, Ray, RayHit, ColliderHandle, ContactRecord
 
 #pragma once
 
@@ -211,4 +211,43 @@ struct PhysicsMaterial {
     [[nodiscard]] static PhysicsMaterial wood() { return PhysicsMaterial{0.6, 0.2, 0.0, 0.05}; }
 };
 
+// ============================================================================
+// Body Category
+// ============================================================================
+
+// What a Bullet collision object belongs to. Kept as a bit set in the
+// object's second user index so contacts can be classified without lookups.
+enum class BodyCategory : uint32_t {
+    None = 0,
+    Chunk = 1 << 0,      // Static world geometry; has no handle
+    Collider = 1 << 1,   // User index is a ColliderHandle
+    RigidBody = 1 << 2,  // User index is a RigidBodyHandle
+    Debris = 1 << 3,     // Rigid body owned by the debris system
+};
+
+inline BodyCategory operator|(BodyCategory a, BodyCategory b) {
+    return static_cast<BodyCategory>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+}
+
+[[nodiscard]] inline bool has_category(uint32_t categories, BodyCategory category) {
+    return (categories & static_cast<uint32_t>(category)) != 0;
+}
+
+// ============================================================================
+// Contact Record
+// ============================================================================
+
+// One penetrating contact point, gathered once per fixed step
+struct ContactRecord {
+    uint32_t handle_a = 0;  // Collider or rigid body handle, per category_a; 0 for chunks
+    uint32_t handle_b = 0;
+    uint32_t category_a = 0;  // BodyCategory bits
+    uint32_t category_b = 0;
+    glm::dvec3 point{0.0};   // World position on A
+    glm::dvec3 normal{0.0};  // World normal on B
+    double penetration_depth = 0.0;
+    double impulse = 0.0;          // Normal impulse applied by the solver
+    double normal_velocity = 0.0;  // Relative speed along the normal
+};
+
 }  // namespace realcraft::physics
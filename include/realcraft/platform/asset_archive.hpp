@@ -0,0 +1,189 @@
+// RealCraft Platform Abstraction Layer
+// asset_archive.hpp - Packed, memory-mapped asset archive
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace realcraft::platform {
+
+namespace fs = std::filesystem;
+
+// ============================================================================
+// Archive Format
+// ============================================================================
+//
+// [AssetArchiveHeader][entry data, 16-byte aligned...][AssetTocEntry * N][path strings]
+//
+// The TOC is sorted by (path_hash, path) so lookups are a binary search. All
+// fields are little-endian. Paths are relative, use '/' separators, and are
+// matched exactly (e.g. "shaders/glsl/basic.vert").
+
+inline constexpr uint32_t ASSET_ARCHIVE_MAGIC = 0x4B504352;  // "RCPK" - RealCraft Pack
+inline constexpr uint32_t ASSET_ARCHIVE_VERSION = 1;
+inline constexpr uint64_t ASSET_ARCHIVE_ALIGNMENT = 16;
+
+enum class AssetCompression : uint32_t {
+    None = 0,  // Served zero-copy from the mapping
+    Zstd = 1,  // Decompressed on every read
+};
+
+#pragma pack(push, 1)
+struct AssetArchiveHeader {
+    uint32_t magic = ASSET_ARCHIVE_MAGIC;
+    uint32_t version = ASSET_ARCHIVE_VERSION;
+    uint32_t entry_count = 0;
+    uint32_t reserved = 0;
+    uint64_t toc_offset = 0;
+    uint64_t strings_offset = 0;
+};
+
+struct AssetTocEntry {
+    uint64_t path_hash = 0;    // asset_path_hash(path)
+    uint64_t offset = 0;       // Start of the stored bytes
+    uint64_t stored_size = 0;  // Bytes in the archive
+    uint64_t size = 0;         // Bytes after decompression
+    uint32_t compression = 0;  // AssetCompression
+    uint32_t path_offset = 0;  // Relative to strings_offset
+    uint32_t path_length = 0;
+    uint32_t reserved = 0;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(AssetArchiveHeader) == 32, "AssetArchiveHeader must be 32 bytes");
+static_assert(sizeof(AssetTocEntry) == 48, "AssetTocEntry must be 48 bytes");
+
+// 64-bit FNV-1a of the path as stored in the archive
+[[nodiscard]] uint64_t asset_path_hash(std::string_view path);
+
+// ============================================================================
+// Asset Archive (reader)
+// ============================================================================
+
+struct AssetEntryInfo {
+    std::string_view path;  // Points into the mapping
+    uint64_t size = 0;
+    uint64_t stored_size = 0;
+    AssetCompression compression = AssetCompression::None;
+};
+
+// Read-only view of a packed archive. The file is mapped once on open(); all
+// lookups are served from memory without further syscalls. Safe to read from
+// multiple threads once opened.
+class AssetArchive {
+public:
+    AssetArchive();
+    ~AssetArchive();
+
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+    AssetArchive(AssetArchive&&) noexcept;
+    AssetArchive& operator=(AssetArchive&&) noexcept;
+
+    // Map and validate the archive; returns false if it is missing or corrupt
+    bool open(const fs::path& path);
+    void close();
+    [[nodiscard]] bool is_open() const;
+    [[nodiscard]] const fs::path& path() const;
+
+    [[nodiscard]] size_t entry_count() const;
+    [[nodiscard]] bool contains(std::string_view path) const;
+    [[nodiscard]] std::optional<AssetEntryInfo> find(std::string_view path) const;
+
+    // Bytes of an uncompressed entry, valid until close(). Returns nullopt for
+    // missing or compressed entries.
+    [[nodiscard]] std::optional<std::span<const uint8_t>> view(std::string_view path) const;
+
+    // Copy of the entry, decompressed if needed
+    [[nodiscard]] std::optional<std::vector<uint8_t>> read(std::string_view path) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+// ============================================================================
+// Asset Archive Writer (packer)
+// ============================================================================
+
+struct AssetArchiveWriterConfig {
+    int compression_level = 19;        // zstd level; packing is offline
+    size_t min_compress_size = 256;    // Smaller entries are stored as-is
+    double min_compression_gain = 0.1; // Keep compressed only if >= 10% smaller
+};
+
+class AssetArchiveWriter {
+public:
+    explicit AssetArchiveWriter(const AssetArchiveWriterConfig& config = {});
+    ~AssetArchiveWriter();
+
+    AssetArchiveWriter(const AssetArchiveWriter&) = delete;
+    AssetArchiveWriter& operator=(const AssetArchiveWriter&) = delete;
+
+    // Add (or replace) an entry. With allow_compression = false the entry is
+    // always stored raw so it can be viewed zero-copy.
+    void add(std::string path, std::vector<uint8_t> data, bool allow_compression = true);
+
+    // Add every file under `root` as "<prefix>/<relative path>"; returns the count
+    size_t add_directory(const fs::path& root, std::string_view prefix);
+
+    [[nodiscard]] size_t entry_count() const;
+
+    bool write(const fs::path& output) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+// ============================================================================
+// Asset Store
+// ============================================================================
+
+struct AssetStoreConfig {
+    fs::path archive_path;  // Packed archive; may be empty or missing
+    fs::path loose_root;    // Directory that archive paths are relative to
+
+#if defined(NDEBUG)
+    bool allow_loose_files = false;
+#else
+    bool allow_loose_files = true;  // Development builds read edited files directly
+#endif
+};
+
+// Resolves asset paths against the mounted archive first, then (if enabled)
+// loose files under loose_root.
+class AssetStore {
+public:
+    AssetStore();
+    ~AssetStore();
+
+    AssetStore(const AssetStore&) = delete;
+    AssetStore& operator=(const AssetStore&) = delete;
+
+    // Returns false if neither an archive nor loose files are available
+    bool initialize(const AssetStoreConfig& config);
+    void shutdown();
+
+    [[nodiscard]] bool has_archive() const;
+    [[nodiscard]] bool exists(std::string_view path) const;
+
+    [[nodiscard]] std::optional<std::vector<uint8_t>> read_binary(std::string_view path) const;
+    [[nodiscard]] std::optional<std::string> read_text(std::string_view path) const;
+
+    // Zero-copy bytes when the asset is stored uncompressed in the archive
+    [[nodiscard]] std::optional<std::span<const uint8_t>> view(std::string_view path) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace realcraft::platform
@@ -8,6 +8,7 @@
 #include <future>
 #include <memory>
 #include <optional>
+#include <realcraft/platform/io_executor.hpp>
 #include <span>
 #include <string>
 #include <string_view>
@@ -38,14 +39,23 @@ public:
     static bool write_binary(const fs::path& path, std::span<const uint8_t> data);
     static bool write_text(const fs::path& path, std::string_view content);
 
-    // Asynchronous file operations (returns std::future)
+    // Asynchronous file operations, run on IoExecutor::shared(). Requests
+    // cancelled before they start complete with std::nullopt without
+    // touching the disk.
     using BinaryResult = std::optional<std::vector<uint8_t>>;
     using TextResult = std::optional<std::string>;
     using BinaryCallback = std::function<void(BinaryResult)>;
     using TextCallback = std::function<void(TextResult)>;
+    using BatchCallback = std::function<void(const fs::path&, BinaryResult)>;
 
-    static std::future<BinaryResult> read_binary_async(const fs::path& path);
-    static std::future<TextResult> read_text_async(const fs::path& path);
+    static std::future<BinaryResult> read_binary_async(const fs::path& path, const IoRequestOptions& options = {});
+    static std::future<TextResult> read_text_async(const fs::path& path, const IoRequestOptions& options = {});
+    static void read_binary_async(const fs::path& path, BinaryCallback callback, const IoRequestOptions& options = {});
+    static void read_text_async(const fs::path& path, TextCallback callback, const IoRequestOptions& options = {});
+
+    // Queue many reads at once; the callback runs once per path
+    static void read_binary_batch_async(std::vector<fs::path> paths, BatchCallback callback,
+                                        const IoRequestOptions& options = {});
 
     // Directory operations
     static bool create_directories(const fs::path& path);
@@ -66,14 +76,37 @@ private:
     FileSystem() = delete;  // Static class, no instances
 };
 
+// Shared, immutable view of a cached resource. Holding a handle keeps the
+// bytes alive even if the cache evicts or replaces the entry.
+class ResourceHandle {
+public:
+    ResourceHandle() = default;
+    explicit ResourceHandle(std::shared_ptr<const std::vector<uint8_t>> data) : data_(std::move(data)) {}
+
+    [[nodiscard]] bool has_value() const { return data_ != nullptr; }
+    explicit operator bool() const { return has_value(); }
+
+    [[nodiscard]] const std::vector<uint8_t>& operator*() const { return *data_; }
+    [[nodiscard]] const std::vector<uint8_t>* operator->() const { return data_.get(); }
+
+    [[nodiscard]] std::span<const uint8_t> span() const {
+        return data_ ? std::span<const uint8_t>(*data_) : std::span<const uint8_t>();
+    }
+    [[nodiscard]] size_t size() const { return data_ ? data_->size() : 0; }
+
+private:
+    std::shared_ptr<const std::vector<uint8_t>> data_;
+};
+
 // Resource cache for commonly accessed files
+//
+// Keys are hash-partitioned across independently locked shards, each with
+// its own LRU list. Eviction removes the least recently used entry across
+// all shards in O(shards), independent of the entry count.
 class ResourceCache {
 public:
-    struct CacheEntry {
-        std::vector<uint8_t> data;
-        fs::file_time_type modified_time;
-        size_t access_count = 0;
-    };
+    // Produces the bytes for a missing key; nullopt means "not available"
+    using Loader = std::function<std::optional<std::vector<uint8_t>>()>;
 
     ResourceCache();
     ~ResourceCache();
@@ -89,19 +122,22 @@ public:
     [[nodiscard]] size_t get_max_size() const;
 
     // Cache operations
-    [[nodiscard]] std::optional<std::span<const uint8_t>> get(const std::string& key) const;
+    [[nodiscard]] ResourceHandle get(const std::string& key) const;
     void put(const std::string& key, std::span<const uint8_t> data);
     void put(const std::string& key, std::vector<uint8_t>&& data);
     void invalidate(const std::string& key);
     void clear();
 
+    // Return the cached entry, or run `loader` and cache its result.
+    // Concurrent misses on the same key share a single loader call.
+    ResourceHandle get_or_load(const std::string& key, const Loader& loader);
+
     // Stats
     [[nodiscard]] size_t current_size() const;
     [[nodiscard]] size_t entry_count() const;
 
     // Load with automatic caching
-    std::optional<std::span<const uint8_t>> load_cached(const std::string& key, const fs::path& source_path,
-                                                        bool check_modified = true);
+    ResourceHandle load_cached(const std::string& key, const fs::path& source_path, bool check_modified = true);
 
 private:
     struct Impl;
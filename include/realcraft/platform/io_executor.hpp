@@ -0,0 +1,120 @@
+// RealCraft Platform Abstraction Layer
+// io_executor.hpp - Bounded, prioritized thread pool for blocking I/O
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace realcraft::platform {
+
+// Scheduling class of an I/O request. Workers always take the oldest request
+// of the highest non-empty priority.
+enum class IoPriority : uint8_t {
+    High,    // Needed this frame (player surroundings, teleport target)
+    Normal,  // Regular streaming and asset loads
+    Low,     // Prefetch and background work
+};
+
+// Shared cancellation flag; copies observe the same state. A default
+// constructed token can never be cancelled, use create() for one that can.
+class CancellationToken {
+public:
+    CancellationToken() = default;
+
+    [[nodiscard]] static CancellationToken create() {
+        CancellationToken token;
+        token.cancelled_ = std::make_shared<std::atomic<bool>>(false);
+        return token;
+    }
+
+    void cancel() const {
+        if (cancelled_) {
+            cancelled_->store(true, std::memory_order_release);
+        }
+    }
+
+    [[nodiscard]] bool is_cancelled() const {
+        return cancelled_ && cancelled_->load(std::memory_order_acquire);
+    }
+
+private:
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+// Callbacks posted from any thread and run by whichever thread drains the
+// queue (typically the main thread once per frame).
+class CompletionQueue {
+public:
+    CompletionQueue();
+    ~CompletionQueue();
+
+    CompletionQueue(const CompletionQueue&) = delete;
+    CompletionQueue& operator=(const CompletionQueue&) = delete;
+
+    void post(std::function<void()> callback);
+
+    // Run every callback queued so far on the calling thread; returns how many ran
+    size_t drain();
+
+    [[nodiscard]] size_t pending() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+// Per-request options for I/O submitted through FileSystem
+struct IoRequestOptions {
+    IoPriority priority = IoPriority::Normal;
+    CancellationToken token;
+
+    // Deliver the completion callback here instead of on the I/O thread
+    CompletionQueue* completion_queue = nullptr;
+};
+
+struct IoExecutorConfig {
+    // Worker count; 0 picks min(4, hardware threads)
+    size_t thread_count = 0;
+};
+
+// Fixed-size pool for blocking file I/O. Requests beyond the worker count
+// wait in a priority queue instead of spawning more threads.
+class IoExecutor {
+public:
+    using Task = std::function<void()>;
+
+    explicit IoExecutor(const IoExecutorConfig& config = {});
+
+    // Finishes the queued requests, then joins the workers
+    ~IoExecutor();
+
+    IoExecutor(const IoExecutor&) = delete;
+    IoExecutor& operator=(const IoExecutor&) = delete;
+
+    // Process-wide executor used by FileSystem's async reads
+    static IoExecutor& shared();
+
+    // Tasks whose token is cancelled before a worker picks them up are dropped
+    void submit(Task task, IoPriority priority = IoPriority::Normal, const CancellationToken& token = {});
+
+    // Enqueue several tasks under a single lock
+    void submit_batch(std::vector<Task> tasks, IoPriority priority = IoPriority::Normal,
+                      const CancellationToken& token = {});
+
+    // Block until every submitted task has run or been dropped
+    void wait_idle();
+
+    [[nodiscard]] size_t thread_count() const;
+    [[nodiscard]] size_t queued_count() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace realcraft::platform
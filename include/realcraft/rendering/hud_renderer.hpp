@@ -103,6 +103,11 @@ struct HUDData {
     uint32_t chunks_culled = 0;
     uint32_t triangles = 0;
     uint32_t draw_calls = 0;
+    uint32_t chunks_loaded = 0;
+    uint32_t chunks_dirty = 0;
+    uint32_t chunks_pending = 0;     // Being generated
+    double chunk_gen_p99_ms = 0.0;   // From the metrics registry
+    double mesh_build_p99_ms = 0.0;  // From the metrics registry
     float time_of_day = 0.0f;   // 0.0 = midnight, 0.5 = noon, 1.0 = midnight
     uint64_t total_memory = 0;  // Bytes
     uint64_t used_memory = 0;   // Bytes
@@ -10,6 +10,7 @@
 #include <memory>
 #include <realcraft/world/block.hpp>
 #include <realcraft/world/chunk.hpp>
+#include <span>
 
 namespace realcraft::rendering {
 
@@ -18,6 +19,11 @@ struct MeshGeneratorConfig {
     bool enable_greedy_meshing = true;
     bool enable_ambient_occlusion = true;
     uint8_t ao_strength = 64;  // How dark AO gets (0-255)
+
+    // Atlas texture per face, indexed by block_id * 6 + face (see
+    // TextureManager::get_face_texture_table). Must outlive the generator;
+    // when empty, BlockType texture indices are used.
+    std::span<const uint16_t> face_texture_table;
 };
 
 // Generates chunk meshes from voxel data
@@ -7,6 +7,7 @@
 #include "mesh_generator.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -111,6 +112,7 @@ private:
     struct MeshRequest {
         world::ChunkPos pos;
         MeshPriority priority;
+        std::chrono::steady_clock::time_point requested_at;  // For request-to-visible latency
     };
     struct RequestCompare {
         bool operator()(const MeshRequest& a, const MeshRequest& b) const {
@@ -126,6 +128,7 @@ private:
         world::ChunkPos pos;
         ChunkMeshData data;
         ChunkMeshStats stats;
+        std::chrono::steady_clock::time_point requested_at;
     };
     std::queue<CompletedMesh> completed_queue_;
     std::mutex completed_mutex_;
@@ -6,6 +6,7 @@
 #include <glm/glm.hpp>
 
 #include <cstdint>
+#include <filesystem>
 #include <memory>
 #include <optional>
 #include <realcraft/graphics/device.hpp>
@@ -41,6 +42,10 @@ struct TextureAtlasDesc {
     uint32_t tile_size = 16;    // Standard block texture size
     uint32_t padding = 2;       // Padding between tiles
     uint32_t max_layers = 4;    // Max array layers
+
+    // Mip levels are generated while every tile and its padding stay texel
+    // aligned, i.e. 1 + log2 of the largest power of two dividing both
+    // padding and tile_size (2 levels with the defaults)
     bool generate_mipmaps = true;
     std::string debug_name = "BlockAtlas";
 };
@@ -71,11 +76,32 @@ public:
     // Atlas Building
     // ========================================================================
 
-    // Build the atlas texture (must call after adding all textures)
+    // Build the atlas texture (must call after adding all textures). Bakes
+    // first unless bake() or load_baked() already produced the pixel data.
     bool build();
 
+    // CPU half of build(): pack the tiles, compose the layers and filter the
+    // mip chain, in parallel. Needs no graphics device.
+    bool bake();
+
     // Check if atlas is built
     [[nodiscard]] bool is_built() const { return is_built_; }
+    [[nodiscard]] bool is_baked() const { return !baked_levels_.empty(); }
+
+    // ========================================================================
+    // Baked Cache
+    // ========================================================================
+
+    // Write the baked pixel data and lookup tables to one file, tagged with a
+    // caller-defined key describing the inputs
+    bool save_baked(const std::filesystem::path& path, uint64_t key) const;
+
+    // Load a file written by save_baked() with the same key and settings,
+    // replacing any staged textures; build() then only uploads
+    bool load_baked(const std::filesystem::path& path, uint64_t key);
+
+    // Pixel data of one baked mip level (all layers, consecutive); empty once built
+    [[nodiscard]] std::span<const uint8_t> get_baked_level(uint32_t level) const;
 
     // ========================================================================
     // Lookup
@@ -103,6 +129,7 @@ public:
     [[nodiscard]] uint32_t get_atlas_size() const { return desc_.atlas_size; }
     [[nodiscard]] uint32_t get_tile_size() const { return desc_.tile_size; }
     [[nodiscard]] uint32_t get_layer_count() const { return current_layer_ + 1; }
+    [[nodiscard]] uint32_t get_mip_levels() const { return mip_levels_; }
     [[nodiscard]] size_t get_texture_count() const { return entries_.size(); }
 
 private:
@@ -118,6 +145,10 @@ private:
     };
     std::vector<StagedTexture> staged_textures_;
 
+    // Baked atlas data, one buffer per mip level
+    std::vector<std::vector<uint8_t>> baked_levels_;
+    uint32_t mip_levels_ = 1;
+
     // Built atlas data
     std::vector<TextureAtlasEntry> entries_;
     std::unordered_map<std::string, uint16_t> name_to_index_;
@@ -130,8 +161,13 @@ private:
     uint32_t current_y_ = 0;
     uint32_t row_height_ = 0;
 
-    // Pack a texture into the atlas
-    bool pack_texture(const StagedTexture& tex, TextureAtlasEntry& out_entry);
+    // Pack a texture into the atlas; out_x/out_y receive the texel origin
+    bool pack_texture(const StagedTexture& tex, TextureAtlasEntry& out_entry, uint32_t& out_x, uint32_t& out_y);
+
+    [[nodiscard]] uint32_t compute_mip_levels() const;
+
+    // Create the GPU texture and sampler from the baked levels
+    bool upload();
 };
 
 }  // namespace realcraft::rendering
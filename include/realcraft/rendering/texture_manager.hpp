@@ -6,9 +6,14 @@
 #include "texture_atlas.hpp"
 
 #include <cstdint>
+#include <filesystem>
+#include <functional>
 #include <memory>
 #include <realcraft/graphics/device.hpp>
 #include <realcraft/world/block.hpp>
+#include <span>
+#include <string>
+#include <vector>
 
 namespace realcraft::rendering {
 
@@ -17,8 +22,14 @@ struct TextureManagerConfig {
     uint32_t atlas_size = 512;
     uint32_t tile_size = 16;
     bool generate_procedural = true;  // Generate placeholder textures
+
+    // Directory for the baked atlas; empty disables caching
+    std::filesystem::path cache_directory;
 };
 
+// Bump whenever procedural texture output changes, so baked atlases are rebuilt
+inline constexpr uint32_t PROCEDURAL_TEXTURE_VERSION = 1;
+
 // Manages block textures
 class TextureManager {
 public:
@@ -52,17 +63,33 @@ public:
     // Get UV rect for a texture index
     [[nodiscard]] glm::vec4 get_texture_uv(uint16_t texture_index) const;
 
+    // Flat per-face tables, indexed by block_id * 6 + face. Stable until shutdown.
+    [[nodiscard]] std::span<const uint16_t> get_face_texture_table() const { return face_texture_table_; }
+    [[nodiscard]] std::span<const glm::vec4> get_face_uv_table() const { return face_uv_table_; }
+
 private:
     graphics::GraphicsDevice* device_ = nullptr;
     TextureManagerConfig config_;
 
     std::unique_ptr<TextureAtlas> block_atlas_;
+    std::vector<uint16_t> face_texture_table_;
+    std::vector<glm::vec4> face_uv_table_;
+
+    struct TextureJob {
+        std::string name;
+        std::function<std::vector<uint8_t>()> generate;
+    };
 
     // Generate procedural textures for all registered blocks
     void generate_block_textures();
 
-    // Register a single block's textures
-    void register_block_textures(const world::BlockType& block_type);
+    // Queue a single block's textures
+    void collect_block_textures(const world::BlockType& block_type, std::vector<TextureJob>& jobs) const;
+
+    // Hash of everything that determines the baked atlas contents
+    [[nodiscard]] uint64_t compute_cache_key(const TextureAtlasDesc& atlas_desc) const;
+
+    void build_face_tables();
 };
 
 }  // namespace realcraft::rendering
@@ -246,11 +246,15 @@ public:
     void set_broken_callback(BlockBrokenCallback callback);
     void set_tick_callback(BlockId id, BlockTickCallback callback);
 
-    // Invoke callbacks (called internally by world systems)
+    // Invoke callbacks (called internally by world systems). Tick callbacks
+    // run outside the registry lock and may be invoked from several threads.
     void on_block_placed(const WorldBlockPos& pos, BlockId id, BlockStateId state) const;
     void on_block_broken(const WorldBlockPos& pos, BlockId id) const;
     void on_block_tick(const WorldBlockPos& pos, BlockId id, double dt) const;
 
+    // True if a tick callback is registered for the block (lock-free)
+    [[nodiscard]] bool is_tickable(BlockId id) const;
+
     // Common block IDs (set after register_defaults)
     [[nodiscard]] BlockId air_id() const { return BLOCK_AIR; }
     [[nodiscard]] BlockId stone_id() const { return stone_id_; }
@@ -0,0 +1,106 @@
+// RealCraft World System
+// block_change_journal.hpp - Versioned per-chunk log of block changes
+
+#pragma once
+
+#include "chunk_data.hpp"
+#include "types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace realcraft::world {
+
+// ============================================================================
+// Block Change Records
+// ============================================================================
+
+struct BlockChange {
+    uint32_t index = 0;  // local_to_index() of the block
+    PaletteEntry old_entry;
+    PaletteEntry new_entry;
+};
+
+// Result of BlockChangeJournal::changes_since()
+struct ChunkDelta {
+    uint64_t version = 0;              // Version the delta brings the caller up to
+    bool snapshot_required = false;    // Too old (or unknown): re-read the whole chunk
+    std::vector<BlockChange> changes;  // Oldest first, one entry per block
+};
+
+// ============================================================================
+// Block Change Journal
+// ============================================================================
+
+// Bounded ring of recent block changes with a version that grows on every
+// change. Incremental consumers (meshing, physics, lighting, sync) remember
+// the version they last processed and ask for what changed since; once the
+// ring has dropped something they would need, they are told to take a full
+// snapshot instead.
+//
+// Repeated writes to one block coalesce into a single entry that keeps the
+// state from before the first write. A rewrite moves the block's entry to the
+// newest slot; the slot it leaves is reclaimed before anything live is
+// evicted, so busy blocks cannot push others out of the ring. A caller whose version falls between two coalesced writes gets
+// the right new state but an older old state.
+//
+// Versions come from a process-wide counter, so a chunk that is unloaded and
+// reloaded never reissues a version an observer already holds.
+//
+// Not thread-safe; Chunk guards it with its own lock.
+class BlockChangeJournal {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 256;
+
+    explicit BlockChangeJournal(size_t capacity = DEFAULT_CAPACITY);
+
+    [[nodiscard]] uint64_t version() const { return version_; }
+
+    // Oldest version changes_since() can answer with a delta
+    [[nodiscard]] uint64_t oldest_version() const { return floor_; }
+
+    // Record one block change and advance the version
+    void record(uint32_t index, const PaletteEntry& old_entry, const PaletteEntry& new_entry);
+
+    // Forget all entries after a bulk rewrite (generation, fill, load); any
+    // older version now needs a snapshot
+    void invalidate();
+
+    [[nodiscard]] ChunkDelta changes_since(uint64_t since) const;
+
+    // Entries held, counting coalesced-away slots not yet reclaimed
+    [[nodiscard]] size_t size() const { return static_cast<size_t>(tail_ - head_); }
+    [[nodiscard]] size_t capacity() const { return capacity_; }
+
+private:
+    struct Entry {
+        uint32_t index = 0;
+        bool live = false;  // False once a later write to the block took over
+        PaletteEntry old_entry;
+        PaletteEntry new_entry;
+        uint64_t version = 0;
+    };
+
+    [[nodiscard]] Entry& slot(uint64_t seq) { return ring_[static_cast<size_t>(seq % capacity_)]; }
+    [[nodiscard]] const Entry& slot(uint64_t seq) const { return ring_[static_cast<size_t>(seq % capacity_)]; }
+
+    // Free one slot: drop dead entries, compact, or evict the oldest entry
+    void make_room();
+    void compact();
+    void evict_oldest();
+
+    size_t capacity_;
+    uint64_t version_;
+    uint64_t floor_;
+
+    // Allocated on the first change; most chunks are never edited
+    std::vector<Entry> ring_;
+    uint64_t head_ = 0;                            // Sequence number of the oldest entry
+    uint64_t tail_ = 0;                            // Sequence number the next entry gets
+    size_t dead_ = 0;                              // Entries between head_ and tail_ that are not live
+    std::unordered_map<uint32_t, uint64_t> live_;  // Block index -> sequence number of its entry
+};
+
+}  // namespace realcraft::world
@@ -0,0 +1,122 @@
+// RealCraft World System
+// block_tick_scheduler.hpp - Scheduled and random block ticks
+
+#pragma once
+
+#include "types.hpp"
+#include "world_manager.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace realcraft::world {
+
+// ============================================================================
+// Block Tick Configuration
+// ============================================================================
+
+struct BlockTickConfig {
+    double tick_rate = 20.0;                // World ticks per second
+    uint32_t random_ticks_per_section = 3;  // Samples per 16^3 section holding tickable blocks
+    uint32_t max_ticks_per_update = 4;      // Catch-up cap after a long frame
+    uint32_t worker_threads = 0;            // 0 = hardware threads - 1, at most 4
+    size_t min_parallel_chunks = 4;         // Fewer active chunks than this tick on the caller only
+    uint64_t seed = 0;                      // Random tick seed (0 = world seed)
+};
+
+// ============================================================================
+// Block Tick Scheduler
+// ============================================================================
+
+// Drives BlockRegistry::on_block_tick for loaded chunks:
+//  - scheduled ticks fire a set number of ticks after schedule_tick(); they
+//    live in a hierarchical timing wheel and are saved in chunk metadata
+//  - random ticks sample a few positions per 16^3 section per tick, but only
+//    in sections that hold tickable blocks (per-section counts kept up to
+//    date from block change events)
+// so a tick costs time in proportion to tickable content, not loaded volume.
+//
+// Chunks tick in parallel. Tick callbacks must not write to the world
+// directly; they call set_block()/schedule_tick() here, which buffer the
+// change and apply it after all chunks have ticked, in chunk order.
+//
+// update()/tick() and the WorldManager calls they trigger belong to the game
+// thread; register tick callbacks before chunks load.
+class BlockTickScheduler : public IWorldObserver {
+public:
+    BlockTickScheduler();
+    ~BlockTickScheduler() override;
+
+    // Non-copyable, non-movable
+    BlockTickScheduler(const BlockTickScheduler&) = delete;
+    BlockTickScheduler& operator=(const BlockTickScheduler&) = delete;
+    BlockTickScheduler(BlockTickScheduler&&) = delete;
+    BlockTickScheduler& operator=(BlockTickScheduler&&) = delete;
+
+    // ========================================================================
+    // Lifecycle
+    // ========================================================================
+
+    // Registers as a world observer and picks up already loaded chunks
+    bool initialize(WorldManager* world_manager, const BlockTickConfig& config = {});
+
+    // Writes pending scheduled ticks back into chunk metadata (marking those
+    // chunks dirty) so a following world save keeps them
+    void shutdown();
+    [[nodiscard]] bool is_initialized() const;
+
+    // Runs as many ticks as delta_time covers at the configured rate
+    void update(double delta_time);
+
+    // Runs exactly one tick
+    void tick();
+
+    [[nodiscard]] uint64_t get_current_tick() const;
+
+    // ========================================================================
+    // Block Changes (safe from tick callbacks)
+    // ========================================================================
+
+    // Tick the block at pos after delay_ticks (at least 1). An earlier pending
+    // tick for the same position wins. Ignored for chunks not yet picked up
+    // (loads are picked up at the start of each tick).
+    void schedule_tick(const WorldBlockPos& pos, uint32_t delay_ticks);
+    [[nodiscard]] bool has_scheduled_tick(const WorldBlockPos& pos) const;
+
+    // Deferred inside a tick, immediate otherwise
+    void set_block(const WorldBlockPos& pos, BlockId id, BlockStateId state = 0);
+
+    // ========================================================================
+    // IWorldObserver Implementation
+    // ========================================================================
+
+    void on_chunk_loaded(const ChunkPos& pos, Chunk& chunk) override;
+    void on_chunk_unloading(const ChunkPos& pos, const Chunk& chunk) override;
+    void on_chunk_saving(const ChunkPos& pos, Chunk& chunk) override;
+    void on_block_changed(const BlockChangeEvent& event) override;
+
+    // ========================================================================
+    // Statistics
+    // ========================================================================
+
+    struct Stats {
+        uint64_t current_tick = 0;
+        size_t tracked_chunks = 0;
+        size_t tickable_sections = 0;  // Sections sampled by random ticks
+        size_t pending_scheduled = 0;
+        size_t last_random_ticks = 0;     // Callbacks from random sampling
+        size_t last_scheduled_ticks = 0;  // Callbacks from the timing wheel
+        size_t last_deferred_writes = 0;
+        double last_tick_ms = 0.0;
+    };
+
+    [[nodiscard]] Stats get_stats() const;
+    [[nodiscard]] const BlockTickConfig& get_config() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace realcraft::world
@@ -17,6 +17,7 @@ namespace realcraft::world {
 struct CaveConfig {
     // World seed for deterministic generation
     uint32_t seed = 0;
+    NoiseSimdLevel noise_simd = NoiseSimdLevel::Auto;
 
     // Master enable/disable
     bool enabled = true;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "block_change_journal.hpp"
 #include "chunk_data.hpp"
 #include "types.hpp"
 
@@ -25,6 +26,12 @@ class Chunk;
 // Chunk Metadata
 // ============================================================================
 
+// A pending scheduled block tick, saved with its chunk
+struct ScheduledBlockTick {
+    uint32_t index = 0;  // local_to_index() of the block
+    uint32_t delay = 0;  // Ticks left when the chunk was saved
+};
+
 struct ChunkMetadata {
     uint8_t biome_id = 0;                   // Primary biome
     uint32_t generation_seed = 0;           // Seed used for generation
@@ -32,6 +39,9 @@ struct ChunkMetadata {
     uint32_t tick_count = 0;                // Total ticks processed
     bool has_been_generated = false;        // True if procedurally generated
     bool has_player_modifications = false;  // True if player changed blocks
+
+    // Filled by BlockTickScheduler before the chunk is saved
+    std::vector<ScheduledBlockTick> scheduled_ticks;
 };
 
 // ============================================================================
@@ -90,6 +100,38 @@ public:
     void set_block(const LocalBlockPos& pos, BlockId id, BlockStateId state = 0);
     void set_entry(const LocalBlockPos& pos, const PaletteEntry& entry);
 
+    // ========================================================================
+    // Bulk Reads (one read lock, bulk palette decode)
+    // ========================================================================
+
+    // Inclusive box, x fastest, then z, then y (local_to_index() order):
+    //   out[((y - min.y) * depth + (z - min.z)) * width + (x - min.x)]
+    // Each returns false without writing if the request leaves the chunk or
+    // out is smaller than the documented size.
+    bool read_region(const LocalBlockPos& min, const LocalBlockPos& max, std::span<BlockId> out) const;
+    bool read_region(const LocalBlockPos& min, const LocalBlockPos& max, std::span<PaletteEntry> out) const;
+
+    // CHUNK_SIZE_Y blocks, bottom up
+    bool read_column(int32_t x, int32_t z, std::span<BlockId> out) const;
+
+    // One layer: CHUNK_SIZE_X * CHUNK_SIZE_Z blocks, x fastest
+    bool read_slab(int32_t y, std::span<BlockId> out) const;
+
+    // One storage section (STORAGE_SECTION_HEIGHT layers): STORAGE_SECTION_VOLUME blocks
+    bool read_section(int32_t section, std::span<BlockId> out) const;
+
+    // ========================================================================
+    // Change Tracking
+    // ========================================================================
+
+    // Grows on every block change (lock-free)
+    [[nodiscard]] uint64_t get_version() const;
+
+    // Per-block changes since a version returned by get_version() or a
+    // previous delta. Single-block writes are journaled; bulk writes through
+    // WriteLock and deserialize() ask older callers for a snapshot.
+    [[nodiscard]] ChunkDelta changes_since(uint64_t version) const;
+
     // ========================================================================
     // Batch Operations (for performance, hold lock for duration)
     // ========================================================================
@@ -121,8 +163,9 @@ public:
     // Serialization
     // ========================================================================
 
+    // Always writes the latest voxel format; reads any VOXEL_FORMAT_* version
     [[nodiscard]] std::vector<uint8_t> serialize() const;
-    bool deserialize(std::span<const uint8_t> data);
+    bool deserialize(std::span<const uint8_t> data, uint32_t format_version = VOXEL_FORMAT_TICKS);
 
     // ========================================================================
     // Statistics
@@ -143,12 +186,34 @@ private:
 
     void set_state(ChunkState state);
 
+    // Journal a single-block write (unique lock held)
+    void record_change(size_t index, const PaletteEntry& old_entry, const PaletteEntry& new_entry);
+
+    // Bulk rewrite: drop the journal (unique lock held)
+    void invalidate_journal();
+
+    // Set the dirty flag, keeping the owner's dirty chunk count in step
+    void set_dirty_flag(bool dirty);
+
+    // Owner's running count of dirty chunks (nullptr when not owned).
+    // Detaching takes back this chunk's contribution.
+    void attach_dirty_counter(std::atomic<size_t>* counter);
+    void detach_dirty_counter();
+
     ChunkPos position_;
     std::atomic<ChunkState> state_{ChunkState::Unloaded};
+
+    // Flag transitions and (de)attachment happen under dirty_mutex_, so the
+    // counter always holds exactly one count per attached dirty chunk.
+    // is_dirty() reads the flag without the lock.
     std::atomic<bool> dirty_{false};
+    std::atomic<size_t>* dirty_counter_ = nullptr;
+    std::mutex dirty_mutex_;
 
     VoxelStorage storage_;
     ChunkMetadata metadata_;
+    BlockChangeJournal journal_;
+    std::atomic<uint64_t> version_;
 
     std::array<Chunk*, 4> neighbors_{};  // NegX, PosX, NegZ, PosZ (horizontal only)
 
@@ -212,12 +277,13 @@ public:
     void fill(const PaletteEntry& entry);
     void fill_region(const LocalBlockPos& min, const LocalBlockPos& max, const PaletteEntry& entry);
 
-    // Direct storage access
+    // Direct storage access (counts as a bulk write)
     [[nodiscard]] VoxelStorage& storage();
 
 private:
     Chunk* chunk_;
     std::unique_lock<std::shared_mutex> lock_;
+    bool modified_ = false;  // Invalidates the chunk journal on release
 };
 
 }  // namespace realcraft::world
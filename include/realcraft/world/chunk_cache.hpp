@@ -0,0 +1,55 @@
+// RealCraft World System
+// chunk_cache.hpp - Compressed in-memory tier for recently unloaded chunks
+
+#pragma once
+
+#include "types.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace realcraft::world {
+
+// ============================================================================
+// Compressed Chunk Cache
+// ============================================================================
+
+// Holds serialized (compressed) chunk blobs for chunks that left the decoded
+// set, so revisiting them skips disk I/O and regeneration. Evicts least
+// recently stored entries once `capacity` is exceeded; callers persist chunks
+// before caching them, so eviction simply drops the blob. Thread-safe.
+class CompressedChunkCache {
+public:
+    explicit CompressedChunkCache(size_t capacity = 256);
+    ~CompressedChunkCache();
+
+    // Non-copyable
+    CompressedChunkCache(const CompressedChunkCache&) = delete;
+    CompressedChunkCache& operator=(const CompressedChunkCache&) = delete;
+
+    // Store a blob, replacing any existing entry for the chunk
+    void put(const ChunkPos& pos, std::vector<uint8_t> blob);
+
+    // Remove and return a chunk's blob (nullopt if not cached)
+    [[nodiscard]] std::optional<std::vector<uint8_t>> take(const ChunkPos& pos);
+
+    [[nodiscard]] bool contains(const ChunkPos& pos) const;
+    void erase(const ChunkPos& pos);
+    void clear();
+
+    // Capacity in chunks (0 disables the cache)
+    void set_capacity(size_t capacity);
+    [[nodiscard]] size_t get_capacity() const;
+
+    // Statistics
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] size_t memory_usage() const;  // Blob bytes held
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace realcraft::world
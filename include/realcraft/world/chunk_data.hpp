@@ -32,6 +32,22 @@ struct PaletteEntry {
     static PaletteEntry from_block(BlockId id) { return {id, 0}; }
 };
 
+// ============================================================================
+// Voxel Payload Formats
+// ============================================================================
+
+// Encodings produced by VoxelStorage; ChunkFileHeader::version records which
+// one a saved chunk uses.
+inline constexpr uint32_t VOXEL_FORMAT_RLE = 1;        // (count, value) runs over the whole chunk
+inline constexpr uint32_t VOXEL_FORMAT_SECTIONED = 2;  // Per-section local palettes + packed indices
+inline constexpr uint32_t VOXEL_FORMAT_TICKS = 3;      // Scheduled block ticks, then the sectioned payload
+
+// Sections used by the sectioned format: full-width horizontal slabs, so each
+// one is a contiguous range of the y-major index array
+inline constexpr int32_t STORAGE_SECTION_HEIGHT = SUBCHUNK_SIZE;
+inline constexpr int32_t STORAGE_SECTION_COUNT = CHUNK_SIZE_Y / STORAGE_SECTION_HEIGHT;
+inline constexpr int32_t STORAGE_SECTION_VOLUME = CHUNK_SIZE_X * STORAGE_SECTION_HEIGHT * CHUNK_SIZE_Z;
+
 // ============================================================================
 // Voxel Storage (palette-based with RLE compression for serialization)
 // ============================================================================
@@ -61,6 +77,31 @@ public:
     [[nodiscard]] BlockStateId get_state(const LocalBlockPos& pos) const;
     void set_block(const LocalBlockPos& pos, BlockId id, BlockStateId state = 0);
 
+    // ========================================================================
+    // Bulk Access
+    // ========================================================================
+
+    // Decode out.size() consecutive voxels from first_index on, in
+    // local_to_index() order; voxels past the chunk read as air. Palettes of
+    // up to 16 entries decode 16 voxels per step with a byte shuffle when the
+    // CPU has one (SSSE3, detected at runtime, or NEON).
+    void decode_blocks(size_t first_index, std::span<BlockId> out) const;
+    void decode_entries(size_t first_index, std::span<PaletteEntry> out) const;
+
+    // Whether the shuffle decode runs on this CPU, and a switch to force the
+    // scalar path (process-wide; for tests and benchmarks)
+    [[nodiscard]] static bool shuffle_decode_supported();
+    static void set_shuffle_decode_enabled(bool enabled);
+
+    // Decode the inclusive box [min, max] into out, x fastest, then z, then y.
+    // row_pitch and slice_pitch are the distances in out between consecutive
+    // z rows and y layers (0 = tightly packed). Returns false without writing
+    // if the box leaves the chunk or out is too small for the layout.
+    bool read_region(const LocalBlockPos& min, const LocalBlockPos& max, std::span<BlockId> out,
+                     size_t row_pitch = 0, size_t slice_pitch = 0) const;
+    bool read_region(const LocalBlockPos& min, const LocalBlockPos& max, std::span<PaletteEntry> out,
+                     size_t row_pitch = 0, size_t slice_pitch = 0) const;
+
     // ========================================================================
     // Fill Operations
     // ========================================================================
@@ -95,6 +136,12 @@ public:
     // Deserialize from RLE-compressed format
     bool deserialize_rle(std::span<const uint8_t> data);
 
+    // Serialize to sectioned format: uniform sections collapse to a single
+    // palette reference, others store a local palette and bit-packed indices
+    // (1/2/4/8 bits, or raw 16-bit global indices that decode with a memcpy)
+    [[nodiscard]] std::vector<uint8_t> serialize_sections() const;
+    bool deserialize_sections(std::span<const uint8_t> data);
+
     // Raw palette + indices (for debugging/testing)
     [[nodiscard]] std::vector<uint8_t> serialize_raw() const;
     bool deserialize_raw(std::span<const uint8_t> data);
@@ -17,6 +17,7 @@ namespace realcraft::world {
 
 struct ClimateConfig {
     uint32_t seed = 0;
+    NoiseSimdLevel noise_simd = NoiseSimdLevel::Auto;
 
     // Temperature noise (large scale, varies by latitude simulation)
     struct TemperatureNoise {
@@ -18,12 +18,14 @@ namespace realcraft::world {
 // Binary Format Version
 // ============================================================================
 
-inline constexpr uint32_t CHUNK_FORMAT_VERSION = 1;
+inline constexpr uint32_t CHUNK_FORMAT_VERSION = VOXEL_FORMAT_TICKS;
 inline constexpr uint32_t REGION_FORMAT_VERSION = 1;
+inline constexpr uint32_t JOURNAL_FORMAT_VERSION = 1;
 
 // Magic bytes for file identification
 inline constexpr uint32_t CHUNK_MAGIC = 0x52435643;   // "RCVC" - RealCraft Voxel Chunk
 inline constexpr uint32_t REGION_MAGIC = 0x52435652;  // "RCVR" - RealCraft Voxel Region
+inline constexpr uint32_t JOURNAL_MAGIC = 0x5243564A;  // "RCVJ" - RealCraft Voxel Journal
 
 // ============================================================================
 // Chunk Header (binary layout)
@@ -38,7 +40,8 @@ struct ChunkFileHeader {
     uint32_t compressed_size = 0;    // Size after compression
     uint32_t uncompressed_size = 0;  // Original data size
     uint8_t compression_type = 1;    // 0=none, 1=zstd
-    uint8_t reserved[7] = {};
+    uint32_t dictionary_id = 0;      // zstd dictionary used (0 = none)
+    uint8_t reserved[3] = {};
 };
 static_assert(sizeof(ChunkFileHeader) == 32, "ChunkFileHeader must be 32 bytes");
 
@@ -57,8 +60,31 @@ struct RegionChunkEntry {
     uint32_t size = 0;    // Compressed size (0 = not present)
 };
 static_assert(sizeof(RegionChunkEntry) == 8, "RegionChunkEntry must be 8 bytes");
+
+struct JournalFileHeader {
+    uint32_t magic = JOURNAL_MAGIC;
+    uint32_t version = JOURNAL_FORMAT_VERSION;
+    uint8_t reserved[8] = {};
+};
+static_assert(sizeof(JournalFileHeader) == 16, "JournalFileHeader must be 16 bytes");
+
+struct JournalRecordHeader {
+    uint32_t type = 0;      // JournalRecordType
+    uint32_t batch = 0;     // Commit batch this record belongs to
+    int32_t chunk_x = 0;    // Commit records: number of records in the batch
+    int32_t chunk_z = 0;
+    uint32_t size = 0;      // Payload bytes following the header
+    uint32_t checksum = 0;  // CRC32 of this header (checksum = 0) and payload
+};
+static_assert(sizeof(JournalRecordHeader) == 24, "JournalRecordHeader must be 24 bytes");
 #pragma pack(pop)
 
+enum class JournalRecordType : uint32_t {
+    ChunkWrite = 1,
+    ChunkDelete = 2,
+    Commit = 3,
+};
+
 // ============================================================================
 // Compression Type
 // ============================================================================
@@ -69,10 +95,69 @@ enum class CompressionType : uint8_t {
     // Legacy: Zlib = 2 (for backwards compatibility if needed)
 };
 
+// Default zstd levels (1-22). Auto-saves favour speed, final saves ratio.
+inline constexpr int DEFAULT_COMPRESSION_LEVEL = 3;
+inline constexpr int DEFAULT_FINAL_SAVE_COMPRESSION_LEVEL = 9;
+
+// ============================================================================
+// Compression Dictionary
+// ============================================================================
+
+// A zstd dictionary trained on raw chunk payloads. Chunk payloads are small
+// and highly similar, so a shared dictionary markedly improves their ratio.
+// Dictionaries live in <world>/dictionaries/<id>.zdict and are referenced by
+// ID from ChunkFileHeader::dictionary_id, so retraining never orphans chunks
+// written with an older dictionary.
+class CompressionDictionary {
+public:
+    static constexpr size_t DEFAULT_MAX_SIZE = 64 * 1024;
+
+    ~CompressionDictionary();
+
+    // Non-copyable
+    CompressionDictionary(const CompressionDictionary&) = delete;
+    CompressionDictionary& operator=(const CompressionDictionary&) = delete;
+
+    // Wrap existing dictionary bytes (nullptr if not a valid zstd dictionary)
+    [[nodiscard]] static std::shared_ptr<CompressionDictionary> create(std::vector<uint8_t> data);
+
+    // Train from a sample of uncompressed chunk payloads (nullptr on failure)
+    [[nodiscard]] static std::shared_ptr<CompressionDictionary> train(std::span<const std::vector<uint8_t>> samples,
+                                                                      size_t max_size = DEFAULT_MAX_SIZE);
+
+    // File I/O
+    [[nodiscard]] static std::shared_ptr<CompressionDictionary> load(const std::filesystem::path& path);
+    bool save(const std::filesystem::path& path) const;
+
+    [[nodiscard]] uint32_t get_id() const;
+    [[nodiscard]] std::span<const uint8_t> get_data() const;
+
+    // Dictionary storage layout inside a world directory
+    [[nodiscard]] static std::filesystem::path directory(const std::filesystem::path& world_directory);
+    [[nodiscard]] static std::filesystem::path path_for(const std::filesystem::path& world_directory, uint32_t id);
+    [[nodiscard]] static std::filesystem::path active_marker(const std::filesystem::path& world_directory);
+
+    // Point the active marker at a dictionary ID. The marker is replaced
+    // atomically, so readers see either the old or the new ID.
+    static bool write_active_marker(const std::filesystem::path& world_directory, uint32_t id);
+
+private:
+    CompressionDictionary();
+
+    friend class ChunkSerializer;
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 // ============================================================================
 // Chunk Serializer
 // ============================================================================
 
+// Compression and decompression reuse per-thread zstd contexts, so a single
+// serializer can be shared by all generation workers. Configure it (level,
+// dictionaries) before sharing; the setters are not synchronized.
+
 class ChunkSerializer {
 public:
     ChunkSerializer();
@@ -85,13 +170,29 @@ public:
     // Configuration
     void set_compression(CompressionType type);
     [[nodiscard]] CompressionType get_compression() const;
+    void set_compression_level(int level);
+    [[nodiscard]] int get_compression_level() const;
+
+    // Dictionaries: every added dictionary can be decoded, the active one
+    // (if any) is used when compressing
+    void add_dictionary(std::shared_ptr<const CompressionDictionary> dictionary);
+    void set_active_dictionary(std::shared_ptr<const CompressionDictionary> dictionary);
+    [[nodiscard]] const CompressionDictionary* get_active_dictionary() const;
+
+    // Load all dictionaries stored in a world directory and activate the one
+    // named by its active marker. Returns the number of dictionaries loaded.
+    size_t load_dictionaries(const std::filesystem::path& world_directory);
 
     // Serialize chunk to binary blob
     [[nodiscard]] std::vector<uint8_t> serialize(const Chunk& chunk) const;
+    [[nodiscard]] std::vector<uint8_t> serialize(const Chunk& chunk, int compression_level) const;
 
     // Deserialize binary blob to chunk
     bool deserialize(Chunk& chunk, std::span<const uint8_t> data) const;
 
+    // Validate and decompress a blob to the raw chunk payload
+    [[nodiscard]] std::optional<std::vector<uint8_t>> decode_payload(std::span<const uint8_t> data) const;
+
     // File I/O
     bool save_to_file(const Chunk& chunk, const std::filesystem::path& path) const;
     bool load_from_file(Chunk& chunk, const std::filesystem::path& path) const;
@@ -108,6 +209,8 @@ private:
 // Region File (32x32 chunks per file)
 // ============================================================================
 
+// Thread-safe: chunk reads run concurrently via positional reads, writes
+// append to disjoint ranges and only serialize while publishing the entry.
 class RegionFile {
 public:
     static constexpr int32_t CHUNKS_PER_SIDE = REGION_SIZE;
@@ -142,8 +245,8 @@ public:
     [[nodiscard]] size_t file_size() const;
     [[nodiscard]] glm::ivec2 get_region_pos() const;
 
-    // Flush changes to disk
-    void flush();
+    // Flush changes to disk. Returns false if the sync failed.
+    bool flush();
 
 private:
     struct Impl;
@@ -154,8 +257,19 @@ private:
 // Region Manager (caches open region files)
 // ============================================================================
 
+// The LRU cache is guarded by its own lock that is never held during disk
+// I/O, so operations on different regions (and reads within one region) run
+// in parallel across generation workers.
+//
+// With the write-ahead journal enabled (<world>/journal.rcj), writes and
+// deletes are staged in memory and made durable as one group by commit():
+// the batch is appended with per-record checksums and synced once. Region
+// files are only touched by checkpoint(), which runs when the journal grows
+// past its threshold. Reads see staged and committed data immediately.
 class RegionManager {
 public:
+    static constexpr size_t DEFAULT_CHECKPOINT_THRESHOLD = 32 * 1024 * 1024;
+
     explicit RegionManager(const std::filesystem::path& world_directory);
     ~RegionManager();
 
@@ -169,12 +283,31 @@ public:
     bool write_chunk(const ChunkPos& chunk, std::span<const uint8_t> data);
     bool delete_chunk(const ChunkPos& chunk);
 
-    // Flush all open region files
-    void flush();
+    // Commit the journal, checkpointing it once it exceeds the threshold.
+    // Without a journal, syncs all open region files. Returns false if the
+    // commit failed; the writes then stay staged for the next attempt.
+    bool flush();
 
-    // Close all region files
+    // Close all region files (checkpoints the journal first)
     void close_all();
 
+    // Write-ahead journal. Enabling replays every batch committed before an
+    // unclean shutdown into the region files; torn batches are discarded.
+    // Returns false, leaving the journal file intact, if any committed
+    // record could not be applied.
+    bool enable_journal();
+    [[nodiscard]] bool is_journal_enabled() const;
+
+    // Make all staged writes durable with a single sync. On failure nothing
+    // is unstaged, so a later commit retries the same writes.
+    bool commit();
+
+    // Copy committed writes into region files, sync them and reset the journal
+    bool checkpoint();
+
+    void set_checkpoint_threshold(size_t bytes);
+    [[nodiscard]] size_t journal_size() const;
+
     // Set max open region files (LRU eviction)
     void set_max_open_files(size_t count);
     [[nodiscard]] size_t get_max_open_files() const;
@@ -31,6 +31,9 @@ struct TerrainConfig {
     // World seed for deterministic generation
     uint32_t seed = 0;
 
+    // SIMD level for all generation noise (also applied to climate and caves)
+    NoiseSimdLevel noise_simd = NoiseSimdLevel::Auto;
+
     // Height parameters
     int32_t sea_level = 64;         // Water fills up to this height
     int32_t base_height = 64;       // Average terrain height
@@ -107,6 +110,39 @@ struct TerrainConfig {
     StructureConfig structures;
 };
 
+// ============================================================================
+// Generation Stage Times
+// ============================================================================
+
+/// Wall time spent in each generation pass, in milliseconds
+struct GenerationStageTimes {
+    double heightmap_ms = 0.0;
+    double erosion_ms = 0.0;
+    double terrain_ms = 0.0;     // Column fill: biomes, density, caves
+    double decoration_ms = 0.0;  // Cave decorations
+    double ores_ms = 0.0;
+    double structures_ms = 0.0;
+    double trees_ms = 0.0;
+    double vegetation_ms = 0.0;
+
+    [[nodiscard]] double total_ms() const {
+        return heightmap_ms + erosion_ms + terrain_ms + decoration_ms + ores_ms + structures_ms + trees_ms +
+               vegetation_ms;
+    }
+
+    GenerationStageTimes& operator+=(const GenerationStageTimes& other) {
+        heightmap_ms += other.heightmap_ms;
+        erosion_ms += other.erosion_ms;
+        terrain_ms += other.terrain_ms;
+        decoration_ms += other.decoration_ms;
+        ores_ms += other.ores_ms;
+        structures_ms += other.structures_ms;
+        trees_ms += other.trees_ms;
+        vegetation_ms += other.vegetation_ms;
+        return *this;
+    }
+};
+
 // ============================================================================
 // Terrain Generator
 // ============================================================================
@@ -129,6 +165,9 @@ public:
     /// Generate terrain for a chunk (thread-safe, reentrant)
     void generate(Chunk& chunk) const;
 
+    /// Generate and add the time spent in each pass to `times` (may be null)
+    void generate(Chunk& chunk, GenerationStageTimes* times) const;
+
     /// Generate heightmap for a chunk position (for preview/debugging)
     /// Returns a CHUNK_SIZE_X * CHUNK_SIZE_Z array of heights
     [[nodiscard]] std::array<int32_t, CHUNK_SIZE_X * CHUNK_SIZE_Z> generate_heightmap(const ChunkPos& pos) const;
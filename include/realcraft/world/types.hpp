@@ -377,6 +377,18 @@ inline void water_set_pressure(BlockStateId& state, uint8_t pressure) {
     }
 }
 
+// ============================================================================
+// Noise SIMD Level
+// ============================================================================
+
+// Highest SIMD feature set generation noise may dispatch to. Results can
+// differ in the last bits between levels, so anything that compares output
+// across machines (golden hashes, replays) pins Scalar.
+enum class NoiseSimdLevel : uint8_t {
+    Auto,   // Best level the host CPU supports
+    Scalar  // No SIMD, identical on every platform
+};
+
 }  // namespace realcraft::world
 
 // ============================================================================
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "chunk.hpp"
+#include "chunk_cache.hpp"
 #include "origin_shifter.hpp"
 #include "serialization.hpp"
 #include "types.hpp"
@@ -12,6 +13,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace realcraft::world {
@@ -29,14 +31,23 @@ struct WorldConfig {
     std::filesystem::path save_directory;  // Empty = default saves dir
 
     // Memory limits
-    size_t max_loaded_chunks = 1024;  // Force unload if exceeded
-    size_t chunk_cache_size = 256;    // Keep recently used in memory
+    size_t max_loaded_chunks = 1024;  // Hard cap on decoded chunks (view distance is clamped to fit)
+    size_t chunk_cache_size = 256;    // Unloaded chunks kept compressed in RAM (0 = disabled)
 
     // Origin shifting
     OriginShiftConfig origin_shift;
 
-    // Auto-save interval (seconds, 0 = disabled)
-    double auto_save_interval = 300.0;
+    // Auto-save interval (seconds, 0 = disabled). Each auto-save is one
+    // journal commit, so frequent saves stay cheap.
+    double auto_save_interval = 60.0;
+
+    // Write-ahead journal for crash-consistent batched saves
+    bool enable_journal = true;
+    size_t journal_checkpoint_bytes = RegionManager::DEFAULT_CHECKPOINT_THRESHOLD;
+
+    // zstd levels for periodic/unload saves and for save_all()/shutdown
+    int auto_save_compression_level = DEFAULT_COMPRESSION_LEVEL;
+    int final_save_compression_level = DEFAULT_FINAL_SAVE_COMPRESSION_LEVEL;
 };
 
 // ============================================================================
@@ -66,6 +77,13 @@ public:
         (void)pos;
         (void)chunk;
     }
+    // Called before a loaded chunk is serialized, so observers can store
+    // their per-chunk state in its metadata. Must not call back into the
+    // WorldManager.
+    virtual void on_chunk_saving(const ChunkPos& pos, Chunk& chunk) {
+        (void)pos;
+        (void)chunk;
+    }
     virtual void on_block_changed(const BlockChangeEvent& event) { (void)event; }
     virtual void on_origin_shifted(const WorldBlockPos& old_origin, const WorldBlockPos& new_origin) {
         (void)old_origin;
@@ -139,6 +157,12 @@ public:
     [[nodiscard]] PaletteEntry get_entry(const WorldBlockPos& pos) const;
     void set_block(const WorldBlockPos& pos, BlockId id, BlockStateId state = 0);
 
+    // Bulk read of an inclusive box that may span chunks, in the same layout
+    // as Chunk::read_region (x fastest, then z, then y). Each chunk is read
+    // under one lock; unloaded chunks and y outside the world read as air.
+    // Returns false without writing if min > max or out is too small.
+    bool read_region(const WorldBlockPos& min, const WorldBlockPos& max, std::span<BlockId> out) const;
+
     // ========================================================================
     // Player Position (for chunk loading)
     // ========================================================================
@@ -193,10 +217,11 @@ public:
     // ========================================================================
 
     [[nodiscard]] size_t loaded_chunk_count() const;
+    [[nodiscard]] size_t cached_chunk_count() const;  // Compressed tier
     [[nodiscard]] size_t pending_generation_count() const;
     [[nodiscard]] size_t pending_load_count() const;
-    [[nodiscard]] size_t dirty_chunk_count() const;
-    [[nodiscard]] size_t total_memory_usage() const;
+    [[nodiscard]] size_t dirty_chunk_count() const;   // O(1), maintained as chunks change
+    [[nodiscard]] size_t total_memory_usage() const;  // Walks every chunk; not for per-frame use
 
     // ========================================================================
     // Configuration
@@ -204,6 +229,9 @@ public:
 
     [[nodiscard]] const WorldConfig& get_config() const;
     void set_view_distance(int32_t distance);
+    // View distance actually loaded: the requested one, clamped so the view
+    // square plus its unload margin fits max_loaded_chunks
+    [[nodiscard]] int32_t get_effective_view_distance() const;
     [[nodiscard]] uint32_t get_seed() const;
 
 private:
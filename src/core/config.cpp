@@ -231,7 +231,10 @@ void Config::set_defaults() {
               {{config_key::MASTER_VOLUME, 1.0}, {config_key::MUSIC_VOLUME, 0.7}, {config_key::SFX_VOLUME, 1.0}}},
              {config_section::INPUT, {{config_key::MOUSE_SENSITIVITY, 1.0}, {config_key::INVERT_Y, false}}},
              {config_section::GAMEPLAY, {{config_key::VIEW_DISTANCE, 8}}},
-             {config_section::DEBUG, {{config_key::SHOW_FPS, true}, {config_key::LOG_LEVEL, "info"}}}};
+             {config_section::DEBUG,
+              {{config_key::SHOW_FPS, true},
+               {config_key::LOG_LEVEL, "info"},
+               {config_key::DETERMINISTIC_TASKS, false}}}};
     impl_->dirty = true;
 }
 
@@ -4,6 +4,9 @@
 #include <format>
 #include <realcraft/core/engine.hpp>
 #include <realcraft/core/memory.hpp>
+#include <realcraft/core/metrics.hpp>
+#include <realcraft/core/profiler.hpp>
+#include <realcraft/graphics/shader_cache.hpp>
 #include <realcraft/platform/file_io.hpp>
 #include <realcraft/platform/input_action.hpp>
 #include <realcraft/platform/platform.hpp>
@@ -22,6 +25,7 @@ struct Engine::Impl {
     std::unique_ptr<Config> app_config;
     std::unique_ptr<GameLoop> game_loop;
     std::unique_ptr<platform::InputMapper> input_mapper;
+    std::unique_ptr<platform::AssetStore> assets;
 
     // User callbacks
     InitCallback init_callback;
@@ -69,7 +73,12 @@ bool Engine::initialize(const EngineConfig& config) {
 
     // Initialize memory tracking
     MemoryTracker::initialize();
-    initialize_frame_allocator();
+    initialize_frame_arenas();
+
+#if defined(REALCRAFT_ENABLE_PROFILING) && REALCRAFT_ENABLE_PROFILING
+    Profiler::initialize();
+    REALCRAFT_PROFILE_THREAD("Main");
+#endif
 
     // Initialize platform layer
     if (!platform::initialize()) {
@@ -85,6 +94,23 @@ bool Engine::initialize(const EngineConfig& config) {
     }
     impl_->app_config->load_or_create_default(config_path);
 
+    // Mount packed assets, with loose files as fallback in development builds
+    platform::AssetStoreConfig asset_config;
+    asset_config.archive_path = config.asset_archive_path.empty()
+                                    ? platform::FileSystem::get_executable_directory() / "assets.rcpak"
+                                    : config.asset_archive_path;
+    asset_config.loose_root = config.asset_root;
+#if defined(REALCRAFT_SOURCE_ROOT)
+    if (asset_config.loose_root.empty()) {
+        asset_config.loose_root = REALCRAFT_SOURCE_ROOT;
+    }
+#endif
+    impl_->assets = std::make_unique<platform::AssetStore>();
+    if (!impl_->assets->initialize(asset_config)) {
+        REALCRAFT_LOG_WARN(log_category::ENGINE, "No asset archive or asset directory found");
+    }
+    graphics::ShaderCompiler::set_default_assets(impl_->assets.get());
+
     // Create window with config settings
     impl_->window = platform::create_window();
     platform::Window::Config window_config = config.window;
@@ -108,6 +134,15 @@ bool Engine::initialize(const EngineConfig& config) {
     impl_->input_mapper = std::make_unique<platform::InputMapper>(impl_->window->get_input());
     impl_->input_mapper->load_defaults();
 
+    // Compiled shaders persist across runs; every ShaderCompiler created
+    // from here on consults this cache first
+    auto shader_cache = std::make_shared<graphics::ShaderCache>();
+    graphics::ShaderCacheConfig shader_cache_config;
+    shader_cache_config.directory = platform::FileSystem::get_user_data_directory() / "shader_cache";
+    if (shader_cache->initialize(shader_cache_config)) {
+        graphics::ShaderCompiler::set_default_cache(std::move(shader_cache));
+    }
+
     // Create graphics device
     graphics::DeviceDesc device_desc;
     device_desc.metal_layer = impl_->window->get_metal_layer();
@@ -144,6 +179,8 @@ bool Engine::initialize(const EngineConfig& config) {
         impl_->app_config->get_double(config_section::GRAPHICS, config_key::TARGET_FPS, loop_config.target_fps);
     loop_config.target_fps = target_fps;
     loop_config.vsync = window_config.vsync;
+    loop_config.tasks.deterministic = impl_->app_config->get_bool(
+        config_section::DEBUG, config_key::DETERMINISTIC_TASKS, loop_config.tasks.deterministic);
 
     impl_->game_loop->configure(loop_config);
 
@@ -187,13 +224,32 @@ void Engine::shutdown() {
     }
 
     impl_->app_config.reset();
+    graphics::ShaderCompiler::set_default_assets(nullptr);
+    impl_->assets.reset();
+
+    if (auto shader_cache = graphics::ShaderCompiler::get_default_cache()) {
+        const auto stats = shader_cache->stats();
+        REALCRAFT_LOG_INFO(log_category::GRAPHICS, "Shader cache: {} hits, {} misses, {} stored, {} evicted",
+                           stats.hits, stats.misses, stats.stores, stats.evictions);
+        graphics::ShaderCompiler::set_default_cache(nullptr);
+    }
 
     platform::shutdown();
 
+    // Final metrics snapshot for offline comparison between runs
+    MetricsRegistry::instance().dump(platform::FileSystem::get_user_data_directory() / "metrics" /
+                                     "realcraft_metrics.txt");
+
+#if defined(REALCRAFT_ENABLE_PROFILING) && REALCRAFT_ENABLE_PROFILING
+    // Keep the last window of events for chrome://tracing / Perfetto
+    Profiler::export_chrome_trace(platform::FileSystem::get_user_data_directory() / "traces" / "realcraft_trace.json");
+    Profiler::shutdown();
+#endif
+
     // Memory tracking report
+    shutdown_frame_arenas();
     MemoryTracker::log_stats();
     MemoryTracker::report_leaks();
-    shutdown_frame_allocator();
     MemoryTracker::shutdown();
 
     REALCRAFT_LOG_INFO(log_category::ENGINE, "Goodbye!");
@@ -315,6 +371,14 @@ const GameLoop* Engine::get_game_loop() const {
     return impl_->game_loop.get();
 }
 
+platform::AssetStore* Engine::get_assets() {
+    return impl_->assets.get();
+}
+
+const platform::AssetStore* Engine::get_assets() const {
+    return impl_->assets.get();
+}
+
 platform::Input* Engine::get_input() {
     if (impl_->window) {
         return impl_->window->get_input();
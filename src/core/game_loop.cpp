@@ -5,6 +5,7 @@
 #include <realcraft/core/game_loop.hpp>
 #include <realcraft/core/logger.hpp>
 #include <realcraft/core/memory.hpp>
+#include <realcraft/core/profiler.hpp>
 #include <realcraft/platform/timer.hpp>
 
 namespace realcraft::core {
@@ -15,6 +16,7 @@ struct GameLoop::Impl {
     FixedUpdateCallback fixed_update_callback;
     UpdateCallback update_callback;
     RenderCallback render_callback;
+    TaskGraph task_graph;
 
     platform::FrameTimer frame_timer;
     double accumulator = 0.0;
@@ -34,6 +36,7 @@ GameLoop::~GameLoop() = default;
 
 void GameLoop::configure(const GameLoopConfig& config) {
     impl_->config = config;
+    impl_->task_graph.configure(config.tasks);
 
     if (config.target_fps > 0.0) {
         impl_->frame_timer.set_target_fps(config.target_fps);
@@ -63,22 +66,40 @@ void GameLoop::set_render(RenderCallback callback) {
     impl_->render_callback = std::move(callback);
 }
 
+TaskGraph& GameLoop::get_task_graph() {
+    return impl_->task_graph;
+}
+
+const TaskGraph& GameLoop::get_task_graph() const {
+    return impl_->task_graph;
+}
+
 void GameLoop::run_frame() {
-    // Reset per-frame allocator
-    reset_frame_allocator();
+    REALCRAFT_PROFILE_ZONE("Frame");
+
+    // Release last frame's arena allocations and record peak memory use
+    reset_frame_arenas();
+    MemoryTracker::sample_peaks();
 
     // Begin frame timing
     impl_->frame_timer.begin_frame();
 
-    // Calculate frame time, clamping to prevent spiral of death
-    double frame_time = impl_->frame_timer.get_unscaled_delta_time();
+    // Calculate frame time, clamping to prevent spiral of death. Simulated
+    // time keeps replays independent of how fast the machine runs them.
+    double frame_time = impl_->config.simulated_frame_time > 0.0 ? impl_->config.simulated_frame_time
+                                                                 : impl_->frame_timer.get_unscaled_delta_time();
     frame_time = std::min(frame_time, impl_->config.max_frame_time);
 
     // Variable update (runs every frame)
     double scaled_delta = frame_time * impl_->time_scale;
     if (impl_->update_callback) {
+        REALCRAFT_PROFILE_ZONE("Update");
         impl_->update_callback(scaled_delta);
     }
+    {
+        REALCRAFT_PROFILE_ZONE("Update Tasks");
+        impl_->task_graph.run(TaskPhase::Update, scaled_delta);
+    }
 
     // Fixed timestep updates (only if not paused)
     if (!impl_->paused) {
@@ -87,8 +108,13 @@ void GameLoop::run_frame() {
         // Run fixed updates until we've caught up
         while (impl_->accumulator >= impl_->config.fixed_timestep) {
             if (impl_->fixed_update_callback) {
+                REALCRAFT_PROFILE_ZONE("Fixed Update");
                 impl_->fixed_update_callback(impl_->config.fixed_timestep);
             }
+            {
+                REALCRAFT_PROFILE_ZONE("Fixed Update Tasks");
+                impl_->task_graph.run(TaskPhase::FixedUpdate, impl_->config.fixed_timestep);
+            }
             impl_->accumulator -= impl_->config.fixed_timestep;
         }
     }
@@ -98,6 +124,7 @@ void GameLoop::run_frame() {
 
     // Render
     if (impl_->render_callback) {
+        REALCRAFT_PROFILE_ZONE("Render");
         impl_->render_callback(impl_->interpolation);
     }
 
@@ -106,6 +133,7 @@ void GameLoop::run_frame() {
 
     // Wait for target frame time if frame limiting is enabled
     if (impl_->frame_timer.is_frame_limiting_enabled()) {
+        REALCRAFT_PROFILE_ZONE("Frame Limit Wait");
         impl_->frame_timer.wait_for_target_frame_time();
     }
 }
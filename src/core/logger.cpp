@@ -4,23 +4,148 @@
 #include <spdlog/sinks/rotating_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <iterator>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <realcraft/core/logger.hpp>
 #include <realcraft/platform/file_io.hpp>
-#include <unordered_map>
+#include <thread>
+#include <vector>
+
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+#    include <io.h>
+#else
+#    include <cerrno>
+#    include <unistd.h>
+#endif
 
 namespace realcraft::core {
 
 namespace {
 
+// Interned categories; slot 0 catches names beyond the table size
+constexpr size_t MAX_CATEGORIES = 64;
+constexpr const char* OVERFLOW_CATEGORY = "other";
+
+constexpr size_t RECORD_ALIGNMENT = 8;
+constexpr size_t MIN_THREAD_BUFFER_SIZE = 4 * 1024;
+constexpr auto BACKEND_IDLE_WAIT = std::chrono::milliseconds(5);
+
+constexpr std::array<int, 4> CRASH_SIGNALS = {SIGSEGV, SIGABRT, SIGFPE, SIGILL};
+
+// Fixed-size header in front of every record. A header with a null format
+// function marks padding up to the end of the ring; when fewer bytes than a
+// header remain before the end, the reader wraps without a marker.
+struct RecordHeader {
+    uint32_t size;         // Header + payload, rounded up to RECORD_ALIGNMENT
+    uint32_t format_size;  // Leading payload bytes holding the format string
+    int64_t timestamp_ns;  // system_clock, so sinks print the time of the call
+    detail::LogFormatFn format;
+    detail::LogCategoryId category;
+    LogLevel level;
+};
+
+// Single-producer/single-consumer byte ring owned by one logging thread
+struct ThreadLogBuffer {
+    explicit ThreadLogBuffer(size_t size)
+        : data(std::make_unique<std::byte[]>(size)), capacity(size), mask(size - 1) {}
+
+    std::unique_ptr<std::byte[]> data;
+    size_t capacity;
+    uint64_t mask;
+    alignas(64) std::atomic<uint64_t> head{0};  // Written by the owner
+    alignas(64) std::atomic<uint64_t> tail{0};  // Written by the backend
+    uint64_t reserved_head = 0;                 // Owner only: end of the record being written
+    bool wake_on_commit = false;                // Owner only: notify the backend after committing
+    std::atomic<bool> abandoned{false};         // Owner thread has exited
+};
+
+// Per-thread handle; marks the buffer abandoned when the thread exits so the
+// backend can release it once drained
+struct ThreadLogHandle {
+    std::shared_ptr<ThreadLogBuffer> buffer;
+    uint64_t generation = 0;
+
+    ~ThreadLogHandle() {
+        if (buffer) {
+            buffer->abandoned.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local ThreadLogHandle t_log_handle;
+
+// Formatted record waiting to be written by the backend
+struct PendingRecord {
+    int64_t timestamp_ns;
+    LogLevel level;
+    detail::LogCategoryId category;
+    std::string text;
+};
+
 // Global logger state
 struct LoggerState {
-    bool initialized = false;
-    LogLevel global_level = LogLevel::Info;
-    std::unordered_map<std::string, LogLevel> category_levels;
+    std::atomic<bool> initialized{false};
     std::shared_ptr<spdlog::logger> console_logger;
     std::shared_ptr<spdlog::logger> file_logger;
-    std::mutex mutex;
+    std::mutex mutex;  // Lifecycle and sink access
+
+    // Level table: effective level per interned category, read lock-free
+    std::mutex category_mutex;  // Registration and level changes
+    LogLevel global_level = LogLevel::Info;
+    std::array<std::string, MAX_CATEGORIES> category_names;
+    std::array<int, MAX_CATEGORIES> category_overrides{};  // -1 = follow global level
+    std::array<std::atomic<int>, MAX_CATEGORIES> category_levels{};
+    std::atomic<size_t> category_count{1};
+
+    // Async backend
+    size_t buffer_capacity = 0;
+    LogOverflowPolicy overflow_policy = LogOverflowPolicy::Block;
+    std::atomic<uint64_t> generation{0};  // Bumped per initialize so threads re-register
+    std::atomic<int> active_writers{0};   // Threads between begin_record() and end_record()
+    std::atomic<uint64_t> dropped{0};
+    uint64_t dropped_reported = 0;  // Backend only
+
+    std::mutex buffers_mutex;
+    std::vector<std::shared_ptr<ThreadLogBuffer>> buffers;
+
+    std::mutex drain_mutex;  // Held by whoever is draining (backend or crash handler)
+
+    std::thread backend;
+    std::mutex backend_mutex;
+    std::condition_variable backend_cv;
+    std::condition_variable flush_cv;
+    bool stop_requested = false;
+    bool wake_requested = false;
+    uint64_t flush_requested = 0;
+    uint64_t flush_completed = 0;
+
+    std::array<void (*)(int), CRASH_SIGNALS.size()> previous_handlers{};
+    bool crash_handlers_installed = false;
+
+    LoggerState() {
+        category_names[0] = OVERFLOW_CATEGORY;
+        category_overrides.fill(-1);
+    }
+
+    // Exit without Logger::shutdown(): still stop the backend cleanly
+    ~LoggerState() {
+        if (backend.joinable()) {
+            {
+                std::lock_guard lock(backend_mutex);
+                stop_requested = true;
+            }
+            backend_cv.notify_one();
+            backend.join();
+        }
+    }
 };
 
 LoggerState& get_state() {
@@ -49,8 +174,333 @@ spdlog::level::level_enum to_spdlog_level(LogLevel level) {
     }
 }
 
+// ============================================================================
+// Category Table
+// ============================================================================
+
+// Recompute effective levels after a change; returns the lowest enabled level.
+// Caller must hold category_mutex.
+int refresh_category_levels(LoggerState& state) {
+    const int global = static_cast<int>(state.global_level);
+    int min_level = global;
+    const size_t count = state.category_count.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i) {
+        const int level = state.category_overrides[i] >= 0 ? state.category_overrides[i] : global;
+        state.category_levels[i].store(level, std::memory_order_relaxed);
+        min_level = std::min(min_level, level);
+    }
+    return min_level;
+}
+
+std::optional<detail::LogCategoryId> find_category(const LoggerState& state, std::string_view category) {
+    const size_t count = state.category_count.load(std::memory_order_acquire);
+    for (size_t i = 1; i < count; ++i) {
+        if (state.category_names[i] == category) {
+            return static_cast<detail::LogCategoryId>(i);
+        }
+    }
+    return std::nullopt;
+}
+
+// Caller must hold category_mutex
+detail::LogCategoryId intern_category_locked(LoggerState& state, std::string_view category) {
+    if (auto id = find_category(state, category)) {
+        return *id;
+    }
+    const size_t count = state.category_count.load(std::memory_order_relaxed);
+    if (count >= MAX_CATEGORIES) {
+        return 0;
+    }
+    state.category_names[count] = std::string(category);
+    state.category_overrides[count] = -1;
+    state.category_levels[count].store(static_cast<int>(state.global_level), std::memory_order_relaxed);
+    state.category_count.store(count + 1, std::memory_order_release);
+    return static_cast<detail::LogCategoryId>(count);
+}
+
+detail::LogCategoryId intern_category(LoggerState& state, std::string_view category) {
+    if (auto id = find_category(state, category)) {
+        return *id;
+    }
+    std::lock_guard lock(state.category_mutex);
+    return intern_category_locked(state, category);
+}
+
+// ============================================================================
+// Async Backend
+// ============================================================================
+
+ThreadLogBuffer* acquire_thread_buffer(LoggerState& state) {
+    ThreadLogHandle& handle = t_log_handle;
+    const uint64_t generation = state.generation.load(std::memory_order_acquire);
+    if (!handle.buffer || handle.generation != generation) {
+        if (handle.buffer) {
+            handle.buffer->abandoned.store(true, std::memory_order_release);
+        }
+        handle.buffer = std::make_shared<ThreadLogBuffer>(state.buffer_capacity);
+        handle.generation = generation;
+        std::lock_guard lock(state.buffers_mutex);
+        state.buffers.push_back(handle.buffer);
+    }
+    return handle.buffer.get();
+}
+
+void wake_backend(LoggerState& state) {
+    {
+        std::lock_guard lock(state.backend_mutex);
+        state.wake_requested = true;
+    }
+    state.backend_cv.notify_one();
+}
+
+// Copy every committed record out of the thread buffers, formatting as we go.
+// Caller must hold drain_mutex.
+void collect_records(LoggerState& state, std::vector<std::shared_ptr<ThreadLogBuffer>>& buffers,
+                     std::vector<PendingRecord>& records) {
+    {
+        std::lock_guard lock(state.buffers_mutex);
+        buffers = state.buffers;
+    }
+
+    for (const auto& buffer : buffers) {
+        uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+        const uint64_t head = buffer->head.load(std::memory_order_acquire);
+
+        while (tail != head) {
+            const size_t offset = tail & buffer->mask;
+            if (buffer->capacity - offset < sizeof(RecordHeader)) {
+                tail += buffer->capacity - offset;
+                continue;
+            }
+
+            RecordHeader header;
+            std::memcpy(&header, buffer->data.get() + offset, sizeof(header));
+            if (header.format == nullptr) {
+                tail += header.size;
+                continue;
+            }
+
+            const std::byte* payload = buffer->data.get() + offset + sizeof(RecordHeader);
+            const std::string_view format(reinterpret_cast<const char*>(payload), header.format_size);
+            PendingRecord record{header.timestamp_ns, header.level, header.category, {}};
+            try {
+                record.text = header.format(format, payload + header.format_size);
+            } catch (const std::exception& ex) {
+                record.text = fmt::format("<format error: {}> {}", ex.what(), format);
+            }
+            records.push_back(std::move(record));
+            tail += header.size;
+        }
+
+        buffer->tail.store(tail, std::memory_order_release);
+    }
+
+    // Release buffers of exited threads once they are empty
+    std::unique_lock lock(state.buffers_mutex, std::try_to_lock);
+    if (lock.owns_lock()) {
+        std::erase_if(state.buffers, [](const std::shared_ptr<ThreadLogBuffer>& buffer) {
+            return buffer->abandoned.load(std::memory_order_acquire) &&
+                   buffer->tail.load(std::memory_order_relaxed) == buffer->head.load(std::memory_order_acquire);
+        });
+    }
+}
+
+// Caller must hold `mutex`
+void write_records(LoggerState& state, std::vector<PendingRecord>& records) {
+    // Threads drain in turn; restore call order across them
+    std::stable_sort(records.begin(), records.end(),
+                     [](const PendingRecord& a, const PendingRecord& b) { return a.timestamp_ns < b.timestamp_ns; });
+
+    std::string line;
+    for (const auto& record : records) {
+        line.clear();
+        fmt::format_to(std::back_inserter(line), "[{}] {}", state.category_names[record.category], record.text);
+        const auto time = spdlog::log_clock::time_point(
+            std::chrono::duration_cast<spdlog::log_clock::duration>(std::chrono::nanoseconds(record.timestamp_ns)));
+        const auto level = to_spdlog_level(record.level);
+        if (state.console_logger) {
+            state.console_logger->log(time, spdlog::source_loc{}, level, line);
+        }
+        if (state.file_logger) {
+            state.file_logger->log(time, spdlog::source_loc{}, level, line);
+        }
+    }
+
+    const uint64_t dropped = state.dropped.load(std::memory_order_relaxed);
+    if (dropped > state.dropped_reported) {
+        line = fmt::format("[{}] Dropped {} log messages (thread log buffer full)", log_category::ENGINE,
+                           dropped - state.dropped_reported);
+        state.dropped_reported = dropped;
+        if (state.console_logger) {
+            state.console_logger->log(spdlog::level::warn, line);
+        }
+        if (state.file_logger) {
+            state.file_logger->log(spdlog::level::warn, line);
+        }
+    }
+}
+
+void drain(LoggerState& state, std::vector<std::shared_ptr<ThreadLogBuffer>>& buffers,
+           std::vector<PendingRecord>& records) {
+    std::lock_guard drain_lock(state.drain_mutex);
+    records.clear();
+    collect_records(state, buffers, records);
+    std::lock_guard lock(state.mutex);
+    write_records(state, records);
+}
+
+void flush_sinks(LoggerState& state) {
+    if (state.console_logger) {
+        state.console_logger->flush();
+    }
+    if (state.file_logger) {
+        state.file_logger->flush();
+    }
+}
+
+void backend_thread() {
+    LoggerState& state = get_state();
+    std::vector<std::shared_ptr<ThreadLogBuffer>> buffers;
+    std::vector<PendingRecord> records;
+
+    while (true) {
+        uint64_t flush_target = 0;
+        bool flush_pending = false;
+        bool stop = false;
+        {
+            std::unique_lock lock(state.backend_mutex);
+            state.backend_cv.wait_for(lock, BACKEND_IDLE_WAIT, [&state] {
+                return state.stop_requested || state.wake_requested || state.flush_requested > state.flush_completed;
+            });
+            state.wake_requested = false;
+            flush_target = state.flush_requested;
+            flush_pending = state.flush_requested > state.flush_completed;
+            stop = state.stop_requested;
+        }
+
+        drain(state, buffers, records);
+
+        if (flush_pending || stop) {
+            {
+                std::lock_guard lock(state.mutex);
+                flush_sinks(state);
+            }
+            std::lock_guard lock(state.backend_mutex);
+            state.flush_completed = std::max(state.flush_completed, flush_target);
+            state.flush_cv.notify_all();
+        }
+
+        if (stop) {
+            break;
+        }
+    }
+}
+
+// Unbuffered write to stderr; safe to call from a signal handler
+void crash_write(std::string_view text) {
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+    _write(2, text.data(), static_cast<unsigned>(text.size()));
+#else
+    while (!text.empty()) {
+        ssize_t written = ::write(STDERR_FILENO, text.data(), text.size());
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return;
+        }
+        text.remove_prefix(static_cast<size_t>(written));
+    }
+#endif
+}
+
+// Best effort: dump whatever the crashing process still holds, then hand the
+// signal on to the previous handler. A fatal signal may arrive inside malloc
+// or a sink, so this never allocates, formats, blocks on a lock or touches
+// spdlog. Records go straight to stderr with write(2), grouped by thread:
+// preformatted messages in full, others as their format string with the
+// arguments left out.
+void crash_signal_handler(int signal) {
+    LoggerState& state = get_state();
+
+    std::unique_lock drain_lock(state.drain_mutex, std::try_to_lock);
+    std::unique_lock buffers_lock(state.buffers_mutex, std::defer_lock);
+    if (drain_lock.owns_lock() && buffers_lock.try_lock()) {
+        for (const auto& buffer : state.buffers) {
+            uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+            const uint64_t head = buffer->head.load(std::memory_order_acquire);
+
+            while (tail != head) {
+                const size_t offset = tail & buffer->mask;
+                if (buffer->capacity - offset < sizeof(RecordHeader)) {
+                    tail += buffer->capacity - offset;
+                    continue;
+                }
+
+                RecordHeader header;
+                std::memcpy(&header, buffer->data.get() + offset, sizeof(header));
+                tail += header.size;
+                if (header.format == nullptr) {
+                    continue;
+                }
+
+                const std::byte* payload = buffer->data.get() + offset + sizeof(RecordHeader);
+                std::string_view text(reinterpret_cast<const char*>(payload), header.format_size);
+                if (header.format == &detail::log_format_preformatted) {
+                    const std::byte* args = payload + header.format_size;
+                    text = detail::log_decode<std::string_view>(args);
+                }
+                crash_write("[");
+                crash_write(state.category_names[header.category]);
+                crash_write("] ");
+                crash_write(text);
+                crash_write("\n");
+            }
+
+            buffer->tail.store(tail, std::memory_order_release);
+        }
+        buffers_lock.unlock();
+    }
+    if (drain_lock.owns_lock()) {
+        drain_lock.unlock();
+    }
+
+    for (size_t i = 0; i < CRASH_SIGNALS.size(); ++i) {
+        if (CRASH_SIGNALS[i] == signal) {
+            std::signal(signal, state.previous_handlers[i] != SIG_ERR ? state.previous_handlers[i] : SIG_DFL);
+            break;
+        }
+    }
+    std::raise(signal);
+}
+
+void install_crash_handlers(LoggerState& state) {
+    for (size_t i = 0; i < CRASH_SIGNALS.size(); ++i) {
+        state.previous_handlers[i] = std::signal(CRASH_SIGNALS[i], crash_signal_handler);
+    }
+    state.crash_handlers_installed = true;
+}
+
+void restore_crash_handlers(LoggerState& state) {
+    if (!state.crash_handlers_installed) {
+        return;
+    }
+    for (size_t i = 0; i < CRASH_SIGNALS.size(); ++i) {
+        std::signal(CRASH_SIGNALS[i], state.previous_handlers[i] != SIG_ERR ? state.previous_handlers[i] : SIG_DFL);
+    }
+    state.crash_handlers_installed = false;
+}
+
 }  // namespace
 
+namespace detail {
+
+std::string log_format_preformatted(std::string_view /*format*/, const std::byte* args) {
+    return std::string(log_decode<std::string_view>(args));
+}
+
+}  // namespace detail
+
 void Logger::initialize(const LoggerConfig& config) {
     auto& state = get_state();
     std::filesystem::path log_path;  // Store for logging after lock release
@@ -98,18 +548,37 @@ void Logger::initialize(const LoggerConfig& config) {
             state.file_logger->set_level(spdlog::level::trace);  // Let sink filter
             state.file_logger->flush_on(spdlog::level::info);    // Flush on every info message
 
-            state.global_level = config.console_level;
-            state.initialized = true;
-
         } catch (const spdlog::spdlog_ex& ex) {
             // Fallback to basic console logging if file creation fails
             spdlog::error("Logger initialization failed: {}", ex.what());
 
             auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
             state.console_logger = std::make_shared<spdlog::logger>("console", console_sink);
+        }
+
+        {
+            std::lock_guard category_lock(state.category_mutex);
             state.global_level = config.console_level;
-            state.initialized = true;
+            min_level_.store(refresh_category_levels(state), std::memory_order_relaxed);
         }
+
+        if (config.async) {
+            state.buffer_capacity = std::bit_ceil(std::max(config.thread_buffer_size, MIN_THREAD_BUFFER_SIZE));
+            state.overflow_policy = config.overflow_policy;
+            state.dropped.store(0, std::memory_order_relaxed);
+            state.dropped_reported = 0;
+            state.stop_requested = false;
+            state.flush_requested = 0;
+            state.flush_completed = 0;
+            state.generation.fetch_add(1, std::memory_order_acq_rel);
+            state.backend = std::thread(backend_thread);
+            if (config.flush_on_crash) {
+                install_crash_handlers(state);
+            }
+            async_.store(true, std::memory_order_release);
+        }
+
+        state.initialized = true;
     }  // Lock released here
 
     // Log initialization success AFTER releasing the lock to avoid deadlock
@@ -121,56 +590,89 @@ void Logger::initialize(const LoggerConfig& config) {
 
 void Logger::shutdown() {
     auto& state = get_state();
-    std::lock_guard lock(state.mutex);
 
     if (!state.initialized) {
         return;
     }
 
-    // Flush all pending logs
-    if (state.console_logger) {
-        state.console_logger->flush();
-    }
-    if (state.file_logger) {
-        state.file_logger->flush();
+    // Route new messages to the synchronous path, wait for in-flight records,
+    // then let the backend drain and flush everything before it exits
+    if (async_.exchange(false, std::memory_order_seq_cst)) {
+        while (state.active_writers.load(std::memory_order_seq_cst) > 0) {
+            std::this_thread::yield();
+        }
+        {
+            std::lock_guard lock(state.backend_mutex);
+            state.stop_requested = true;
+        }
+        state.backend_cv.notify_one();
+        if (state.backend.joinable()) {
+            state.backend.join();
+        }
+        restore_crash_handlers(state);
+
+        std::lock_guard lock(state.buffers_mutex);
+        state.buffers.clear();
     }
 
+    std::lock_guard lock(state.mutex);
+
+    // Flush all pending logs
+    flush_sinks(state);
+
     state.console_logger.reset();
     state.file_logger.reset();
-    state.category_levels.clear();
+    {
+        std::lock_guard category_lock(state.category_mutex);
+        state.category_overrides.fill(-1);
+        state.global_level = LogLevel::Info;
+        refresh_category_levels(state);
+    }
+    min_level_.store(0, std::memory_order_relaxed);
     state.initialized = false;
 
     spdlog::shutdown();
 }
 
 bool Logger::is_initialized() {
-    auto& state = get_state();
-    std::lock_guard lock(state.mutex);
-    return state.initialized;
+    return get_state().initialized.load(std::memory_order_acquire);
 }
 
 void Logger::set_category_level(std::string_view category, LogLevel level) {
     auto& state = get_state();
-    std::lock_guard lock(state.mutex);
-    state.category_levels[std::string(category)] = level;
+    std::lock_guard lock(state.category_mutex);
+    const detail::LogCategoryId id = intern_category_locked(state, category);
+    if (id != 0) {
+        state.category_overrides[id] = static_cast<int>(level);
+    }
+    const int min_level = refresh_category_levels(state);
+    if (state.initialized) {
+        min_level_.store(min_level, std::memory_order_relaxed);
+    }
 }
 
 LogLevel Logger::get_category_level(std::string_view category) {
     auto& state = get_state();
-    std::lock_guard lock(state.mutex);
+    std::lock_guard lock(state.category_mutex);
 
-    auto it = state.category_levels.find(std::string(category));
-    if (it != state.category_levels.end()) {
-        return it->second;
+    if (auto id = find_category(state, category); id && state.category_overrides[*id] >= 0) {
+        return static_cast<LogLevel>(state.category_overrides[*id]);
     }
     return state.global_level;
 }
 
 void Logger::set_global_level(LogLevel level) {
     auto& state = get_state();
-    std::lock_guard lock(state.mutex);
-    state.global_level = level;
+    {
+        std::lock_guard lock(state.category_mutex);
+        state.global_level = level;
+        const int min_level = refresh_category_levels(state);
+        if (state.initialized) {
+            min_level_.store(min_level, std::memory_order_relaxed);
+        }
+    }
 
+    std::lock_guard lock(state.mutex);
     if (state.console_logger) {
         // Update console sink level
         for (auto& sink : state.console_logger->sinks()) {
@@ -181,50 +683,50 @@ void Logger::set_global_level(LogLevel level) {
 
 LogLevel Logger::get_global_level() {
     auto& state = get_state();
-    std::lock_guard lock(state.mutex);
+    std::lock_guard lock(state.category_mutex);
     return state.global_level;
 }
 
 void Logger::flush() {
     auto& state = get_state();
-    std::lock_guard lock(state.mutex);
 
-    if (state.console_logger) {
-        state.console_logger->flush();
-    }
-    if (state.file_logger) {
-        state.file_logger->flush();
+    if (async_.load(std::memory_order_acquire)) {
+        std::unique_lock lock(state.backend_mutex);
+        const uint64_t target = ++state.flush_requested;
+        state.backend_cv.notify_one();
+        state.flush_cv.wait(lock, [&state, target] { return state.flush_completed >= target || state.stop_requested; });
+        return;
     }
+
+    std::lock_guard lock(state.mutex);
+    flush_sinks(state);
 }
 
-bool Logger::should_log(LogLevel level, std::string_view category) {
+uint64_t Logger::dropped_message_count() {
+    return get_state().dropped.load(std::memory_order_relaxed);
+}
+
+bool Logger::should_log(LogLevel level, std::string_view category, detail::LogCategoryId& id) {
     auto& state = get_state();
 
-    if (!state.initialized) {
+    if (!state.initialized.load(std::memory_order_acquire)) {
         // Before initialization, use spdlog default
         return true;
     }
 
-    LogLevel category_level;
-    {
-        std::lock_guard lock(state.mutex);
-        auto it = state.category_levels.find(std::string(category));
-        if (it != state.category_levels.end()) {
-            category_level = it->second;
-        } else {
-            category_level = state.global_level;
-        }
-    }
-
-    return static_cast<int>(level) >= static_cast<int>(category_level);
+    id = intern_category(state, category);
+    return static_cast<int>(level) >= state.category_levels[id].load(std::memory_order_relaxed);
 }
 
 void Logger::log_message(LogLevel level, std::string_view category, std::string_view message) {
     auto& state = get_state();
 
     if (!state.initialized) {
-        // Before initialization, use spdlog directly
-        spdlog::log(to_spdlog_level(level), "[{}] {}", category, message);
+        // Before initialization, use spdlog directly (its default logger is
+        // gone once spdlog::shutdown() has run)
+        if (auto* fallback = spdlog::default_logger_raw(); fallback != nullptr) {
+            fallback->log(to_spdlog_level(level), "[{}] {}", category, message);
+        }
         return;
     }
 
@@ -241,4 +743,80 @@ void Logger::log_message(LogLevel level, std::string_view category, std::string_
     }
 }
 
+Logger::RecordSlot Logger::begin_record(LogLevel level, detail::LogCategoryId category, detail::LogFormatFn format,
+                                        size_t format_size, size_t payload_size, std::byte*& out) {
+    auto& state = get_state();
+
+    // Announce the writer before re-checking async_ so shutdown() either sees
+    // this record in flight or this thread sees the backend stopping
+    state.active_writers.fetch_add(1, std::memory_order_seq_cst);
+    if (!async_.load(std::memory_order_seq_cst)) {
+        state.active_writers.fetch_sub(1, std::memory_order_release);
+        return RecordSlot::Synchronous;
+    }
+
+    const size_t total = (sizeof(RecordHeader) + payload_size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+    ThreadLogBuffer* buffer = acquire_thread_buffer(state);
+    if (total > buffer->capacity / 4) {
+        state.active_writers.fetch_sub(1, std::memory_order_release);
+        return RecordSlot::Synchronous;
+    }
+
+    uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    size_t offset = head & buffer->mask;
+    const size_t padding = offset + total > buffer->capacity ? buffer->capacity - offset : 0;
+
+    while (buffer->capacity - (head - buffer->tail.load(std::memory_order_acquire)) < padding + total) {
+        if (state.overflow_policy == LogOverflowPolicy::Drop) {
+            state.dropped.fetch_add(1, std::memory_order_relaxed);
+            state.active_writers.fetch_sub(1, std::memory_order_release);
+            return RecordSlot::Dropped;
+        }
+        if (!async_.load(std::memory_order_acquire)) {
+            state.active_writers.fetch_sub(1, std::memory_order_release);
+            return RecordSlot::Synchronous;
+        }
+        wake_backend(state);
+        std::this_thread::yield();
+    }
+
+    if (padding > 0) {
+        if (padding >= sizeof(RecordHeader)) {
+            RecordHeader marker{};
+            marker.size = static_cast<uint32_t>(padding);
+            std::memcpy(buffer->data.get() + offset, &marker, sizeof(marker));
+        }
+        head += padding;
+        offset = 0;
+    }
+
+    RecordHeader header{};
+    header.size = static_cast<uint32_t>(total);
+    header.format_size = static_cast<uint32_t>(format_size);
+    header.timestamp_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    header.format = format;
+    header.category = category;
+    header.level = level;
+    std::memcpy(buffer->data.get() + offset, &header, sizeof(header));
+
+    buffer->reserved_head = head + total;
+    buffer->wake_on_commit = level >= LogLevel::Error;
+    out = buffer->data.get() + offset + sizeof(RecordHeader);
+    return RecordSlot::Reserved;
+}
+
+void Logger::end_record() {
+    auto& state = get_state();
+    ThreadLogBuffer* buffer = t_log_handle.buffer.get();
+    buffer->head.store(buffer->reserved_head, std::memory_order_release);
+    state.active_writers.fetch_sub(1, std::memory_order_release);
+
+    // Errors are written promptly rather than on the next idle wakeup
+    if (buffer->wake_on_commit) {
+        wake_backend(state);
+    }
+}
+
 }  // namespace realcraft::core
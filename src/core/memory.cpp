@@ -2,6 +2,7 @@
 // memory.cpp - Memory tracking and allocators implementation
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <mutex>
 #include <realcraft/core/logger.hpp>
@@ -12,84 +13,214 @@ namespace realcraft::core {
 
 namespace {
 
-// Memory tracker state
+// ============================================================================
+// Tracker State
+// ============================================================================
+
+// One per thread. Only the owning thread writes, so updates are plain
+// load/store pairs; atomics make the concurrent reads well-defined.
+struct ThreadCounters {
+    struct Category {
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> deallocations{0};
+        std::atomic<uint64_t> bytes_allocated{0};
+        std::atomic<uint64_t> bytes_freed{0};
+    };
+    std::array<Category, MEMORY_CATEGORY_COUNT> categories;
+};
+
+struct CategoryTotals {
+    uint64_t allocations = 0;
+    uint64_t deallocations = 0;
+    uint64_t bytes_allocated = 0;
+    uint64_t bytes_freed = 0;
+};
+using Totals = std::array<CategoryTotals, MEMORY_CATEGORY_COUNT>;
+
 struct TrackerState {
-    bool initialized = false;
-    MemoryStats stats;
+    std::atomic<bool> initialized{false};
+
+    // Counter blocks are never freed: a thread's block still holds the
+    // allocations it made after the thread exits
     std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadCounters>> blocks;
+    Totals baseline{};  // Totals at the last reset_stats()
+
+    std::atomic<size_t> peak_allocations{0};
+    std::atomic<size_t> peak_bytes{0};
 
 #ifdef REALCRAFT_DEBUG
     struct AllocationInfo {
         size_t size;
         const char* tag;
     };
+    std::mutex debug_mutex;
     std::unordered_map<void*, AllocationInfo> allocations;
 #endif
 };
 
+// Leaked so that threads exiting after static destruction can still record
 TrackerState& get_tracker_state() {
-    static TrackerState state;
-    return state;
+    static auto* state = new TrackerState();
+    return *state;
+}
+
+// Trivially destructible, so it stays usable from other thread_local destructors
+thread_local ThreadCounters* t_counters = nullptr;
+
+ThreadCounters& local_counters() {
+    if (t_counters == nullptr) {
+        auto& state = get_tracker_state();
+        auto counters = std::make_unique<ThreadCounters>();
+        t_counters = counters.get();
+        std::lock_guard lock(state.mutex);
+        state.blocks.push_back(std::move(counters));
+    }
+    return *t_counters;
 }
 
-// Frame allocator singleton
-std::unique_ptr<LinearAllocator> g_frame_allocator;
-std::mutex g_frame_allocator_mutex;
+void bump(std::atomic<uint64_t>& counter, uint64_t amount) {
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+// Requires state.mutex
+Totals sum_counters(const TrackerState& state) {
+    Totals totals{};
+    for (const auto& block : state.blocks) {
+        for (size_t i = 0; i < MEMORY_CATEGORY_COUNT; ++i) {
+            const auto& source = block->categories[i];
+            auto& total = totals[i];
+            total.allocations += source.allocations.load(std::memory_order_relaxed);
+            total.deallocations += source.deallocations.load(std::memory_order_relaxed);
+            total.bytes_allocated += source.bytes_allocated.load(std::memory_order_relaxed);
+            total.bytes_freed += source.bytes_freed.load(std::memory_order_relaxed);
+        }
+    }
+    return totals;
+}
+
+// Counters of different threads are read at slightly different times, so a
+// free can be seen before its allocation
+size_t active(uint64_t added, uint64_t removed) {
+    return added > removed ? static_cast<size_t>(added - removed) : 0;
+}
+
+void raise_peak(std::atomic<size_t>& peak, size_t value) {
+    size_t current = peak.load(std::memory_order_relaxed);
+    while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+MemoryStats build_stats(const Totals& totals, const Totals& baseline) {
+    MemoryStats stats;
+    for (size_t i = 0; i < MEMORY_CATEGORY_COUNT; ++i) {
+        const auto& total = totals[i];
+        auto& category = stats.categories[i];
+        category.total_allocations = active(total.allocations, baseline[i].allocations);
+        category.total_deallocations = active(total.deallocations, baseline[i].deallocations);
+        category.active_allocations = active(total.allocations, total.deallocations);
+        category.active_bytes = active(total.bytes_allocated, total.bytes_freed);
+
+        stats.total_allocations += category.total_allocations;
+        stats.total_deallocations += category.total_deallocations;
+        stats.active_allocations += category.active_allocations;
+        stats.active_bytes += category.active_bytes;
+    }
+    return stats;
+}
+
+// Arena block size and frame counter shared by all threads
+std::atomic<size_t> g_arena_block_size{256 * 1024};
+std::atomic<uint64_t> g_frame_epoch{0};
+
+constexpr size_t BLOCK_ALIGNMENT = alignof(std::max_align_t);
 
 }  // namespace
 
-// MemoryTracker implementation
+const char* memory_category_name(MemoryCategory category) {
+    switch (category) {
+        case MemoryCategory::General:
+            return "General";
+        case MemoryCategory::World:
+            return "World";
+        case MemoryCategory::Meshing:
+            return "Meshing";
+        case MemoryCategory::Physics:
+            return "Physics";
+        case MemoryCategory::Rendering:
+            return "Rendering";
+        case MemoryCategory::Gameplay:
+            return "Gameplay";
+        case MemoryCategory::Arena:
+            return "Arena";
+        case MemoryCategory::Pool:
+            return "Pool";
+        case MemoryCategory::Count:
+            break;
+    }
+    return "Unknown";
+}
+
+// ============================================================================
+// MemoryTracker
+// ============================================================================
+
 void MemoryTracker::initialize() {
     auto& state = get_tracker_state();
-    std::lock_guard lock(state.mutex);
-
-    if (state.initialized) {
+    if (state.initialized.exchange(true)) {
         return;
     }
 
-    state.stats = MemoryStats{};
-    state.initialized = true;
+    reset_stats();
 
 #ifdef REALCRAFT_DEBUG
+    std::lock_guard lock(state.debug_mutex);
     state.allocations.clear();
 #endif
 }
 
 void MemoryTracker::shutdown() {
     auto& state = get_tracker_state();
-    std::lock_guard lock(state.mutex);
-
-    if (!state.initialized) {
+    if (!state.initialized.exchange(false)) {
         return;
     }
 
 #ifdef REALCRAFT_DEBUG
     // Report any remaining allocations as leaks
-    if (!state.allocations.empty()) {
-        report_leaks();
-    }
+    report_leaks();
+    std::lock_guard lock(state.debug_mutex);
     state.allocations.clear();
 #endif
-
-    state.initialized = false;
 }
 
 bool MemoryTracker::is_initialized() {
-    auto& state = get_tracker_state();
-    std::lock_guard lock(state.mutex);
-    return state.initialized;
+    return get_tracker_state().initialized.load(std::memory_order_relaxed);
 }
 
 MemoryStats MemoryTracker::get_stats() {
     auto& state = get_tracker_state();
-    std::lock_guard lock(state.mutex);
-    return state.stats;
+    MemoryStats stats;
+    {
+        std::lock_guard lock(state.mutex);
+        stats = build_stats(sum_counters(state), state.baseline);
+    }
+
+    raise_peak(state.peak_allocations, stats.active_allocations);
+    raise_peak(state.peak_bytes, stats.active_bytes);
+    stats.peak_allocations = state.peak_allocations.load(std::memory_order_relaxed);
+    stats.peak_bytes = state.peak_bytes.load(std::memory_order_relaxed);
+    return stats;
 }
 
 void MemoryTracker::reset_stats() {
     auto& state = get_tracker_state();
     std::lock_guard lock(state.mutex);
-    state.stats = MemoryStats{};
+    state.baseline = sum_counters(state);
+
+    // Peaks restart from what is live now
+    const MemoryStats stats = build_stats(state.baseline, state.baseline);
+    state.peak_allocations.store(stats.active_allocations, std::memory_order_relaxed);
+    state.peak_bytes.store(stats.active_bytes, std::memory_order_relaxed);
 }
 
 void MemoryTracker::log_stats() {
@@ -97,26 +228,50 @@ void MemoryTracker::log_stats() {
 
     REALCRAFT_LOG_INFO(log_category::MEMORY, "Memory Stats - Active: {} allocs ({} bytes), Peak: {} allocs ({} bytes)",
                        stats.active_allocations, stats.active_bytes, stats.peak_allocations, stats.peak_bytes);
+
+    for (size_t i = 0; i < MEMORY_CATEGORY_COUNT; ++i) {
+        const auto& category = stats.categories[i];
+        if (category.total_allocations == 0 && category.active_allocations == 0) {
+            continue;
+        }
+        REALCRAFT_LOG_DEBUG(log_category::MEMORY, "  {}: {} active allocs ({} bytes), {} total",
+                            memory_category_name(static_cast<MemoryCategory>(i)), category.active_allocations,
+                            category.active_bytes, category.total_allocations);
+    }
 }
 
-void MemoryTracker::track_allocation(void* ptr, size_t size, const char* tag) {
-    if (!ptr)
+void MemoryTracker::sample_peaks() {
+    (void)get_stats();
+}
+
+void MemoryTracker::record_allocation(MemoryCategory category, size_t size) {
+    if (!get_tracker_state().initialized.load(std::memory_order_relaxed)) {
         return;
+    }
+    auto& counters = local_counters().categories[static_cast<size_t>(category)];
+    bump(counters.allocations, 1);
+    bump(counters.bytes_allocated, size);
+}
 
-    auto& state = get_tracker_state();
-    std::lock_guard lock(state.mutex);
+void MemoryTracker::record_deallocation(MemoryCategory category, size_t size) {
+    if (!get_tracker_state().initialized.load(std::memory_order_relaxed)) {
+        return;
+    }
+    auto& counters = local_counters().categories[static_cast<size_t>(category)];
+    bump(counters.deallocations, 1);
+    bump(counters.bytes_freed, size);
+}
 
-    if (!state.initialized) {
+void MemoryTracker::track_allocation(void* ptr, size_t size, const char* tag) {
+    if (!ptr || !is_initialized()) {
         return;
     }
 
-    state.stats.total_allocations++;
-    state.stats.active_allocations++;
-    state.stats.active_bytes += size;
-    state.stats.peak_allocations = std::max(state.stats.peak_allocations, state.stats.active_allocations);
-    state.stats.peak_bytes = std::max(state.stats.peak_bytes, state.stats.active_bytes);
+    record_allocation(MemoryCategory::General, size);
 
 #ifdef REALCRAFT_DEBUG
+    auto& state = get_tracker_state();
+    std::lock_guard lock(state.debug_mutex);
     state.allocations[ptr] = {size, tag};
 #else
     (void)tag;
@@ -124,44 +279,44 @@ void MemoryTracker::track_allocation(void* ptr, size_t size, const char* tag) {
 }
 
 void MemoryTracker::track_deallocation(void* ptr) {
-    if (!ptr)
-        return;
-
-    auto& state = get_tracker_state();
-    std::lock_guard lock(state.mutex);
-
-    if (!state.initialized) {
+    if (!ptr || !is_initialized()) {
         return;
     }
 
 #ifdef REALCRAFT_DEBUG
-    auto it = state.allocations.find(ptr);
-    if (it != state.allocations.end()) {
-        state.stats.total_deallocations++;
-        state.stats.active_allocations--;
-        state.stats.active_bytes -= it->second.size;
+    auto& state = get_tracker_state();
+    size_t size = 0;
+    {
+        std::lock_guard lock(state.debug_mutex);
+        auto it = state.allocations.find(ptr);
+        if (it == state.allocations.end()) {
+            return;
+        }
+        size = it->second.size;
         state.allocations.erase(it);
     }
+    record_deallocation(MemoryCategory::General, size);
 #else
-    state.stats.total_deallocations++;
-    if (state.stats.active_allocations > 0) {
-        state.stats.active_allocations--;
-    }
+    record_deallocation(MemoryCategory::General, 0);
 #endif
 }
 
 void MemoryTracker::report_leaks() {
 #ifdef REALCRAFT_DEBUG
     auto& state = get_tracker_state();
-    // Note: Called from shutdown, mutex should already be held
+    std::lock_guard lock(state.debug_mutex);
 
     if (state.allocations.empty()) {
         REALCRAFT_LOG_INFO(log_category::MEMORY, "No memory leaks detected");
         return;
     }
 
+    size_t leaked_bytes = 0;
+    for (const auto& [ptr, info] : state.allocations) {
+        leaked_bytes += info.size;
+    }
     REALCRAFT_LOG_WARN(log_category::MEMORY, "Memory leaks detected: {} allocations ({} bytes)",
-                       state.allocations.size(), state.stats.active_bytes);
+                       state.allocations.size(), leaked_bytes);
 
     size_t count = 0;
     for (const auto& [ptr, info] : state.allocations) {
@@ -176,7 +331,10 @@ void MemoryTracker::report_leaks() {
 #endif
 }
 
-// LinearAllocator implementation
+// ============================================================================
+// LinearAllocator
+// ============================================================================
+
 struct LinearAllocator::Impl {
     uint8_t* buffer = nullptr;
     size_t capacity = 0;
@@ -235,41 +393,241 @@ size_t LinearAllocator::remaining() const {
     return impl_->capacity - impl_->offset;
 }
 
-// Frame allocator singleton
-LinearAllocator& get_frame_allocator() {
-    std::lock_guard lock(g_frame_allocator_mutex);
+// ============================================================================
+// Arena
+// ============================================================================
+
+Arena::Arena(size_t block_size, MemoryCategory category)
+    : block_size_(std::max(block_size, BLOCK_ALIGNMENT)), category_(category) {}
+
+Arena::~Arena() {
+    purge();
+}
+
+void* Arena::allocate_slow(size_t size, size_t alignment) {
+    const size_t needed = size + alignment;
+
+    // Reuse a later block that was kept after a release() or reset()
+    const size_t first = cursor_ != nullptr ? current_ + 1 : current_;
+    for (size_t i = first; i < blocks_.size(); ++i) {
+        if (blocks_[i].size >= needed) {
+            use_block(i);
+            return allocate(size, alignment);
+        }
+    }
 
-    if (!g_frame_allocator) {
-        // Auto-initialize with default size if not explicitly initialized
-        g_frame_allocator = std::make_unique<LinearAllocator>(4 * 1024 * 1024);
+    Block block;
+    block.size = std::max(block_size_, needed);
+    block.data = static_cast<std::byte*>(std::malloc(block.size));
+    if (block.data == nullptr) {
+        REALCRAFT_LOG_ERROR(log_category::MEMORY, "Arena failed to allocate a {} byte block", block.size);
+        return nullptr;
     }
+    MemoryTracker::record_allocation(category_, block.size);
+
+    blocks_.push_back(block);
+    use_block(blocks_.size() - 1);
+    return allocate(size, alignment);
+}
 
-    return *g_frame_allocator;
+void Arena::use_block(size_t index) {
+    current_ = index;
+    cursor_ = blocks_[index].data;
+    limit_ = blocks_[index].data + blocks_[index].size;
 }
 
-void initialize_frame_allocator(size_t capacity) {
-    std::lock_guard lock(g_frame_allocator_mutex);
+Arena::Marker Arena::mark() const {
+    if (cursor_ == nullptr) {
+        return {};
+    }
+    return {current_, static_cast<size_t>(cursor_ - blocks_[current_].data)};
+}
 
-    if (g_frame_allocator) {
-        REALCRAFT_LOG_WARN(log_category::MEMORY, "Frame allocator already initialized, ignoring new capacity");
+void Arena::release(const Marker& marker) {
+    if (blocks_.empty()) {
         return;
     }
+    high_water_ = std::max(high_water_, used());
+    use_block(marker.block);
+    cursor_ += marker.offset;
+}
+
+void Arena::reset() {
+    high_water_ = std::max(high_water_, used());
 
-    g_frame_allocator = std::make_unique<LinearAllocator>(capacity);
-    REALCRAFT_LOG_INFO(log_category::MEMORY, "Frame allocator initialized with {} bytes", capacity);
+    // Grown past one block: merge, so the next frame fits in a single block
+    if (blocks_.size() > 1) {
+        const size_t high_water = high_water_;
+        purge();
+        block_size_ = std::max(block_size_, high_water);
+        return;
+    }
+
+    if (!blocks_.empty()) {
+        use_block(0);
+    }
 }
 
-void shutdown_frame_allocator() {
-    std::lock_guard lock(g_frame_allocator_mutex);
-    g_frame_allocator.reset();
+void Arena::purge() {
+    for (const auto& block : blocks_) {
+        std::free(block.data);
+        MemoryTracker::record_deallocation(category_, block.size);
+    }
+    blocks_.clear();
+    cursor_ = nullptr;
+    limit_ = nullptr;
+    current_ = 0;
+    high_water_ = 0;
 }
 
-void reset_frame_allocator() {
-    std::lock_guard lock(g_frame_allocator_mutex);
+size_t Arena::used() const {
+    if (cursor_ == nullptr) {
+        return 0;
+    }
+    size_t total = static_cast<size_t>(cursor_ - blocks_[current_].data);
+    for (size_t i = 0; i < current_; ++i) {
+        total += blocks_[i].size;
+    }
+    return total;
+}
 
-    if (g_frame_allocator) {
-        g_frame_allocator->reset();
+size_t Arena::capacity() const {
+    size_t total = 0;
+    for (const auto& block : blocks_) {
+        total += block.size;
     }
+    return total;
+}
+
+// ============================================================================
+// Per-Thread Arenas
+// ============================================================================
+
+Arena& get_frame_arena() {
+    thread_local Arena arena(g_arena_block_size.load(std::memory_order_relaxed));
+    thread_local uint64_t epoch = g_frame_epoch.load(std::memory_order_relaxed);
+
+    const uint64_t current = g_frame_epoch.load(std::memory_order_relaxed);
+    if (epoch != current) {
+        epoch = current;
+        arena.reset();
+    }
+    return arena;
+}
+
+Arena& get_job_arena() {
+    thread_local Arena arena(g_arena_block_size.load(std::memory_order_relaxed));
+    return arena;
+}
+
+void initialize_frame_arenas(size_t block_size) {
+    g_arena_block_size.store(block_size, std::memory_order_relaxed);
+    REALCRAFT_LOG_INFO(log_category::MEMORY, "Frame arenas use {} byte blocks", block_size);
+}
+
+void reset_frame_arenas() {
+    g_frame_epoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+void shutdown_frame_arenas() {
+    get_frame_arena().purge();
+    get_job_arena().purge();
+}
+
+// ============================================================================
+// PoolAllocator
+// ============================================================================
+
+struct PoolAllocator::Impl {
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    size_t block_size = 0;
+    size_t blocks_per_slab = 0;
+    MemoryCategory category = MemoryCategory::Pool;
+
+    std::mutex mutex;
+    FreeBlock* free_list = nullptr;
+    std::vector<std::byte*> slabs;
+    size_t capacity = 0;
+    size_t in_use = 0;
+
+    // Requires mutex
+    bool grow() {
+        const size_t slab_bytes = block_size * blocks_per_slab;
+        auto* slab = static_cast<std::byte*>(std::malloc(slab_bytes));
+        if (slab == nullptr) {
+            REALCRAFT_LOG_ERROR(log_category::MEMORY, "PoolAllocator failed to allocate a {} byte slab", slab_bytes);
+            return false;
+        }
+        MemoryTracker::record_allocation(category, slab_bytes);
+        slabs.push_back(slab);
+
+        // Thread the new blocks onto the free list, lowest address first
+        for (size_t i = blocks_per_slab; i-- > 0;) {
+            auto* block = reinterpret_cast<FreeBlock*>(slab + i * block_size);
+            block->next = free_list;
+            free_list = block;
+        }
+        capacity += blocks_per_slab;
+        return true;
+    }
+};
+
+PoolAllocator::PoolAllocator(size_t block_size, size_t blocks_per_slab, MemoryCategory category)
+    : impl_(std::make_unique<Impl>()) {
+    // Every block must hold a free-list link and keep the next block aligned
+    const size_t size = std::max(block_size, sizeof(Impl::FreeBlock));
+    impl_->block_size = (size + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT;
+    impl_->blocks_per_slab = std::max<size_t>(blocks_per_slab, 1);
+    impl_->category = category;
+}
+
+PoolAllocator::~PoolAllocator() {
+    if (impl_->in_use > 0) {
+        REALCRAFT_LOG_WARN(log_category::MEMORY, "PoolAllocator destroyed with {} blocks in use", impl_->in_use);
+    }
+    for (auto* slab : impl_->slabs) {
+        std::free(slab);
+        MemoryTracker::record_deallocation(impl_->category, impl_->block_size * impl_->blocks_per_slab);
+    }
+}
+
+void* PoolAllocator::allocate() {
+    std::lock_guard lock(impl_->mutex);
+    if (impl_->free_list == nullptr && !impl_->grow()) {
+        return nullptr;
+    }
+    auto* block = impl_->free_list;
+    impl_->free_list = block->next;
+    ++impl_->in_use;
+    return block;
+}
+
+void PoolAllocator::deallocate(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    std::lock_guard lock(impl_->mutex);
+    auto* block = static_cast<Impl::FreeBlock*>(ptr);
+    block->next = impl_->free_list;
+    impl_->free_list = block;
+    --impl_->in_use;
+}
+
+size_t PoolAllocator::block_size() const {
+    return impl_->block_size;
+}
+
+size_t PoolAllocator::capacity() const {
+    std::lock_guard lock(impl_->mutex);
+    return impl_->capacity;
+}
+
+size_t PoolAllocator::in_use() const {
+    std::lock_guard lock(impl_->mutex);
+    return impl_->in_use;
 }
 
 }  // namespace realcraft::core
@@ -0,0 +1,203 @@
+// RealCraft Engine Core
+// metrics.cpp - Runtime metrics registry implementation
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <realcraft/core/logger.hpp>
+#include <realcraft/core/metrics.hpp>
+#include <realcraft/platform/file_io.hpp>
+
+namespace realcraft::core {
+
+// ============================================================================
+// Histogram
+// ============================================================================
+
+uint64_t Histogram::percentile(double quantile) const {
+    const uint64_t total = count();
+    if (total == 0) {
+        return 0;
+    }
+
+    quantile = std::clamp(quantile, 0.0, 1.0);
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(quantile * static_cast<double>(total) + 0.5));
+    const uint64_t max_value = max_.load(std::memory_order_relaxed);
+
+    // Buckets are read without a global snapshot, so concurrent records may
+    // leave the running total short of `total`; fall back to the maximum
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::min(bucket_upper_bound(i), max_value);
+        }
+    }
+    return max_value;
+}
+
+HistogramSummary Histogram::summary() const {
+    HistogramSummary result;
+    result.count = count();
+    if (result.count == 0) {
+        return result;
+    }
+    result.sum = sum_.load(std::memory_order_relaxed);
+    result.min = min_.load(std::memory_order_relaxed);
+    result.max = max_.load(std::memory_order_relaxed);
+    result.p50 = percentile(0.50);
+    result.p90 = percentile(0.90);
+    result.p99 = percentile(0.99);
+    return result;
+}
+
+void Histogram::reset() {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    min_.store(UINT64_MAX, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// MetricsSnapshot
+// ============================================================================
+
+namespace {
+
+template <typename T>
+const T* find_entry(const std::vector<MetricsSnapshot::Entry<T>>& entries, std::string_view name) {
+    auto it = std::lower_bound(entries.begin(), entries.end(), name,
+                               [](const auto& entry, std::string_view key) { return entry.name < key; });
+    if (it != entries.end() && it->name == name) {
+        return &it->value;
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+const uint64_t* MetricsSnapshot::find_counter(std::string_view name) const {
+    return find_entry(counters, name);
+}
+
+const int64_t* MetricsSnapshot::find_gauge(std::string_view name) const {
+    return find_entry(gauges, name);
+}
+
+const HistogramSummary* MetricsSnapshot::find_histogram(std::string_view name) const {
+    return find_entry(histograms, name);
+}
+
+std::string MetricsSnapshot::to_text() const {
+    std::string out;
+    auto it = std::back_inserter(out);
+    for (const auto& [name, value] : counters) {
+        fmt::format_to(it, "counter {} {}\n", name, value);
+    }
+    for (const auto& [name, value] : gauges) {
+        fmt::format_to(it, "gauge {} {}\n", name, value);
+    }
+    for (const auto& [name, h] : histograms) {
+        fmt::format_to(it, "histogram {} count={} mean={:.1f} min={} p50={} p90={} p99={} max={}\n", name, h.count,
+                       h.mean(), h.min, h.p50, h.p90, h.p99, h.max);
+    }
+    return out;
+}
+
+// ============================================================================
+// MetricsRegistry
+// ============================================================================
+
+struct MetricsRegistry::Impl {
+    // Ordered maps keep snapshots sorted; unique_ptr keeps addresses stable
+    std::map<std::string, std::unique_ptr<Counter>, std::less<>> counters;
+    std::map<std::string, std::unique_ptr<Gauge>, std::less<>> gauges;
+    std::map<std::string, std::unique_ptr<Histogram>, std::less<>> histograms;
+    mutable std::mutex mutex;
+
+    template <typename T>
+    T& get_or_create(std::map<std::string, std::unique_ptr<T>, std::less<>>& map, std::string_view name) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = map.find(name);
+        if (it == map.end()) {
+            it = map.emplace(std::string(name), std::make_unique<T>()).first;
+        }
+        return *it->second;
+    }
+};
+
+MetricsRegistry::MetricsRegistry() : impl_(std::make_unique<Impl>()) {}
+
+MetricsRegistry::~MetricsRegistry() = default;
+
+MetricsRegistry& MetricsRegistry::instance() {
+    static MetricsRegistry instance;
+    return instance;
+}
+
+Counter& MetricsRegistry::counter(std::string_view name) {
+    return impl_->get_or_create(impl_->counters, name);
+}
+
+Gauge& MetricsRegistry::gauge(std::string_view name) {
+    return impl_->get_or_create(impl_->gauges, name);
+}
+
+Histogram& MetricsRegistry::histogram(std::string_view name) {
+    return impl_->get_or_create(impl_->histograms, name);
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+
+    MetricsSnapshot result;
+    result.counters.reserve(impl_->counters.size());
+    for (const auto& [name, metric] : impl_->counters) {
+        result.counters.push_back({name, metric->value()});
+    }
+    result.gauges.reserve(impl_->gauges.size());
+    for (const auto& [name, metric] : impl_->gauges) {
+        result.gauges.push_back({name, metric->value()});
+    }
+    result.histograms.reserve(impl_->histograms.size());
+    for (const auto& [name, metric] : impl_->histograms) {
+        result.histograms.push_back({name, metric->summary()});
+    }
+    return result;
+}
+
+bool MetricsRegistry::dump(const std::filesystem::path& path) const {
+    const auto parent = path.parent_path();
+    if (!parent.empty() && !platform::FileSystem::exists(parent) && !platform::FileSystem::create_directories(parent)) {
+        REALCRAFT_LOG_ERROR(log_category::ENGINE, "Failed to create metrics directory: {}", parent.string());
+        return false;
+    }
+
+    if (!platform::FileSystem::write_text(path, snapshot().to_text())) {
+        REALCRAFT_LOG_ERROR(log_category::ENGINE, "Failed to write metrics file: {}", path.string());
+        return false;
+    }
+
+    REALCRAFT_LOG_INFO(log_category::ENGINE, "Wrote metrics to: {}", path.string());
+    return true;
+}
+
+void MetricsRegistry::reset() {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    for (auto& [name, metric] : impl_->counters) {
+        metric->reset();
+    }
+    for (auto& [name, metric] : impl_->gauges) {
+        metric->reset();
+    }
+    for (auto& [name, metric] : impl_->histograms) {
+        metric->reset();
+    }
+}
+
+}  // namespace realcraft::core
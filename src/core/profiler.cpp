@@ -0,0 +1,372 @@
+// RealCraft Engine Core
+// profiler.cpp - Scoped profiling zones with per-thread ring buffers
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <realcraft/core/logger.hpp>
+#include <realcraft/core/profiler.hpp>
+#include <realcraft/platform/file_io.hpp>
+#include <vector>
+
+namespace realcraft::core {
+
+namespace {
+
+enum class EventType : uint8_t { Begin, End, Counter };
+
+// Slot fields are relaxed atomics so the exporter may read a slot while its
+// owner overwrites it; such slots are detected and dropped (see snapshot())
+struct EventSlot {
+    std::atomic<const char*> name{nullptr};
+    std::atomic<int64_t> timestamp_ns{0};
+    std::atomic<double> value{0.0};
+    std::atomic<EventType> type{EventType::Begin};
+};
+
+struct RecordedEvent {
+    const char* name;
+    int64_t timestamp_ns;
+    double value;
+    EventType type;
+};
+
+// Single-producer ring owned by one thread
+struct ThreadBuffer {
+    ThreadBuffer(size_t capacity, uint32_t id, uint64_t gen)
+        : slots(std::make_unique<EventSlot[]>(capacity)), mask(capacity - 1), thread_id(id), generation(gen) {}
+
+    std::unique_ptr<EventSlot[]> slots;
+    uint64_t mask;
+    std::atomic<uint64_t> head{0};  // Next write index, written by the owner only
+    std::atomic<uint64_t> tail{0};  // Oldest index still wanted, advanced by clear()
+    uint32_t thread_id;
+    uint64_t generation;
+    std::string name;  // Guarded by ProfilerState::mutex
+};
+
+struct ProfilerState {
+    std::atomic<bool> initialized{false};
+    std::atomic<bool> capturing{false};
+    std::atomic<uint64_t> generation{0};  // Bumped on init/shutdown so threads re-register
+    std::atomic<int64_t> epoch_ns{0};
+
+    std::mutex mutex;  // Registration and export only
+    size_t capacity = 0;
+    uint32_t next_thread_id = 1;
+    std::vector<std::shared_ptr<ThreadBuffer>> threads;
+};
+
+ProfilerState& get_profiler_state() {
+    static ProfilerState state;
+    return state;
+}
+
+thread_local std::shared_ptr<ThreadBuffer> t_buffer;
+thread_local std::string t_thread_name;
+
+int64_t steady_now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+size_t round_up_pow2(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// Returns this thread's buffer, registering one on first use
+ThreadBuffer* acquire_buffer(ProfilerState& state) {
+    const uint64_t generation = state.generation.load(std::memory_order_acquire);
+    if (t_buffer && t_buffer->generation == generation) {
+        return t_buffer.get();
+    }
+
+    std::lock_guard lock(state.mutex);
+    if (!state.initialized.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    auto buffer = std::make_shared<ThreadBuffer>(state.capacity, state.next_thread_id++,
+                                                 state.generation.load(std::memory_order_relaxed));
+    buffer->name = t_thread_name;
+    state.threads.push_back(buffer);
+    t_buffer = std::move(buffer);
+    return t_buffer.get();
+}
+
+void record(EventType type, const char* name, double value) {
+    auto& state = get_profiler_state();
+    if (!state.capturing.load(std::memory_order_acquire)) {
+        return;
+    }
+    ThreadBuffer* buffer = acquire_buffer(state);
+    if (!buffer) {
+        return;
+    }
+
+    const uint64_t index = buffer->head.load(std::memory_order_relaxed);
+    // A reader that observes this slot's new contents also observes head >= index
+    std::atomic_thread_fence(std::memory_order_release);
+    EventSlot& slot = buffer->slots[index & buffer->mask];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.timestamp_ns.store(steady_now_ns() - state.epoch_ns.load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+    slot.value.store(value, std::memory_order_relaxed);
+    slot.type.store(type, std::memory_order_relaxed);
+    buffer->head.store(index + 1, std::memory_order_release);
+}
+
+// Oldest readable index for a given head
+uint64_t first_readable(const ThreadBuffer& buffer, uint64_t head) {
+    const uint64_t capacity = buffer.mask + 1;
+    const uint64_t oldest = head > capacity ? head - capacity : 0;
+    return std::max(oldest, buffer.tail.load(std::memory_order_acquire));
+}
+
+// Copy a thread's events, dropping any slot its owner overwrote meanwhile
+std::vector<RecordedEvent> snapshot(const ThreadBuffer& buffer) {
+    const uint64_t head = buffer.head.load(std::memory_order_acquire);
+    const uint64_t begin = first_readable(buffer, head);
+
+    std::vector<RecordedEvent> events;
+    events.reserve(static_cast<size_t>(head - begin));
+    for (uint64_t i = begin; i < head; ++i) {
+        const EventSlot& slot = buffer.slots[i & buffer.mask];
+        events.push_back({slot.name.load(std::memory_order_relaxed), slot.timestamp_ns.load(std::memory_order_relaxed),
+                          slot.value.load(std::memory_order_relaxed), slot.type.load(std::memory_order_relaxed)});
+    }
+
+    // The slot being written when head_after was read is index head_after
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t head_after = buffer.head.load(std::memory_order_relaxed);
+    const uint64_t capacity = buffer.mask + 1;
+    const uint64_t valid_from = head_after + 1 > capacity ? head_after + 1 - capacity : 0;
+    if (valid_from > begin) {
+        const auto torn = static_cast<size_t>(std::min<uint64_t>(valid_from - begin, events.size()));
+        events.erase(events.begin(), events.begin() + static_cast<std::ptrdiff_t>(torn));
+    }
+    return events;
+}
+
+void append_json_string(std::string& out, std::string_view text) {
+    out += '"';
+    for (char c : text) {
+        switch (c) {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    fmt::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<unsigned>(c));
+                } else {
+                    out += c;
+                }
+                break;
+        }
+    }
+    out += '"';
+}
+
+}  // namespace
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void Profiler::initialize(const ProfilerConfig& config) {
+    auto& state = get_profiler_state();
+    std::lock_guard lock(state.mutex);
+
+    if (state.initialized.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    state.capacity = round_up_pow2(std::max<size_t>(config.events_per_thread, 16));
+    state.threads.clear();
+    state.next_thread_id = 1;
+    state.epoch_ns.store(steady_now_ns(), std::memory_order_relaxed);
+    state.generation.fetch_add(1, std::memory_order_release);
+    state.initialized.store(true, std::memory_order_release);
+    state.capturing.store(config.start_capturing, std::memory_order_release);
+
+    REALCRAFT_LOG_INFO(log_category::ENGINE, "Profiler initialized ({} events per thread)", state.capacity);
+}
+
+void Profiler::shutdown() {
+    auto& state = get_profiler_state();
+    std::lock_guard lock(state.mutex);
+
+    if (!state.initialized.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    state.capturing.store(false, std::memory_order_release);
+    state.initialized.store(false, std::memory_order_release);
+    state.generation.fetch_add(1, std::memory_order_release);
+    state.threads.clear();  // Threads still holding a buffer keep it alive until they re-register
+}
+
+bool Profiler::is_initialized() {
+    return get_profiler_state().initialized.load(std::memory_order_acquire);
+}
+
+void Profiler::set_capturing(bool capturing) {
+    auto& state = get_profiler_state();
+    state.capturing.store(capturing && state.initialized.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+bool Profiler::is_capturing() {
+    return get_profiler_state().capturing.load(std::memory_order_acquire);
+}
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+void Profiler::begin_zone(const char* name) {
+    record(EventType::Begin, name, 0.0);
+}
+
+void Profiler::end_zone(const char* name) {
+    record(EventType::End, name, 0.0);
+}
+
+void Profiler::counter(const char* name, double value) {
+    record(EventType::Counter, name, value);
+}
+
+void Profiler::set_thread_name(std::string_view name) {
+    t_thread_name = std::string(name);
+
+    auto& state = get_profiler_state();
+    if (!state.initialized.load(std::memory_order_acquire)) {
+        return;
+    }
+    if (ThreadBuffer* buffer = acquire_buffer(state)) {
+        std::lock_guard lock(state.mutex);
+        buffer->name = t_thread_name;
+    }
+}
+
+void Profiler::clear() {
+    auto& state = get_profiler_state();
+    std::lock_guard lock(state.mutex);
+    for (const auto& buffer : state.threads) {
+        buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+}
+
+size_t Profiler::event_count() {
+    auto& state = get_profiler_state();
+    std::lock_guard lock(state.mutex);
+    size_t count = 0;
+    for (const auto& buffer : state.threads) {
+        const uint64_t head = buffer->head.load(std::memory_order_acquire);
+        count += static_cast<size_t>(head - first_readable(*buffer, head));
+    }
+    return count;
+}
+
+// ============================================================================
+// Export
+// ============================================================================
+
+std::string Profiler::to_chrome_trace() {
+    auto& state = get_profiler_state();
+
+    // Copy the registry so rings are read without holding the mutex
+    std::vector<std::shared_ptr<ThreadBuffer>> threads;
+    std::vector<std::string> names;
+    {
+        std::lock_guard lock(state.mutex);
+        threads = state.threads;
+        for (const auto& buffer : threads) {
+            names.push_back(buffer->name);
+        }
+    }
+
+    std::string out;
+    out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    auto separator = [&] {
+        if (!first) {
+            out += ",\n";
+        }
+        first = false;
+    };
+
+    for (size_t t = 0; t < threads.size(); ++t) {
+        const ThreadBuffer& buffer = *threads[t];
+
+        separator();
+        out += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,";
+        fmt::format_to(std::back_inserter(out), "\"tid\":{},\"args\":{{\"name\":", buffer.thread_id);
+        append_json_string(out, names[t].empty() ? fmt::format("Thread {}", buffer.thread_id) : names[t]);
+        out += "}}";
+
+        // Ends whose begin was overwritten by the ring would confuse viewers
+        uint32_t depth = 0;
+        for (const RecordedEvent& event : snapshot(buffer)) {
+            if (event.name == nullptr) {
+                continue;
+            }
+            const char* phase = "C";
+            if (event.type == EventType::Begin) {
+                phase = "B";
+                ++depth;
+            } else if (event.type == EventType::End) {
+                if (depth == 0) {
+                    continue;
+                }
+                phase = "E";
+                --depth;
+            }
+
+            separator();
+            out += "{\"name\":";
+            append_json_string(out, event.name);
+            fmt::format_to(std::back_inserter(out), ",\"ph\":\"{}\",\"pid\":1,\"tid\":{},\"ts\":{:.3f}", phase,
+                           buffer.thread_id, static_cast<double>(event.timestamp_ns) / 1000.0);
+            if (event.type == EventType::Counter) {
+                fmt::format_to(std::back_inserter(out), ",\"args\":{{\"value\":{}}}", event.value);
+            }
+            out += '}';
+        }
+    }
+
+    out += "]}\n";
+    return out;
+}
+
+bool Profiler::export_chrome_trace(const std::filesystem::path& path) {
+    const auto parent = path.parent_path();
+    if (!parent.empty() && !platform::FileSystem::exists(parent) && !platform::FileSystem::create_directories(parent)) {
+        REALCRAFT_LOG_ERROR(log_category::ENGINE, "Failed to create trace directory: {}", parent.string());
+        return false;
+    }
+
+    if (!platform::FileSystem::write_text(path, to_chrome_trace())) {
+        REALCRAFT_LOG_ERROR(log_category::ENGINE, "Failed to write trace file: {}", path.string());
+        return false;
+    }
+
+    REALCRAFT_LOG_INFO(log_category::ENGINE, "Wrote profiler trace to: {}", path.string());
+    return true;
+}
+
+}  // namespace realcraft::core
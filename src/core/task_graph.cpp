@@ -0,0 +1,363 @@
+// RealCraft Engine Core
+// task_graph.cpp - Per-frame task graph implementation
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <realcraft/core/logger.hpp>
+#include <realcraft/core/metrics.hpp>
+#include <realcraft/core/profiler.hpp>
+#include <realcraft/core/task_graph.hpp>
+#include <thread>
+#include <unordered_set>
+
+namespace realcraft::core {
+
+namespace {
+
+constexpr size_t PHASE_COUNT = 2;
+
+size_t phase_index(TaskPhase phase) {
+    return static_cast<size_t>(phase);
+}
+
+bool intersects(const std::vector<std::string>& a, const std::vector<std::string>& b) {
+    for (const auto& name : a) {
+        if (std::find(b.begin(), b.end(), name) != b.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Write-after-read, read-after-write and write-after-write all order tasks
+bool conflicts(const TaskDesc& earlier, const TaskDesc& later) {
+    return intersects(earlier.writes, later.reads) || intersects(earlier.writes, later.writes) ||
+           intersects(earlier.reads, later.writes);
+}
+
+// Profiler zone names are stored by pointer and must outlive every capture
+const char* intern_zone_name(const std::string& name) {
+    static std::mutex mutex;
+    static auto* names = new std::unordered_set<std::string>();
+    std::lock_guard<std::mutex> lock(mutex);
+    return names->insert(name).first->c_str();
+}
+
+uint32_t default_worker_count() {
+    const uint32_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    return std::min(4u, hardware - 1);
+}
+
+}  // namespace
+
+struct TaskGraph::Impl {
+    struct Task {
+        TaskId id = INVALID_TASK_ID;
+        TaskDesc desc;
+        TaskFunction function;
+        const char* zone_name = nullptr;
+        Histogram* histogram = nullptr;
+
+        // Built per phase from the declared resources
+        std::vector<Task*> dependents;
+        uint32_t dependency_count = 0;
+        uint32_t pending = 0;  // Guarded by mutex during run()
+
+        uint64_t last_us = 0;
+        bool ran_on_worker = false;
+    };
+
+    TaskGraphConfig config;
+    std::vector<std::unique_ptr<Task>> tasks;  // Registration order
+    std::array<std::vector<Task*>, PHASE_COUNT> phases;
+    std::array<bool, PHASE_COUNT> phase_dirty{true, true};
+    TaskId next_id = 1;
+
+    // Execution state
+    std::mutex mutex;
+    std::condition_variable worker_cv;  // Worker tasks queued, or stopping
+    std::condition_variable frame_cv;   // Anything the frame thread may act on
+    std::deque<Task*> worker_queue;
+    std::deque<Task*> main_queue;
+    size_t remaining = 0;
+    double delta_time = 0.0;
+    bool stopping = false;
+    std::vector<std::thread> workers;
+    uint32_t worker_target = default_worker_count();
+
+    ~Impl() { stop_workers(); }
+
+    void start_workers() {
+        stopping = false;
+        workers.reserve(worker_target);
+        for (uint32_t i = 0; i < worker_target; ++i) {
+            workers.emplace_back([this] { worker_main(); });
+        }
+    }
+
+    void stop_workers() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        worker_cv.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+    }
+
+    void worker_main() {
+        REALCRAFT_PROFILE_THREAD("TaskWorker");
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            worker_cv.wait(lock, [this] { return stopping || !worker_queue.empty(); });
+            if (stopping) {
+                return;
+            }
+            Task* task = worker_queue.front();
+            worker_queue.pop_front();
+            const double dt = delta_time;
+
+            lock.unlock();
+            execute(*task, dt, true);
+            lock.lock();
+            complete(*task);
+        }
+    }
+
+    std::vector<Task*>& prepare(TaskPhase phase) {
+        const size_t index = phase_index(phase);
+        auto& list = phases[index];
+        if (!phase_dirty[index]) {
+            return list;
+        }
+
+        list.clear();
+        for (auto& task : tasks) {
+            if (task->desc.phase == phase) {
+                task->dependents.clear();
+                task->dependency_count = 0;
+                list.push_back(task.get());
+            }
+        }
+        for (size_t later = 0; later < list.size(); ++later) {
+            for (size_t earlier = 0; earlier < later; ++earlier) {
+                if (conflicts(list[earlier]->desc, list[later]->desc)) {
+                    list[earlier]->dependents.push_back(list[later]);
+                    ++list[later]->dependency_count;
+                }
+            }
+        }
+        phase_dirty[index] = false;
+        return list;
+    }
+
+    static void execute(Task& task, double dt, bool on_worker) {
+        REALCRAFT_PROFILE_ZONE(task.zone_name);
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            task.function(dt);
+        } catch (const std::exception& e) {
+            REALCRAFT_LOG_ERROR(log_category::ENGINE, "Task '{}' threw: {}", task.desc.name, e.what());
+        } catch (...) {
+            REALCRAFT_LOG_ERROR(log_category::ENGINE, "Task '{}' threw an unknown exception", task.desc.name);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        task.last_us = us > 0 ? static_cast<uint64_t>(us) : 0;
+        task.ran_on_worker = on_worker;
+        task.histogram->record(task.last_us);
+    }
+
+    // Both require the mutex to be held
+    void enqueue(Task& task) {
+        if (task.desc.main_thread) {
+            main_queue.push_back(&task);
+        } else {
+            worker_queue.push_back(&task);
+            worker_cv.notify_one();
+        }
+        frame_cv.notify_one();
+    }
+
+    void complete(Task& task) {
+        for (Task* dependent : task.dependents) {
+            if (--dependent->pending == 0) {
+                enqueue(*dependent);
+            }
+        }
+        if (--remaining == 0) {
+            frame_cv.notify_one();
+        }
+    }
+
+    Task* find(TaskId id) const {
+        for (const auto& task : tasks) {
+            if (task->id == id) {
+                return task.get();
+            }
+        }
+        return nullptr;
+    }
+};
+
+TaskGraph::TaskGraph() : impl_(std::make_unique<Impl>()) {}
+
+TaskGraph::~TaskGraph() = default;
+
+void TaskGraph::configure(const TaskGraphConfig& config) {
+    impl_->config = config;
+
+    const uint32_t target = config.worker_threads != 0 ? config.worker_threads : default_worker_count();
+    if (target != impl_->worker_target) {
+        impl_->stop_workers();
+        impl_->worker_target = target;
+    }
+}
+
+const TaskGraphConfig& TaskGraph::get_config() const {
+    return impl_->config;
+}
+
+void TaskGraph::set_deterministic(bool deterministic) {
+    impl_->config.deterministic = deterministic;
+}
+
+bool TaskGraph::is_deterministic() const {
+    return impl_->config.deterministic;
+}
+
+TaskId TaskGraph::add_task(const TaskDesc& desc, TaskFunction function) {
+    if (desc.name.empty() || !function) {
+        REALCRAFT_LOG_ERROR(log_category::ENGINE, "Task needs a name and a function");
+        return INVALID_TASK_ID;
+    }
+    for (const auto& task : impl_->tasks) {
+        if (task->desc.name == desc.name) {
+            REALCRAFT_LOG_ERROR(log_category::ENGINE, "Task '{}' is already registered", desc.name);
+            return INVALID_TASK_ID;
+        }
+    }
+
+    auto task = std::make_unique<Impl::Task>();
+    task->id = impl_->next_id++;
+    task->desc = desc;
+    task->function = std::move(function);
+    task->zone_name = intern_zone_name(desc.name);
+    task->histogram = &MetricsRegistry::instance().histogram("task." + desc.name + "_us");
+
+    const TaskId id = task->id;
+    impl_->tasks.push_back(std::move(task));
+    impl_->phase_dirty[phase_index(desc.phase)] = true;
+    return id;
+}
+
+void TaskGraph::remove_task(TaskId id) {
+    auto it = std::find_if(impl_->tasks.begin(), impl_->tasks.end(),
+                           [id](const std::unique_ptr<Impl::Task>& task) { return task->id == id; });
+    if (it == impl_->tasks.end()) {
+        return;
+    }
+    impl_->phase_dirty[phase_index((*it)->desc.phase)] = true;
+    impl_->tasks.erase(it);
+}
+
+void TaskGraph::clear() {
+    impl_->tasks.clear();
+    impl_->phase_dirty.fill(true);
+}
+
+size_t TaskGraph::task_count(TaskPhase phase) const {
+    return static_cast<size_t>(std::count_if(impl_->tasks.begin(), impl_->tasks.end(),
+                                             [phase](const auto& task) { return task->desc.phase == phase; }));
+}
+
+size_t TaskGraph::worker_count() const {
+    return impl_->worker_target;
+}
+
+void TaskGraph::run(TaskPhase phase, double delta_time) {
+    auto& list = impl_->prepare(phase);
+    if (list.empty()) {
+        return;
+    }
+
+    // Registration order is a valid topological order
+    if (impl_->config.deterministic) {
+        for (auto* task : list) {
+            Impl::execute(*task, delta_time, false);
+        }
+        return;
+    }
+
+    if (impl_->workers.empty() && impl_->worker_target > 0) {
+        impl_->start_workers();
+    }
+
+    std::unique_lock<std::mutex> lock(impl_->mutex);
+    impl_->delta_time = delta_time;
+    impl_->remaining = list.size();
+    for (auto* task : list) {
+        task->pending = task->dependency_count;
+    }
+    for (auto* task : list) {
+        if (task->pending == 0) {
+            impl_->enqueue(*task);
+        }
+    }
+
+    // The frame thread runs main-thread tasks and otherwise helps with the rest
+    while (impl_->remaining > 0) {
+        Impl::Task* task = nullptr;
+        if (!impl_->main_queue.empty()) {
+            task = impl_->main_queue.front();
+            impl_->main_queue.pop_front();
+        } else if (!impl_->worker_queue.empty()) {
+            task = impl_->worker_queue.front();
+            impl_->worker_queue.pop_front();
+        }
+
+        if (task == nullptr) {
+            impl_->frame_cv.wait(lock);
+            continue;
+        }
+
+        lock.unlock();
+        Impl::execute(*task, delta_time, false);
+        lock.lock();
+        impl_->complete(*task);
+    }
+}
+
+std::vector<std::string> TaskGraph::get_dependencies(TaskId id) const {
+    std::vector<std::string> names;
+    const auto* target = impl_->find(id);
+    if (target == nullptr) {
+        return names;
+    }
+    for (const auto& task : impl_->tasks) {
+        if (task.get() == target) {
+            break;
+        }
+        if (task->desc.phase == target->desc.phase && conflicts(task->desc, target->desc)) {
+            names.push_back(task->desc.name);
+        }
+    }
+    return names;
+}
+
+std::vector<TaskTiming> TaskGraph::get_timings() const {
+    std::vector<TaskTiming> timings;
+    timings.reserve(impl_->tasks.size());
+    for (const auto& task : impl_->tasks) {
+        timings.push_back({task->desc.name, task->desc.phase, task->last_us, task->ran_on_worker});
+    }
+    return timings;
+}
+
+}  // namespace realcraft::core
@@ -0,0 +1,214 @@
+// RealCraft Gameplay System
+// input_recording.cpp - Input recording file format
+
+#include <cstring>
+#include <fstream>
+#include <realcraft/core/logger.hpp>
+#include <realcraft/gameplay/input_recording.hpp>
+#include <realcraft/platform/file_io.hpp>
+#include <span>
+
+namespace realcraft::gameplay {
+
+namespace {
+
+// Fields are written one by one in host byte order; sizes are fixed so the
+// frame count follows from the file size
+constexpr size_t HEADER_SIZE = 4 + 4 + 4 + 4 + 4 + 8 + 3 * 8 + 4 + 4;
+constexpr size_t FRAME_SIZE = 3 * 4 + 4 + 4 + 1 + 1;
+
+class Writer {
+public:
+    template <typename T>
+    void value(T v) {
+        const auto* begin = reinterpret_cast<const char*>(&v);
+        data_.insert(data_.end(), begin, begin + sizeof(v));
+    }
+
+    [[nodiscard]] const std::vector<char>& data() const { return data_; }
+    void clear() { data_.clear(); }
+
+private:
+    std::vector<char> data_;
+};
+
+class Reader {
+public:
+    explicit Reader(std::span<const uint8_t> data) : data_(data) {}
+
+    template <typename T>
+    T value() {
+        T v{};
+        if (sizeof(v) <= data_.size() - offset_) {
+            std::memcpy(&v, data_.data() + offset_, sizeof(v));
+            offset_ += sizeof(v);
+        }
+        return v;
+    }
+
+private:
+    std::span<const uint8_t> data_;
+    size_t offset_ = 0;
+};
+
+void write_frame(Writer& w, const InputFrame& frame) {
+    w.value(frame.move_direction.x);
+    w.value(frame.move_direction.y);
+    w.value(frame.move_direction.z);
+    w.value(frame.camera_pitch);
+    w.value(frame.camera_yaw);
+    w.value(frame.buttons);
+    w.value(frame.hotbar_slot);
+}
+
+InputFrame read_frame(Reader& r) {
+    InputFrame frame;
+    frame.move_direction.x = r.value<float>();
+    frame.move_direction.y = r.value<float>();
+    frame.move_direction.z = r.value<float>();
+    frame.camera_pitch = r.value<float>();
+    frame.camera_yaw = r.value<float>();
+    frame.buttons = r.value<uint8_t>();
+    frame.hotbar_slot = r.value<uint8_t>();
+    return frame;
+}
+
+// Frames are buffered and written in batches of about one second
+constexpr size_t FLUSH_FRAMES = 60;
+
+}  // namespace
+
+// ============================================================================
+// Recorder
+// ============================================================================
+
+struct InputRecorder::Impl {
+    std::ofstream file;
+    std::filesystem::path path;
+    Writer pending;
+    size_t pending_frames = 0;
+    uint64_t frame_count = 0;
+
+    void flush() {
+        if (pending_frames == 0) {
+            return;
+        }
+        file.write(pending.data().data(), static_cast<std::streamsize>(pending.data().size()));
+        file.flush();
+        pending.clear();
+        pending_frames = 0;
+    }
+};
+
+InputRecorder::InputRecorder() : impl_(std::make_unique<Impl>()) {}
+
+InputRecorder::~InputRecorder() {
+    stop();
+}
+
+bool InputRecorder::start(const std::filesystem::path& path, const RecordingHeader& header) {
+    stop();
+
+    std::error_code ec;
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path(), ec);
+    }
+    impl_->file.open(path, std::ios::binary | std::ios::trunc);
+    if (!impl_->file) {
+        REALCRAFT_LOG_ERROR(core::log_category::GAME, "Failed to open input recording {}", path.string());
+        return false;
+    }
+
+    Writer w;
+    w.value(INPUT_RECORDING_MAGIC);
+    w.value(INPUT_RECORDING_VERSION);
+    w.value(header.world_seed);
+    w.value(header.gameplay_seed);
+    w.value(header.view_distance);
+    w.value(header.fixed_timestep);
+    w.value(header.spawn_position.x);
+    w.value(header.spawn_position.y);
+    w.value(header.spawn_position.z);
+    w.value(header.camera_pitch);
+    w.value(header.camera_yaw);
+    impl_->file.write(w.data().data(), static_cast<std::streamsize>(w.data().size()));
+    impl_->file.flush();
+
+    impl_->path = path;
+    impl_->frame_count = 0;
+    REALCRAFT_LOG_INFO(core::log_category::GAME, "Recording input to {} (world seed {}, gameplay seed {})",
+                       path.string(), header.world_seed, header.gameplay_seed);
+    return true;
+}
+
+void InputRecorder::stop() {
+    if (!impl_->file.is_open()) {
+        return;
+    }
+    impl_->flush();
+    impl_->file.close();
+    REALCRAFT_LOG_INFO(core::log_category::GAME, "Recorded {} input frames to {}", impl_->frame_count,
+                       impl_->path.string());
+}
+
+bool InputRecorder::is_recording() const {
+    return impl_->file.is_open();
+}
+
+void InputRecorder::record(const InputFrame& frame) {
+    if (!impl_->file.is_open()) {
+        return;
+    }
+    write_frame(impl_->pending, frame);
+    ++impl_->frame_count;
+    if (++impl_->pending_frames >= FLUSH_FRAMES) {
+        impl_->flush();
+    }
+}
+
+uint64_t InputRecorder::frame_count() const {
+    return impl_->frame_count;
+}
+
+// ============================================================================
+// Loading
+// ============================================================================
+
+std::optional<InputRecording> load_input_recording(const std::filesystem::path& path) {
+    auto data = platform::FileSystem::read_binary(path);
+    if (!data) {
+        return std::nullopt;
+    }
+    if (data->size() < HEADER_SIZE) {
+        REALCRAFT_LOG_ERROR(core::log_category::GAME, "Input recording {} is truncated", path.string());
+        return std::nullopt;
+    }
+
+    Reader r(*data);
+    if (r.value<uint32_t>() != INPUT_RECORDING_MAGIC || r.value<uint32_t>() != INPUT_RECORDING_VERSION) {
+        REALCRAFT_LOG_ERROR(core::log_category::GAME, "{} is not a version {} input recording", path.string(),
+                            INPUT_RECORDING_VERSION);
+        return std::nullopt;
+    }
+
+    InputRecording recording;
+    auto& header = recording.header;
+    header.world_seed = r.value<uint32_t>();
+    header.gameplay_seed = r.value<uint32_t>();
+    header.view_distance = r.value<int32_t>();
+    header.fixed_timestep = r.value<double>();
+    header.spawn_position.x = r.value<double>();
+    header.spawn_position.y = r.value<double>();
+    header.spawn_position.z = r.value<double>();
+    header.camera_pitch = r.value<float>();
+    header.camera_yaw = r.value<float>();
+
+    const size_t frame_count = (data->size() - HEADER_SIZE) / FRAME_SIZE;
+    recording.frames.reserve(frame_count);
+    for (size_t i = 0; i < frame_count; ++i) {
+        recording.frames.push_back(read_frame(r));
+    }
+    return recording;
+}
+
+}  // namespace realcraft::gameplay
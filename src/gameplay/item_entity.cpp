@@ -3,23 +3,289 @@
 
 #include <algorithm>
 #include <cmath>
+#include <mutex>
 #include <random>
 #include <realcraft/core/logger.hpp>
 #include <realcraft/gameplay/item_entity.hpp>
 #include <realcraft/physics/physics_world.hpp>
 #include <realcraft/world/world_manager.hpp>
+#include <unordered_map>
 
 namespace realcraft::gameplay {
 
+namespace {
+
+// Entity IDs are (generation << SLOT_BITS) | slot. Generations start at 1,
+// so no ID is ever 0, and a recycled slot never matches an older ID.
+constexpr uint32_t SLOT_BITS = 20;
+constexpr uint32_t SLOT_MASK = (1u << SLOT_BITS) - 1;
+constexpr uint32_t MAX_GENERATION = (1u << (32 - SLOT_BITS)) - 1;
+constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+enum EntityFlags : uint8_t {
+    FLAG_ALIVE = 1 << 0,
+    FLAG_ON_GROUND = 1 << 1,
+    FLAG_SLEEPING = 1 << 2,
+    FLAG_REMOVED = 1 << 3,  // Removal deferred until the end of update()
+};
+
+// Spatial hash cell of a position; wrapping far coordinates only costs extra distance checks
+uint64_t cell_key(int64_t x, int64_t y, int64_t z) {
+    return (static_cast<uint64_t>(x) & 0xFFFFFF) | ((static_cast<uint64_t>(z) & 0xFFFFFF) << 24) |
+           ((static_cast<uint64_t>(y) & 0xFFFF) << 48);
+}
+
+int64_t cell_coord(double value) {
+    return static_cast<int64_t>(std::floor(value / ItemEntity::GRID_CELL_SIZE));
+}
+
+uint64_t cell_of(const glm::dvec3& position) {
+    return cell_key(cell_coord(position.x), cell_coord(position.y), cell_coord(position.z));
+}
+
+}  // namespace
+
 // ============================================================================
 // Implementation Details
 // ============================================================================
 
 struct ItemEntityManager::Impl {
-    std::vector<ItemEntity> entities;
-    uint32_t next_id = 1;
+    // Structure-of-arrays storage, indexed by slot
+    std::vector<glm::dvec3> position;
+    std::vector<glm::dvec3> velocity;
+    std::vector<ItemStack> item;
+    std::vector<double> spawn_time;
+    std::vector<uint64_t> cell;
+    std::vector<uint32_t> generation;
+    std::vector<uint8_t> flags;
+    std::vector<uint32_t> awake_index;  // Position in `awake`, or NO_SLOT while sleeping
+    std::vector<uint32_t> older;        // Spawn-order links
+    std::vector<uint32_t> newer;
+
+    std::vector<uint32_t> free_slots;
+    std::vector<uint32_t> awake;         // Slots simulated this tick
+    std::vector<uint32_t> merge_queue;   // Slots that just fell asleep and still need a merge check
+    std::vector<uint32_t> pending_removal;
+    uint32_t oldest = NO_SLOT;
+    uint32_t newest = NO_SLOT;
+    size_t count = 0;
+
+    // Uniform spatial hash over all live entities
+    std::unordered_map<uint64_t, std::vector<uint32_t>> grid;
+
     double current_time = 0.0;
     std::mt19937 rng{std::random_device{}()};
+
+    // Block positions whose support went away, queued by on_block_changed
+    std::mutex wake_mutex;
+    std::vector<world::WorldBlockPos> pending_wakes;
+
+    [[nodiscard]] uint32_t make_id(uint32_t slot) const { return (generation[slot] << SLOT_BITS) | slot; }
+
+    [[nodiscard]] uint32_t resolve(uint32_t id) const {
+        const uint32_t slot = id & SLOT_MASK;
+        if (slot >= flags.size() || (flags[slot] & (FLAG_ALIVE | FLAG_REMOVED)) != FLAG_ALIVE ||
+            generation[slot] != (id >> SLOT_BITS)) {
+            return NO_SLOT;
+        }
+        return slot;
+    }
+
+    [[nodiscard]] bool can_pickup(uint32_t slot, double delay) const {
+        return (current_time - spawn_time[slot]) >= delay;
+    }
+
+    uint32_t allocate() {
+        uint32_t slot;
+        if (!free_slots.empty()) {
+            slot = free_slots.back();
+            free_slots.pop_back();
+        } else {
+            slot = static_cast<uint32_t>(flags.size());
+            position.emplace_back(0.0);
+            velocity.emplace_back(0.0);
+            item.emplace_back();
+            spawn_time.push_back(0.0);
+            cell.push_back(0);
+            generation.push_back(0);
+            flags.push_back(0);
+            awake_index.push_back(NO_SLOT);
+            older.push_back(NO_SLOT);
+            newer.push_back(NO_SLOT);
+        }
+        generation[slot] = generation[slot] >= MAX_GENERATION ? 1 : generation[slot] + 1;
+        return slot;
+    }
+
+    void grid_insert(uint32_t slot) { grid[cell[slot]].push_back(slot); }
+
+    void grid_remove(uint32_t slot) {
+        auto it = grid.find(cell[slot]);
+        if (it == grid.end()) {
+            return;
+        }
+        auto& slots = it->second;
+        auto pos = std::find(slots.begin(), slots.end(), slot);
+        if (pos != slots.end()) {
+            *pos = slots.back();
+            slots.pop_back();
+        }
+        if (slots.empty()) {
+            grid.erase(it);
+        }
+    }
+
+    void grid_move(uint32_t slot) {
+        const uint64_t key = cell_of(position[slot]);
+        if (key != cell[slot]) {
+            grid_remove(slot);
+            cell[slot] = key;
+            grid_insert(slot);
+        }
+    }
+
+    // Visit every live slot whose cell overlaps the cube of `radius` around `center`
+    template <typename Fn>
+    void query(const glm::dvec3& center, double radius, Fn&& fn) const {
+        const int64_t x0 = cell_coord(center.x - radius), x1 = cell_coord(center.x + radius);
+        const int64_t y0 = cell_coord(center.y - radius), y1 = cell_coord(center.y + radius);
+        const int64_t z0 = cell_coord(center.z - radius), z1 = cell_coord(center.z + radius);
+        for (int64_t y = y0; y <= y1; ++y) {
+            for (int64_t z = z0; z <= z1; ++z) {
+                for (int64_t x = x0; x <= x1; ++x) {
+                    auto it = grid.find(cell_key(x, y, z));
+                    if (it == grid.end()) {
+                        continue;
+                    }
+                    for (uint32_t slot : it->second) {
+                        if ((flags[slot] & FLAG_REMOVED) == 0) {
+                            fn(slot);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void set_awake(uint32_t slot) {
+        if (awake_index[slot] != NO_SLOT) {
+            return;
+        }
+        flags[slot] = static_cast<uint8_t>(flags[slot] & ~FLAG_SLEEPING);
+        awake_index[slot] = static_cast<uint32_t>(awake.size());
+        awake.push_back(slot);
+    }
+
+    void set_asleep(uint32_t slot) {
+        const uint32_t index = awake_index[slot];
+        if (index == NO_SLOT) {
+            return;
+        }
+        const uint32_t moved = awake.back();
+        awake[index] = moved;
+        awake_index[moved] = index;
+        awake.pop_back();
+        awake_index[slot] = NO_SLOT;
+        flags[slot] |= FLAG_SLEEPING;
+    }
+
+    void link_newest(uint32_t slot) {
+        older[slot] = newest;
+        newer[slot] = NO_SLOT;
+        if (newest != NO_SLOT) {
+            newer[newest] = slot;
+        } else {
+            oldest = slot;
+        }
+        newest = slot;
+    }
+
+    void unlink(uint32_t slot) {
+        if (older[slot] != NO_SLOT) {
+            newer[older[slot]] = newer[slot];
+        } else {
+            oldest = newer[slot];
+        }
+        if (newer[slot] != NO_SLOT) {
+            older[newer[slot]] = older[slot];
+        } else {
+            newest = older[slot];
+        }
+        older[slot] = NO_SLOT;
+        newer[slot] = NO_SLOT;
+    }
+
+    // Remove immediately; not valid while update() is iterating
+    void destroy(uint32_t slot) {
+        set_asleep(slot);
+        grid_remove(slot);
+        unlink(slot);
+        item[slot] = ItemStack{};
+        flags[slot] = 0;
+        free_slots.push_back(slot);
+        --count;
+    }
+
+    // Remove at the end of the current update()
+    void defer_destroy(uint32_t slot) {
+        if ((flags[slot] & FLAG_REMOVED) == 0) {
+            flags[slot] |= FLAG_REMOVED;
+            pending_removal.push_back(slot);
+        }
+    }
+
+    void reserve(size_t capacity) {
+        position.reserve(capacity);
+        velocity.reserve(capacity);
+        item.reserve(capacity);
+        spawn_time.reserve(capacity);
+        cell.reserve(capacity);
+        generation.reserve(capacity);
+        flags.reserve(capacity);
+        awake_index.reserve(capacity);
+        older.reserve(capacity);
+        newer.reserve(capacity);
+        awake.reserve(capacity);
+    }
+
+    [[nodiscard]] ItemEntity snapshot(uint32_t slot, const ItemEntityConfig& config) const {
+        const double age = current_time - spawn_time[slot];
+        ItemEntity entity;
+        entity.id = make_id(slot);
+        entity.position = position[slot];
+        entity.velocity = velocity[slot];
+        entity.item = item[slot];
+        entity.spawn_time = spawn_time[slot];
+        entity.lifetime = config.default_lifetime;
+        entity.rotation = ItemEntity::ROTATION_SPEED * static_cast<float>(age);
+        entity.bob_offset =
+            std::sin(static_cast<float>(current_time) * ItemEntity::BOB_SPEED) * ItemEntity::BOB_AMPLITUDE;
+        entity.on_ground = (flags[slot] & FLAG_ON_GROUND) != 0;
+        entity.can_pickup = age >= config.pickup_delay;
+        entity.sleeping = (flags[slot] & FLAG_SLEEPING) != 0;
+        return entity;
+    }
+
+    void reset() {
+        position.clear();
+        velocity.clear();
+        item.clear();
+        spawn_time.clear();
+        cell.clear();
+        generation.clear();
+        flags.clear();
+        awake_index.clear();
+        older.clear();
+        newer.clear();
+        free_slots.clear();
+        awake.clear();
+        merge_queue.clear();
+        pending_removal.clear();
+        grid.clear();
+        oldest = NO_SLOT;
+        newest = NO_SLOT;
+        count = 0;
+    }
 };
 
 // ============================================================================
@@ -34,9 +300,6 @@ ItemEntityManager::~ItemEntityManager() {
     }
 }
 
-ItemEntityManager::ItemEntityManager(ItemEntityManager&&) noexcept = default;
-ItemEntityManager& ItemEntityManager::operator=(ItemEntityManager&&) noexcept = default;
-
 bool ItemEntityManager::initialize(physics::PhysicsWorld* physics_world, world::WorldManager* world_manager,
                                    Inventory* player_inventory, const ItemEntityConfig& config) {
     if (initialized_) {
@@ -53,8 +316,12 @@ bool ItemEntityManager::initialize(physics::PhysicsWorld* physics_world, world::
     world_manager_ = world_manager;
     player_inventory_ = player_inventory;
     config_ = config;
+    impl_->rng.seed(config_.seed != 0 ? config_.seed : std::random_device{}());
 
-    impl_->entities.reserve(config_.max_entities);
+    impl_->reserve(config_.max_entities);
+    if (world_manager_ != nullptr) {
+        world_manager_->add_observer(this);
+    }
     initialized_ = true;
 
     REALCRAFT_LOG_INFO(core::log_category::GAME, "ItemEntityManager initialized (max {} entities)",
@@ -67,7 +334,14 @@ void ItemEntityManager::shutdown() {
         return;
     }
 
-    impl_->entities.clear();
+    if (world_manager_ != nullptr) {
+        world_manager_->remove_observer(this);
+    }
+    {
+        std::lock_guard<std::mutex> lock(impl_->wake_mutex);
+        impl_->pending_wakes.clear();
+    }
+    impl_->reset();
     physics_world_ = nullptr;
     world_manager_ = nullptr;
     player_inventory_ = nullptr;
@@ -83,35 +357,40 @@ void ItemEntityManager::update(double dt, const glm::dvec3& player_position) {
 
     impl_->current_time += dt;
 
-    // Update each entity
-    for (auto& entity : impl_->entities) {
-        if (entity.marked_for_removal) {
-            continue;
-        }
-
-        // Update pickup availability
-        if (!entity.can_pickup && (impl_->current_time - entity.spawn_time) >= ItemEntity::PICKUP_DELAY) {
-            entity.can_pickup = true;
-        }
+    // Items resting on blocks removed since the last update start falling
+    std::vector<world::WorldBlockPos> wakes;
+    {
+        std::lock_guard<std::mutex> lock(impl_->wake_mutex);
+        wakes.swap(impl_->pending_wakes);
+    }
+    for (const auto& pos : wakes) {
+        wake_items_near(glm::dvec3(pos.x, pos.y, pos.z) + glm::dvec3(0.5), 1.5);
+    }
 
-        // Update physics
-        if (config_.enable_physics) {
-            update_physics(entity, dt);
+    // Simulate awake entities only; sleeping ones cost nothing until woken.
+    // Rotation and bob are derived from time when a snapshot is taken.
+    if (config_.enable_physics) {
+        auto& awake = impl_->awake;
+        for (size_t i = 0; i < awake.size();) {
+            const uint32_t slot = awake[i];
+            update_physics(slot, dt);
+            impl_->grid_move(slot);
+
+            // Falling asleep swaps another slot into position i
+            if (i < awake.size() && awake[i] == slot) {
+                ++i;
+            }
         }
-
-        // Update visual effects
-        entity.rotation += ItemEntity::ROTATION_SPEED * static_cast<float>(dt);
-        entity.bob_offset =
-            std::sin(static_cast<float>(impl_->current_time) * ItemEntity::BOB_SPEED) * ItemEntity::BOB_AMPLITUDE;
-
-        // Check for pickup
-        update_pickup(entity, player_position, impl_->current_time);
     }
 
+    // Check for pickup
+    update_pickup(player_position);
+
     // Merge nearby identical items
     if (config_.enable_merging) {
         update_merging();
     }
+    impl_->merge_queue.clear();
 
     // Remove expired/picked up entities
     cleanup_entities(impl_->current_time);
@@ -122,36 +401,37 @@ uint32_t ItemEntityManager::spawn_item(const glm::dvec3& position, const ItemSta
         return 0;
     }
 
-    // Check entity limit
-    if (impl_->entities.size() >= config_.max_entities) {
-        // Remove oldest entity to make room
-        if (!impl_->entities.empty()) {
-            impl_->entities.erase(impl_->entities.begin());
-        }
+    // Check entity limit; the spawn-order list makes evicting the oldest O(1)
+    if (impl_->count >= config_.max_entities && impl_->oldest != NO_SLOT) {
+        impl_->destroy(impl_->oldest);
+    }
+    if (impl_->free_slots.empty() && impl_->flags.size() > SLOT_MASK) {
+        return 0;
     }
 
-    ItemEntity entity;
-    entity.id = impl_->next_id++;
-    entity.position = position;
-    entity.velocity = velocity;
-    entity.item = item;
-    entity.spawn_time = impl_->current_time;
-    entity.lifetime = config_.default_lifetime;
-    entity.rotation = 0.0f;
-    entity.bob_offset = 0.0f;
-    entity.on_ground = false;
-    entity.can_pickup = false;
-    entity.marked_for_removal = false;
-
-    impl_->entities.push_back(entity);
-
-    REALCRAFT_LOG_DEBUG(core::log_category::GAME, "Spawned item entity {} at ({:.1f}, {:.1f}, {:.1f})", entity.id,
+    const uint32_t slot = impl_->allocate();
+    impl_->position[slot] = position;
+    impl_->velocity[slot] = velocity;
+    impl_->item[slot] = item;
+    impl_->spawn_time[slot] = impl_->current_time;
+    impl_->flags[slot] = FLAG_ALIVE;
+    impl_->cell[slot] = cell_of(position);
+    impl_->grid_insert(slot);
+    impl_->link_newest(slot);
+    impl_->set_awake(slot);
+    ++impl_->count;
+
+    const uint32_t id = impl_->make_id(slot);
+    REALCRAFT_LOG_DEBUG(core::log_category::GAME, "Spawned item entity {} at ({:.1f}, {:.1f}, {:.1f})", id,
                         position.x, position.y, position.z);
 
-    return entity.id;
+    return id;
 }
 
 void ItemEntityManager::spawn_block_drops(const glm::dvec3& position, world::BlockId block_id) {
+    // Items resting on the broken block must fall
+    wake_items_near(position + glm::dvec3(0.5), 1.5);
+
     // Create item stack for this block
     ItemStack item = ItemRegistry::instance().create_block_item(block_id, 1);
     if (item.is_empty()) {
@@ -179,177 +459,231 @@ uint32_t ItemEntityManager::spawn_item_scattered(const glm::dvec3& position, con
     return spawn_item(position, item, velocity);
 }
 
+void ItemEntityManager::wake_items_near(const glm::dvec3& position, double radius) {
+    impl_->query(position, radius, [this](uint32_t slot) {
+        if ((impl_->flags[slot] & FLAG_SLEEPING) != 0) {
+            impl_->flags[slot] = static_cast<uint8_t>(impl_->flags[slot] & ~FLAG_ON_GROUND);
+            impl_->set_awake(slot);
+        }
+    });
+}
+
+void ItemEntityManager::on_block_changed(const world::BlockChangeEvent& event) {
+    if (event.from_generation) {
+        return;
+    }
+
+    // Still something items can rest on (same test as the ground check)
+    const world::BlockType* block = world::BlockRegistry::instance().get(event.new_entry.block_id);
+    if (block != nullptr && block->is_solid() && !block->is_liquid()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(impl_->wake_mutex);
+    impl_->pending_wakes.push_back(event.position);
+}
+
 size_t ItemEntityManager::entity_count() const {
-    return impl_->entities.size();
+    return impl_->count;
 }
 
-const std::vector<ItemEntity>& ItemEntityManager::get_entities() const {
-    return impl_->entities;
+size_t ItemEntityManager::sleeping_count() const {
+    return impl_->count - impl_->awake.size();
 }
 
-const ItemEntity* ItemEntityManager::find_entity(uint32_t id) const {
-    for (const auto& entity : impl_->entities) {
-        if (entity.id == id) {
-            return &entity;
+void ItemEntityManager::for_each_entity(const std::function<void(const ItemEntity&)>& callback) const {
+    for (uint32_t slot = impl_->oldest; slot != NO_SLOT; slot = impl_->newer[slot]) {
+        if ((impl_->flags[slot] & FLAG_REMOVED) == 0) {
+            callback(impl_->snapshot(slot, config_));
         }
     }
-    return nullptr;
+}
+
+std::optional<ItemEntity> ItemEntityManager::find_entity(uint32_t id) const {
+    const uint32_t slot = impl_->resolve(id);
+    if (slot == NO_SLOT) {
+        return std::nullopt;
+    }
+    return impl_->snapshot(slot, config_);
 }
 
 bool ItemEntityManager::pickup_entity(uint32_t id) {
-    for (auto& entity : impl_->entities) {
-        if (entity.id == id && !entity.marked_for_removal) {
-            // Try to add to inventory
-            ItemStack remaining = player_inventory_->add_item(entity.item);
-            if (remaining.is_empty()) {
-                entity.marked_for_removal = true;
-                REALCRAFT_LOG_DEBUG(core::log_category::GAME, "Picked up item entity {}", id);
-                return true;
-            }
-            // Partial pickup
-            entity.item = remaining;
-            return false;
-        }
+    const uint32_t slot = impl_->resolve(id);
+    if (slot == NO_SLOT || player_inventory_ == nullptr) {
+        return false;
     }
+
+    // Try to add to inventory
+    ItemStack remaining = player_inventory_->add_item(impl_->item[slot]);
+    if (remaining.is_empty()) {
+        impl_->destroy(slot);
+        REALCRAFT_LOG_DEBUG(core::log_category::GAME, "Picked up item entity {}", id);
+        return true;
+    }
+    // Partial pickup
+    impl_->item[slot] = remaining;
     return false;
 }
 
 void ItemEntityManager::remove_entity(uint32_t id) {
-    for (auto& entity : impl_->entities) {
-        if (entity.id == id) {
-            entity.marked_for_removal = true;
-            return;
-        }
+    const uint32_t slot = impl_->resolve(id);
+    if (slot != NO_SLOT) {
+        impl_->destroy(slot);
     }
 }
 
 void ItemEntityManager::clear() {
-    impl_->entities.clear();
+    // Destroy slot by slot so generations survive and old IDs stay invalid
+    while (impl_->oldest != NO_SLOT) {
+        impl_->destroy(impl_->oldest);
+    }
+    impl_->merge_queue.clear();
+    impl_->pending_removal.clear();
 }
 
 // ============================================================================
 // Private Methods
 // ============================================================================
 
-void ItemEntityManager::update_physics(ItemEntity& entity, double dt) {
+void ItemEntityManager::update_physics(uint32_t slot, double dt) {
+    auto& velocity = impl_->velocity[slot];
+    auto& flags = impl_->flags[slot];
+
     // Apply gravity if not on ground
-    if (!entity.on_ground) {
-        entity.velocity.y -= ItemEntity::GRAVITY * dt;
+    if ((flags & FLAG_ON_GROUND) == 0) {
+        velocity.y -= ItemEntity::GRAVITY * dt;
     }
 
     // Apply air resistance
-    entity.velocity *= (1.0 - ItemEntity::AIR_RESISTANCE);
+    velocity *= (1.0 - ItemEntity::AIR_RESISTANCE);
 
     // Update position
-    glm::dvec3 new_position = entity.position + entity.velocity * dt;
+    glm::dvec3 new_position = impl_->position[slot] + velocity * dt;
 
     // Check ground collision
-    if (check_ground_collision(entity)) {
-        entity.on_ground = true;
-        entity.velocity.y = 0.0;
-        entity.velocity.x *= ItemEntity::GROUND_FRICTION;
-        entity.velocity.z *= ItemEntity::GROUND_FRICTION;
+    if (check_ground_collision(slot)) {
+        flags |= FLAG_ON_GROUND;
+        velocity.y = 0.0;
+        velocity.x *= ItemEntity::GROUND_FRICTION;
+        velocity.z *= ItemEntity::GROUND_FRICTION;
 
         // Stop movement if slow enough
-        if (glm::length(entity.velocity) < 0.1) {
-            entity.velocity = glm::dvec3(0.0);
+        if (glm::length(velocity) < 0.1) {
+            velocity = glm::dvec3(0.0);
+
+            // At rest and pickable: sleep until woken, after one last merge check
+            if (impl_->can_pickup(slot, config_.pickup_delay)) {
+                impl_->set_asleep(slot);
+                impl_->merge_queue.push_back(slot);
+            }
         }
     } else {
-        entity.on_ground = false;
-        entity.position = new_position;
+        flags = static_cast<uint8_t>(flags & ~FLAG_ON_GROUND);
+        impl_->position[slot] = new_position;
     }
 }
 
-void ItemEntityManager::update_pickup(ItemEntity& entity, const glm::dvec3& player_position, double current_time) {
-    if (!entity.can_pickup || entity.marked_for_removal) {
-        return;
-    }
+void ItemEntityManager::update_pickup(const glm::dvec3& player_position) {
+    impl_->query(player_position, config_.pickup_radius, [&](uint32_t slot) {
+        if (!impl_->can_pickup(slot, config_.pickup_delay)) {
+            return;
+        }
 
-    // Check distance to player
-    double distance = glm::length(entity.position - player_position);
-    if (distance > config_.pickup_radius) {
-        return;
-    }
+        // Check distance to player
+        double distance = glm::length(impl_->position[slot] - player_position);
+        if (distance > config_.pickup_radius) {
+            return;
+        }
 
-    // Try to add to inventory
-    ItemStack remaining = player_inventory_->add_item(entity.item);
-    if (remaining.is_empty()) {
-        entity.marked_for_removal = true;
-        REALCRAFT_LOG_DEBUG(core::log_category::GAME, "Auto-picked up item entity {} ({}x)", entity.id,
-                            entity.item.count);
-    } else if (remaining.count < entity.item.count) {
-        // Partial pickup
-        REALCRAFT_LOG_DEBUG(core::log_category::GAME, "Partial pickup of item entity {}: {} -> {}", entity.id,
-                            entity.item.count, remaining.count);
-        entity.item = remaining;
-    }
+        // Try to add to inventory
+        ItemStack& item = impl_->item[slot];
+        ItemStack remaining = player_inventory_->add_item(item);
+        if (remaining.is_empty()) {
+            impl_->defer_destroy(slot);
+            REALCRAFT_LOG_DEBUG(core::log_category::GAME, "Auto-picked up item entity {} ({}x)",
+                                impl_->make_id(slot), item.count);
+        } else if (remaining.count < item.count) {
+            // Partial pickup
+            REALCRAFT_LOG_DEBUG(core::log_category::GAME, "Partial pickup of item entity {}: {} -> {}",
+                                impl_->make_id(slot), item.count, remaining.count);
+            item = remaining;
+        }
+    });
 }
 
 void ItemEntityManager::update_merging() {
-    // Check pairs of entities for merging
-    for (size_t i = 0; i < impl_->entities.size(); ++i) {
-        ItemEntity& a = impl_->entities[i];
-        if (a.marked_for_removal || !a.can_pickup) {
-            continue;
+    // Awake entities look for merge partners every tick; sleeping entities
+    // only once, when they come to rest. Any pair with one awake member is
+    // found by that member, so no sleeping pair is ever rechecked.
+    auto merge_into = [this](uint32_t a) {
+        if ((impl_->flags[a] & FLAG_REMOVED) != 0 || !impl_->can_pickup(a, config_.pickup_delay)) {
+            return;
         }
 
-        for (size_t j = i + 1; j < impl_->entities.size(); ++j) {
-            ItemEntity& b = impl_->entities[j];
-            if (b.marked_for_removal || !b.can_pickup) {
-                continue;
+        impl_->query(impl_->position[a], ItemEntity::MERGE_RADIUS, [&](uint32_t b) {
+            if (b == a || !impl_->can_pickup(b, config_.pickup_delay)) {
+                return;
             }
 
             // Check if same item type and can stack
-            if (a.item.item_id != b.item.item_id) {
-                continue;
+            ItemStack& item_a = impl_->item[a];
+            ItemStack& item_b = impl_->item[b];
+            if (item_a.item_id != item_b.item_id) {
+                return;
             }
-            if (!a.item.can_merge(b.item)) {
-                continue;
+            if (!item_a.can_merge(item_b)) {
+                return;
             }
 
             // Check distance
-            double distance = glm::length(a.position - b.position);
+            double distance = glm::length(impl_->position[a] - impl_->position[b]);
             if (distance > ItemEntity::MERGE_RADIUS) {
-                continue;
+                return;
             }
 
             // Merge b into a
-            uint16_t overflow = a.item.add(b.item.count);
+            uint16_t overflow = item_a.add(item_b.count);
             if (overflow == 0) {
                 // Fully merged
-                b.marked_for_removal = true;
+                impl_->defer_destroy(b);
             } else {
                 // Partial merge
-                b.item.count = overflow;
+                item_b.count = overflow;
             }
-        }
+        });
+    };
+
+    for (size_t i = 0; i < impl_->awake.size(); ++i) {
+        merge_into(impl_->awake[i]);
+    }
+    for (uint32_t slot : impl_->merge_queue) {
+        merge_into(slot);
     }
 }
 
 void ItemEntityManager::cleanup_entities(double current_time) {
-    impl_->entities.erase(std::remove_if(impl_->entities.begin(), impl_->entities.end(),
-                                         [current_time](const ItemEntity& entity) {
-                                             // Remove if marked or expired
-                                             if (entity.marked_for_removal) {
-                                                 return true;
-                                             }
-                                             if ((current_time - entity.spawn_time) >= entity.lifetime) {
-                                                 REALCRAFT_LOG_DEBUG(core::log_category::GAME,
-                                                                     "Item entity {} despawned (expired)", entity.id);
-                                                 return true;
-                                             }
-                                             return false;
-                                         }),
-                          impl_->entities.end());
+    // Remove picked up and merged entities
+    for (uint32_t slot : impl_->pending_removal) {
+        impl_->destroy(slot);
+    }
+    impl_->pending_removal.clear();
+
+    // Lifetimes are uniform, so expired entities are always the oldest ones
+    while (impl_->oldest != NO_SLOT && (current_time - impl_->spawn_time[impl_->oldest]) >= config_.default_lifetime) {
+        REALCRAFT_LOG_DEBUG(core::log_category::GAME, "Item entity {} despawned (expired)",
+                            impl_->make_id(impl_->oldest));
+        impl_->destroy(impl_->oldest);
+    }
 }
 
-bool ItemEntityManager::check_ground_collision(ItemEntity& entity) {
+bool ItemEntityManager::check_ground_collision(uint32_t slot) {
     // Simple ground check - check block below
-    glm::dvec3 feet_pos = entity.position - glm::dvec3(0.0, 0.1, 0.0);
+    glm::dvec3& position = impl_->position[slot];
+    glm::dvec3 feet_pos = position - glm::dvec3(0.0, 0.1, 0.0);
 
     if (is_position_solid(feet_pos)) {
         // Snap to top of block
-        entity.position.y = std::floor(entity.position.y) + 0.25;  // Slight offset for visual
+        position.y = std::floor(position.y) + 0.25;  // Slight offset for visual
         return true;
     }
 
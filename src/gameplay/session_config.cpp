@@ -0,0 +1,34 @@
+// RealCraft Gameplay System
+// session_config.cpp - Default gameplay tuning
+
+#include <realcraft/gameplay/session_config.hpp>
+
+namespace realcraft::gameplay {
+
+SessionConfig default_session_config() {
+    SessionConfig config;
+
+    config.physics.gravity = glm::dvec3(0.0, -9.81, 0.0);
+    config.physics.fixed_timestep = 1.0 / 60.0;
+
+    config.player.capsule_radius = 0.4;
+    config.player.capsule_height = 1.8;
+    config.player.eye_height = 1.6;
+    config.player.walk_speed = 4.3;
+    config.player.sprint_speed = 5.6;
+    config.player.jump_height = 1.25;
+    config.player.gravity = 32.0;
+
+    config.interaction.reach_distance = 5.0;
+    config.interaction.base_break_speed = 1.0;
+
+    config.inventory.creative_mode = false;  // Survival mode - consume items when placing
+    config.inventory.pickup_radius = 2.0;
+
+    config.item_entity.max_entities = 500;
+    config.item_entity.pickup_radius = 2.0;
+
+    return config;
+}
+
+}  // namespace realcraft::gameplay
@@ -0,0 +1,584 @@
+// RealCraft Graphics Abstraction Layer
+// shader_cache.cpp - Persistent shader cache implementation
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <realcraft/graphics/shader_cache.hpp>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace realcraft::graphics {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr const char* ENTRY_EXTENSION = ".rcshader";
+
+// ============================================================================
+// Key Hashing
+// ============================================================================
+
+// Two independent FNV-1a lanes, giving a 128-bit key
+struct KeyHasher {
+    uint64_t a = 14695981039346656037ull;
+    uint64_t b = 0x6c62272e07bb0142ull;
+
+    void add(std::string_view data) {
+        for (char c : data) {
+            const auto byte = static_cast<uint8_t>(c);
+            a = (a ^ byte) * 1099511628211ull;
+            b = (b ^ static_cast<uint8_t>(byte ^ 0x5Au)) * 0x100000001b3ull;
+            b ^= b >> 29;
+        }
+        // Length-terminate so adjacent fields cannot run together
+        const uint64_t size = data.size();
+        for (int i = 0; i < 8; ++i) {
+            a = (a ^ ((size >> (i * 8)) & 0xFFu)) * 1099511628211ull;
+        }
+    }
+
+    [[nodiscard]] std::string hex() const {
+        static constexpr char digits[] = "0123456789abcdef";
+        std::string out(32, '0');
+        for (int i = 0; i < 16; ++i) {
+            out[static_cast<size_t>(i)] = digits[(a >> (60 - i * 4)) & 0xF];
+            out[static_cast<size_t>(16 + i)] = digits[(b >> (60 - i * 4)) & 0xF];
+        }
+        return out;
+    }
+};
+
+std::optional<std::string> read_file_text(const fs::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return std::nullopt;
+    }
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+// Names referenced by `#include "x"` / `#include <x>` directives
+std::vector<std::string> find_includes(std::string_view source) {
+    std::vector<std::string> names;
+    size_t pos = 0;
+    while ((pos = source.find("#include", pos)) != std::string_view::npos) {
+        pos += 8;
+        const size_t open = source.find_first_of("\"<\n", pos);
+        if (open == std::string_view::npos || source[open] == '\n') {
+            continue;
+        }
+        const char close_char = source[open] == '"' ? '"' : '>';
+        const size_t close = source.find_first_of(std::string{close_char, '\n'}, open + 1);
+        if (close == std::string_view::npos || source[close] == '\n') {
+            continue;
+        }
+        names.emplace_back(source.substr(open + 1, close - open - 1));
+        pos = close;
+    }
+    return names;
+}
+
+// Hash every file reachable through #include, in discovery order. Names that
+// do not resolve are hashed as-is, so adding the file later changes the key.
+void hash_include_closure(KeyHasher& hasher, std::string_view source, const std::vector<std::string>& include_paths,
+                          std::unordered_set<std::string>& visited) {
+    for (const auto& name : find_includes(source)) {
+        std::optional<std::string> content;
+        fs::path resolved;
+        for (const auto& dir : include_paths) {
+            resolved = fs::path(dir) / name;
+            content = read_file_text(resolved);
+            if (content) {
+                break;
+            }
+        }
+
+        hasher.add(name);
+        if (!content) {
+            hasher.add("<unresolved>");
+            continue;
+        }
+        if (!visited.insert(resolved.lexically_normal().string()).second) {
+            continue;
+        }
+        hasher.add(*content);
+        hash_include_closure(hasher, *content, include_paths, visited);
+    }
+}
+
+// ============================================================================
+// Entry Serialization
+// ============================================================================
+
+class EntryWriter {
+public:
+    void u32(uint32_t value) { append(&value, sizeof(value)); }
+    void u64(uint64_t value) { append(&value, sizeof(value)); }
+    void size(size_t value) { u64(static_cast<uint64_t>(value)); }
+
+    void bytes(std::span<const uint8_t> data) {
+        size(data.size());
+        append(data.data(), data.size());
+    }
+
+    void string(std::string_view text) {
+        size(text.size());
+        append(text.data(), text.size());
+    }
+
+    void members(const std::vector<ShaderUniformMember>& list) {
+        size(list.size());
+        for (const auto& member : list) {
+            string(member.name);
+            string(member.type_name);
+            size(member.offset);
+            size(member.size);
+            u32(member.array_size);
+        }
+    }
+
+    void stage_io(const std::vector<ShaderStageInput>& list) {
+        size(list.size());
+        for (const auto& io : list) {
+            string(io.name);
+            u32(io.location);
+            string(io.type_name);
+        }
+    }
+
+    [[nodiscard]] std::vector<uint8_t>& data() { return data_; }
+
+private:
+    void append(const void* source, size_t count) {
+        const auto* begin = static_cast<const uint8_t*>(source);
+        data_.insert(data_.end(), begin, begin + count);
+    }
+
+    std::vector<uint8_t> data_;
+};
+
+class EntryReader {
+public:
+    explicit EntryReader(std::span<const uint8_t> data) : data_(data) {}
+
+    [[nodiscard]] bool ok() const { return ok_; }
+
+    uint32_t u32() {
+        uint32_t value = 0;
+        read(&value, sizeof(value));
+        return value;
+    }
+
+    uint64_t u64() {
+        uint64_t value = 0;
+        read(&value, sizeof(value));
+        return value;
+    }
+
+    size_t size() {
+        const uint64_t value = u64();
+        if (value > data_.size()) {
+            ok_ = false;  // Longer than the whole entry: corrupt
+            return 0;
+        }
+        return static_cast<size_t>(value);
+    }
+
+    std::vector<uint8_t> bytes() {
+        std::vector<uint8_t> out(size());
+        read(out.data(), out.size());
+        return out;
+    }
+
+    std::string string() {
+        std::string out(size(), '\0');
+        read(out.data(), out.size());
+        return out;
+    }
+
+    std::vector<ShaderUniformMember> members() {
+        std::vector<ShaderUniformMember> list(size());
+        for (auto& member : list) {
+            member.name = string();
+            member.type_name = string();
+            member.offset = size();
+            member.size = size();
+            member.array_size = u32();
+        }
+        return list;
+    }
+
+    std::vector<ShaderStageInput> stage_io() {
+        std::vector<ShaderStageInput> list(size());
+        for (auto& io : list) {
+            io.name = string();
+            io.location = u32();
+            io.type_name = string();
+        }
+        return list;
+    }
+
+private:
+    void read(void* out, size_t count) {
+        if (!ok_ || count > data_.size() - offset_) {
+            ok_ = false;
+            return;
+        }
+        if (count > 0) {
+            std::memcpy(out, data_.data() + offset_, count);
+        }
+        offset_ += count;
+    }
+
+    std::span<const uint8_t> data_;
+    size_t offset_ = 0;
+    bool ok_ = true;
+};
+
+std::vector<uint8_t> serialize_entry(const CompiledShader& shader) {
+    EntryWriter w;
+    w.u32(SHADER_CACHE_MAGIC);
+    w.u32(SHADER_CACHE_VERSION);
+    w.bytes(shader.spirv_bytecode);
+    w.string(shader.msl_source);
+
+    const ShaderReflection& r = shader.reflection;
+    w.u32(static_cast<uint32_t>(r.stage));
+    w.string(r.entry_point);
+
+    w.size(r.uniform_buffers.size());
+    for (const auto& ubo : r.uniform_buffers) {
+        w.string(ubo.name);
+        w.u32(ubo.set);
+        w.u32(ubo.binding);
+        w.size(ubo.size);
+        w.members(ubo.members);
+    }
+
+    w.size(r.sampled_images.size());
+    for (const auto& image : r.sampled_images) {
+        w.string(image.name);
+        w.u32(image.set);
+        w.u32(image.binding);
+        w.u32(static_cast<uint32_t>(image.dimension));
+        w.u32(image.is_array ? 1u : 0u);
+    }
+
+    w.size(r.storage_buffers.size());
+    for (const auto& ssbo : r.storage_buffers) {
+        w.string(ssbo.name);
+        w.u32(ssbo.set);
+        w.u32(ssbo.binding);
+        w.size(ssbo.size);
+    }
+
+    w.size(r.push_constants.size());
+    for (const auto& pc : r.push_constants) {
+        w.size(pc.offset);
+        w.size(pc.size);
+        w.u32(static_cast<uint32_t>(pc.stages));
+        w.members(pc.members);
+    }
+
+    w.stage_io(r.inputs);
+    w.stage_io(r.outputs);
+    return std::move(w.data());
+}
+
+std::optional<CompiledShader> deserialize_entry(std::span<const uint8_t> data) {
+    EntryReader r(data);
+    if (r.u32() != SHADER_CACHE_MAGIC || r.u32() != SHADER_CACHE_VERSION) {
+        return std::nullopt;
+    }
+
+    CompiledShader shader;
+    shader.spirv_bytecode = r.bytes();
+    shader.msl_source = r.string();
+    shader.msl_bytecode.assign(shader.msl_source.begin(), shader.msl_source.end());
+
+    ShaderReflection& reflection = shader.reflection;
+    reflection.stage = static_cast<ShaderStage>(r.u32());
+    reflection.entry_point = r.string();
+
+    reflection.uniform_buffers.resize(r.size());
+    for (auto& ubo : reflection.uniform_buffers) {
+        ubo.name = r.string();
+        ubo.set = r.u32();
+        ubo.binding = r.u32();
+        ubo.size = r.size();
+        ubo.members = r.members();
+    }
+
+    reflection.sampled_images.resize(r.size());
+    for (auto& image : reflection.sampled_images) {
+        image.name = r.string();
+        image.set = r.u32();
+        image.binding = r.u32();
+        image.dimension = static_cast<TextureType>(r.u32());
+        image.is_array = r.u32() != 0;
+    }
+
+    reflection.storage_buffers.resize(r.size());
+    for (auto& ssbo : reflection.storage_buffers) {
+        ssbo.name = r.string();
+        ssbo.set = r.u32();
+        ssbo.binding = r.u32();
+        ssbo.size = r.size();
+    }
+
+    reflection.push_constants.resize(r.size());
+    for (auto& pc : reflection.push_constants) {
+        pc.offset = r.size();
+        pc.size = r.size();
+        pc.stages = static_cast<ShaderStage>(r.u32());
+        pc.members = r.members();
+    }
+
+    reflection.inputs = r.stage_io();
+    reflection.outputs = r.stage_io();
+
+    if (!r.ok() || shader.spirv_bytecode.empty()) {
+        return std::nullopt;
+    }
+    shader.success = true;
+    return shader;
+}
+
+}  // namespace
+
+// ============================================================================
+// ShaderCache Implementation
+// ============================================================================
+
+struct ShaderCache::Impl {
+    ShaderCacheConfig config;
+    bool enabled = false;
+
+    std::unordered_map<std::string, size_t> entry_sizes;  // Key -> file size
+    size_t total_size = 0;
+    mutable std::mutex mutex;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> stores{0};
+    std::atomic<uint64_t> evictions{0};
+
+    [[nodiscard]] fs::path entry_path(const std::string& key) const {
+        return config.directory / (key + ENTRY_EXTENSION);
+    }
+
+    void forget(const std::string& key) {
+        auto it = entry_sizes.find(key);
+        if (it != entry_sizes.end()) {
+            total_size -= it->second;
+            entry_sizes.erase(it);
+        }
+    }
+
+    // Evict least recently used entries (by file mtime, which load() bumps)
+    // until the cache fits. Caller must hold mutex.
+    void trim(const std::string& keep) {
+        if (total_size <= config.max_size_bytes) {
+            return;
+        }
+
+        std::vector<std::pair<fs::file_time_type, std::string>> by_age;
+        by_age.reserve(entry_sizes.size());
+        for (const auto& [key, size] : entry_sizes) {
+            std::error_code ec;
+            auto time = fs::last_write_time(entry_path(key), ec);
+            by_age.emplace_back(ec ? fs::file_time_type::min() : time, key);
+        }
+        std::sort(by_age.begin(), by_age.end());
+
+        for (const auto& [time, key] : by_age) {
+            if (total_size <= config.max_size_bytes) {
+                break;
+            }
+            if (key == keep) {
+                continue;
+            }
+            std::error_code ec;
+            fs::remove(entry_path(key), ec);
+            forget(key);
+            evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+};
+
+ShaderCache::ShaderCache() : impl_(std::make_unique<Impl>()) {}
+
+ShaderCache::~ShaderCache() = default;
+
+bool ShaderCache::initialize(const ShaderCacheConfig& config) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->config = config;
+    impl_->entry_sizes.clear();
+    impl_->total_size = 0;
+    impl_->enabled = false;
+
+    std::error_code ec;
+    fs::create_directories(config.directory, ec);
+    if (config.directory.empty() || !fs::is_directory(config.directory, ec)) {
+        spdlog::warn("Shader cache disabled: cannot use directory '{}'", config.directory.string());
+        return false;
+    }
+
+    for (const auto& entry : fs::directory_iterator(config.directory, ec)) {
+        const auto& path = entry.path();
+        if (path.extension() == ENTRY_EXTENSION) {
+            const auto size = static_cast<size_t>(entry.file_size(ec));
+            if (!ec) {
+                impl_->entry_sizes[path.stem().string()] = size;
+                impl_->total_size += size;
+            }
+        } else if (path.extension() == ".tmp") {
+            fs::remove(path, ec);  // Left over from an interrupted store
+        }
+    }
+
+    impl_->enabled = true;
+    impl_->trim({});
+    spdlog::info("Shader cache: {} entries ({} KB) in {}", impl_->entry_sizes.size(), impl_->total_size / 1024,
+                 config.directory.string());
+    return true;
+}
+
+bool ShaderCache::is_enabled() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->enabled;
+}
+
+std::string ShaderCache::compute_key(std::string_view source, const ShaderCompileOptions& options,
+                                     std::string_view compiler_id) {
+    KeyHasher hasher;
+    hasher.add(std::to_string(SHADER_CACHE_VERSION));
+    hasher.add(compiler_id);
+    hasher.add(std::to_string(static_cast<uint32_t>(options.stage)));
+    hasher.add(options.entry_point);
+    for (const auto& define : options.defines) {
+        hasher.add(define);
+    }
+    hasher.add(options.generate_debug_info ? "debug" : "nodebug");
+    hasher.add(options.optimize ? "opt" : "noopt");
+    hasher.add(options.generate_reflection ? "reflect" : "noreflect");
+    hasher.add(source);
+
+    std::unordered_set<std::string> visited;
+    hash_include_closure(hasher, source, options.include_paths, visited);
+    return hasher.hex();
+}
+
+std::optional<CompiledShader> ShaderCache::load(const std::string& key) {
+    fs::path path;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        if (!impl_->enabled || !impl_->entry_sizes.contains(key)) {
+            impl_->misses.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        path = impl_->entry_path(key);
+    }
+
+    std::optional<CompiledShader> shader;
+    if (auto text = read_file_text(path)) {
+        shader = deserialize_entry(
+            std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(text->data()), text->size()));
+    }
+
+    if (!shader) {
+        // Missing or corrupt: drop it so the next store replaces it
+        spdlog::warn("Discarding unreadable shader cache entry: {}", path.string());
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        std::error_code ec;
+        fs::remove(path, ec);
+        impl_->forget(key);
+        impl_->misses.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+    // Mark as recently used for eviction
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    impl_->hits.fetch_add(1, std::memory_order_relaxed);
+    return shader;
+}
+
+bool ShaderCache::store(const std::string& key, const CompiledShader& shader) {
+    if (!shader.success || shader.spirv_bytecode.empty() || !is_enabled()) {
+        return false;
+    }
+
+    const std::vector<uint8_t> data = serialize_entry(shader);
+    const fs::path path = impl_->entry_path(key);
+
+    // Unique temp name so concurrent stores of the same key do not collide
+    thread_local std::mt19937_64 rng{std::random_device{}()};
+    fs::path temp = path;
+    temp += "." + std::to_string(rng()) + ".tmp";
+
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file) {
+            spdlog::warn("Failed to write shader cache entry: {}", temp.string());
+            std::error_code ec;
+            fs::remove(temp, ec);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    fs::rename(temp, path, ec);
+    if (ec) {
+        spdlog::warn("Failed to commit shader cache entry '{}': {}", path.string(), ec.message());
+        fs::remove(temp, ec);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->forget(key);
+    impl_->entry_sizes[key] = data.size();
+    impl_->total_size += data.size();
+    impl_->stores.fetch_add(1, std::memory_order_relaxed);
+    impl_->trim(key);
+    return true;
+}
+
+void ShaderCache::clear() {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    for (const auto& [key, size] : impl_->entry_sizes) {
+        std::error_code ec;
+        fs::remove(impl_->entry_path(key), ec);
+    }
+    impl_->entry_sizes.clear();
+    impl_->total_size = 0;
+}
+
+size_t ShaderCache::size_bytes() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->total_size;
+}
+
+size_t ShaderCache::entry_count() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->entry_sizes.size();
+}
+
+ShaderCacheStats ShaderCache::stats() const {
+    ShaderCacheStats result;
+    result.hits = impl_->hits.load(std::memory_order_relaxed);
+    result.misses = impl_->misses.load(std::memory_order_relaxed);
+    result.stores = impl_->stores.load(std::memory_order_relaxed);
+    result.evictions = impl_->evictions.load(std::memory_order_relaxed);
+    return result;
+}
+
+}  // namespace realcraft::graphics
@@ -8,12 +8,16 @@
 #include <glslang/Public/ResourceLimits.h>
 #include <glslang/Public/ShaderLang.h>
 #include <glslang/SPIRV/GlslangToSpv.h>
+#include <glslang/build_info.h>
 #include <mutex>
+#include <realcraft/graphics/shader_cache.hpp>
 #include <realcraft/graphics/shader_compiler.hpp>
+#include <realcraft/platform/asset_archive.hpp>
 #include <spirv_cross/spirv_cross.hpp>
 #include <spirv_cross/spirv_glsl.hpp>
 #include <spirv_cross/spirv_msl.hpp>
 #include <spirv_cross/spirv_reflect.hpp>
+#include <string>
 #include <unordered_map>
 
 namespace realcraft::graphics {
@@ -27,6 +31,66 @@ void initialize_glslang() {
     std::call_once(glslang_init_flag, []() { glslang::InitializeProcess(); });
 }
 
+// SPIRV-Cross has no version header; the build passes the package version
+// (or a fingerprint of the library) instead
+#ifndef REALCRAFT_SPIRV_CROSS_VERSION
+#    define REALCRAFT_SPIRV_CROSS_VERSION "unknown"
+#endif
+
+// SPIR-V environment for GLSL compilation
+constexpr glslang::EShTargetClientVersion TARGET_CLIENT_VERSION = glslang::EShTargetVulkan_1_2;
+constexpr glslang::EShTargetLanguageVersion TARGET_SPIRV_VERSION = glslang::EShTargetSpv_1_5;
+constexpr int DEFAULT_GLSL_VERSION = 450;
+constexpr EShMessages BASE_MESSAGES = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
+
+// Metal buffer index layout:
+// - Indices 0-9: Reserved for vertex buffers
+// - Indices 10-19: Uniform buffers (set 0, binding N -> buffer index 10+N)
+// - Index 30: Push constants
+constexpr uint32_t MSL_UNIFORM_BUFFER_BASE_INDEX = 10;
+constexpr uint32_t MSL_UNIFORM_BUFFER_COUNT = 10;
+constexpr uint32_t MSL_PUSH_CONSTANT_INDEX = 30;
+
+spirv_cross::CompilerMSL::Options make_msl_options() {
+    // Note: We use glm::perspectiveRH_ZO which already produces [0,1] depth range
+    // for Metal, so we do NOT enable fixup_clipspace (that would double-convert).
+    // Metal's NDC Y-axis is same as OpenGL, so no flip_vert_y needed.
+    spirv_cross::CompilerMSL::Options msl_options;
+    msl_options.platform = spirv_cross::CompilerMSL::Options::macOS;
+    msl_options.msl_version = spirv_cross::CompilerMSL::Options::make_msl_version(3, 0);
+    msl_options.enable_decoration_binding = true;
+    msl_options.argument_buffers = false;  // Use discrete resources for simplicity
+    return msl_options;
+}
+
+// Everything besides the source and options that affects compile_glsl output,
+// built from the same settings the compile path uses
+const std::string& compiler_id() {
+    static const std::string id = [] {
+        const spirv_cross::CompilerMSL::Options msl = make_msl_options();
+        std::string result = "glslang-" + std::to_string(GLSLANG_VERSION_MAJOR) + "." +
+                             std::to_string(GLSLANG_VERSION_MINOR) + "." + std::to_string(GLSLANG_VERSION_PATCH);
+        result += ";spirv-cross-" + std::string(REALCRAFT_SPIRV_CROSS_VERSION);
+        result += ";client=" + std::to_string(static_cast<int>(TARGET_CLIENT_VERSION));
+        result += ";spirv=" + std::to_string(static_cast<int>(TARGET_SPIRV_VERSION));
+        result += ";glsl=" + std::to_string(DEFAULT_GLSL_VERSION);
+        result += ";messages=" + std::to_string(static_cast<int>(BASE_MESSAGES));
+        result += ";msl-platform=" + std::to_string(static_cast<int>(msl.platform));
+        result += ";msl=" + std::to_string(msl.msl_version);
+        result += ";decoration-binding=" + std::to_string(msl.enable_decoration_binding);
+        result += ";argument-buffers=" + std::to_string(msl.argument_buffers);
+        result +=
+            ";ubo=" + std::to_string(MSL_UNIFORM_BUFFER_BASE_INDEX) + "x" + std::to_string(MSL_UNIFORM_BUFFER_COUNT);
+        result += ";pc=" + std::to_string(MSL_PUSH_CONSTANT_INDEX);
+        return result;
+    }();
+    return id;
+}
+
+std::mutex default_cache_mutex;
+std::shared_ptr<ShaderCache> default_cache;
+const platform::AssetStore* default_assets = nullptr;
+
 // Convert ShaderStage to glslang stage
 EShLanguage to_glslang_stage(ShaderStage stage) {
     switch (stage) {
@@ -198,10 +262,15 @@ struct ShaderCompiler::Impl {
 
     std::unordered_map<std::string, WatchedFile> watched_files;
     std::mutex watched_files_mutex;
+
+    std::shared_ptr<ShaderCache> cache;
+    const platform::AssetStore* assets = nullptr;
 };
 
 ShaderCompiler::ShaderCompiler() : impl_(std::make_unique<Impl>()) {
     initialize_glslang();
+    impl_->cache = get_default_cache();
+    impl_->assets = get_default_assets();
 }
 
 ShaderCompiler::~ShaderCompiler() {
@@ -212,6 +281,21 @@ ShaderCompiler::ShaderCompiler(ShaderCompiler&&) noexcept = default;
 ShaderCompiler& ShaderCompiler::operator=(ShaderCompiler&&) noexcept = default;
 
 CompiledShader ShaderCompiler::compile_glsl(std::string_view source, const ShaderCompileOptions& options) {
+    const std::string key = cache_key(source, options);
+    if (!key.empty()) {
+        if (auto cached = impl_->cache->load(key)) {
+            return std::move(*cached);
+        }
+    }
+
+    CompiledShader result = compile_glsl_uncached(source, options);
+    if (!key.empty() && result.success) {
+        impl_->cache->store(key, result);
+    }
+    return result;
+}
+
+CompiledShader ShaderCompiler::compile_glsl_uncached(std::string_view source, const ShaderCompileOptions& options) {
     CompiledShader result;
     result.reflection.stage = options.stage;
     result.reflection.entry_point = options.entry_point;
@@ -226,9 +310,9 @@ CompiledShader ShaderCompiler::compile_glsl(std::string_view source, const Shade
     shader.setSourceEntryPoint(options.entry_point.c_str());
 
     // Set environment
-    shader.setEnvInput(glslang::EShSourceGlsl, glslang_stage, glslang::EShClientVulkan, glslang::EShTargetVulkan_1_2);
-    shader.setEnvClient(glslang::EShClientVulkan, glslang::EShTargetVulkan_1_2);
-    shader.setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_5);
+    shader.setEnvInput(glslang::EShSourceGlsl, glslang_stage, glslang::EShClientVulkan, TARGET_CLIENT_VERSION);
+    shader.setEnvClient(glslang::EShClientVulkan, TARGET_CLIENT_VERSION);
+    shader.setEnvTarget(glslang::EShTargetSpv, TARGET_SPIRV_VERSION);
 
     // Add defines
     std::string preamble;
@@ -240,13 +324,13 @@ CompiledShader ShaderCompiler::compile_glsl(std::string_view source, const Shade
     }
 
     // Parse
-    EShMessages messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
+    EShMessages messages = BASE_MESSAGES;
     if (options.generate_debug_info) {
         messages = static_cast<EShMessages>(messages | EShMsgDebugInfo);
     }
 
     const TBuiltInResource* resources = GetDefaultResources();
-    if (!shader.parse(resources, 450, false, messages)) {
+    if (!shader.parse(resources, DEFAULT_GLSL_VERSION, false, messages)) {
         result.success = false;
         result.error_message = shader.getInfoLog();
         spdlog::error("GLSL compilation failed: {}", result.error_message);
@@ -307,24 +391,87 @@ CompiledShader ShaderCompiler::compile_glsl(std::string_view source, const Shade
 
 CompiledShader ShaderCompiler::compile_glsl_file(const std::filesystem::path& path,
                                                  const ShaderCompileOptions& options) {
-    std::ifstream file(path, std::ios::binary);
-    if (!file) {
+    // Asset paths resolve against the packed archive first; loose files are
+    // only read where the store allows them (development builds)
+    std::optional<std::string> source;
+    if (impl_->assets && path.is_relative()) {
+        source = impl_->assets->read_text(path.generic_string());
+    } else if (std::ifstream file(path, std::ios::binary); file) {
+        source.emplace((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    }
+
+    if (!source) {
         CompiledShader result;
         result.success = false;
         result.error_message = "Failed to open file: " + path.string();
         return result;
     }
-
-    std::string source((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-    return compile_glsl(source, options);
+    return compile_glsl(*source, options);
 }
 
 std::future<CompiledShader> ShaderCompiler::compile_glsl_async(std::string source, ShaderCompileOptions options) {
-    return std::async(std::launch::async, [this, source = std::move(source), options = std::move(options)]() mutable {
-        return compile_glsl(source, options);
+    std::string key = cache_key(source, options);
+    if (!key.empty()) {
+        if (auto cached = impl_->cache->load(key)) {
+            std::promise<CompiledShader> ready;
+            ready.set_value(std::move(*cached));
+            return ready.get_future();
+        }
+    }
+
+    return std::async(std::launch::async, [this, source = std::move(source), options = std::move(options),
+                                           key = std::move(key)]() mutable {
+        CompiledShader result = compile_glsl_uncached(source, options);
+        if (!key.empty() && result.success) {
+            impl_->cache->store(key, result);
+        }
+        return result;
     });
 }
 
+std::string ShaderCompiler::cache_key(std::string_view source, const ShaderCompileOptions& options) const {
+    if (!impl_->cache || !impl_->cache->is_enabled()) {
+        return {};
+    }
+    return ShaderCache::compute_key(source, options, compiler_id());
+}
+
+void ShaderCompiler::set_cache(std::shared_ptr<ShaderCache> cache) {
+    impl_->cache = std::move(cache);
+}
+
+std::shared_ptr<ShaderCache> ShaderCompiler::get_cache() const {
+    return impl_->cache;
+}
+
+void ShaderCompiler::set_default_cache(std::shared_ptr<ShaderCache> cache) {
+    std::lock_guard<std::mutex> lock(default_cache_mutex);
+    default_cache = std::move(cache);
+}
+
+std::shared_ptr<ShaderCache> ShaderCompiler::get_default_cache() {
+    std::lock_guard<std::mutex> lock(default_cache_mutex);
+    return default_cache;
+}
+
+void ShaderCompiler::set_assets(const platform::AssetStore* assets) {
+    impl_->assets = assets;
+}
+
+const platform::AssetStore* ShaderCompiler::get_assets() const {
+    return impl_->assets;
+}
+
+void ShaderCompiler::set_default_assets(const platform::AssetStore* assets) {
+    std::lock_guard<std::mutex> lock(default_cache_mutex);
+    default_assets = assets;
+}
+
+const platform::AssetStore* ShaderCompiler::get_default_assets() {
+    std::lock_guard<std::mutex> lock(default_cache_mutex);
+    return default_assets;
+}
+
 std::optional<std::string> ShaderCompiler::spirv_to_msl(std::span<const uint8_t> spirv) {
     if (spirv.empty() || spirv.size() % 4 != 0) {
         spdlog::error("Invalid SPIR-V bytecode");
@@ -337,30 +484,13 @@ std::optional<std::string> ShaderCompiler::spirv_to_msl(std::span<const uint8_t>
     try {
         spirv_cross::CompilerMSL msl(std::move(spirv_words));
 
-        // Note: We use glm::perspectiveRH_ZO which already produces [0,1] depth range
-        // for Metal, so we do NOT enable fixup_clipspace (that would double-convert).
-        // Metal's NDC Y-axis is same as OpenGL, so no flip_vert_y needed.
-
-        // Configure MSL options
-        spirv_cross::CompilerMSL::Options msl_options;
-        msl_options.platform = spirv_cross::CompilerMSL::Options::macOS;
-        msl_options.msl_version = spirv_cross::CompilerMSL::Options::make_msl_version(3, 0);
-        msl_options.enable_decoration_binding = true;
-        msl_options.argument_buffers = false;  // Use discrete resources for simplicity
-
-        // Metal buffer index layout:
-        // - Indices 0-9: Reserved for vertex buffers
-        // - Indices 10-19: Uniform buffers (set 0, binding N -> buffer index 10+N)
-        // - Index 30: Push constants
-        constexpr uint32_t UNIFORM_BUFFER_BASE_INDEX = 10;
-
         // Remap uniform buffers to indices 10+ to avoid collision with vertex buffers
         // This handles set 0 bindings 0-9
-        for (uint32_t binding = 0; binding < 10; ++binding) {
+        for (uint32_t binding = 0; binding < MSL_UNIFORM_BUFFER_COUNT; ++binding) {
             spirv_cross::MSLResourceBinding ubo_binding;
             ubo_binding.desc_set = 0;
             ubo_binding.binding = binding;
-            ubo_binding.msl_buffer = UNIFORM_BUFFER_BASE_INDEX + binding;
+            ubo_binding.msl_buffer = MSL_UNIFORM_BUFFER_BASE_INDEX + binding;
 
             ubo_binding.stage = spv::ExecutionModelVertex;
             msl.add_msl_resource_binding(ubo_binding);
@@ -374,14 +504,14 @@ std::optional<std::string> ShaderCompiler::spirv_to_msl(std::span<const uint8_t>
         push_constant_binding.stage = spv::ExecutionModelVertex;
         push_constant_binding.desc_set = spirv_cross::kPushConstDescSet;
         push_constant_binding.binding = spirv_cross::kPushConstBinding;
-        push_constant_binding.msl_buffer = 30;
+        push_constant_binding.msl_buffer = MSL_PUSH_CONSTANT_INDEX;
         msl.add_msl_resource_binding(push_constant_binding);
 
         // Also for fragment stage in case push constants are used there
         push_constant_binding.stage = spv::ExecutionModelFragment;
         msl.add_msl_resource_binding(push_constant_binding);
 
-        msl.set_msl_options(msl_options);
+        msl.set_msl_options(make_msl_options());
 
         std::string msl_source = msl.compile();
         return msl_source;
@@ -4,20 +4,25 @@
 #include <realcraft/core/config.hpp>
 #include <realcraft/core/engine.hpp>
 #include <realcraft/core/logger.hpp>
+#include <realcraft/core/metrics.hpp>
 #include <realcraft/gameplay/block_interaction.hpp>
+#include <realcraft/gameplay/input_recording.hpp>
 #include <realcraft/gameplay/inventory.hpp>
 #include <realcraft/gameplay/item.hpp>
 #include <realcraft/gameplay/item_entity.hpp>
 #include <realcraft/gameplay/player_stats.hpp>
+#include <realcraft/gameplay/session_config.hpp>
 #include <realcraft/graphics/command_buffer.hpp>
 #include <realcraft/graphics/swap_chain.hpp>
 #include <realcraft/graphics/types.hpp>
 #include <realcraft/physics/physics_world.hpp>
 #include <realcraft/physics/player_controller.hpp>
+#include <realcraft/platform/file_io.hpp>
 #include <realcraft/platform/input.hpp>
 #include <realcraft/platform/input_action.hpp>
 #include <realcraft/rendering/hud_renderer.hpp>
 #include <realcraft/rendering/render_system.hpp>
+#include <realcraft/world/block_tick_scheduler.hpp>
 #include <realcraft/world/world_manager.hpp>
 
 // Bullet Physics
@@ -25,7 +30,11 @@
 
 // FastNoise2
 #include <FastNoise/FastNoise.h>
+#include <algorithm>
 #include <cmath>
+#include <filesystem>
+#include <random>
+#include <string_view>
 
 namespace {
 
@@ -53,11 +62,51 @@ bool verify_fastnoise2() {
     return (noise_value >= -2.0f && noise_value <= 2.0f);
 }
 
+// --record <file> captures every fixed step's input for realcraft_replay
+std::filesystem::path parse_record_path(int argc, char* argv[]) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::string_view(argv[i]) == "--record") {
+            return argv[i + 1];
+        }
+    }
+    return {};
+}
+
+// Input consumed by one fixed step, in the form a recording stores it
+realcraft::gameplay::InputFrame make_input_frame(const realcraft::physics::PlayerInput& input,
+                                                 const realcraft::rendering::Camera& camera, bool primary_held,
+                                                 bool secondary_just_pressed, int hotbar_slot) {
+    namespace button = realcraft::gameplay::input_button;
+
+    realcraft::gameplay::InputFrame frame;
+    frame.move_direction = input.move_direction;
+    frame.camera_pitch = camera.get_pitch();
+    frame.camera_yaw = camera.get_yaw();
+    frame.hotbar_slot = static_cast<uint8_t>(hotbar_slot);
+
+    const std::pair<bool, uint8_t> flags[] = {
+        {input.jump_pressed, button::JUMP},
+        {input.jump_just_pressed, button::JUMP_JUST_PRESSED},
+        {input.sprint_pressed, button::SPRINT},
+        {input.crouch_pressed, button::CROUCH},
+        {primary_held, button::PRIMARY},
+        {secondary_just_pressed, button::SECONDARY_JUST_PRESSED},
+    };
+    for (const auto& [set, flag] : flags) {
+        if (set) {
+            frame.buttons = static_cast<uint8_t>(frame.buttons | flag);
+        }
+    }
+    return frame;
+}
+
 }  // namespace
 
-int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
+int main(int argc, char* argv[]) {
     using namespace realcraft;
 
+    const std::filesystem::path record_path = parse_record_path(argc, argv);
+
     // Configure engine
     core::EngineConfig config;
     config.app_name = "RealCraft";
@@ -110,6 +159,14 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     }
     REALCRAFT_LOG_INFO(core::log_category::ENGINE, "World Manager: OK");
 
+    // Scheduled and random block ticks
+    world::BlockTickScheduler block_ticks;
+    if (!block_ticks.initialize(&world_manager)) {
+        REALCRAFT_LOG_ERROR(core::log_category::ENGINE, "Failed to initialize Block Tick Scheduler");
+        world_manager.shutdown();
+        return 1;
+    }
+
     // Initialize Render System
     rendering::RenderSystemConfig render_config;
     render_config.camera.fov_degrees = 70.0f;
@@ -117,6 +174,7 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     render_config.camera.move_speed = 10.0f;
     render_config.render_distance = 4.0f;
     render_config.mesh_manager.worker_threads = 2;
+    render_config.texture_manager.cache_directory = platform::FileSystem::get_user_data_directory() / "texture_cache";
 
     rendering::RenderSystem render_system;
     if (!render_system.initialize(&engine, &world_manager, render_config)) {
@@ -126,13 +184,12 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     }
     REALCRAFT_LOG_INFO(core::log_category::ENGINE, "Render System: OK");
 
-    // Initialize Physics World
-    physics::PhysicsConfig physics_config;
-    physics_config.gravity = glm::dvec3(0.0, -9.81, 0.0);
-    physics_config.fixed_timestep = 1.0 / 60.0;
+    // Gameplay tuning, shared with realcraft_replay so recordings replay alike
+    gameplay::SessionConfig session_config = gameplay::default_session_config();
 
+    // Initialize Physics World
     physics::PhysicsWorld physics_world;
-    if (!physics_world.initialize(&world_manager, physics_config)) {
+    if (!physics_world.initialize(&world_manager, session_config.physics)) {
         REALCRAFT_LOG_ERROR(core::log_category::ENGINE, "Failed to initialize Physics World");
         render_system.shutdown();
         world_manager.shutdown();
@@ -141,17 +198,8 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     REALCRAFT_LOG_INFO(core::log_category::ENGINE, "Physics World: OK");
 
     // Initialize Player Controller
-    physics::PlayerControllerConfig player_config;
-    player_config.capsule_radius = 0.4;
-    player_config.capsule_height = 1.8;
-    player_config.eye_height = 1.6;
-    player_config.walk_speed = 4.3;
-    player_config.sprint_speed = 5.6;
-    player_config.jump_height = 1.25;
-    player_config.gravity = 32.0;
-
     physics::PlayerController player_controller;
-    if (!player_controller.initialize(&physics_world, &world_manager, player_config)) {
+    if (!player_controller.initialize(&physics_world, &world_manager, session_config.player)) {
         REALCRAFT_LOG_ERROR(core::log_category::ENGINE, "Failed to initialize Player Controller");
         physics_world.shutdown();
         render_system.shutdown();
@@ -171,13 +219,9 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     world_manager.set_player_position({0.0, 80.0, 0.0});
 
     // Initialize Block Interaction System
-    gameplay::BlockInteractionConfig interaction_config;
-    interaction_config.reach_distance = 5.0;
-    interaction_config.base_break_speed = 1.0;
-
     gameplay::BlockInteractionSystem block_interaction;
     if (!block_interaction.initialize(&physics_world, &player_controller, &world_manager, &render_system.get_camera(),
-                                      interaction_config)) {
+                                      session_config.interaction)) {
         REALCRAFT_LOG_ERROR(core::log_category::ENGINE, "Failed to initialize Block Interaction System");
         player_controller.shutdown();
         physics_world.shutdown();
@@ -193,12 +237,8 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
                        gameplay::ItemRegistry::instance().count());
 
     // Initialize Inventory
-    gameplay::InventoryConfig inventory_config;
-    inventory_config.creative_mode = false;  // Survival mode - consume items when placing
-    inventory_config.pickup_radius = 2.0;
-
     gameplay::Inventory inventory;
-    if (!inventory.initialize(inventory_config)) {
+    if (!inventory.initialize(session_config.inventory)) {
         REALCRAFT_LOG_ERROR(core::log_category::ENGINE, "Failed to initialize Inventory");
         block_interaction.shutdown();
         player_controller.shutdown();
@@ -216,13 +256,13 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     gameplay::PlayerStats player_stats;
     REALCRAFT_LOG_INFO(core::log_category::ENGINE, "Player Stats: OK (stub)");
 
-    // Initialize Item Entity Manager
-    gameplay::ItemEntityConfig item_entity_config;
-    item_entity_config.max_entities = 500;
-    item_entity_config.pickup_radius = 2.0;
+    // Initialize Item Entity Manager. Gameplay randomness comes from one seed
+    // so a recording can reproduce it.
+    const uint32_t gameplay_seed = std::max(1u, std::random_device{}());
+    session_config.item_entity.seed = gameplay_seed;
 
     gameplay::ItemEntityManager item_entity_manager;
-    if (!item_entity_manager.initialize(&physics_world, &world_manager, &inventory, item_entity_config)) {
+    if (!item_entity_manager.initialize(&physics_world, &world_manager, &inventory, session_config.item_entity)) {
         REALCRAFT_LOG_ERROR(core::log_category::ENGINE, "Failed to initialize Item Entity Manager");
         inventory.shutdown();
         block_interaction.shutdown();
@@ -246,6 +286,24 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     // Shared player input state (updated in update callback, used in fixed_update)
     physics::PlayerInput player_input;
 
+    // Block actions as last applied by the update callback, for the recorder.
+    // Placement is latched until a fixed step records it, like jumping.
+    bool primary_action_held = false;
+    bool secondary_action_latched = false;
+
+    gameplay::InputRecorder input_recorder;
+    if (!record_path.empty()) {
+        gameplay::RecordingHeader header;
+        header.world_seed = world_manager.get_seed();
+        header.gameplay_seed = gameplay_seed;
+        header.view_distance = world_config.view_distance;
+        header.fixed_timestep = engine.get_game_loop()->get_fixed_timestep();
+        header.spawn_position = player_controller.get_position();
+        header.camera_pitch = render_system.get_camera().get_pitch();
+        header.camera_yaw = render_system.get_camera().get_yaw();
+        (void)input_recorder.start(record_path, header);
+    }
+
     // Create input mapper for rebindable controls
     platform::InputMapper input_mapper(engine.get_input());
     input_mapper.load_defaults();
@@ -266,26 +324,48 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     REALCRAFT_LOG_INFO(core::log_category::ENGINE, "  T - Toggle wireframe");
     REALCRAFT_LOG_INFO(core::log_category::ENGINE, "  P - Pause/resume day-night cycle");
 
-    // Fixed update callback (60 Hz physics)
-    engine.set_fixed_update_callback([&render_system, &physics_world, &player_controller, &player_input](double dt) {
-        // Store previous state for interpolation
-        player_controller.store_previous_state();
-
-        // Update player physics
-        player_controller.fixed_update(dt, player_input);
-
-        // Reset jump just pressed (consumed by physics)
-        player_input.jump_just_pressed = false;
-
-        // Update physics world
-        physics_world.fixed_update(dt);
-        render_system.fixed_update(dt);
-    });
+    // Per-frame subsystem work runs as tasks. Each task declares the state it
+    // reads and writes; tasks that do not conflict run in parallel, the rest
+    // in registration order. WorldManager is internally synchronized, so
+    // plain block reads are not declared.
+    core::TaskGraph& tasks = engine.get_game_loop()->get_task_graph();
+
+    // Fixed update tasks (60 Hz physics)
+    (void)tasks.add_task({.name = "player_physics",
+                          .phase = core::TaskPhase::FixedUpdate,
+                          .reads = {"physics", "camera", "inventory"},
+                          .writes = {"player", "player_input"}},
+                         [&player_controller, &player_input, &render_system, &inventory, &input_recorder,
+                          &primary_action_held, &secondary_action_latched](double dt) {
+                             if (input_recorder.is_recording()) {
+                                 input_recorder.record(make_input_frame(
+                                     player_input, render_system.get_camera(), primary_action_held,
+                                     secondary_action_latched, inventory.get_selected_slot()));
+                                 secondary_action_latched = false;
+                             }
+
+                             // Store previous state for interpolation
+                             player_controller.store_previous_state();
+
+                             // Update player physics
+                             player_controller.fixed_update(dt, player_input);
+
+                             // Reset jump just pressed (consumed by physics)
+                             player_input.jump_just_pressed = false;
+                         });
+    (void)tasks.add_task({.name = "physics_step", .phase = core::TaskPhase::FixedUpdate, .writes = {"physics"}},
+                         [&physics_world](double dt) { physics_world.fixed_update(dt); });
+    (void)tasks.add_task({.name = "camera_history", .phase = core::TaskPhase::FixedUpdate, .writes = {"camera"}},
+                         [&render_system](double dt) { render_system.fixed_update(dt); });
+
+    // Latency histograms shown on the debug overlay
+    core::Histogram& chunk_generation_us = core::MetricsRegistry::instance().histogram("world.chunk_generation_us");
+    core::Histogram& mesh_build_us = core::MetricsRegistry::instance().histogram("mesh.build_us");
 
     // Variable update callback (every frame)
     engine.set_update_callback([&engine, &world_manager, &render_system, &player_controller, &player_input,
-                                &input_mapper, &block_interaction, &inventory, &item_entity_manager,
-                                &player_stats](double dt) {
+                                &input_mapper, &block_interaction, &inventory, &primary_action_held,
+                                &secondary_action_latched](double dt) {
         auto* input = engine.get_input();
         auto* window = engine.get_window();
 
@@ -376,8 +456,14 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
 
         // Block interaction input (only when mouse is captured)
         if (input->is_mouse_captured()) {
-            block_interaction.on_primary_action(input_mapper.is_action_pressed("primary_action"));
-            block_interaction.on_secondary_action(input_mapper.is_action_just_pressed("secondary_action"));
+            primary_action_held = input_mapper.is_action_pressed("primary_action");
+            block_interaction.on_primary_action(primary_action_held);
+            if (input_mapper.is_action_just_pressed("secondary_action")) {
+                secondary_action_latched = true;
+                block_interaction.on_secondary_action(true);
+            } else {
+                block_interaction.on_secondary_action(false);
+            }
 
             // Hotbar selection (1-9 keys)
             for (int i = 1; i <= 9; ++i) {
@@ -396,6 +482,7 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
             }
         } else {
             // Release primary action when mouse not captured
+            primary_action_held = false;
             block_interaction.on_primary_action(false);
         }
 
@@ -418,61 +505,81 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
 
         // Update player position for chunk loading
         world_manager.set_player_position(player_controller.get_position());
+    });
 
-        // Update item entities (physics, pickup, despawn)
-        item_entity_manager.update(dt, player_controller.get_position());
-
-        // Update world (chunk loading/unloading)
-        world_manager.update(dt);
-
-        // Update HUD data
-        rendering::HUDData hud_data;
-
-        // Hotbar slots
-        for (int i = 0; i < 9; ++i) {
-            const auto& slot = inventory.get_hotbar_slot(static_cast<size_t>(i));
-            hud_data.hotbar_slots[i].empty = slot.is_empty();
-            if (!slot.is_empty()) {
-                const auto* item = gameplay::ItemRegistry::instance().get(slot.item_id);
-                if (item) {
-                    hud_data.hotbar_slots[i].texture_index = item->get_texture_index();
-                    hud_data.hotbar_slots[i].count = slot.count;
-                    hud_data.hotbar_slots[i].durability = slot.durability;
-                    hud_data.hotbar_slots[i].max_durability = item->get_max_durability();
+    // Variable update tasks, run after the callback above each frame
+    (void)tasks.add_task({.name = "item_entities", .reads = {"player"}, .writes = {"item_entities", "inventory"}},
+                         [&item_entity_manager, &player_controller](double dt) {
+                             // Update item entities (physics, pickup, despawn)
+                             item_entity_manager.update(dt, player_controller.get_position());
+                         });
+
+    // Chunk loading notifies world observers such as the mesh manager
+    (void)tasks.add_task({.name = "world_streaming", .writes = {"chunks"}, .main_thread = true},
+                         [&world_manager](double dt) { world_manager.update(dt); });
+
+    // Block ticks apply their writes through the world, so they notify observers too
+    (void)tasks.add_task({.name = "block_ticks", .writes = {"chunks"}, .main_thread = true},
+                         [&block_ticks](double dt) { block_ticks.update(dt); });
+
+    (void)tasks.add_task(
+        {.name = "hud", .reads = {"inventory", "player", "chunks", "render"}, .writes = {"hud"}},
+        [&engine, &world_manager, &render_system, &player_controller, &inventory, &player_stats, &chunk_generation_us,
+         &mesh_build_us](double /*dt*/) {
+            // Update HUD data
+            rendering::HUDData hud_data;
+
+            // Hotbar slots
+            for (int i = 0; i < 9; ++i) {
+                const auto& slot = inventory.get_hotbar_slot(static_cast<size_t>(i));
+                hud_data.hotbar_slots[i].empty = slot.is_empty();
+                if (!slot.is_empty()) {
+                    const auto* item = gameplay::ItemRegistry::instance().get(slot.item_id);
+                    if (item) {
+                        hud_data.hotbar_slots[i].texture_index = item->get_texture_index();
+                        hud_data.hotbar_slots[i].count = slot.count;
+                        hud_data.hotbar_slots[i].durability = slot.durability;
+                        hud_data.hotbar_slots[i].max_durability = item->get_max_durability();
+                    }
                 }
             }
-        }
-        hud_data.selected_slot = inventory.get_selected_slot();
-
-        // Player stats
-        hud_data.health = player_stats.health;
-        hud_data.max_health = player_stats.max_health;
-        hud_data.hunger = player_stats.hunger;
-        hud_data.max_hunger = player_stats.max_hunger;
-
-        // Debug info
-        hud_data.fps = engine.get_game_loop()->get_fps();
-        hud_data.frame_time_ms = engine.get_game_loop()->get_unscaled_delta_time() * 1000.0;
-        hud_data.player_position = player_controller.get_position();
-        hud_data.chunk_x =
-            static_cast<int32_t>(std::floor(hud_data.player_position.x / static_cast<double>(world::CHUNK_SIZE_X)));
-        hud_data.chunk_z =
-            static_cast<int32_t>(std::floor(hud_data.player_position.z / static_cast<double>(world::CHUNK_SIZE_Z)));
-        hud_data.camera_pitch = render_system.get_camera().get_pitch();
-        hud_data.camera_yaw = render_system.get_camera().get_yaw();
-
-        const auto& render_stats = render_system.get_stats();
-        hud_data.chunks_rendered = render_stats.chunks_rendered;
-        hud_data.chunks_culled = render_stats.chunks_culled;
-        hud_data.triangles = render_stats.triangles_rendered;
-        hud_data.draw_calls = render_stats.draw_calls;
-        hud_data.time_of_day = render_system.get_day_night_cycle().get_time();
-
-        render_system.get_hud_renderer().update(hud_data);
-
-        // Update render system
-        render_system.update(dt);
-    });
+            hud_data.selected_slot = inventory.get_selected_slot();
+
+            // Player stats
+            hud_data.health = player_stats.health;
+            hud_data.max_health = player_stats.max_health;
+            hud_data.hunger = player_stats.hunger;
+            hud_data.max_hunger = player_stats.max_hunger;
+
+            // Debug info
+            hud_data.fps = engine.get_game_loop()->get_fps();
+            hud_data.frame_time_ms = engine.get_game_loop()->get_unscaled_delta_time() * 1000.0;
+            hud_data.player_position = player_controller.get_position();
+            hud_data.chunk_x =
+                static_cast<int32_t>(std::floor(hud_data.player_position.x / static_cast<double>(world::CHUNK_SIZE_X)));
+            hud_data.chunk_z =
+                static_cast<int32_t>(std::floor(hud_data.player_position.z / static_cast<double>(world::CHUNK_SIZE_Z)));
+            hud_data.camera_pitch = render_system.get_camera().get_pitch();
+            hud_data.camera_yaw = render_system.get_camera().get_yaw();
+
+            const auto& render_stats = render_system.get_stats();
+            hud_data.chunks_rendered = render_stats.chunks_rendered;
+            hud_data.chunks_culled = render_stats.chunks_culled;
+            hud_data.triangles = render_stats.triangles_rendered;
+            hud_data.draw_calls = render_stats.draw_calls;
+            hud_data.chunks_loaded = static_cast<uint32_t>(world_manager.loaded_chunk_count());
+            hud_data.chunks_dirty = static_cast<uint32_t>(world_manager.dirty_chunk_count());
+            hud_data.chunks_pending = static_cast<uint32_t>(world_manager.pending_generation_count());
+            hud_data.chunk_gen_p99_ms = static_cast<double>(chunk_generation_us.percentile(0.99)) / 1000.0;
+            hud_data.mesh_build_p99_ms = static_cast<double>(mesh_build_us.percentile(0.99)) / 1000.0;
+            hud_data.time_of_day = render_system.get_day_night_cycle().get_time();
+
+            render_system.get_hud_renderer().update(hud_data);
+        });
+
+    // Mesh uploads need the graphics device
+    (void)tasks.add_task({.name = "render_update", .writes = {"render"}, .main_thread = true},
+                         [&render_system](double dt) { render_system.update(dt); });
 
     // Render callback
     engine.set_render_callback([&render_system](double interpolation) { render_system.render(interpolation); });
@@ -480,6 +587,8 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     // Run the engine (blocks until exit)
     engine.run();
 
+    input_recorder.stop();
+
     // Cleanup (reverse order of initialization)
     item_entity_manager.shutdown();
     inventory.shutdown();
@@ -487,6 +596,7 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     player_controller.shutdown();
     physics_world.shutdown();
     render_system.shutdown();
+    block_ticks.shutdown();  // Hands pending ticks to the chunks before the final save
     world_manager.shutdown();
 
     return 0;
@@ -1,6 +1,7 @@
 // RealCraft Physics Engine
 // chunk_collider.cpp - Chunk-to-collision shape conversion implementation
 
+#include <array>
 #include <btBulletCollisionCommon.h>
 #include <realcraft/physics/chunk_collider.hpp>
 #include <realcraft/world/block.hpp>
@@ -67,6 +68,7 @@ struct ChunkCollider::Impl {
         // Mark as static object
         collision_object->setCollisionFlags(collision_object->getCollisionFlags() |
                                             btCollisionObject::CF_STATIC_OBJECT);
+        collision_object->setUserIndex2(static_cast<int>(BodyCategory::Chunk));
 
         update_transform();
     }
@@ -140,19 +142,21 @@ void ChunkCollider::rebuild(const world::Chunk& chunk) {
     // Get read lock on chunk
     auto read_lock = chunk.read_lock();
 
-    // Iterate over all blocks in chunk
+    // Iterate over all blocks in chunk, decoding a layer at a time
+    std::array<world::BlockId, static_cast<size_t>(world::CHUNK_SIZE_X * world::CHUNK_SIZE_Z)> layer;
     for (int y = 0; y < world::CHUNK_SIZE_Y; ++y) {
+        read_lock.storage().decode_blocks(world::local_to_index(world::LocalBlockPos(0, y, 0)), layer);
+        const world::BlockId* block = layer.data();
         for (int z = 0; z < world::CHUNK_SIZE_Z; ++z) {
-            for (int x = 0; x < world::CHUNK_SIZE_X; ++x) {
+            for (int x = 0; x < world::CHUNK_SIZE_X; ++x, ++block) {
                 world::LocalBlockPos pos(x, y, z);
-                auto entry = read_lock.get_entry(pos);
 
                 // Skip air and blocks without collision
-                if (entry.block_id == world::BLOCK_AIR) {
+                if (*block == world::BLOCK_AIR) {
                     continue;
                 }
 
-                const world::BlockType* block_type = world::BlockRegistry::instance().get(entry.block_id);
+                const world::BlockType* block_type = world::BlockRegistry::instance().get(*block);
                 if (!block_type || !block_type->has_collision()) {
                     continue;
                 }
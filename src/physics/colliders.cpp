@@ -57,6 +57,7 @@ AABBCollider::AABBCollider(ColliderHandle handle, const AABBColliderDesc& desc)
 
     // Store handle for later retrieval
     collision_object_->setUserIndex(static_cast<int>(handle_));
+    collision_object_->setUserIndex2(static_cast<int>(BodyCategory::Collider));
     collision_object_->setUserPointer(this);
 }
 
@@ -174,6 +175,7 @@ CapsuleCollider::CapsuleCollider(ColliderHandle handle, const CapsuleColliderDes
     }
 
     collision_object_->setUserIndex(static_cast<int>(handle_));
+    collision_object_->setUserIndex2(static_cast<int>(BodyCategory::Collider));
     collision_object_->setUserPointer(this);
 }
 
@@ -282,6 +284,7 @@ ConvexHullCollider::ConvexHullCollider(ColliderHandle handle, const ConvexHullCo
     }
 
     collision_object_->setUserIndex(static_cast<int>(handle_));
+    collision_object_->setUserIndex2(static_cast<int>(BodyCategory::Collider));
     collision_object_->setUserPointer(this);
 }
 
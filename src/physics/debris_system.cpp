@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <random>
+#include <realcraft/core/memory.hpp>
 #include <realcraft/physics/convex_hull_generator.hpp>
 #include <realcraft/physics/debris_system.hpp>
 #include <realcraft/physics/impact_damage.hpp>
@@ -31,6 +32,97 @@ struct DebrisSystem::Impl {
 
     Stats stats;
     bool initialized = false;
+
+    // Apply damage for one debris contact; target_type says what was hit
+    void apply_impact(RigidBodyHandle debris_handle, DebrisImpactEvent::TargetType target_type,
+                      const glm::dvec3& contact_point, const glm::dvec3& contact_normal, double impact_velocity) {
+        auto it = debris_map.find(debris_handle);
+        if (it == debris_map.end()) {
+            return;
+        }
+        DebrisData& debris_data = it->second;
+
+        // Check impact cooldown
+        if (current_time - debris_data.last_impact_time < config.impact_cooldown_seconds) {
+            return;
+        }
+
+        // Check velocity threshold
+        if (impact_velocity < config.impact_damage_threshold) {
+            return;
+        }
+
+        // Check mass threshold
+        if (debris_data.total_mass < config.min_debris_mass_kg) {
+            return;
+        }
+
+        // Calculate damage
+        // Kinetic energy: E = 0.5 * m * v^2
+        double kinetic_energy = 0.5 * debris_data.total_mass * impact_velocity * impact_velocity;
+
+        // Brittleness factor - brittle debris shatters and transfers more energy
+        double brittleness_factor = 1.0 + static_cast<double>(debris_data.average_brittleness);
+
+        double damage = kinetic_energy * brittleness_factor * config.damage_velocity_multiplier;
+
+        // Create impact event
+        DebrisImpactEvent event;
+        event.debris_handle = debris_handle;
+        event.impact_point = contact_point;
+        event.impact_normal = contact_normal;
+        event.impact_velocity = impact_velocity;
+        event.damage_amount = damage;
+        event.target_type = target_type;
+
+        // Resolve the block that was hit
+        if (target_type == DebrisImpactEvent::TargetType::Block) {
+            // Find which block was hit using raycast
+            auto hit = physics_world->raycast_voxels(contact_point + contact_normal * 0.1, -contact_normal, 1.0);
+            if (hit && hit->block_position) {
+                event.block_position = hit->block_position;
+                event.block_id = hit->block_id;
+            } else {
+                // Approximate block position from contact point
+                world::WorldBlockPos block_pos{
+                    static_cast<int64_t>(std::floor(contact_point.x - contact_normal.x * 0.5)),
+                    static_cast<int64_t>(std::floor(contact_point.y - contact_normal.y * 0.5)),
+                    static_cast<int64_t>(std::floor(contact_point.z - contact_normal.z * 0.5))};
+                event.block_position = block_pos;
+
+                // Get block type from world
+                world::ChunkPos chunk_pos = world::world_to_chunk(block_pos);
+                world::Chunk* chunk = world_manager->get_chunk(chunk_pos);
+                if (chunk) {
+                    auto local_pos = world::world_to_local(block_pos);
+                    event.block_id = chunk->get_block(local_pos);
+                }
+            }
+        }
+
+        // Update debris data
+        debris_data.last_impact_time = current_time;
+        ++debris_data.impact_count;
+        ++stats.impacts_this_frame;
+        stats.total_damage_dealt += damage;
+
+        // Handle block damage
+        if (event.target_type == DebrisImpactEvent::TargetType::Block && event.block_position.has_value()) {
+            if (impact_handler) {
+                bool destroyed = impact_handler->on_block_impact(
+                    *event.block_position, event.block_id.value_or(world::BLOCK_AIR), damage, -contact_normal);
+
+                if (destroyed) {
+                    ++stats.blocks_destroyed;
+                }
+            }
+        }
+
+        // Invoke callback
+        if (impact_callback) {
+            impact_callback(event);
+        }
+    }
 };
 
 // ============================================================================
@@ -99,7 +191,7 @@ void DebrisSystem::update(double delta_time) {
     impl_->spawned_this_frame = 0;
     impl_->stats.impacts_this_frame = 0;
 
-    std::vector<RigidBodyHandle> to_remove;
+    core::ArenaVector<RigidBodyHandle> to_remove{core::ArenaAllocator<RigidBodyHandle>(core::get_frame_arena())};
     size_t sleeping_count = 0;
 
     for (auto& [handle, data] : impl_->debris_map) {
@@ -291,6 +383,9 @@ RigidBodyHandle DebrisSystem::spawn_single_debris(const std::vector<world::World
     data.marked_for_removal = false;
 
     impl_->debris_map[handle] = std::move(data);
+    if (RigidBody* body = impl_->physics_world->get_rigid_body(handle)) {
+        body->add_body_category(BodyCategory::Debris);
+    }
     ++impl_->spawned_this_frame;
     ++impl_->stats.total_spawned;
     impl_->stats.active_debris = impl_->debris_map.size();
@@ -415,94 +510,41 @@ void DebrisSystem::on_collision(RigidBodyHandle body_a, RigidBodyHandle body_b,
         return;
     }
 
-    DebrisData& debris_data = impl_->debris_map[debris_handle];
-
-    // Check impact cooldown
-    if (impl_->current_time - debris_data.last_impact_time < impl_->config.impact_cooldown_seconds) {
-        return;
-    }
-
-    // Check velocity threshold
-    if (impact_velocity < impl_->config.impact_damage_threshold) {
-        return;
-    }
-
-    // Check mass threshold
-    if (debris_data.total_mass < impl_->config.min_debris_mass_kg) {
-        return;
-    }
-
-    // Calculate damage
-    // Kinetic energy: E = 0.5 * m * v^2
-    double kinetic_energy = 0.5 * debris_data.total_mass * impact_velocity * impact_velocity;
-
-    // Brittleness factor - brittle debris shatters and transfers more energy
-    double brittleness_factor = 1.0 + static_cast<double>(debris_data.average_brittleness);
-
-    double damage = kinetic_energy * brittleness_factor * impl_->config.damage_velocity_multiplier;
-
-    // Create impact event
-    DebrisImpactEvent event;
-    event.debris_handle = debris_handle;
-    event.impact_point = contact_point;
-    event.impact_normal = contact_normal;
-    event.impact_velocity = impact_velocity;
-    event.damage_amount = damage;
-
     // Determine target type
+    auto target_type = DebrisImpactEvent::TargetType::Unknown;
     if (other_handle == INVALID_RIGID_BODY) {
         // Hit static world geometry (chunk collider)
-        event.target_type = DebrisImpactEvent::TargetType::Block;
-
-        // Find which block was hit using raycast
-        auto hit = impl_->physics_world->raycast_voxels(contact_point + contact_normal * 0.1, -contact_normal, 1.0);
-        if (hit && hit->block_position) {
-            event.block_position = hit->block_position;
-            event.block_id = hit->block_id;
-        } else {
-            // Approximate block position from contact point
-            world::WorldBlockPos block_pos{static_cast<int64_t>(std::floor(contact_point.x - contact_normal.x * 0.5)),
-                                           static_cast<int64_t>(std::floor(contact_point.y - contact_normal.y * 0.5)),
-                                           static_cast<int64_t>(std::floor(contact_point.z - contact_normal.z * 0.5))};
-            event.block_position = block_pos;
-
-            // Get block type from world
-            world::ChunkPos chunk_pos = world::world_to_chunk(block_pos);
-            world::Chunk* chunk = impl_->world_manager->get_chunk(chunk_pos);
-            if (chunk) {
-                auto local_pos = world::world_to_local(block_pos);
-                event.block_id = chunk->get_block(local_pos);
-            }
-        }
+        target_type = DebrisImpactEvent::TargetType::Block;
     } else if (impl_->debris_map.count(other_handle)) {
-        event.target_type = DebrisImpactEvent::TargetType::OtherDebris;
-    } else {
-        // Could be player or entity - for now mark as unknown
-        // Phase 8 will add entity detection
-        event.target_type = DebrisImpactEvent::TargetType::Unknown;
+        target_type = DebrisImpactEvent::TargetType::OtherDebris;
     }
 
-    // Update debris data
-    debris_data.last_impact_time = impl_->current_time;
-    ++debris_data.impact_count;
-    ++impl_->stats.impacts_this_frame;
-    impl_->stats.total_damage_dealt += damage;
+    impl_->apply_impact(debris_handle, target_type, contact_point, contact_normal, impact_velocity);
+}
 
-    // Handle block damage
-    if (event.target_type == DebrisImpactEvent::TargetType::Block && event.block_position.has_value()) {
-        if (impl_->impact_handler) {
-            bool destroyed = impl_->impact_handler->on_block_impact(
-                *event.block_position, event.block_id.value_or(world::BLOCK_AIR), damage, -contact_normal);
+void DebrisSystem::process_contacts(std::span<const ContactRecord> contacts) {
+    if (!impl_->initialized || !impl_->config.enable_impact_damage) {
+        return;
+    }
 
-            if (destroyed) {
-                ++impl_->stats.blocks_destroyed;
-            }
+    for (const ContactRecord& contact : contacts) {
+        // Classify from the category bits; only debris contacts matter
+        const bool a_is_debris = has_category(contact.category_a, BodyCategory::Debris);
+        if (!a_is_debris && !has_category(contact.category_b, BodyCategory::Debris)) {
+            continue;
+        }
+        const RigidBodyHandle debris_handle = a_is_debris ? contact.handle_a : contact.handle_b;
+        const uint32_t other_category = a_is_debris ? contact.category_b : contact.category_a;
+
+        // Could be player or entity when neither - for now mark as unknown
+        auto target_type = DebrisImpactEvent::TargetType::Unknown;
+        if (has_category(other_category, BodyCategory::Chunk)) {
+            target_type = DebrisImpactEvent::TargetType::Block;
+        } else if (has_category(other_category, BodyCategory::Debris)) {
+            target_type = DebrisImpactEvent::TargetType::OtherDebris;
         }
-    }
 
-    // Invoke callback
-    if (impl_->impact_callback) {
-        impl_->impact_callback(event);
+        impl_->apply_impact(debris_handle, target_type, contact.point, contact.normal, contact.normal_velocity);
     }
 }
 
@@ -5,6 +5,7 @@
 #include <chrono>
 #include <cmath>
 #include <queue>
+#include <realcraft/core/memory.hpp>
 #include <realcraft/physics/fluid_simulation.hpp>
 #include <realcraft/physics/physics_world.hpp>
 #include <unordered_set>
@@ -26,8 +27,13 @@ struct FluidSimulation::Impl {
     // Cached water block ID for quick comparisons
     world::BlockId water_block_id = world::BLOCK_INVALID;
 
-    // Active water blocks that need updates (positions queued for processing)
-    std::unordered_set<world::WorldBlockPos> active_water_blocks;
+    // Active water blocks that need updates (positions queued for processing).
+    // Their hash nodes churn as water spreads and settles, so they come from a pool.
+    core::PoolAllocator node_pool{64};
+    std::unordered_set<world::WorldBlockPos, std::hash<world::WorldBlockPos>, std::equal_to<world::WorldBlockPos>,
+                       core::PoolStdAllocator<world::WorldBlockPos>>
+        active_water_blocks{0, std::hash<world::WorldBlockPos>{}, std::equal_to<world::WorldBlockPos>{},
+                            core::PoolStdAllocator<world::WorldBlockPos>{node_pool}};
     std::queue<world::WorldBlockPos> update_queue;
 
     // Callback for fluid events
@@ -268,7 +274,10 @@ struct FluidSimulation::Impl {
         // 2. Horizontal spread (if not source or still has water)
         if (remaining_level > config.min_flow_level || is_source) {
             // Find valid horizontal neighbors
-            std::vector<world::WorldBlockPos> valid_neighbors;
+            core::ArenaScope scope(core::get_job_arena());
+            core::ArenaVector<world::WorldBlockPos> valid_neighbors{
+                core::ArenaAllocator<world::WorldBlockPos>(scope.arena())};
+            valid_neighbors.reserve(4);
 
             for (const auto& offset : HORIZONTAL_OFFSETS) {
                 world::WorldBlockPos neighbor = pos + world::WorldBlockPos(offset);
@@ -448,7 +457,10 @@ void FluidSimulation::update(double delta_time) {
 
     // Process update queue with a limit
     uint32_t updates_processed = 0;
-    std::unordered_set<world::WorldBlockPos> processed_this_frame;
+    std::unordered_set<world::WorldBlockPos, std::hash<world::WorldBlockPos>, std::equal_to<world::WorldBlockPos>,
+                       core::ArenaAllocator<world::WorldBlockPos>>
+        processed_this_frame{0, std::hash<world::WorldBlockPos>{}, std::equal_to<world::WorldBlockPos>{},
+                             core::ArenaAllocator<world::WorldBlockPos>(core::get_frame_arena())};
 
     while (!impl_->update_queue.empty() && updates_processed < impl_->config.max_updates_per_frame) {
         world::WorldBlockPos pos = impl_->update_queue.front();
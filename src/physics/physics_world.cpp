@@ -3,8 +3,10 @@
 
 #include <btBulletDynamicsCommon.h>
 #include <chrono>
+#include <cmath>
 #include <mutex>
 #include <realcraft/core/logger.hpp>
+#include <realcraft/core/profiler.hpp>
 #include <realcraft/physics/impact_damage.hpp>
 #include <realcraft/physics/physics_world.hpp>
 #include <realcraft/world/block.hpp>
@@ -51,11 +53,15 @@ struct PhysicsWorld::Impl {
     // Collision callback
     CollisionCallback collision_callback;
 
+    // Penetrating contacts of the last step, reused across steps
+    std::vector<ContactRecord> contacts;
+
     // Interpolation alpha for rendering
     double interpolation_alpha = 0.0;
 
     // Stats
     double last_step_time_ms = 0.0;
+    double last_shift_time_ms = 0.0;
 
     // Structural integrity system
     std::unique_ptr<StructuralIntegritySystem> structural_integrity;
@@ -94,7 +100,98 @@ struct PhysicsWorld::Impl {
         return true;
     }
 
+    // Single pass over Bullet's manifolds. Bodies are classified by the
+    // BodyCategory bits in their second user index.
+    void gather_contacts() {
+        REALCRAFT_PROFILE_ZONE("Physics: Contacts");
+        contacts.clear();
+
+        const int num_manifolds = dispatcher->getNumManifolds();
+        for (int i = 0; i < num_manifolds; ++i) {
+            const btPersistentManifold* manifold = dispatcher->getManifoldByIndexInternal(i);
+            if (!manifold || manifold->getNumContacts() == 0) {
+                continue;
+            }
+
+            const btCollisionObject* obj_a = manifold->getBody0();
+            const btCollisionObject* obj_b = manifold->getBody1();
+            const auto category_a = static_cast<uint32_t>(obj_a->getUserIndex2());
+            const auto category_b = static_cast<uint32_t>(obj_b->getUserIndex2());
+
+            // Chunks carry no handle
+            const uint32_t handle_a =
+                has_category(category_a, BodyCategory::Chunk) ? 0 : static_cast<uint32_t>(obj_a->getUserIndex());
+            const uint32_t handle_b =
+                has_category(category_b, BodyCategory::Chunk) ? 0 : static_cast<uint32_t>(obj_b->getUserIndex());
+
+            // Relative velocity is per manifold; only its normal component varies per point
+            btVector3 relative_velocity(0, 0, 0);
+            if (const btRigidBody* body_a = btRigidBody::upcast(obj_a)) {
+                relative_velocity += body_a->getLinearVelocity();
+            }
+            if (const btRigidBody* body_b = btRigidBody::upcast(obj_b)) {
+                relative_velocity -= body_b->getLinearVelocity();
+            }
+
+            for (int j = 0; j < manifold->getNumContacts(); ++j) {
+                const btManifoldPoint& pt = manifold->getContactPoint(j);
+                if (pt.getDistance() >= 0.0f) {
+                    continue;
+                }
+
+                ContactRecord& contact = contacts.emplace_back();
+                contact.handle_a = handle_a;
+                contact.handle_b = handle_b;
+                contact.category_a = category_a;
+                contact.category_b = category_b;
+                contact.point = glm::dvec3(pt.getPositionWorldOnA().getX(), pt.getPositionWorldOnA().getY(),
+                                           pt.getPositionWorldOnA().getZ());
+                contact.normal =
+                    glm::dvec3(pt.m_normalWorldOnB.getX(), pt.m_normalWorldOnB.getY(), pt.m_normalWorldOnB.getZ());
+                contact.penetration_depth = static_cast<double>(-pt.getDistance());
+                contact.impulse = static_cast<double>(pt.getAppliedImpulse());
+                contact.normal_velocity = static_cast<double>(std::abs(relative_velocity.dot(pt.m_normalWorldOnB)));
+            }
+        }
+    }
+
+    // Translate every node volume and proxy bounds of the broadphase trees.
+    // Bodies move by the same amount, so their proxies stay inside their
+    // volumes and Bullet neither reinserts them nor searches for new pairs,
+    // which it would otherwise do for every proxy on the next step.
+    void translate_broadphase(const glm::dvec3& translation) {
+        const btVector3 shift(static_cast<btScalar>(translation.x), static_cast<btScalar>(translation.y),
+                              static_cast<btScalar>(translation.z));
+
+        for (btDbvt& tree : broadphase->m_sets) {
+            if (tree.m_root == nullptr) {
+                continue;
+            }
+
+            // Iterative so deep trees cannot overflow the stack
+            btAlignedObjectArray<btDbvtNode*> stack;
+            stack.push_back(tree.m_root);
+            while (stack.size() > 0) {
+                btDbvtNode* node = stack[stack.size() - 1];
+                stack.pop_back();
+
+                node->volume.tMins() += shift;
+                node->volume.tMaxs() += shift;
+                if (node->isleaf()) {
+                    auto* proxy = static_cast<btDbvtProxy*>(node->data);
+                    proxy->m_aabbMin += shift;
+                    proxy->m_aabbMax += shift;
+                } else {
+                    stack.push_back(node->childs[0]);
+                    stack.push_back(node->childs[1]);
+                }
+            }
+        }
+    }
+
     void shutdown_bullet() {
+        contacts.clear();
+
         // Remove all collision objects first
         {
             std::lock_guard<std::mutex> lock(chunk_mutex);
@@ -260,6 +357,7 @@ void PhysicsWorld::fixed_update(double fixed_delta) {
     if (!impl_->initialized || !impl_->dynamics_world) {
         return;
     }
+    REALCRAFT_PROFILE_ZONE("PhysicsWorld::fixed_update");
 
     auto start = std::chrono::high_resolution_clock::now();
 
@@ -273,41 +371,31 @@ void PhysicsWorld::fixed_update(double fixed_delta) {
 
     // Step the physics simulation
     // This applies gravity, forces, collision response, and constraint solving
-    impl_->dynamics_world->stepSimulation(static_cast<btScalar>(fixed_delta), impl_->config.max_substeps,
-                                          static_cast<btScalar>(impl_->config.fixed_timestep));
+    {
+        REALCRAFT_PROFILE_ZONE("Physics: stepSimulation");
+        impl_->dynamics_world->stepSimulation(static_cast<btScalar>(fixed_delta), impl_->config.max_substeps,
+                                              static_cast<btScalar>(impl_->config.fixed_timestep));
+    }
+
+    // Gather contacts once; every consumer below reads the buffer
+    impl_->gather_contacts();
 
     // Process collision callbacks
     if (impl_->collision_callback) {
-        int num_manifolds = impl_->dispatcher->getNumManifolds();
-        for (int i = 0; i < num_manifolds; ++i) {
-            btPersistentManifold* manifold = impl_->dispatcher->getManifoldByIndexInternal(i);
-            if (!manifold) {
-                continue;
-            }
-
-            const btCollisionObject* obj_a = manifold->getBody0();
-            const btCollisionObject* obj_b = manifold->getBody1();
-
-            for (int j = 0; j < manifold->getNumContacts(); ++j) {
-                const btManifoldPoint& pt = manifold->getContactPoint(j);
-                if (pt.getDistance() < 0.0f) {
-                    CollisionEvent event;
-                    event.collider_a = static_cast<ColliderHandle>(obj_a->getUserIndex());
-                    event.collider_b = static_cast<ColliderHandle>(obj_b->getUserIndex());
-                    event.contact_point = glm::dvec3(pt.getPositionWorldOnA().getX(), pt.getPositionWorldOnA().getY(),
-                                                     pt.getPositionWorldOnA().getZ());
-                    event.contact_normal =
-                        glm::dvec3(pt.m_normalWorldOnB.getX(), pt.m_normalWorldOnB.getY(), pt.m_normalWorldOnB.getZ());
-                    event.penetration_depth = static_cast<double>(-pt.getDistance());
-
-                    impl_->collision_callback(event);
-                }
-            }
+        for (const ContactRecord& contact : impl_->contacts) {
+            CollisionEvent event;
+            event.collider_a = contact.handle_a;
+            event.collider_b = contact.handle_b;
+            event.contact_point = contact.point;
+            event.contact_normal = contact.normal;
+            event.penetration_depth = contact.penetration_depth;
+            impl_->collision_callback(event);
         }
     }
 
     // Update fluid simulation system
     if (impl_->fluid_simulation && impl_->fluid_simulation->is_enabled()) {
+        REALCRAFT_PROFILE_ZONE("Physics: Fluids");
         impl_->fluid_simulation->update(fixed_delta);
 
         // Apply buoyancy and drag forces to all dynamic rigid bodies
@@ -351,71 +439,19 @@ void PhysicsWorld::fixed_update(double fixed_delta) {
 
     // Update structural integrity system
     if (impl_->structural_integrity) {
+        REALCRAFT_PROFILE_ZONE("Physics: Structural Integrity");
         impl_->structural_integrity->update(fixed_delta);
     }
 
     // Update debris system
     if (impl_->debris_system) {
+        REALCRAFT_PROFILE_ZONE("Physics: Debris");
         impl_->debris_system->update(fixed_delta);
     }
 
     // Process debris collisions for impact damage
     if (impl_->debris_system) {
-        int num_manifolds = impl_->dispatcher->getNumManifolds();
-        for (int i = 0; i < num_manifolds; ++i) {
-            btPersistentManifold* manifold = impl_->dispatcher->getManifoldByIndexInternal(i);
-            if (!manifold) {
-                continue;
-            }
-
-            const btCollisionObject* obj_a = manifold->getBody0();
-            const btCollisionObject* obj_b = manifold->getBody1();
-
-            // Get rigid body handles
-            RigidBodyHandle handle_a = static_cast<RigidBodyHandle>(obj_a->getUserIndex());
-            RigidBodyHandle handle_b = static_cast<RigidBodyHandle>(obj_b->getUserIndex());
-
-            // Check if either is debris
-            bool a_is_debris = impl_->debris_system->is_debris(handle_a);
-            bool b_is_debris = impl_->debris_system->is_debris(handle_b);
-
-            if (!a_is_debris && !b_is_debris) {
-                continue;
-            }
-
-            for (int j = 0; j < manifold->getNumContacts(); ++j) {
-                const btManifoldPoint& pt = manifold->getContactPoint(j);
-                if (pt.getDistance() < 0.0f) {
-                    glm::dvec3 contact_point(pt.getPositionWorldOnA().getX(), pt.getPositionWorldOnA().getY(),
-                                             pt.getPositionWorldOnA().getZ());
-                    glm::dvec3 contact_normal(pt.m_normalWorldOnB.getX(), pt.m_normalWorldOnB.getY(),
-                                              pt.m_normalWorldOnB.getZ());
-
-                    // Calculate impact velocity
-                    double impact_velocity = 0.0;
-                    const btRigidBody* body_a = btRigidBody::upcast(obj_a);
-                    const btRigidBody* body_b = btRigidBody::upcast(obj_b);
-
-                    if (body_a && body_b) {
-                        btVector3 rel_vel = body_a->getLinearVelocity() - body_b->getLinearVelocity();
-                        impact_velocity = static_cast<double>(std::abs(rel_vel.dot(
-                            btVector3(static_cast<btScalar>(contact_normal.x), static_cast<btScalar>(contact_normal.y),
-                                      static_cast<btScalar>(contact_normal.z)))));
-                    } else if (body_a) {
-                        impact_velocity = static_cast<double>(std::abs(body_a->getLinearVelocity().dot(
-                            btVector3(static_cast<btScalar>(contact_normal.x), static_cast<btScalar>(contact_normal.y),
-                                      static_cast<btScalar>(contact_normal.z)))));
-                    } else if (body_b) {
-                        impact_velocity = static_cast<double>(std::abs(body_b->getLinearVelocity().dot(
-                            btVector3(static_cast<btScalar>(contact_normal.x), static_cast<btScalar>(contact_normal.y),
-                                      static_cast<btScalar>(contact_normal.z)))));
-                    }
-
-                    impl_->debris_system->on_collision(handle_a, handle_b, contact_point, contact_normal,
-                                                       impact_velocity);
-                }
-            }
-        }
+        impl_->debris_system->process_contacts(impl_->contacts);
     }
 
     auto end = std::chrono::high_resolution_clock::now();
@@ -707,6 +743,10 @@ void PhysicsWorld::set_collision_callback(CollisionCallback callback) {
     impl_->collision_callback = std::move(callback);
 }
 
+std::span<const ContactRecord> PhysicsWorld::get_contacts() const {
+    return impl_->contacts;
+}
+
 // ============================================================================
 // IWorldObserver Implementation
 // ============================================================================
@@ -782,6 +822,9 @@ void PhysicsWorld::on_block_changed(const world::BlockChangeEvent& event) {
 }
 
 void PhysicsWorld::on_origin_shifted(const world::WorldBlockPos& old_origin, const world::WorldBlockPos& new_origin) {
+    REALCRAFT_PROFILE_ZONE("PhysicsWorld::on_origin_shifted");
+    auto start = std::chrono::high_resolution_clock::now();
+
     glm::dvec3 delta(static_cast<double>(new_origin.x - old_origin.x), static_cast<double>(new_origin.y - old_origin.y),
                      static_cast<double>(new_origin.z - old_origin.z));
 
@@ -795,6 +838,14 @@ void PhysicsWorld::on_origin_shifted(const world::WorldBlockPos& old_origin, con
         }
     }
 
+    // Update all collider positions
+    {
+        std::lock_guard<std::mutex> lock(impl_->collider_mutex);
+        for (auto& [handle, collider] : impl_->colliders) {
+            collider->set_position(collider->get_position() - delta);
+        }
+    }
+
     // Update all rigid body positions
     {
         std::lock_guard<std::mutex> lock(impl_->rigid_body_mutex);
@@ -803,8 +854,17 @@ void PhysicsWorld::on_origin_shifted(const world::WorldBlockPos& old_origin, con
         }
     }
 
-    REALCRAFT_LOG_DEBUG(core::log_category::PHYSICS, "Origin shifted, new offset: ({}, {}, {})", impl_->origin_offset.x,
-                        impl_->origin_offset.y, impl_->origin_offset.z);
+    // Move the broadphase with them so the next step has nothing to refit
+    if (impl_->broadphase) {
+        impl_->translate_broadphase(-delta);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    impl_->last_shift_time_ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+    REALCRAFT_LOG_DEBUG(core::log_category::PHYSICS, "Origin shifted in {:.3f} ms, new offset: ({}, {}, {})",
+                        impl_->last_shift_time_ms, impl_->origin_offset.x, impl_->origin_offset.y,
+                        impl_->origin_offset.z);
 }
 
 // ============================================================================
@@ -856,6 +916,7 @@ PhysicsWorld::DebugStats PhysicsWorld::get_stats() const {
     }
 
     stats.last_step_time_ms = impl_->last_step_time_ms;
+    stats.last_shift_time_ms = impl_->last_shift_time_ms;
 
     return stats;
 }
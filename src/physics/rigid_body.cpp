@@ -174,12 +174,27 @@ void RigidBody::create_rigid_body(const RigidBodyDesc& desc) {
 
     // Store handle and pointer for callbacks
     rigid_body_->setUserIndex(static_cast<int>(handle_));
+    rigid_body_->setUserIndex2(static_cast<int>(BodyCategory::RigidBody));
     rigid_body_->setUserPointer(this);
 
     // Initial gravity will be set when added to world
     update_gravity();
 }
 
+// ============================================================================
+// Identification
+// ============================================================================
+
+uint32_t RigidBody::get_body_categories() const {
+    return rigid_body_ ? static_cast<uint32_t>(rigid_body_->getUserIndex2()) : 0;
+}
+
+void RigidBody::add_body_category(BodyCategory category) {
+    if (rigid_body_) {
+        rigid_body_->setUserIndex2(static_cast<int>(get_body_categories() | static_cast<uint32_t>(category)));
+    }
+}
+
 // ============================================================================
 // Transform
 // ============================================================================
@@ -451,6 +466,11 @@ void RigidBody::apply_origin_shift(const glm::dvec3& shift) {
     transform.setOrigin(new_origin);
     rigid_body_->setWorldTransform(transform);
 
+    // Bullet interpolates from this between substeps
+    btTransform interpolation = rigid_body_->getInterpolationWorldTransform();
+    interpolation.setOrigin(interpolation.getOrigin() - glm_to_bullet_vec(shift));
+    rigid_body_->setInterpolationWorldTransform(interpolation);
+
     // Update motion state
     if (motion_state_) {
         motion_state_->setWorldTransform(transform);
@@ -0,0 +1,518 @@
+// RealCraft Platform Abstraction Layer
+// asset_archive.cpp - Packed asset archive reader, writer and asset store
+
+#include <spdlog/spdlog.h>
+#include <zstd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <realcraft/platform/asset_archive.hpp>
+#include <realcraft/platform/file_io.hpp>
+
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace realcraft::platform {
+
+uint64_t asset_path_hash(std::string_view path) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : path) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+namespace {
+
+// ============================================================================
+// File Mapping
+// ============================================================================
+
+// Read-only mapping of a whole file
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { unmap(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool map(const fs::path& path) {
+        unmap();
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+            CloseHandle(file);
+            return false;
+        }
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping) {
+            return false;
+        }
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);  // The view keeps the mapping alive
+        if (!view) {
+            return false;
+        }
+        data_ = static_cast<const uint8_t*>(view);
+        size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat info {};
+        if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+            ::close(fd);
+            return false;
+        }
+        void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // The mapping keeps the file alive
+        if (view == MAP_FAILED) {
+            return false;
+        }
+        data_ = static_cast<const uint8_t*>(view);
+        size_ = static_cast<size_t>(info.st_size);
+#endif
+        return true;
+    }
+
+    void unmap() {
+        if (!data_) {
+            return;
+        }
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+        UnmapViewOfFile(data_);
+#else
+        ::munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    [[nodiscard]] std::span<const uint8_t> bytes() const { return {data_, size_}; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+template <typename T>
+T read_pod(std::span<const uint8_t> bytes, uint64_t offset) {
+    T value;
+    std::memcpy(&value, bytes.data() + offset, sizeof(T));
+    return value;
+}
+
+std::string normalize_asset_path(std::string path) {
+    std::replace(path.begin(), path.end(), '\\', '/');
+    while (path.starts_with("./")) {
+        path.erase(0, 2);
+    }
+    return path;
+}
+
+uint64_t align_up(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace
+
+// ============================================================================
+// AssetArchive
+// ============================================================================
+
+struct AssetArchive::Impl {
+    fs::path path;
+    MappedFile mapping;
+    std::vector<AssetTocEntry> toc;  // Copied out of the mapping; small
+    uint64_t strings_offset = 0;
+
+    [[nodiscard]] std::string_view entry_path(const AssetTocEntry& entry) const {
+        const auto bytes = mapping.bytes();
+        return {reinterpret_cast<const char*>(bytes.data() + strings_offset + entry.path_offset), entry.path_length};
+    }
+
+    [[nodiscard]] const AssetTocEntry* lookup(std::string_view asset_path) const {
+        const uint64_t hash = asset_path_hash(asset_path);
+        auto it = std::lower_bound(toc.begin(), toc.end(), hash,
+                                   [](const AssetTocEntry& entry, uint64_t key) { return entry.path_hash < key; });
+        for (; it != toc.end() && it->path_hash == hash; ++it) {
+            if (entry_path(*it) == asset_path) {
+                return &*it;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] std::span<const uint8_t> stored_bytes(const AssetTocEntry& entry) const {
+        return mapping.bytes().subspan(entry.offset, entry.stored_size);
+    }
+
+    bool validate() {
+        const auto bytes = mapping.bytes();
+        if (bytes.size() < sizeof(AssetArchiveHeader)) {
+            return false;
+        }
+
+        const auto header = read_pod<AssetArchiveHeader>(bytes, 0);
+        if (header.magic != ASSET_ARCHIVE_MAGIC || header.version != ASSET_ARCHIVE_VERSION) {
+            return false;
+        }
+
+        const uint64_t toc_bytes = uint64_t{header.entry_count} * sizeof(AssetTocEntry);
+        if (header.toc_offset > bytes.size() || toc_bytes > bytes.size() - header.toc_offset ||
+            header.strings_offset > bytes.size()) {
+            return false;
+        }
+
+        toc.resize(header.entry_count);
+        std::memcpy(toc.data(), bytes.data() + header.toc_offset, toc_bytes);
+        strings_offset = header.strings_offset;
+
+        const uint64_t strings_size = bytes.size() - strings_offset;
+        for (const auto& entry : toc) {
+            if (entry.offset > bytes.size() || entry.stored_size > bytes.size() - entry.offset ||
+                uint64_t{entry.path_offset} + entry.path_length > strings_size ||
+                entry.compression > static_cast<uint32_t>(AssetCompression::Zstd)) {
+                return false;
+            }
+        }
+        return std::is_sorted(toc.begin(), toc.end(),
+                              [](const AssetTocEntry& a, const AssetTocEntry& b) { return a.path_hash < b.path_hash; });
+    }
+};
+
+AssetArchive::AssetArchive() : impl_(std::make_unique<Impl>()) {}
+
+AssetArchive::~AssetArchive() = default;
+
+AssetArchive::AssetArchive(AssetArchive&&) noexcept = default;
+
+AssetArchive& AssetArchive::operator=(AssetArchive&&) noexcept = default;
+
+bool AssetArchive::open(const fs::path& path) {
+    close();
+
+    if (!impl_->mapping.map(path)) {
+        spdlog::debug("Asset archive not available: {}", path.string());
+        return false;
+    }
+    if (!impl_->validate()) {
+        spdlog::error("Invalid asset archive: {}", path.string());
+        close();
+        return false;
+    }
+
+    impl_->path = path;
+    spdlog::info("Mapped asset archive '{}' ({} entries, {} bytes)", path.string(), impl_->toc.size(),
+                 impl_->mapping.bytes().size());
+    return true;
+}
+
+void AssetArchive::close() {
+    impl_->mapping.unmap();
+    impl_->toc.clear();
+    impl_->strings_offset = 0;
+    impl_->path.clear();
+}
+
+bool AssetArchive::is_open() const {
+    return !impl_->mapping.bytes().empty();
+}
+
+const fs::path& AssetArchive::path() const {
+    return impl_->path;
+}
+
+size_t AssetArchive::entry_count() const {
+    return impl_->toc.size();
+}
+
+bool AssetArchive::contains(std::string_view path) const {
+    return impl_->lookup(path) != nullptr;
+}
+
+std::optional<AssetEntryInfo> AssetArchive::find(std::string_view path) const {
+    const AssetTocEntry* entry = impl_->lookup(path);
+    if (!entry) {
+        return std::nullopt;
+    }
+    AssetEntryInfo info;
+    info.path = impl_->entry_path(*entry);
+    info.size = entry->size;
+    info.stored_size = entry->stored_size;
+    info.compression = static_cast<AssetCompression>(entry->compression);
+    return info;
+}
+
+std::optional<std::span<const uint8_t>> AssetArchive::view(std::string_view path) const {
+    const AssetTocEntry* entry = impl_->lookup(path);
+    if (!entry || entry->compression != static_cast<uint32_t>(AssetCompression::None)) {
+        return std::nullopt;
+    }
+    return impl_->stored_bytes(*entry);
+}
+
+std::optional<std::vector<uint8_t>> AssetArchive::read(std::string_view path) const {
+    const AssetTocEntry* entry = impl_->lookup(path);
+    if (!entry) {
+        return std::nullopt;
+    }
+
+    const auto stored = impl_->stored_bytes(*entry);
+    if (entry->compression == static_cast<uint32_t>(AssetCompression::None)) {
+        return std::vector<uint8_t>(stored.begin(), stored.end());
+    }
+
+    std::vector<uint8_t> result(entry->size);
+    const size_t written = ZSTD_decompress(result.data(), result.size(), stored.data(), stored.size());
+    if (ZSTD_isError(written) || written != result.size()) {
+        spdlog::error("Failed to decompress asset '{}' from archive", path);
+        return std::nullopt;
+    }
+    return result;
+}
+
+// ============================================================================
+// AssetArchiveWriter
+// ============================================================================
+
+struct AssetArchiveWriter::Impl {
+    struct PendingEntry {
+        std::vector<uint8_t> data;
+        bool allow_compression = true;
+    };
+
+    AssetArchiveWriterConfig config;
+    std::map<std::string, PendingEntry> entries;
+};
+
+AssetArchiveWriter::AssetArchiveWriter(const AssetArchiveWriterConfig& config) : impl_(std::make_unique<Impl>()) {
+    impl_->config = config;
+}
+
+AssetArchiveWriter::~AssetArchiveWriter() = default;
+
+void AssetArchiveWriter::add(std::string path, std::vector<uint8_t> data, bool allow_compression) {
+    impl_->entries[normalize_asset_path(std::move(path))] = {std::move(data), allow_compression};
+}
+
+size_t AssetArchiveWriter::add_directory(const fs::path& root, std::string_view prefix) {
+    size_t added = 0;
+    for (const auto& file : FileSystem::list_files(root, "", true)) {
+        if (file.filename().string().starts_with(".")) {
+            continue;  // Hidden files and .gitkeep placeholders
+        }
+        auto data = FileSystem::read_binary(file);
+        if (!data) {
+            spdlog::warn("Skipping unreadable asset: {}", file.string());
+            continue;
+        }
+        std::string relative = fs::relative(file, root).generic_string();
+        add(prefix.empty() ? relative : std::string(prefix) + "/" + relative, std::move(*data));
+        ++added;
+    }
+    return added;
+}
+
+size_t AssetArchiveWriter::entry_count() const {
+    return impl_->entries.size();
+}
+
+bool AssetArchiveWriter::write(const fs::path& output) const {
+    const auto& config = impl_->config;
+
+    struct Packed {
+        const std::string* path;
+        AssetTocEntry toc;
+        std::vector<uint8_t> compressed;  // Empty when stored raw
+    };
+    std::vector<Packed> packed;
+    packed.reserve(impl_->entries.size());
+
+    // Compress, then lay out data blobs in path order
+    uint64_t offset = sizeof(AssetArchiveHeader);
+    std::string strings;
+    for (const auto& [path, entry] : impl_->entries) {
+        Packed item{&path, {}, {}};
+        item.toc.path_hash = asset_path_hash(path);
+        item.toc.size = entry.data.size();
+        item.toc.stored_size = entry.data.size();
+
+        if (entry.allow_compression && entry.data.size() >= config.min_compress_size) {
+            std::vector<uint8_t> compressed(ZSTD_compressBound(entry.data.size()));
+            const size_t size = ZSTD_compress(compressed.data(), compressed.size(), entry.data.data(),
+                                              entry.data.size(), config.compression_level);
+            const auto limit = static_cast<double>(entry.data.size()) * (1.0 - config.min_compression_gain);
+            if (!ZSTD_isError(size) && static_cast<double>(size) <= limit) {
+                compressed.resize(size);
+                item.compressed = std::move(compressed);
+                item.toc.compression = static_cast<uint32_t>(AssetCompression::Zstd);
+                item.toc.stored_size = size;
+            }
+        }
+
+        offset = align_up(offset, ASSET_ARCHIVE_ALIGNMENT);
+        item.toc.offset = offset;
+        offset += item.toc.stored_size;
+
+        item.toc.path_offset = static_cast<uint32_t>(strings.size());
+        item.toc.path_length = static_cast<uint32_t>(path.size());
+        strings += path;
+
+        packed.push_back(std::move(item));
+    }
+
+    AssetArchiveHeader header;
+    header.entry_count = static_cast<uint32_t>(packed.size());
+    header.toc_offset = align_up(offset, ASSET_ARCHIVE_ALIGNMENT);
+    header.strings_offset = header.toc_offset + packed.size() * sizeof(AssetTocEntry);
+
+    std::vector<AssetTocEntry> toc;
+    toc.reserve(packed.size());
+    for (const auto& item : packed) {
+        toc.push_back(item.toc);
+    }
+    std::sort(toc.begin(), toc.end(), [&strings](const AssetTocEntry& a, const AssetTocEntry& b) {
+        if (a.path_hash != b.path_hash) {
+            return a.path_hash < b.path_hash;
+        }
+        return std::string_view(strings).substr(a.path_offset, a.path_length) <
+               std::string_view(strings).substr(b.path_offset, b.path_length);
+    });
+
+    // Assemble in memory
+    std::vector<uint8_t> out(header.strings_offset + strings.size(), 0);
+    std::memcpy(out.data(), &header, sizeof(header));
+    for (const auto& item : packed) {
+        const auto& source = item.compressed.empty() ? impl_->entries.at(*item.path).data : item.compressed;
+        if (!source.empty()) {
+            std::memcpy(out.data() + item.toc.offset, source.data(), source.size());
+        }
+    }
+    if (!toc.empty()) {
+        std::memcpy(out.data() + header.toc_offset, toc.data(), toc.size() * sizeof(AssetTocEntry));
+    }
+    std::memcpy(out.data() + header.strings_offset, strings.data(), strings.size());
+
+    // Write beside the target and rename over it, so a process that still
+    // has the old archive mapped never sees it truncated
+    fs::path temp = output;
+    temp += ".tmp";
+    if (!FileSystem::write_binary(temp, out)) {
+        spdlog::error("Failed to write asset archive: {}", output.string());
+        return false;
+    }
+    std::error_code ec;
+    fs::rename(temp, output, ec);
+    if (ec) {
+        spdlog::error("Failed to replace asset archive '{}': {}", output.string(), ec.message());
+        FileSystem::remove(temp);
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// AssetStore
+// ============================================================================
+
+struct AssetStore::Impl {
+    AssetStoreConfig config;
+    AssetArchive archive;
+    bool loose_enabled = false;
+
+    [[nodiscard]] std::optional<fs::path> loose_path(std::string_view path) const {
+        if (!loose_enabled) {
+            return std::nullopt;
+        }
+        fs::path full = config.loose_root / fs::path(path);
+        if (!FileSystem::is_file(full)) {
+            return std::nullopt;
+        }
+        return full;
+    }
+};
+
+AssetStore::AssetStore() : impl_(std::make_unique<Impl>()) {}
+
+AssetStore::~AssetStore() = default;
+
+bool AssetStore::initialize(const AssetStoreConfig& config) {
+    shutdown();
+    impl_->config = config;
+
+    if (!config.archive_path.empty()) {
+        impl_->archive.open(config.archive_path);
+    }
+    impl_->loose_enabled =
+        config.allow_loose_files && !config.loose_root.empty() && FileSystem::is_directory(config.loose_root);
+
+    if (!impl_->archive.is_open() && !impl_->loose_enabled) {
+        spdlog::warn("No asset source available (archive: '{}', loose root: '{}')", config.archive_path.string(),
+                     config.loose_root.string());
+        return false;
+    }
+    if (impl_->loose_enabled) {
+        spdlog::info("Loose asset files enabled: {}", config.loose_root.string());
+    }
+    return true;
+}
+
+void AssetStore::shutdown() {
+    impl_->archive.close();
+    impl_->loose_enabled = false;
+}
+
+bool AssetStore::has_archive() const {
+    return impl_->archive.is_open();
+}
+
+bool AssetStore::exists(std::string_view path) const {
+    return impl_->archive.contains(path) || impl_->loose_path(path).has_value();
+}
+
+std::optional<std::vector<uint8_t>> AssetStore::read_binary(std::string_view path) const {
+    if (auto data = impl_->archive.read(path)) {
+        return data;
+    }
+    if (auto full = impl_->loose_path(path)) {
+        return FileSystem::read_binary(*full);
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string> AssetStore::read_text(std::string_view path) const {
+    if (auto view = impl_->archive.view(path)) {
+        return std::string(view->begin(), view->end());
+    }
+    if (auto data = impl_->archive.read(path)) {
+        return std::string(data->begin(), data->end());
+    }
+    if (auto full = impl_->loose_path(path)) {
+        return FileSystem::read_text(*full);
+    }
+    return std::nullopt;
+}
+
+std::optional<std::span<const uint8_t>> AssetStore::view(std::string_view path) const {
+    return impl_->archive.view(path);
+}
+
+}  // namespace realcraft::platform
@@ -4,6 +4,8 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <fstream>
 #include <future>
 #include <mutex>
@@ -240,12 +242,77 @@ bool FileSystem::write_text(const fs::path& path, std::string_view content) {
     }
 }
 
-std::future<FileSystem::BinaryResult> FileSystem::read_binary_async(const fs::path& path) {
-    return std::async(std::launch::async, [path]() { return read_binary(path); });
+namespace {
+
+// Run `read` on the shared I/O executor and hand its result to `complete`,
+// either on the worker or through the requested completion queue
+template <typename Result, typename Read, typename Complete>
+void submit_read(Read read, Complete complete, const IoRequestOptions& options) {
+    CompletionQueue* queue = options.completion_queue;
+    CancellationToken token = options.token;
+    IoExecutor::shared().submit(
+        [read = std::move(read), complete = std::move(complete), queue, token]() mutable {
+            Result result = token.is_cancelled() ? Result{} : read();
+            if (queue) {
+                queue->post([complete = std::move(complete), result = std::move(result)]() mutable {
+                    complete(std::move(result));
+                });
+            } else {
+                complete(std::move(result));
+            }
+        },
+        options.priority);
+}
+
+}  // namespace
+
+std::future<FileSystem::BinaryResult> FileSystem::read_binary_async(const fs::path& path,
+                                                                    const IoRequestOptions& options) {
+    // The promise is settled on the worker; a completion queue would only delay it
+    auto promise = std::make_shared<std::promise<BinaryResult>>();
+    auto future = promise->get_future();
+    IoRequestOptions direct = options;
+    direct.completion_queue = nullptr;
+    read_binary_async(path, [promise](BinaryResult result) { promise->set_value(std::move(result)); }, direct);
+    return future;
+}
+
+std::future<FileSystem::TextResult> FileSystem::read_text_async(const fs::path& path,
+                                                                const IoRequestOptions& options) {
+    auto promise = std::make_shared<std::promise<TextResult>>();
+    auto future = promise->get_future();
+    IoRequestOptions direct = options;
+    direct.completion_queue = nullptr;
+    read_text_async(path, [promise](TextResult result) { promise->set_value(std::move(result)); }, direct);
+    return future;
+}
+
+void FileSystem::read_binary_async(const fs::path& path, BinaryCallback callback, const IoRequestOptions& options) {
+    submit_read<BinaryResult>([path] { return read_binary(path); }, std::move(callback), options);
+}
+
+void FileSystem::read_text_async(const fs::path& path, TextCallback callback, const IoRequestOptions& options) {
+    submit_read<TextResult>([path] { return read_text(path); }, std::move(callback), options);
 }
 
-std::future<FileSystem::TextResult> FileSystem::read_text_async(const fs::path& path) {
-    return std::async(std::launch::async, [path]() { return read_text(path); });
+void FileSystem::read_binary_batch_async(std::vector<fs::path> paths, BatchCallback callback,
+                                         const IoRequestOptions& options) {
+    std::vector<IoExecutor::Task> tasks;
+    tasks.reserve(paths.size());
+    for (auto& path : paths) {
+        tasks.emplace_back([path = std::move(path), callback, queue = options.completion_queue,
+                            token = options.token]() {
+            BinaryResult result = token.is_cancelled() ? BinaryResult{} : read_binary(path);
+            if (queue) {
+                queue->post([path, callback, result = std::move(result)]() mutable {
+                    callback(path, std::move(result));
+                });
+            } else {
+                callback(path, std::move(result));
+            }
+        });
+    }
+    IoExecutor::shared().submit_batch(std::move(tasks), options.priority);
 }
 
 bool FileSystem::create_directories(const fs::path& path) {
@@ -381,11 +448,136 @@ std::optional<fs::file_time_type> FileSystem::last_modified(const fs::path& path
 }
 
 // ResourceCache implementation
-struct ResourceCache::Impl {
+namespace {
+
+constexpr size_t RESOURCE_CACHE_SHARDS = 16;
+
+struct CacheEntry {
+    std::shared_ptr<const std::vector<uint8_t>> data;
+    fs::file_time_type modified_time;
+    uint64_t last_used = 0;            // Cache-wide access tick
+    const std::string* key = nullptr;  // Owning map node's key
+
+    // Intrusive LRU links, most recently used at the head
+    CacheEntry* prev = nullptr;
+    CacheEntry* next = nullptr;
+};
+
+struct CacheShard {
+    // Node-based map, so entry addresses stay valid for the LRU links
     std::unordered_map<std::string, CacheEntry> entries;
-    std::mutex mutex;
-    size_t max_size = 64 * 1024 * 1024;  // 64 MB default
-    size_t current_size = 0;
+    CacheEntry* lru_head = nullptr;
+    CacheEntry* lru_tail = nullptr;
+
+    // Loads in progress, shared by concurrent misses on the same key
+    std::unordered_map<std::string, std::shared_future<ResourceHandle>> loading;
+
+    mutable std::mutex mutex;
+
+    void unlink(CacheEntry& entry) {
+        (entry.prev ? entry.prev->next : lru_head) = entry.next;
+        (entry.next ? entry.next->prev : lru_tail) = entry.prev;
+        entry.prev = nullptr;
+        entry.next = nullptr;
+    }
+
+    void push_front(CacheEntry& entry) {
+        entry.prev = nullptr;
+        entry.next = lru_head;
+        (lru_head ? lru_head->prev : lru_tail) = &entry;
+        lru_head = &entry;
+    }
+
+    // Least recently used entry other than `keep`
+    CacheEntry* eviction_candidate(const std::string* keep) const {
+        CacheEntry* candidate = lru_tail;
+        if (candidate && keep && *candidate->key == *keep) {
+            candidate = candidate->prev;
+        }
+        return candidate;
+    }
+};
+
+}  // namespace
+
+struct ResourceCache::Impl {
+    std::array<CacheShard, RESOURCE_CACHE_SHARDS> shards;
+    std::atomic<size_t> max_size{64 * 1024 * 1024};  // 64 MB default
+    std::atomic<size_t> current_size{0};
+    std::atomic<size_t> entry_count{0};
+    std::atomic<uint64_t> clock{0};
+
+    CacheShard& shard_for(const std::string& key) {
+        return shards[std::hash<std::string>{}(key) % RESOURCE_CACHE_SHARDS];
+    }
+
+    // Caller must hold shard.mutex
+    void touch(CacheShard& shard, CacheEntry& entry) {
+        entry.last_used = clock.fetch_add(1, std::memory_order_relaxed);
+        if (shard.lru_head != &entry) {
+            shard.unlink(entry);
+            shard.push_front(entry);
+        }
+    }
+
+    // Caller must hold shard.mutex
+    void erase(CacheShard& shard, std::unordered_map<std::string, CacheEntry>::iterator it) {
+        shard.unlink(it->second);
+        current_size.fetch_sub(it->second.data->size(), std::memory_order_relaxed);
+        entry_count.fetch_sub(1, std::memory_order_relaxed);
+        shard.entries.erase(it);
+    }
+
+    ResourceHandle store(const std::string& key, std::vector<uint8_t>&& data) {
+        auto shared = std::make_shared<const std::vector<uint8_t>>(std::move(data));
+        const size_t size = shared->size();
+
+        CacheShard& shard = shard_for(key);
+        {
+            std::lock_guard lock(shard.mutex);
+            auto [it, inserted] = shard.entries.try_emplace(key);
+            CacheEntry& entry = it->second;
+            if (inserted) {
+                entry.key = &it->first;
+                shard.push_front(entry);
+                entry_count.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                current_size.fetch_sub(entry.data->size(), std::memory_order_relaxed);
+            }
+            entry.data = shared;
+            entry.modified_time = fs::file_time_type::clock::now();
+            touch(shard, entry);
+            current_size.fetch_add(size, std::memory_order_relaxed);
+        }
+
+        trim(&key);
+        return ResourceHandle(std::move(shared));
+    }
+
+    // Evict least recently used entries until the cache fits its budget. The
+    // entry for `keep` (just stored) survives even if it alone is too large.
+    void trim(const std::string* keep) {
+        while (current_size.load(std::memory_order_relaxed) > max_size.load(std::memory_order_relaxed)) {
+            CacheShard* oldest = nullptr;
+            uint64_t oldest_tick = UINT64_MAX;
+            for (auto& shard : shards) {
+                std::lock_guard lock(shard.mutex);
+                CacheEntry* candidate = shard.eviction_candidate(keep);
+                if (candidate && candidate->last_used < oldest_tick) {
+                    oldest = &shard;
+                    oldest_tick = candidate->last_used;
+                }
+            }
+            if (!oldest) {
+                return;
+            }
+
+            std::lock_guard lock(oldest->mutex);
+            if (CacheEntry* victim = oldest->eviction_candidate(keep)) {
+                erase(*oldest, oldest->entries.find(*victim->key));
+            }
+        }
+    }
 };
 
 ResourceCache::ResourceCache() : impl_(std::make_unique<Impl>()) {}
@@ -397,23 +589,23 @@ ResourceCache::ResourceCache(ResourceCache&&) noexcept = default;
 ResourceCache& ResourceCache::operator=(ResourceCache&&) noexcept = default;
 
 void ResourceCache::set_max_size(size_t bytes) {
-    std::lock_guard lock(impl_->mutex);
-    impl_->max_size = bytes;
+    impl_->max_size.store(bytes, std::memory_order_relaxed);
+    impl_->trim(nullptr);
 }
 
 size_t ResourceCache::get_max_size() const {
-    std::lock_guard lock(impl_->mutex);
-    return impl_->max_size;
+    return impl_->max_size.load(std::memory_order_relaxed);
 }
 
-std::optional<std::span<const uint8_t>> ResourceCache::get(const std::string& key) const {
-    std::lock_guard lock(impl_->mutex);
-    auto it = impl_->entries.find(key);
-    if (it != impl_->entries.end()) {
-        ++it->second.access_count;
-        return std::span<const uint8_t>(it->second.data);
+ResourceHandle ResourceCache::get(const std::string& key) const {
+    CacheShard& shard = impl_->shard_for(key);
+    std::lock_guard lock(shard.mutex);
+    auto it = shard.entries.find(key);
+    if (it != shard.entries.end()) {
+        impl_->touch(shard, it->second);
+        return ResourceHandle(it->second.data);
     }
-    return std::nullopt;
+    return {};
 }
 
 void ResourceCache::put(const std::string& key, std::span<const uint8_t> data) {
@@ -422,96 +614,93 @@ void ResourceCache::put(const std::string& key, std::span<const uint8_t> data) {
 }
 
 void ResourceCache::put(const std::string& key, std::vector<uint8_t>&& data) {
-    std::lock_guard lock(impl_->mutex);
-
-    // Remove existing entry if present
-    auto it = impl_->entries.find(key);
-    if (it != impl_->entries.end()) {
-        impl_->current_size -= it->second.data.size();
-        impl_->entries.erase(it);
-    }
-
-    // Check if we need to evict entries
-    while (impl_->current_size + data.size() > impl_->max_size && !impl_->entries.empty()) {
-        // Simple LRU: find entry with lowest access count
-        auto min_it = impl_->entries.begin();
-        for (auto curr = impl_->entries.begin(); curr != impl_->entries.end(); ++curr) {
-            if (curr->second.access_count < min_it->second.access_count) {
-                min_it = curr;
-            }
-        }
-        impl_->current_size -= min_it->second.data.size();
-        impl_->entries.erase(min_it);
-    }
-
-    // Insert new entry
-    CacheEntry entry;
-    entry.data = std::move(data);
-    entry.modified_time = fs::file_time_type::clock::now();
-    entry.access_count = 1;
-
-    impl_->current_size += entry.data.size();
-    impl_->entries[key] = std::move(entry);
+    (void)impl_->store(key, std::move(data));
 }
 
 void ResourceCache::invalidate(const std::string& key) {
-    std::lock_guard lock(impl_->mutex);
-    auto it = impl_->entries.find(key);
-    if (it != impl_->entries.end()) {
-        impl_->current_size -= it->second.data.size();
-        impl_->entries.erase(it);
+    CacheShard& shard = impl_->shard_for(key);
+    std::lock_guard lock(shard.mutex);
+    auto it = shard.entries.find(key);
+    if (it != shard.entries.end()) {
+        impl_->erase(shard, it);
     }
 }
 
 void ResourceCache::clear() {
-    std::lock_guard lock(impl_->mutex);
-    impl_->entries.clear();
-    impl_->current_size = 0;
+    for (auto& shard : impl_->shards) {
+        std::lock_guard lock(shard.mutex);
+        while (!shard.entries.empty()) {
+            impl_->erase(shard, shard.entries.begin());
+        }
+    }
 }
 
-size_t ResourceCache::current_size() const {
-    std::lock_guard lock(impl_->mutex);
-    return impl_->current_size;
-}
+ResourceHandle ResourceCache::get_or_load(const std::string& key, const Loader& loader) {
+    CacheShard& shard = impl_->shard_for(key);
+    std::promise<ResourceHandle> promise;
+    {
+        std::unique_lock lock(shard.mutex);
+        auto it = shard.entries.find(key);
+        if (it != shard.entries.end()) {
+            impl_->touch(shard, it->second);
+            return ResourceHandle(it->second.data);
+        }
 
-size_t ResourceCache::entry_count() const {
-    std::lock_guard lock(impl_->mutex);
-    return impl_->entries.size();
-}
+        // Another thread is already loading this key: wait for its result
+        auto loading = shard.loading.find(key);
+        if (loading != shard.loading.end()) {
+            std::shared_future<ResourceHandle> pending = loading->second;
+            lock.unlock();
+            return pending.get();
+        }
+        shard.loading.emplace(key, promise.get_future().share());
+    }
 
-std::optional<std::span<const uint8_t>> ResourceCache::load_cached(const std::string& key, const fs::path& source_path,
-                                                                   bool check_modified) {
-    // Check if already cached
-    {
-        std::lock_guard lock(impl_->mutex);
-        auto it = impl_->entries.find(key);
-        if (it != impl_->entries.end()) {
-            if (check_modified) {
-                auto file_time = FileSystem::last_modified(source_path);
-                if (file_time && *file_time > it->second.modified_time) {
-                    // File was modified, invalidate cache
-                    impl_->current_size -= it->second.data.size();
-                    impl_->entries.erase(it);
-                } else {
-                    ++it->second.access_count;
-                    return std::span<const uint8_t>(it->second.data);
-                }
-            } else {
-                ++it->second.access_count;
-                return std::span<const uint8_t>(it->second.data);
-            }
+    ResourceHandle result;
+    try {
+        if (auto data = loader()) {
+            result = impl_->store(key, std::move(*data));
         }
+    } catch (...) {
+        {
+            std::lock_guard lock(shard.mutex);
+            shard.loading.erase(key);
+        }
+        promise.set_exception(std::current_exception());
+        throw;
     }
 
-    // Load from disk
-    auto data = FileSystem::read_binary(source_path);
-    if (!data) {
-        return std::nullopt;
+    // The entry is cached before the in-flight marker goes away, so later
+    // callers hit the cache instead of loading again
+    {
+        std::lock_guard lock(shard.mutex);
+        shard.loading.erase(key);
+    }
+    promise.set_value(result);
+    return result;
+}
+
+size_t ResourceCache::current_size() const {
+    return impl_->current_size.load(std::memory_order_relaxed);
+}
+
+size_t ResourceCache::entry_count() const {
+    return impl_->entry_count.load(std::memory_order_relaxed);
+}
+
+ResourceHandle ResourceCache::load_cached(const std::string& key, const fs::path& source_path, bool check_modified) {
+    if (check_modified) {
+        // Drop the entry if the file changed since it was cached
+        auto file_time = FileSystem::last_modified(source_path);
+        CacheShard& shard = impl_->shard_for(key);
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.entries.find(key);
+        if (it != shard.entries.end() && file_time && *file_time > it->second.modified_time) {
+            impl_->erase(shard, it);
+        }
     }
 
-    // Cache and return
-    put(key, std::move(*data));
-    return get(key);
+    return get_or_load(key, [&source_path] { return FileSystem::read_binary(source_path); });
 }
 
 }  // namespace realcraft::platform
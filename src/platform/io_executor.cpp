@@ -0,0 +1,191 @@
+// RealCraft Platform Abstraction Layer
+// io_executor.cpp - Bounded I/O thread pool implementation
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <realcraft/platform/io_executor.hpp>
+#include <thread>
+
+namespace realcraft::platform {
+
+// ============================================================================
+// CompletionQueue
+// ============================================================================
+
+struct CompletionQueue::Impl {
+    std::vector<std::function<void()>> callbacks;
+    mutable std::mutex mutex;
+};
+
+CompletionQueue::CompletionQueue() : impl_(std::make_unique<Impl>()) {}
+
+CompletionQueue::~CompletionQueue() = default;
+
+void CompletionQueue::post(std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->callbacks.push_back(std::move(callback));
+}
+
+size_t CompletionQueue::drain() {
+    std::vector<std::function<void()>> ready;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        ready.swap(impl_->callbacks);
+    }
+    // Run outside the lock so callbacks may post follow-up work
+    for (auto& callback : ready) {
+        callback();
+    }
+    return ready.size();
+}
+
+size_t CompletionQueue::pending() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->callbacks.size();
+}
+
+// ============================================================================
+// IoExecutor
+// ============================================================================
+
+namespace {
+
+constexpr size_t PRIORITY_COUNT = 3;
+constexpr size_t DEFAULT_MAX_THREADS = 4;
+
+struct QueuedTask {
+    IoExecutor::Task task;
+    CancellationToken token;
+};
+
+}  // namespace
+
+struct IoExecutor::Impl {
+    std::array<std::deque<QueuedTask>, PRIORITY_COUNT> queues;
+    size_t queued = 0;
+    size_t running = 0;
+    bool stopping = false;
+
+    mutable std::mutex mutex;
+    std::condition_variable work_available;
+    std::condition_variable idle;
+
+    std::vector<std::thread> workers;
+
+    // Caller must hold mutex and have checked queued > 0
+    QueuedTask pop_highest() {
+        for (auto& queue : queues) {
+            if (!queue.empty()) {
+                QueuedTask item = std::move(queue.front());
+                queue.pop_front();
+                --queued;
+                return item;
+            }
+        }
+        return {};
+    }
+
+    void worker_thread() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            work_available.wait(lock, [this] { return stopping || queued > 0; });
+            if (queued == 0) {
+                return;  // Stopping and drained
+            }
+
+            QueuedTask item = pop_highest();
+            ++running;
+            lock.unlock();
+
+            if (!item.token.is_cancelled()) {
+                try {
+                    item.task();
+                } catch (const std::exception& e) {
+                    spdlog::error("Unhandled exception in I/O task: {}", e.what());
+                }
+            }
+            item = {};  // Release captured buffers before reporting idle
+
+            lock.lock();
+            --running;
+            if (queued == 0 && running == 0) {
+                idle.notify_all();
+            }
+        }
+    }
+};
+
+IoExecutor::IoExecutor(const IoExecutorConfig& config) : impl_(std::make_unique<Impl>()) {
+    size_t count = config.thread_count;
+    if (count == 0) {
+        count = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, DEFAULT_MAX_THREADS);
+    }
+
+    impl_->workers.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        impl_->workers.emplace_back([this] { impl_->worker_thread(); });
+    }
+}
+
+IoExecutor::~IoExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        impl_->stopping = true;
+    }
+    impl_->work_available.notify_all();
+    for (auto& worker : impl_->workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+IoExecutor& IoExecutor::shared() {
+    static IoExecutor executor;
+    return executor;
+}
+
+void IoExecutor::submit(Task task, IoPriority priority, const CancellationToken& token) {
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        impl_->queues[static_cast<size_t>(priority)].push_back({std::move(task), token});
+        ++impl_->queued;
+    }
+    impl_->work_available.notify_one();
+}
+
+void IoExecutor::submit_batch(std::vector<Task> tasks, IoPriority priority, const CancellationToken& token) {
+    if (tasks.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        auto& queue = impl_->queues[static_cast<size_t>(priority)];
+        for (auto& task : tasks) {
+            queue.push_back({std::move(task), token});
+        }
+        impl_->queued += tasks.size();
+    }
+    impl_->work_available.notify_all();
+}
+
+void IoExecutor::wait_idle() {
+    std::unique_lock<std::mutex> lock(impl_->mutex);
+    impl_->idle.wait(lock, [this] { return impl_->queued == 0 && impl_->running == 0; });
+}
+
+size_t IoExecutor::thread_count() const {
+    return impl_->workers.size();
+}
+
+size_t IoExecutor::queued_count() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->queued;
+}
+
+}  // namespace realcraft::platform
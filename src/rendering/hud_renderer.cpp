@@ -800,6 +800,15 @@ void HUDRenderer::render_debug_overlay(uint32_t width, uint32_t height) {
     render_text_shadowed(render_ss.str(), margin, y, text_color, shadow_color, scale);
     y += line_height;
 
+    // World streaming
+    std::ostringstream world_ss;
+    world_ss.precision(1);
+    world_ss << std::fixed << "World: " << data_.chunks_loaded << " loaded, " << data_.chunks_dirty << " dirty, "
+             << data_.chunks_pending << " pending (gen p99 " << data_.chunk_gen_p99_ms << "ms, mesh p99 "
+             << data_.mesh_build_p99_ms << "ms)";
+    render_text_shadowed(world_ss.str(), margin, y, text_color, shadow_color, scale);
+    y += line_height;
+
     // Time of day
     std::ostringstream time_ss;
     time_ss.precision(2);
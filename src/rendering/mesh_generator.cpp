@@ -4,6 +4,7 @@
 #include <chrono>
 #include <cstring>
 #include <realcraft/core/logger.hpp>
+#include <realcraft/core/profiler.hpp>
 #include <realcraft/rendering/mesh_generator.hpp>
 #include <realcraft/world/types.hpp>
 
@@ -225,6 +226,7 @@ const MeshGeneratorConfig& MeshGenerator::get_config() const {
 bool MeshGenerator::generate(const world::Chunk& chunk, const world::Chunk* neighbor_neg_x,
                              const world::Chunk* neighbor_pos_x, const world::Chunk* neighbor_neg_z,
                              const world::Chunk* neighbor_pos_z, ChunkMeshData& out_data, ChunkMeshStats& out_stats) {
+    REALCRAFT_PROFILE_ZONE("MeshGenerator::generate");
     auto start_time = std::chrono::high_resolution_clock::now();
 
     out_data.clear();
@@ -245,6 +247,9 @@ bool MeshGenerator::generate(const world::Chunk& chunk, const world::Chunk* neig
                     continue;
                 }
 
+                const size_t table_base = static_cast<size_t>(entry.block_id) * 6;
+                const bool use_table = table_base + 6 <= impl_->config.face_texture_table.size();
+
                 bool is_transparent = block_type->is_transparent();
                 auto& vertices = is_transparent ? out_data.transparent_vertices : out_data.opaque_vertices;
                 auto& indices = is_transparent ? out_data.transparent_indices : out_data.opaque_indices;
@@ -256,9 +261,12 @@ bool MeshGenerator::generate(const world::Chunk& chunk, const world::Chunk* neig
                         continue;
                     }
 
-                    // Get texture for this face using the BlockType's texture mapping
+                    // Get texture for this face from the atlas table, falling back
+                    // to the BlockType's texture mapping
                     auto world_dir = static_cast<world::Direction>(f);
-                    uint16_t texture_index = block_type->get_texture_index(world_dir);
+                    uint16_t texture_index = use_table
+                                                 ? impl_->config.face_texture_table[table_base + static_cast<size_t>(f)]
+                                                 : block_type->get_texture_index(world_dir);
 
                     // Calculate AO for each vertex (simplified - full AO would sample neighbors)
                     uint8_t ao[4] = {255, 255, 255, 255};
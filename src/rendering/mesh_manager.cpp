@@ -2,10 +2,31 @@
 // mesh_manager.cpp - Threaded mesh management
 
 #include <realcraft/core/logger.hpp>
+#include <realcraft/core/metrics.hpp>
+#include <realcraft/core/profiler.hpp>
 #include <realcraft/rendering/mesh_manager.hpp>
 
 namespace realcraft::rendering {
 
+namespace {
+
+// Process-wide meshing metrics, resolved once
+struct MeshMetrics {
+    core::Histogram& build_us = core::MetricsRegistry::instance().histogram("mesh.build_us");
+    core::Histogram& request_to_visible_us = core::MetricsRegistry::instance().histogram("mesh.request_to_visible_us");
+    core::Counter& uploads = core::MetricsRegistry::instance().counter("mesh.uploads");
+    core::Counter& dropped_requests = core::MetricsRegistry::instance().counter("mesh.dropped_requests");
+    core::Gauge& pending = core::MetricsRegistry::instance().gauge("mesh.pending");
+    core::Gauge& awaiting_upload = core::MetricsRegistry::instance().gauge("mesh.awaiting_upload");
+};
+
+MeshMetrics& mesh_metrics() {
+    static MeshMetrics metrics;
+    return metrics;
+}
+
+}  // namespace
+
 MeshManager::MeshManager() = default;
 
 MeshManager::~MeshManager() {
@@ -117,10 +138,12 @@ void MeshManager::request_mesh(const world::ChunkPos& pos, MeshPriority priority
 
     // Check queue size limit
     if (request_queue_.size() >= config_.max_pending_requests) {
+        mesh_metrics().dropped_requests.add();
         return;
     }
 
-    request_queue_.push({pos, priority});
+    request_queue_.push({pos, priority, std::chrono::steady_clock::now()});
+    mesh_metrics().pending.set(static_cast<int64_t>(request_queue_.size()));
     request_cv_.notify_one();
 }
 
@@ -211,6 +234,7 @@ size_t MeshManager::total_vertices() const {
 }
 
 void MeshManager::worker_thread() {
+    REALCRAFT_PROFILE_THREAD("Mesh Worker");
     MeshGenerator generator(config_.generator);
 
     while (!shutdown_requested_.load()) {
@@ -231,6 +255,7 @@ void MeshManager::worker_thread() {
 
             request = request_queue_.top();
             request_queue_.pop();
+            mesh_metrics().pending.set(static_cast<int64_t>(request_queue_.size()));
         }
 
         // Get chunk (may need to wait for lock)
@@ -249,16 +274,22 @@ void MeshManager::worker_thread() {
         ChunkMeshData data;
         ChunkMeshStats stats;
 
-        bool has_mesh = generator.generate(*chunk, neg_x, pos_x, neg_z, pos_z, data, stats);
+        bool has_mesh = false;
+        {
+            core::ScopedLatency latency(mesh_metrics().build_us);
+            has_mesh = generator.generate(*chunk, neg_x, pos_x, neg_z, pos_z, data, stats);
+        }
 
         if (has_mesh) {
             std::lock_guard lock(completed_mutex_);
-            completed_queue_.push({request.pos, std::move(data), stats});
+            completed_queue_.push({request.pos, std::move(data), stats, request.requested_at});
+            mesh_metrics().awaiting_upload.set(static_cast<int64_t>(completed_queue_.size()));
         }
     }
 }
 
 void MeshManager::upload_completed_meshes() {
+    REALCRAFT_PROFILE_ZONE("MeshManager::upload_completed_meshes");
     uint32_t uploads = 0;
 
     while (uploads < config_.uploads_per_frame) {
@@ -271,17 +302,27 @@ void MeshManager::upload_completed_meshes() {
             }
             completed = std::move(completed_queue_.front());
             completed_queue_.pop();
+            mesh_metrics().awaiting_upload.set(static_cast<int64_t>(completed_queue_.size()));
         }
 
         auto mesh = std::make_unique<ChunkMesh>();
         mesh->set_stats(completed.stats);
 
-        if (mesh->upload(device_, completed.data)) {
+        bool uploaded = false;
+        {
+            REALCRAFT_PROFILE_ZONE("ChunkMesh::upload");
+            uploaded = mesh->upload(device_, completed.data);
+        }
+        if (uploaded) {
             std::lock_guard lock(meshes_mutex_);
             meshes_[completed.pos] = std::move(mesh);
             uploads++;
+            mesh_metrics().uploads.add();
+            mesh_metrics().request_to_visible_us.record_duration(std::chrono::steady_clock::now() -
+                                                                 completed.requested_at);
         }
     }
+    REALCRAFT_PROFILE_COUNTER("Mesh uploads", uploads);
 }
 
 }  // namespace realcraft::rendering
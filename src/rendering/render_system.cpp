@@ -30,17 +30,20 @@ bool RenderSystem::initialize(core::Engine* engine, world::WorldManager* world,
     // Register as world observer
     world_->add_observer(this);
 
-    // Initialize subsystems
-    mesh_manager_ = std::make_unique<MeshManager>();
-    if (!mesh_manager_->initialize(device_, world_, config_.mesh_manager)) {
-        REALCRAFT_LOG_ERROR(core::log_category::GRAPHICS, "Failed to initialize MeshManager");
+    // Initialize subsystems. Textures come first so meshing can use the
+    // atlas face table.
+    texture_manager_ = std::make_unique<TextureManager>();
+    if (!texture_manager_->initialize(device_, config_.texture_manager)) {
+        REALCRAFT_LOG_ERROR(core::log_category::GRAPHICS, "Failed to initialize TextureManager");
         shutdown();
         return false;
     }
 
-    texture_manager_ = std::make_unique<TextureManager>();
-    if (!texture_manager_->initialize(device_, config_.texture_manager)) {
-        REALCRAFT_LOG_ERROR(core::log_category::GRAPHICS, "Failed to initialize TextureManager");
+    auto mesh_config = config_.mesh_manager;
+    mesh_config.generator.face_texture_table = texture_manager_->get_face_texture_table();
+    mesh_manager_ = std::make_unique<MeshManager>();
+    if (!mesh_manager_->initialize(device_, world_, mesh_config)) {
+        REALCRAFT_LOG_ERROR(core::log_category::GRAPHICS, "Failed to initialize MeshManager");
         shutdown();
         return false;
     }
@@ -125,8 +128,8 @@ void RenderSystem::shutdown() {
     sky_vertex_shader_.reset();
     sky_fragment_shader_.reset();
 
-    texture_manager_.reset();
     mesh_manager_.reset();
+    texture_manager_.reset();
 
     engine_ = nullptr;
     world_ = nullptr;
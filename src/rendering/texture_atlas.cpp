@@ -2,14 +2,141 @@
 // texture_atlas.cpp - Texture atlas implementation
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
 #include <realcraft/core/logger.hpp>
+#include <realcraft/core/parallel.hpp>
 #include <realcraft/graphics/buffer.hpp>
 #include <realcraft/graphics/command_buffer.hpp>
+#include <realcraft/platform/file_io.hpp>
 #include <realcraft/rendering/texture_atlas.hpp>
 #include <unordered_map>
 
 namespace realcraft::rendering {
 
+namespace {
+
+constexpr uint32_t BAKED_ATLAS_MAGIC = 0x41544352;  // "RCTA" - RealCraft Texture Atlas
+constexpr uint32_t BAKED_ATLAS_VERSION = 1;
+
+// ============================================================================
+// Mip Filtering
+// ============================================================================
+
+// The atlas is sRGB, so colour channels are averaged in linear space
+const std::array<float, 256>& srgb_to_linear_table() {
+    static const std::array<float, 256> table = [] {
+        std::array<float, 256> values{};
+        for (size_t i = 0; i < values.size(); ++i) {
+            const float c = static_cast<float>(i) / 255.0f;
+            values[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+        return values;
+    }();
+    return table;
+}
+
+uint8_t linear_to_srgb(float value) {
+    const float c = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+    return static_cast<uint8_t>(std::clamp(c * 255.0f + 0.5f, 0.0f, 255.0f));
+}
+
+// 2x2 box filter of row `y` of one layer, from `src` (src_size texels wide) into `dst`
+void downsample_row(const uint8_t* src, uint32_t src_size, uint8_t* dst, uint32_t dst_size, uint32_t y) {
+    const auto& to_linear = srgb_to_linear_table();
+    const uint8_t* row0 = src + static_cast<size_t>(y) * 2 * src_size * 4;
+    const uint8_t* row1 = row0 + static_cast<size_t>(src_size) * 4;
+    uint8_t* out = dst + static_cast<size_t>(y) * dst_size * 4;
+
+    for (size_t x = 0; x < dst_size; ++x) {
+        const size_t a = x * 8;
+        const size_t b = a + 4;
+        for (size_t c = 0; c < 3; ++c) {
+            const float sum =
+                to_linear[row0[a + c]] + to_linear[row0[b + c]] + to_linear[row1[a + c]] + to_linear[row1[b + c]];
+            out[x * 4 + c] = linear_to_srgb(sum * 0.25f);
+        }
+        const uint32_t alpha = static_cast<uint32_t>(row0[a + 3] + row0[b + 3] + row1[a + 3] + row1[b + 3]);
+        out[x * 4 + 3] = static_cast<uint8_t>((alpha + 2) / 4);
+    }
+}
+
+// ============================================================================
+// Baked File Serialization
+// ============================================================================
+
+class BakedWriter {
+public:
+    template <typename T>
+    void value(T v) {
+        append(&v, sizeof(v));
+    }
+
+    void string(std::string_view text) {
+        value(static_cast<uint32_t>(text.size()));
+        append(text.data(), text.size());
+    }
+
+    void bytes(std::span<const uint8_t> data) { append(data.data(), data.size()); }
+
+    [[nodiscard]] const std::vector<uint8_t>& data() const { return data_; }
+
+private:
+    void append(const void* source, size_t count) {
+        const auto* begin = static_cast<const uint8_t*>(source);
+        data_.insert(data_.end(), begin, begin + count);
+    }
+
+    std::vector<uint8_t> data_;
+};
+
+class BakedReader {
+public:
+    explicit BakedReader(std::span<const uint8_t> data) : data_(data) {}
+
+    [[nodiscard]] bool ok() const { return ok_; }
+    [[nodiscard]] bool at_end() const { return offset_ == data_.size(); }
+
+    template <typename T>
+    T value() {
+        T v{};
+        read(&v, sizeof(v));
+        return v;
+    }
+
+    std::string string() {
+        const auto length = value<uint32_t>();
+        if (!ok_ || length > data_.size() - offset_) {
+            ok_ = false;
+            return {};
+        }
+        std::string out(length, '\0');
+        read(out.data(), out.size());
+        return out;
+    }
+
+    void bytes(std::vector<uint8_t>& out) { read(out.data(), out.size()); }
+
+private:
+    void read(void* out, size_t count) {
+        if (!ok_ || count > data_.size() - offset_) {
+            ok_ = false;
+            return;
+        }
+        if (count > 0) {
+            std::memcpy(out, data_.data() + offset_, count);
+        }
+        offset_ += count;
+    }
+
+    std::span<const uint8_t> data_;
+    size_t offset_ = 0;
+    bool ok_ = true;
+};
+
+}  // namespace
+
 TextureAtlas::TextureAtlas(graphics::GraphicsDevice* device, const TextureAtlasDesc& desc)
     : device_(device), desc_(desc) {}
 
@@ -17,8 +144,8 @@ TextureAtlas::~TextureAtlas() = default;
 
 uint16_t TextureAtlas::add_texture(std::string_view name, uint32_t width, uint32_t height,
                                    std::span<const uint8_t> rgba_data) {
-    if (is_built_) {
-        REALCRAFT_LOG_ERROR(core::log_category::GRAPHICS, "Cannot add texture after atlas is built: {}", name);
+    if (is_built_ || is_baked()) {
+        REALCRAFT_LOG_ERROR(core::log_category::GRAPHICS, "Cannot add texture after atlas is baked: {}", name);
         return UINT16_MAX;
     }
 
@@ -52,7 +179,8 @@ uint16_t TextureAtlas::add_solid_color(std::string_view name, uint8_t r, uint8_t
     return add_texture(name, desc_.tile_size, desc_.tile_size, data);
 }
 
-bool TextureAtlas::pack_texture(const StagedTexture& tex, TextureAtlasEntry& out_entry) {
+bool TextureAtlas::pack_texture(const StagedTexture& tex, TextureAtlasEntry& out_entry, uint32_t& out_x,
+                                uint32_t& out_y) {
     uint32_t padded_w = tex.width + desc_.padding * 2;
     uint32_t padded_h = tex.height + desc_.padding * 2;
 
@@ -79,11 +207,12 @@ bool TextureAtlas::pack_texture(const StagedTexture& tex, TextureAtlasEntry& out
     }
 
     // Pack at current position (accounting for padding)
-    out_entry.u_min = static_cast<float>(current_x_ + desc_.padding) / static_cast<float>(desc_.atlas_size);
-    out_entry.v_min = static_cast<float>(current_y_ + desc_.padding) / static_cast<float>(desc_.atlas_size);
-    out_entry.u_max = static_cast<float>(current_x_ + desc_.padding + tex.width) / static_cast<float>(desc_.atlas_size);
-    out_entry.v_max =
-        static_cast<float>(current_y_ + desc_.padding + tex.height) / static_cast<float>(desc_.atlas_size);
+    out_x = current_x_ + desc_.padding;
+    out_y = current_y_ + desc_.padding;
+    out_entry.u_min = static_cast<float>(out_x) / static_cast<float>(desc_.atlas_size);
+    out_entry.v_min = static_cast<float>(out_y) / static_cast<float>(desc_.atlas_size);
+    out_entry.u_max = static_cast<float>(out_x + tex.width) / static_cast<float>(desc_.atlas_size);
+    out_entry.v_max = static_cast<float>(out_y + tex.height) / static_cast<float>(desc_.atlas_size);
     out_entry.atlas_layer = static_cast<uint16_t>(current_layer_);
     out_entry.width = static_cast<uint16_t>(tex.width);
     out_entry.height = static_cast<uint16_t>(tex.height);
@@ -95,10 +224,31 @@ bool TextureAtlas::pack_texture(const StagedTexture& tex, TextureAtlasEntry& out
     return true;
 }
 
-bool TextureAtlas::build() {
+uint32_t TextureAtlas::compute_mip_levels() const {
+    if (!desc_.generate_mipmaps) {
+        return 1;
+    }
+
+    // A 2x2 box filter only stays inside each tile while tile origins and
+    // sizes remain texel aligned at the next level
+    uint32_t levels = 1;
+    while (levels < 16) {
+        const uint32_t step = 1u << levels;
+        if (desc_.padding % step != 0 || desc_.tile_size % step != 0 || desc_.atlas_size % step != 0) {
+            break;
+        }
+        ++levels;
+    }
+    return levels;
+}
+
+bool TextureAtlas::bake() {
+    if (is_baked()) {
+        return true;
+    }
     if (is_built_) {
         REALCRAFT_LOG_WARN(core::log_category::GRAPHICS, "Atlas already built");
-        return true;
+        return false;
     }
 
     if (staged_textures_.empty()) {
@@ -112,22 +262,85 @@ bool TextureAtlas::build() {
     current_y_ = 0;
     row_height_ = 0;
 
-    // Pack all textures
+    // Pack all textures (sequential, the shelf packer is order dependent)
     entries_.clear();
     entries_.reserve(staged_textures_.size());
+    std::vector<std::pair<uint32_t, uint32_t>> origins(staged_textures_.size());
 
     for (size_t i = 0; i < staged_textures_.size(); i++) {
         TextureAtlasEntry entry;
         entry.index = static_cast<uint16_t>(i);
 
-        if (!pack_texture(staged_textures_[i], entry)) {
+        if (!pack_texture(staged_textures_[i], entry, origins[i].first, origins[i].second)) {
+            entries_.clear();
             return false;
         }
 
         entries_.push_back(entry);
     }
 
-    uint32_t num_layers = current_layer_ + 1;
+    const uint32_t num_layers = current_layer_ + 1;
+    const size_t atlas_size = desc_.atlas_size;
+    const auto padding = static_cast<int64_t>(desc_.padding);
+    mip_levels_ = compute_mip_levels();
+
+    // Compose level 0. Padded tile rectangles never overlap, so every tile is
+    // written independently; the padding repeats the tile's edge texels.
+    std::vector<std::vector<uint8_t>> levels(mip_levels_);
+    levels[0].assign(atlas_size * atlas_size * 4 * num_layers, 0);
+
+    core::parallel_for(staged_textures_.size(), [&](size_t i) {
+        const auto& tex = staged_textures_[i];
+        const auto [origin_x, origin_y] = origins[i];
+        uint8_t* layer_data = levels[0].data() + entries_[i].atlas_layer * atlas_size * atlas_size * 4;
+
+        for (int64_t y = -padding; y < static_cast<int64_t>(tex.height) + padding; ++y) {
+            const auto src_y = static_cast<size_t>(std::clamp<int64_t>(y, 0, tex.height - 1));
+            const auto dst_y = static_cast<size_t>(origin_y + y);
+            for (int64_t x = -padding; x < static_cast<int64_t>(tex.width) + padding; ++x) {
+                const auto src_x = static_cast<size_t>(std::clamp<int64_t>(x, 0, tex.width - 1));
+                const auto dst_x = static_cast<size_t>(origin_x + x);
+                std::memcpy(&layer_data[(dst_y * atlas_size + dst_x) * 4], &tex.data[(src_y * tex.width + src_x) * 4],
+                            4);
+            }
+        }
+    });
+
+    // Each further level is filtered from the previous one, rows in parallel
+    for (uint32_t level = 1; level < mip_levels_; ++level) {
+        const uint32_t src_size = desc_.atlas_size >> (level - 1);
+        const uint32_t dst_size = desc_.atlas_size >> level;
+        const size_t src_layer_bytes = static_cast<size_t>(src_size) * src_size * 4;
+        const size_t dst_layer_bytes = static_cast<size_t>(dst_size) * dst_size * 4;
+        levels[level].resize(dst_layer_bytes * num_layers);
+
+        core::parallel_for(static_cast<size_t>(num_layers) * dst_size, [&](size_t job) {
+            const size_t layer = job / dst_size;
+            downsample_row(levels[level - 1].data() + layer * src_layer_bytes, src_size,
+                           levels[level].data() + layer * dst_layer_bytes, dst_size,
+                           static_cast<uint32_t>(job % dst_size));
+        });
+    }
+
+    baked_levels_ = std::move(levels);
+
+    // The staged copies are no longer needed
+    staged_textures_.clear();
+    staged_textures_.shrink_to_fit();
+
+    REALCRAFT_LOG_DEBUG(core::log_category::GRAPHICS, "Baked texture atlas: {} textures, {} layers, {} mip levels",
+                        entries_.size(), num_layers, mip_levels_);
+
+    return true;
+}
+
+bool TextureAtlas::upload() {
+    if (!device_) {
+        REALCRAFT_LOG_ERROR(core::log_category::GRAPHICS, "Cannot upload atlas without a graphics device");
+        return false;
+    }
+
+    const uint32_t num_layers = get_layer_count();
 
     // Create atlas texture
     graphics::TextureDesc tex_desc;
@@ -136,7 +349,7 @@ bool TextureAtlas::build() {
     tex_desc.width = desc_.atlas_size;
     tex_desc.height = desc_.atlas_size;
     tex_desc.array_layers = num_layers;
-    tex_desc.mip_levels = desc_.generate_mipmaps ? 1 : 1;  // Simplified: 1 mip for now
+    tex_desc.mip_levels = mip_levels_;
     tex_desc.usage = graphics::TextureUsage::Sampled | graphics::TextureUsage::TransferDst;
     tex_desc.debug_name = desc_.debug_name;
 
@@ -146,30 +359,14 @@ bool TextureAtlas::build() {
         return false;
     }
 
-    // Create atlas data and copy textures
-    std::vector<uint8_t> atlas_data(static_cast<size_t>(desc_.atlas_size) * desc_.atlas_size * 4 * num_layers, 0);
-
-    for (size_t i = 0; i < staged_textures_.size(); i++) {
-        const auto& tex = staged_textures_[i];
-        const auto& entry = entries_[i];
-
-        uint32_t dst_x = static_cast<uint32_t>(entry.u_min * desc_.atlas_size);
-        uint32_t dst_y = static_cast<uint32_t>(entry.v_min * desc_.atlas_size);
-        uint32_t layer = entry.atlas_layer;
-
-        // Copy texture data row by row
-        for (uint32_t row = 0; row < tex.height; row++) {
-            size_t src_offset = static_cast<size_t>(row) * tex.width * 4;
-            size_t dst_offset =
-                (layer * desc_.atlas_size * desc_.atlas_size + (dst_y + row) * desc_.atlas_size + dst_x) * 4;
-
-            std::memcpy(&atlas_data[dst_offset], &tex.data[src_offset], tex.width * 4);
-        }
+    // Upload every level via one staging buffer
+    size_t total_size = 0;
+    for (const auto& level : baked_levels_) {
+        total_size += level.size();
     }
 
-    // Upload to GPU via staging buffer
     graphics::BufferDesc staging_desc;
-    staging_desc.size = atlas_data.size();
+    staging_desc.size = total_size;
     staging_desc.usage = graphics::BufferUsage::TransferSrc;
     staging_desc.host_visible = true;
     staging_desc.debug_name = "AtlasStagingBuffer";
@@ -180,27 +377,32 @@ bool TextureAtlas::build() {
         return false;
     }
 
-    staging_buffer->write(atlas_data.data(), atlas_data.size());
-
     // Copy to texture
     auto cmd = device_->create_command_buffer();
     cmd->begin();
 
-    for (uint32_t layer = 0; layer < num_layers; layer++) {
-        graphics::BufferImageCopy region;
-        region.buffer_offset = static_cast<size_t>(layer) * desc_.atlas_size * desc_.atlas_size * 4;
-        region.buffer_row_length = desc_.atlas_size;
-        region.buffer_image_height = desc_.atlas_size;
-        region.texture_offset_x = 0;
-        region.texture_offset_y = 0;
-        region.texture_offset_z = 0;
-        region.texture_width = desc_.atlas_size;
-        region.texture_height = desc_.atlas_size;
-        region.texture_depth = 1;
-        region.mip_level = 0;
-        region.array_layer = layer;
-
-        cmd->copy_buffer_to_texture(staging_buffer.get(), atlas_texture_.get(), region);
+    size_t level_offset = 0;
+    for (uint32_t level = 0; level < mip_levels_; level++) {
+        const uint32_t size = desc_.atlas_size >> level;
+        staging_buffer->write(baked_levels_[level].data(), baked_levels_[level].size(), level_offset);
+
+        for (uint32_t layer = 0; layer < num_layers; layer++) {
+            graphics::BufferImageCopy region;
+            region.buffer_offset = level_offset + static_cast<size_t>(layer) * size * size * 4;
+            region.buffer_row_length = size;
+            region.buffer_image_height = size;
+            region.texture_offset_x = 0;
+            region.texture_offset_y = 0;
+            region.texture_offset_z = 0;
+            region.texture_width = size;
+            region.texture_height = size;
+            region.texture_depth = 1;
+            region.mip_level = level;
+            region.array_layer = layer;
+
+            cmd->copy_buffer_to_texture(staging_buffer.get(), atlas_texture_.get(), region);
+        }
+        level_offset += baked_levels_[level].size();
     }
 
     cmd->end();
@@ -213,6 +415,7 @@ bool TextureAtlas::build() {
     sampler_desc.mip_filter = graphics::FilterMode::Nearest;
     sampler_desc.address_u = graphics::AddressMode::ClampToEdge;
     sampler_desc.address_v = graphics::AddressMode::ClampToEdge;
+    sampler_desc.max_lod = static_cast<float>(mip_levels_ - 1);
     sampler_desc.debug_name = desc_.debug_name + "_Sampler";
 
     atlas_sampler_ = device_->create_sampler(sampler_desc);
@@ -221,18 +424,174 @@ bool TextureAtlas::build() {
         return false;
     }
 
-    // Clear staged data
-    staged_textures_.clear();
-    staged_textures_.shrink_to_fit();
+    return true;
+}
+
+bool TextureAtlas::build() {
+    if (is_built_) {
+        REALCRAFT_LOG_WARN(core::log_category::GRAPHICS, "Atlas already built");
+        return true;
+    }
+
+    if (!bake() || !upload()) {
+        return false;
+    }
+
+    // Clear baked data, the GPU copy is authoritative now
+    baked_levels_.clear();
+    baked_levels_.shrink_to_fit();
 
     is_built_ = true;
 
-    REALCRAFT_LOG_INFO(core::log_category::GRAPHICS, "Built texture atlas: {} textures, {} layers", entries_.size(),
-                       num_layers);
+    REALCRAFT_LOG_INFO(core::log_category::GRAPHICS, "Built texture atlas: {} textures, {} layers, {} mip levels",
+                       entries_.size(), get_layer_count(), mip_levels_);
+
+    return true;
+}
+
+// ============================================================================
+// Baked Cache
+// ============================================================================
+
+bool TextureAtlas::save_baked(const std::filesystem::path& path, uint64_t key) const {
+    if (!is_baked()) {
+        REALCRAFT_LOG_WARN(core::log_category::GRAPHICS, "Cannot save atlas that is not baked");
+        return false;
+    }
+
+    std::vector<std::string_view> names(entries_.size());
+    for (const auto& [name, index] : name_to_index_) {
+        if (index < names.size()) {
+            names[index] = name;
+        }
+    }
+
+    BakedWriter w;
+    w.value(BAKED_ATLAS_MAGIC);
+    w.value(BAKED_ATLAS_VERSION);
+    w.value(key);
+    w.value(desc_.atlas_size);
+    w.value(desc_.tile_size);
+    w.value(desc_.padding);
+    w.value(get_layer_count());
+    w.value(mip_levels_);
+    w.value(static_cast<uint32_t>(entries_.size()));
+
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        const auto& entry = entries_[i];
+        w.string(names[i]);
+        w.value(entry.atlas_layer);
+        w.value(entry.u_min);
+        w.value(entry.v_min);
+        w.value(entry.u_max);
+        w.value(entry.v_max);
+        w.value(entry.width);
+        w.value(entry.height);
+    }
+    for (const auto& level : baked_levels_) {
+        w.bytes(level);
+    }
+
+    // Write beside the target and rename, so a crash never leaves a torn file
+    auto temp_path = path;
+    temp_path += ".tmp";
+    if (!platform::FileSystem::write_binary(temp_path, w.data())) {
+        return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        REALCRAFT_LOG_WARN(core::log_category::GRAPHICS, "Failed to store baked atlas {}: {}", path.string(),
+                           ec.message());
+        std::filesystem::remove(temp_path, ec);
+        return false;
+    }
+    return true;
+}
+
+bool TextureAtlas::load_baked(const std::filesystem::path& path, uint64_t key) {
+    if (is_built_) {
+        REALCRAFT_LOG_WARN(core::log_category::GRAPHICS, "Cannot load baked data into a built atlas");
+        return false;
+    }
+
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec)) {
+        return false;
+    }
+    auto data = platform::FileSystem::read_binary(path);
+    if (!data) {
+        return false;
+    }
+
+    BakedReader r(*data);
+    if (r.value<uint32_t>() != BAKED_ATLAS_MAGIC || r.value<uint32_t>() != BAKED_ATLAS_VERSION ||
+        r.value<uint64_t>() != key) {
+        REALCRAFT_LOG_DEBUG(core::log_category::GRAPHICS, "Baked atlas {} is stale", path.string());
+        return false;
+    }
+
+    const auto atlas_size = r.value<uint32_t>();
+    const auto tile_size = r.value<uint32_t>();
+    const auto padding = r.value<uint32_t>();
+    const auto num_layers = r.value<uint32_t>();
+    const auto mip_levels = r.value<uint32_t>();
+    const auto entry_count = r.value<uint32_t>();
+    if (!r.ok() || atlas_size != desc_.atlas_size || tile_size != desc_.tile_size || padding != desc_.padding ||
+        num_layers == 0 || num_layers > desc_.max_layers || mip_levels != compute_mip_levels() ||
+        entry_count > UINT16_MAX) {
+        REALCRAFT_LOG_DEBUG(core::log_category::GRAPHICS, "Baked atlas {} does not match the atlas settings",
+                            path.string());
+        return false;
+    }
+
+    std::vector<TextureAtlasEntry> entries(entry_count);
+    std::unordered_map<std::string, uint16_t> name_to_index;
+    for (uint32_t i = 0; i < entry_count && r.ok(); ++i) {
+        auto& entry = entries[i];
+        std::string name = r.string();
+        entry.index = static_cast<uint16_t>(i);
+        entry.atlas_layer = r.value<uint16_t>();
+        entry.u_min = r.value<float>();
+        entry.v_min = r.value<float>();
+        entry.u_max = r.value<float>();
+        entry.v_max = r.value<float>();
+        entry.width = r.value<uint16_t>();
+        entry.height = r.value<uint16_t>();
+        name_to_index[std::move(name)] = entry.index;
+    }
+
+    std::vector<std::vector<uint8_t>> levels(mip_levels);
+    for (uint32_t level = 0; level < mip_levels && r.ok(); ++level) {
+        const size_t size = atlas_size >> level;
+        levels[level].resize(size * size * 4 * num_layers);
+        r.bytes(levels[level]);
+    }
+
+    if (!r.ok() || !r.at_end()) {
+        REALCRAFT_LOG_WARN(core::log_category::GRAPHICS, "Baked atlas {} is corrupt", path.string());
+        return false;
+    }
+
+    staged_textures_.clear();
+    staged_textures_.shrink_to_fit();
+    entries_ = std::move(entries);
+    name_to_index_ = std::move(name_to_index);
+    baked_levels_ = std::move(levels);
+    mip_levels_ = mip_levels;
+    current_layer_ = num_layers - 1;
 
     return true;
 }
 
+std::span<const uint8_t> TextureAtlas::get_baked_level(uint32_t level) const {
+    if (level >= baked_levels_.size()) {
+        return {};
+    }
+    return baked_levels_[level];
+}
+
 const TextureAtlasEntry* TextureAtlas::get_entry(uint16_t index) const {
     if (index >= entries_.size()) {
         return nullptr;
@@ -2,11 +2,56 @@
 // texture_manager.cpp - Block texture management
 
 #include <realcraft/core/logger.hpp>
+#include <realcraft/core/parallel.hpp>
 #include <realcraft/rendering/procedural_texture.hpp>
 #include <realcraft/rendering/texture_manager.hpp>
+#include <string_view>
 
 namespace realcraft::rendering {
 
+namespace {
+
+constexpr const char* BAKED_ATLAS_FILE = "block_atlas.rcatlas";
+
+// FNV-1a over the cache key inputs
+struct KeyHasher {
+    uint64_t value = 14695981039346656037ull;
+
+    void bytes(const void* data, size_t size) {
+        const auto* p = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            value = (value ^ p[i]) * 1099511628211ull;
+        }
+    }
+
+    template <typename T>
+    void add(T v) {
+        bytes(&v, sizeof(v));
+    }
+
+    void add(std::string_view text) {
+        add(static_cast<uint64_t>(text.size()));
+        bytes(text.data(), text.size());
+    }
+};
+
+// Atlas texture name for one face of a block
+std::string face_texture_name(const std::string& block_name, uint8_t face) {
+    // For grass, use different textures for different faces
+    if (block_name == "realcraft:grass") {
+        if (face == 3) {  // PosY (top)
+            return block_name + "_top";
+        }
+        if (face == 2) {  // NegY (bottom)
+            return block_name + "_bottom";
+        }
+        return block_name + "_side";
+    }
+    return block_name;
+}
+
+}  // namespace
+
 TextureManager::TextureManager() = default;
 TextureManager::~TextureManager() = default;
 
@@ -27,9 +72,21 @@ bool TextureManager::initialize(graphics::GraphicsDevice* device, const TextureM
 
     block_atlas_ = std::make_unique<TextureAtlas>(device_, atlas_desc);
 
-    // Generate procedural textures for all registered blocks
-    if (config_.generate_procedural) {
-        generate_block_textures();
+    // A baked atlas from an earlier run replaces generation, packing and mip filtering
+    const uint64_t cache_key = compute_cache_key(atlas_desc);
+    const bool use_cache = !config_.cache_directory.empty();
+    const auto cache_path = config_.cache_directory / BAKED_ATLAS_FILE;
+    const bool cache_hit = use_cache && block_atlas_->load_baked(cache_path, cache_key);
+
+    if (!cache_hit) {
+        // Generate procedural textures for all registered blocks
+        if (config_.generate_procedural) {
+            generate_block_textures();
+        }
+
+        if (use_cache && block_atlas_->bake()) {
+            (void)block_atlas_->save_baked(cache_path, cache_key);
+        }
     }
 
     // Build the atlas
@@ -39,19 +96,45 @@ bool TextureManager::initialize(graphics::GraphicsDevice* device, const TextureM
         return false;
     }
 
-    REALCRAFT_LOG_INFO(core::log_category::GRAPHICS, "TextureManager initialized");
+    build_face_tables();
+
+    REALCRAFT_LOG_INFO(core::log_category::GRAPHICS, "TextureManager initialized ({})",
+                       cache_hit ? "cached atlas" : "generated atlas");
     return true;
 }
 
 void TextureManager::shutdown() {
+    face_texture_table_.clear();
+    face_uv_table_.clear();
     block_atlas_.reset();
     device_ = nullptr;
 }
 
+uint64_t TextureManager::compute_cache_key(const TextureAtlasDesc& atlas_desc) const {
+    KeyHasher hasher;
+    hasher.add(PROCEDURAL_TEXTURE_VERSION);
+    hasher.add(atlas_desc.atlas_size);
+    hasher.add(atlas_desc.tile_size);
+    hasher.add(atlas_desc.padding);
+    hasher.add(atlas_desc.max_layers);
+    hasher.add(atlas_desc.generate_mipmaps);
+    hasher.add(config_.generate_procedural);
+
+    const auto& registry = world::BlockRegistry::instance();
+    const size_t count = registry.count();
+    hasher.add(static_cast<uint64_t>(count));
+    for (size_t i = 0; i < count; i++) {
+        const auto* block = registry.get(static_cast<world::BlockId>(i));
+        hasher.add(std::string_view(block ? block->get_name() : std::string()));
+    }
+    return hasher.value;
+}
+
 void TextureManager::generate_block_textures() {
     const auto& registry = world::BlockRegistry::instance();
 
-    // Get all block types and generate textures
+    // Queue textures for all block types
+    std::vector<TextureJob> jobs;
     const size_t count = registry.count();
     for (size_t i = 0; i < count; i++) {
         auto id = static_cast<world::BlockId>(i);
@@ -59,73 +142,77 @@ void TextureManager::generate_block_textures() {
         if (!block)
             continue;
 
-        register_block_textures(*block);
+        collect_block_textures(*block, jobs);
+    }
+
+    // Generators are pure functions, so they run in parallel; textures are
+    // then added in queue order to keep atlas indices deterministic
+    std::vector<std::vector<uint8_t>> results(jobs.size());
+    core::parallel_for(jobs.size(), [&](size_t i) { results[i] = jobs[i].generate(); });
+
+    const uint32_t size = config_.tile_size;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        (void)block_atlas_->add_texture(jobs[i].name, size, size, results[i]);
     }
 }
 
-void TextureManager::register_block_textures(const world::BlockType& block_type) {
+void TextureManager::collect_block_textures(const world::BlockType& block_type, std::vector<TextureJob>& jobs) const {
     const std::string& name = block_type.get_name();
     uint32_t size = config_.tile_size;
 
-    std::vector<uint8_t> texture_data;
-
     // Generate appropriate texture based on block type
     if (name == "realcraft:air") {
         return;  // No texture for air
     } else if (name == "realcraft:stone") {
-        texture_data = ProceduralTextureGenerator::generate_stone(size, 12345);
+        jobs.push_back({name, [size] { return ProceduralTextureGenerator::generate_stone(size, 12345); }});
     } else if (name == "realcraft:dirt") {
-        texture_data = ProceduralTextureGenerator::generate_dirt(size, 23456);
+        jobs.push_back({name, [size] { return ProceduralTextureGenerator::generate_dirt(size, 23456); }});
     } else if (name == "realcraft:grass") {
         // Grass has different top/side textures - add both
-        auto top_data = ProceduralTextureGenerator::generate_grass_top(size, 34567);
-        auto side_data = ProceduralTextureGenerator::generate_grass_side(size, 34568);
-        auto bottom_data = ProceduralTextureGenerator::generate_dirt(size, 23456);
-
-        (void)block_atlas_->add_texture(name + "_top", size, size, top_data);
-        (void)block_atlas_->add_texture(name + "_side", size, size, side_data);
-        (void)block_atlas_->add_texture(name + "_bottom", size, size, bottom_data);
-        return;
+        jobs.push_back({name + "_top", [size] { return ProceduralTextureGenerator::generate_grass_top(size, 34567); }});
+        jobs.push_back(
+            {name + "_side", [size] { return ProceduralTextureGenerator::generate_grass_side(size, 34568); }});
+        jobs.push_back({name + "_bottom", [size] { return ProceduralTextureGenerator::generate_dirt(size, 23456); }});
     } else if (name == "realcraft:sand") {
-        texture_data = ProceduralTextureGenerator::generate_sand(size, 45678);
+        jobs.push_back({name, [size] { return ProceduralTextureGenerator::generate_sand(size, 45678); }});
     } else if (name == "realcraft:water") {
-        texture_data = ProceduralTextureGenerator::generate_water(size, 56789);
+        jobs.push_back({name, [size] { return ProceduralTextureGenerator::generate_water(size, 56789); }});
     } else {
         // Default: checkerboard magenta/black (missing texture)
-        texture_data = ProceduralTextureGenerator::generate(
-            size, size, ProceduralTextureGenerator::rgba(255, 0, 255, 255),
-            ProceduralTextureGenerator::rgba(0, 0, 0, 255), TexturePattern::Checkerboard);
-    }
-
-    if (!texture_data.empty()) {
-        (void)block_atlas_->add_texture(name, size, size, texture_data);
+        jobs.push_back({name, [size] {
+                            return ProceduralTextureGenerator::generate(
+                                size, size, ProceduralTextureGenerator::rgba(255, 0, 255, 255),
+                                ProceduralTextureGenerator::rgba(0, 0, 0, 255), TexturePattern::Checkerboard);
+                        }});
     }
 }
 
-uint16_t TextureManager::get_block_texture_index(world::BlockId block_id, uint8_t face) const {
+void TextureManager::build_face_tables() {
     const auto& registry = world::BlockRegistry::instance();
-    const auto* block = registry.get(block_id);
-    if (!block) {
-        return 0;
-    }
+    const size_t count = registry.count();
 
-    // For grass, use different textures for different faces
-    const std::string& name = block->get_name();
-    if (name == "realcraft:grass") {
-        std::string tex_name;
-        if (face == 3) {  // PosY (top)
-            tex_name = name + "_top";
-        } else if (face == 2) {  // NegY (bottom)
-            tex_name = name + "_bottom";
-        } else {
-            tex_name = name + "_side";
+    face_texture_table_.assign(count * 6, 0);
+    face_uv_table_.assign(count * 6, glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
+
+    for (size_t i = 0; i < count; i++) {
+        const auto* block = registry.get(static_cast<world::BlockId>(i));
+        if (!block) {
+            continue;
+        }
+        for (uint8_t face = 0; face < 6; face++) {
+            const uint16_t index = block_atlas_->find_index(face_texture_name(block->get_name(), face)).value_or(0);
+            face_texture_table_[i * 6 + face] = index;
+            face_uv_table_[i * 6 + face] = block_atlas_->get_uv_rect(index);
         }
-        auto idx = block_atlas_->find_index(tex_name);
-        return idx.value_or(0);
     }
+}
 
-    auto idx = block_atlas_->find_index(name);
-    return idx.value_or(0);
+uint16_t TextureManager::get_block_texture_index(world::BlockId block_id, uint8_t face) const {
+    const size_t slot = static_cast<size_t>(block_id) * 6 + face;
+    if (face >= 6 || slot >= face_texture_table_.size()) {
+        return 0;
+    }
+    return face_texture_table_[slot];
 }
 
 glm::vec4 TextureManager::get_texture_uv(uint16_t texture_index) const {
@@ -0,0 +1,141 @@
+// RealCraft World System
+// block_change_journal.cpp - Versioned per-chunk log of block changes
+
+#include <algorithm>
+#include <atomic>
+#include <realcraft/world/block_change_journal.hpp>
+
+namespace realcraft::world {
+
+namespace {
+
+// Shared by every chunk so versions are never reused across chunk instances
+std::atomic<uint64_t> g_next_version{1};
+
+uint64_t next_version() {
+    return g_next_version.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+// ============================================================================
+// BlockChangeJournal Implementation
+// ============================================================================
+
+BlockChangeJournal::BlockChangeJournal(size_t capacity)
+    : capacity_(std::max<size_t>(1, capacity)), version_(next_version()), floor_(version_) {}
+
+void BlockChangeJournal::record(uint32_t index, const PaletteEntry& old_entry, const PaletteEntry& new_entry) {
+    version_ = next_version();
+    if (ring_.empty()) {
+        ring_.resize(capacity_);
+    }
+
+    PaletteEntry first_old = old_entry;
+    auto it = live_.find(index);
+    if (it != live_.end()) {
+        Entry& previous = slot(it->second);
+
+        // Rewriting the newest entry: update it in place
+        if (it->second + 1 == tail_) {
+            previous.new_entry = new_entry;
+            previous.version = version_;
+            return;
+        }
+
+        first_old = previous.old_entry;
+        previous.live = false;
+        ++dead_;
+        live_.erase(it);
+    }
+
+    if (tail_ - head_ == capacity_) {
+        make_room();
+    }
+    Entry& entry = slot(tail_);
+    entry.index = index;
+    entry.live = true;
+    entry.old_entry = first_old;
+    entry.new_entry = new_entry;
+    entry.version = version_;
+    live_[index] = tail_++;
+}
+
+void BlockChangeJournal::invalidate() {
+    version_ = next_version();
+    floor_ = version_;
+    head_ = 0;
+    tail_ = 0;
+    dead_ = 0;
+    live_.clear();
+}
+
+ChunkDelta BlockChangeJournal::changes_since(uint64_t since) const {
+    ChunkDelta delta;
+    delta.version = version_;
+    if (since == version_) {
+        return delta;
+    }
+    if (since < floor_ || since > version_) {
+        delta.snapshot_required = true;
+        return delta;
+    }
+
+    // Entries are already in version order
+    for (uint64_t seq = head_; seq < tail_; ++seq) {
+        const Entry& entry = slot(seq);
+        if (entry.live && entry.version > since) {
+            delta.changes.push_back({entry.index, entry.old_entry, entry.new_entry});
+        }
+    }
+    return delta;
+}
+
+void BlockChangeJournal::make_room() {
+    // Dead entries at the head cost nothing to drop
+    while (head_ < tail_ && !slot(head_).live) {
+        ++head_;
+        --dead_;
+    }
+    if (tail_ - head_ < capacity_) {
+        return;
+    }
+    if (dead_ > 0) {
+        compact();
+    } else {
+        evict_oldest();
+    }
+}
+
+// Slide live entries down over dead ones, keeping their order. Runs only when
+// the ring is full and frees every dead slot at once.
+void BlockChangeJournal::compact() {
+    uint64_t write = head_;
+    for (uint64_t seq = head_; seq < tail_; ++seq) {
+        const Entry& entry = slot(seq);
+        if (!entry.live) {
+            continue;
+        }
+        if (seq != write) {
+            slot(write) = entry;
+            live_[entry.index] = write;
+        }
+        ++write;
+    }
+    tail_ = write;
+    dead_ = 0;
+}
+
+void BlockChangeJournal::evict_oldest() {
+    const Entry& entry = slot(head_);
+    if (entry.live) {
+        // Anyone older than this entry would now miss it
+        floor_ = std::max(floor_, entry.version);
+        live_.erase(entry.index);
+    } else {
+        --dead_;
+    }
+    ++head_;
+}
+
+}  // namespace realcraft::world
@@ -1,8 +1,11 @@
 // RealCraft World System
 // block_registry.cpp - Block registry singleton implementation
 
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <realcraft/core/logger.hpp>
+#include <realcraft/core/profiler.hpp>
 #include <realcraft/world/block.hpp>
 #include <unordered_map>
 #include <vector>
@@ -16,7 +19,8 @@ namespace realcraft::world {
 struct BlockRegistry::Impl {
     std::vector<std::unique_ptr<BlockType>> blocks;
     std::unordered_map<std::string, BlockId> name_to_id;
-    std::unordered_map<BlockId, BlockTickCallback> tick_callbacks;
+    std::unordered_map<BlockId, std::shared_ptr<const BlockTickCallback>> tick_callbacks;
+    std::array<std::atomic<bool>, size_t{BLOCK_INVALID} + 1> tickable{};
 
     BlockPlacedCallback placed_callback;
     BlockBrokenCallback broken_callback;
@@ -907,7 +911,8 @@ void BlockRegistry::register_defaults() {
 }
 
 const BlockType* BlockRegistry::get(BlockId id) const {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
+    std::unique_lock<std::mutex> lock(impl_->mutex, std::defer_lock);
+    REALCRAFT_PROFILE_LOCK(lock, "Wait: BlockRegistry");
     if (id >= impl_->blocks.size()) {
         return nullptr;
     }
@@ -924,7 +929,8 @@ const BlockType* BlockRegistry::get(std::string_view name) const {
 }
 
 std::optional<BlockId> BlockRegistry::find_id(std::string_view name) const {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
+    std::unique_lock<std::mutex> lock(impl_->mutex, std::defer_lock);
+    REALCRAFT_PROFILE_LOCK(lock, "Wait: BlockRegistry");
     auto it = impl_->name_to_id.find(std::string(name));
     if (it == impl_->name_to_id.end()) {
         return std::nullopt;
@@ -956,7 +962,13 @@ void BlockRegistry::set_broken_callback(BlockBrokenCallback callback) {
 
 void BlockRegistry::set_tick_callback(BlockId id, BlockTickCallback callback) {
     std::lock_guard<std::mutex> lock(impl_->mutex);
-    impl_->tick_callbacks[id] = std::move(callback);
+    const bool tickable = static_cast<bool>(callback);
+    if (tickable) {
+        impl_->tick_callbacks[id] = std::make_shared<const BlockTickCallback>(std::move(callback));
+    } else {
+        impl_->tick_callbacks.erase(id);
+    }
+    impl_->tickable[id].store(tickable, std::memory_order_release);
 }
 
 void BlockRegistry::on_block_placed(const WorldBlockPos& pos, BlockId id, BlockStateId state) const {
@@ -974,11 +986,25 @@ void BlockRegistry::on_block_broken(const WorldBlockPos& pos, BlockId id) const
 }
 
 void BlockRegistry::on_block_tick(const WorldBlockPos& pos, BlockId id, double dt) const {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
-    auto it = impl_->tick_callbacks.find(id);
-    if (it != impl_->tick_callbacks.end()) {
-        it->second(pos, id, dt);
+    if (!is_tickable(id)) {
+        return;
     }
+
+    // Hold a reference rather than the lock while the callback runs
+    std::shared_ptr<const BlockTickCallback> callback;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        auto it = impl_->tick_callbacks.find(id);
+        if (it == impl_->tick_callbacks.end()) {
+            return;
+        }
+        callback = it->second;
+    }
+    (*callback)(pos, id, dt);
+}
+
+bool BlockRegistry::is_tickable(BlockId id) const {
+    return impl_->tickable[id].load(std::memory_order_acquire);
 }
 
 }  // namespace realcraft::world
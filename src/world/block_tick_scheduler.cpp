@@ -0,0 +1,761 @@
+// RealCraft World System
+// block_tick_scheduler.cpp - Scheduled and random block ticks implementation
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <realcraft/core/logger.hpp>
+#include <realcraft/core/profiler.hpp>
+#include <realcraft/world/block.hpp>
+#include <realcraft/world/block_tick_scheduler.hpp>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace realcraft::world {
+
+namespace {
+
+// Random tick sections are 16^3 cubes
+inline constexpr int32_t SECTION_SIZE = SUBCHUNK_SIZE;
+inline constexpr int32_t SECTIONS_X = CHUNK_SIZE_X / SECTION_SIZE;
+inline constexpr int32_t SECTIONS_Y = CHUNK_SIZE_Y / SECTION_SIZE;
+inline constexpr int32_t SECTIONS_Z = CHUNK_SIZE_Z / SECTION_SIZE;
+inline constexpr size_t SECTION_COUNT = static_cast<size_t>(SECTIONS_X * SECTIONS_Y * SECTIONS_Z);
+
+size_t section_of(const LocalBlockPos& pos) {
+    return static_cast<size_t>(((pos.y / SECTION_SIZE) * SECTIONS_Z + pos.z / SECTION_SIZE) * SECTIONS_X +
+                               pos.x / SECTION_SIZE);
+}
+
+LocalBlockPos section_origin(size_t section) {
+    const auto s = static_cast<int32_t>(section);
+    return {(s % SECTIONS_X) * SECTION_SIZE, (s / (SECTIONS_X * SECTIONS_Z)) * SECTION_SIZE,
+            ((s / SECTIONS_X) % SECTIONS_Z) * SECTION_SIZE};
+}
+
+// splitmix64 finalizer; random ticks are a pure function of (seed, tick,
+// chunk), so results do not depend on which thread ticks a chunk
+uint64_t mix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+uint64_t chunk_key(const ChunkPos& pos) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(pos.x)) << 32) | static_cast<uint32_t>(pos.y);
+}
+
+uint32_t default_worker_count() {
+    const uint32_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    return std::min(4u, hardware - 1);
+}
+
+// ============================================================================
+// Timing Wheel
+// ============================================================================
+
+struct WheelEntry {
+    ChunkPos chunk{0, 0};
+    uint32_t index = 0;
+    uint64_t due = 0;
+};
+
+// Three levels of 64 slots cover 2^18 ticks (about 3.6 hours at 20 Hz);
+// anything later waits in an overflow list that is re-filed once per 2^18
+// ticks. Inserting is O(1) and each entry is moved at most once per level.
+class TimingWheel {
+public:
+    static constexpr uint32_t SLOT_BITS = 6;
+    static constexpr uint64_t SLOTS = uint64_t{1} << SLOT_BITS;
+    static constexpr uint32_t LEVELS = 3;
+
+    [[nodiscard]] uint64_t now() const { return now_; }
+
+    // entry.due must not be in the past
+    void insert(const WheelEntry& entry) {
+        const uint64_t delta = entry.due - now_;
+        for (uint32_t level = 0; level < LEVELS; ++level) {
+            const uint32_t shift = SLOT_BITS * level;
+            if (delta < (SLOTS << shift)) {
+                levels_[level][(entry.due >> shift) & (SLOTS - 1)].push_back(entry);
+                return;
+            }
+        }
+        overflow_.push_back(entry);
+    }
+
+    // Step one tick and append the entries due on it
+    void advance(std::vector<WheelEntry>& due) {
+        ++now_;
+
+        // Re-file coarser buckets that now fall within a finer level's range
+        if ((now_ & ((SLOTS << (SLOT_BITS * (LEVELS - 1))) - 1)) == 0) {
+            refile(overflow_);
+        }
+        for (uint32_t level = LEVELS - 1; level > 0; --level) {
+            const uint32_t shift = SLOT_BITS * level;
+            if ((now_ & ((uint64_t{1} << shift) - 1)) == 0) {
+                refile(levels_[level][(now_ >> shift) & (SLOTS - 1)]);
+            }
+        }
+
+        auto& slot = levels_[0][now_ & (SLOTS - 1)];
+        due.insert(due.end(), slot.begin(), slot.end());
+        slot.clear();
+    }
+
+    void clear() {
+        for (auto& level : levels_) {
+            for (auto& slot : level) {
+                slot.clear();
+            }
+        }
+        overflow_.clear();
+    }
+
+private:
+    void refile(std::vector<WheelEntry>& bucket) {
+        std::vector<WheelEntry> entries;
+        entries.swap(bucket);
+        for (const WheelEntry& entry : entries) {
+            insert(entry);
+        }
+    }
+
+    uint64_t now_ = 0;
+    std::array<std::array<std::vector<WheelEntry>, SLOTS>, LEVELS> levels_;
+    std::vector<WheelEntry> overflow_;
+};
+
+// ============================================================================
+// Per-Chunk State
+// ============================================================================
+
+struct ChunkTicks {
+    Chunk* chunk = nullptr;
+    std::array<uint16_t, SECTION_COUNT> tickable{};  // Tickable blocks per section
+    uint32_t tickable_sections = 0;
+    std::unordered_map<uint32_t, uint64_t> scheduled;  // Block index -> due tick
+};
+
+struct DeferredWrite {
+    WorldBlockPos pos{0};
+    PaletteEntry entry;
+};
+
+struct DeferredSchedule {
+    WorldBlockPos pos{0};
+    uint32_t delay = 0;
+};
+
+// One chunk's work for one tick, plus the changes its callbacks requested
+struct TickJob {
+    const void* owner = nullptr;
+    ChunkPos pos{0, 0};
+    Chunk* chunk = nullptr;
+    std::array<uint16_t, SECTION_COUNT> tickable{};
+    std::vector<uint32_t> scheduled;  // Due block indices
+
+    std::vector<std::pair<uint32_t, BlockId>> hits;
+    std::vector<DeferredWrite> writes;
+    std::vector<DeferredSchedule> schedules;
+    size_t scheduled_ticks = 0;
+    size_t random_ticks = 0;
+};
+
+// Job being ticked on this thread, so callbacks can defer their changes
+thread_local TickJob* t_current_job = nullptr;
+
+}  // namespace
+
+// ============================================================================
+// BlockTickScheduler Implementation
+// ============================================================================
+
+struct BlockTickScheduler::Impl {
+    WorldManager* world_manager = nullptr;
+    BlockTickConfig config;
+    bool initialized = false;
+    uint64_t seed = 0;
+    double accumulator = 0.0;
+
+    // Tick state; never held while calling into the WorldManager or locking a chunk
+    mutable std::mutex state_mutex;
+    TimingWheel wheel;
+    std::unordered_map<ChunkPos, ChunkTicks> chunks;
+    std::unordered_set<ChunkPos> random_chunks;  // Chunks with tickable sections
+    size_t tickable_sections = 0;
+    size_t pending_scheduled = 0;
+    Stats stats;
+
+    // Chunks loaded since the last tick (loads are reported on world workers)
+    std::mutex loaded_mutex;
+    std::vector<ChunkPos> loaded_queue;
+
+    // Scratch reused across ticks (game thread only)
+    std::vector<WheelEntry> due_entries;
+    std::vector<std::pair<ChunkPos, uint32_t>> fired;
+    std::vector<ChunkPos> active;
+    std::vector<TickJob> jobs;
+    std::unordered_map<ChunkPos, size_t> job_of;
+    uint64_t tick_number = 0;
+    double tick_dt = 0.0;
+
+    // Worker pool; the game thread also takes jobs
+    std::vector<std::thread> workers;
+    std::mutex pool_mutex;
+    std::condition_variable pool_cv;
+    std::condition_variable done_cv;
+    uint64_t batch = 0;
+    size_t busy_workers = 0;
+    bool stop_workers = false;
+    std::atomic<size_t> next_job{0};
+
+    // ------------------------------------------------------------------------
+    // Bookkeeping (state_mutex held)
+    // ------------------------------------------------------------------------
+
+    void set_section_count(const ChunkPos& pos, ChunkTicks& state, size_t section, uint16_t count) {
+        const bool had = state.tickable[section] > 0;
+        state.tickable[section] = count;
+        if (had == (count > 0)) {
+            return;
+        }
+        if (count > 0) {
+            ++tickable_sections;
+            if (state.tickable_sections++ == 0) {
+                random_chunks.insert(pos);
+            }
+        } else {
+            --tickable_sections;
+            if (--state.tickable_sections == 0) {
+                random_chunks.erase(pos);
+            }
+        }
+    }
+
+    // Returns false if an earlier tick for the block is already pending
+    bool insert_scheduled(const ChunkPos& pos, ChunkTicks& state, uint32_t index, uint64_t due) {
+        auto [it, inserted] = state.scheduled.try_emplace(index, due);
+        if (!inserted) {
+            if (it->second <= due) {
+                return false;
+            }
+            it->second = due;  // The old wheel entry goes stale
+        } else {
+            ++pending_scheduled;
+        }
+        wheel.insert({pos, index, due});
+        return true;
+    }
+
+    void schedule_locked(const WorldBlockPos& pos, uint32_t delay) {
+        const ChunkPos chunk_pos = world_to_chunk(pos);
+        auto it = chunks.find(chunk_pos);
+        if (it == chunks.end()) {
+            return;
+        }
+        const auto index = static_cast<uint32_t>(local_to_index(world_to_local(pos)));
+        if (insert_scheduled(chunk_pos, it->second, index, wheel.now() + std::max(1u, delay))) {
+            it->second.chunk->mark_dirty();
+        }
+    }
+
+    void write_scheduled(const ChunkTicks& state, ChunkMetadata& metadata) const {
+        metadata.scheduled_ticks.clear();
+        metadata.scheduled_ticks.reserve(state.scheduled.size());
+        for (const auto& [index, due] : state.scheduled) {
+            const uint64_t delay = std::min<uint64_t>(due - wheel.now(), UINT32_MAX);
+            metadata.scheduled_ticks.push_back({index, static_cast<uint32_t>(delay)});
+        }
+        std::sort(metadata.scheduled_ticks.begin(), metadata.scheduled_ticks.end(),
+                  [](const ScheduledBlockTick& a, const ScheduledBlockTick& b) { return a.index < b.index; });
+    }
+
+    // ------------------------------------------------------------------------
+    // Chunk Loading
+    // ------------------------------------------------------------------------
+
+    static void count_tickable(const Chunk& chunk, std::array<uint16_t, SECTION_COUNT>& counts) {
+        const BlockRegistry& registry = BlockRegistry::instance();
+        auto lock = chunk.read_lock();
+        const VoxelStorage& storage = lock.storage();
+
+        // Most chunks hold no tickable block type at all
+        const auto& palette = storage.get_palette();
+        if (std::none_of(palette.begin(), palette.end(),
+                         [&](const PaletteEntry& entry) { return registry.is_tickable(entry.block_id); })) {
+            return;
+        }
+
+        std::array<BlockId, static_cast<size_t>(CHUNK_SIZE_X * CHUNK_SIZE_Z)> layer;
+        for (int32_t y = 0; y < CHUNK_SIZE_Y; ++y) {
+            storage.decode_blocks(local_to_index(LocalBlockPos(0, y, 0)), layer);
+            const BlockId* block = layer.data();
+            for (int32_t z = 0; z < CHUNK_SIZE_Z; ++z) {
+                for (int32_t x = 0; x < CHUNK_SIZE_X; ++x, ++block) {
+                    if (registry.is_tickable(*block)) {
+                        ++counts[section_of(LocalBlockPos(x, y, z))];
+                    }
+                }
+            }
+        }
+    }
+
+    // Start tracking chunks reported by on_chunk_loaded (game thread)
+    void absorb_loaded_chunks() {
+        std::vector<ChunkPos> positions;
+        {
+            std::lock_guard<std::mutex> lock(loaded_mutex);
+            positions.swap(loaded_queue);
+        }
+
+        for (const ChunkPos& pos : positions) {
+            Chunk* chunk = world_manager->get_chunk(pos);
+            if (!chunk) {
+                continue;
+            }
+
+            std::array<uint16_t, SECTION_COUNT> counts{};
+            count_tickable(*chunk, counts);
+            std::vector<ScheduledBlockTick> saved;
+            saved.swap(chunk->get_metadata_mut().scheduled_ticks);
+
+            std::lock_guard<std::mutex> lock(state_mutex);
+            ChunkTicks& state = chunks[pos];
+            state.chunk = chunk;
+            for (size_t section = 0; section < SECTION_COUNT; ++section) {
+                set_section_count(pos, state, section, counts[section]);
+            }
+            for (const ScheduledBlockTick& tick : saved) {
+                (void)insert_scheduled(pos, state, tick.index, wheel.now() + std::max(1u, tick.delay));
+            }
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Ticking
+    // ------------------------------------------------------------------------
+
+    // Advance the wheel and build one job per chunk with work (state_mutex held)
+    void collect_jobs() {
+        due_entries.clear();
+        fired.clear();
+        wheel.advance(due_entries);
+        tick_number = wheel.now();
+
+        active.assign(random_chunks.begin(), random_chunks.end());
+        for (const WheelEntry& entry : due_entries) {
+            auto it = chunks.find(entry.chunk);
+            if (it == chunks.end()) {
+                continue;  // Chunk unloaded
+            }
+            auto scheduled = it->second.scheduled.find(entry.index);
+            if (scheduled == it->second.scheduled.end() || scheduled->second != entry.due) {
+                continue;  // Rescheduled earlier and already fired
+            }
+            it->second.scheduled.erase(scheduled);
+            --pending_scheduled;
+            it->second.chunk->mark_dirty();
+            fired.emplace_back(entry.chunk, entry.index);
+            if (it->second.tickable_sections == 0) {
+                active.push_back(entry.chunk);
+            }
+        }
+
+        // Chunk order fixes the order deferred writes are applied in
+        std::sort(active.begin(), active.end(),
+                  [](const ChunkPos& a, const ChunkPos& b) { return a.x != b.x ? a.x < b.x : a.y < b.y; });
+        active.erase(std::unique(active.begin(), active.end()), active.end());
+
+        jobs.resize(active.size());
+        job_of.clear();
+        for (size_t i = 0; i < active.size(); ++i) {
+            const ChunkTicks& state = chunks.at(active[i]);
+            TickJob& job = jobs[i];
+            job.owner = this;
+            job.pos = active[i];
+            job.chunk = state.chunk;
+            job.tickable = state.tickable;
+            job.scheduled.clear();
+            job.hits.clear();
+            job.writes.clear();
+            job.schedules.clear();
+            job_of.emplace(active[i], i);
+        }
+        for (const auto& [pos, index] : fired) {
+            jobs[job_of.at(pos)].scheduled.push_back(index);
+        }
+    }
+
+    void run_job(TickJob& job) const {
+        const BlockRegistry& registry = BlockRegistry::instance();
+
+        // Pick blocks under the chunk lock, but run callbacks without it
+        {
+            auto lock = job.chunk->read_lock();
+            for (uint32_t index : job.scheduled) {
+                const BlockId id = lock.get_entry(index).block_id;
+                if (registry.is_tickable(id)) {
+                    job.hits.emplace_back(index, id);
+                }
+            }
+            job.scheduled_ticks = job.hits.size();
+
+            uint64_t rng = mix64(seed ^ mix64(tick_number ^ mix64(chunk_key(job.pos))));
+            for (size_t section = 0; section < SECTION_COUNT; ++section) {
+                if (job.tickable[section] == 0) {
+                    continue;
+                }
+                const LocalBlockPos origin = section_origin(section);
+                for (uint32_t i = 0; i < config.random_ticks_per_section; ++i) {
+                    rng = mix64(rng);
+                    const LocalBlockPos local = origin + LocalBlockPos(static_cast<int32_t>(rng & 15),
+                                                                       static_cast<int32_t>((rng >> 4) & 15),
+                                                                       static_cast<int32_t>((rng >> 8) & 15));
+                    const auto index = static_cast<uint32_t>(local_to_index(local));
+                    const BlockId id = lock.get_entry(index).block_id;
+                    if (registry.is_tickable(id)) {
+                        job.hits.emplace_back(index, id);
+                    }
+                }
+            }
+            job.random_ticks = job.hits.size() - job.scheduled_ticks;
+        }
+
+        t_current_job = &job;
+        for (const auto& [index, id] : job.hits) {
+            registry.on_block_tick(local_to_world(job.pos, index_to_local(index)), id, tick_dt);
+        }
+        t_current_job = nullptr;
+    }
+
+    void drain_jobs() {
+        for (size_t i = next_job.fetch_add(1, std::memory_order_relaxed); i < jobs.size();
+             i = next_job.fetch_add(1, std::memory_order_relaxed)) {
+            run_job(jobs[i]);
+        }
+    }
+
+    void run_jobs() {
+        if (workers.empty() || jobs.size() < config.min_parallel_chunks) {
+            for (TickJob& job : jobs) {
+                run_job(job);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(pool_mutex);
+            next_job.store(0, std::memory_order_relaxed);
+            busy_workers = workers.size();
+            ++batch;
+        }
+        pool_cv.notify_all();
+        drain_jobs();
+
+        std::unique_lock<std::mutex> lock(pool_mutex);
+        done_cv.wait(lock, [this] { return busy_workers == 0; });
+    }
+
+    void worker_thread() {
+        REALCRAFT_PROFILE_THREAD("Block Tick Worker");
+        uint64_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(pool_mutex);
+                pool_cv.wait(lock, [&] { return stop_workers || batch != seen; });
+                if (stop_workers) {
+                    return;
+                }
+                seen = batch;
+            }
+
+            drain_jobs();
+
+            std::lock_guard<std::mutex> lock(pool_mutex);
+            if (--busy_workers == 0) {
+                done_cv.notify_one();
+            }
+        }
+    }
+
+    void start_workers() {
+        const uint32_t count = config.worker_threads != 0 ? config.worker_threads : default_worker_count();
+        stop_workers = false;
+        for (uint32_t i = 0; i < count; ++i) {
+            workers.emplace_back([this] { worker_thread(); });
+        }
+    }
+
+    void join_workers() {
+        {
+            std::lock_guard<std::mutex> lock(pool_mutex);
+            stop_workers = true;
+        }
+        pool_cv.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+    }
+};
+
+BlockTickScheduler::BlockTickScheduler() : impl_(std::make_unique<Impl>()) {}
+
+BlockTickScheduler::~BlockTickScheduler() {
+    shutdown();
+}
+
+bool BlockTickScheduler::initialize(WorldManager* world_manager, const BlockTickConfig& config) {
+    if (impl_->initialized) {
+        REALCRAFT_LOG_WARN(core::log_category::WORLD, "BlockTickScheduler already initialized");
+        return true;
+    }
+    if (!world_manager || config.tick_rate <= 0.0) {
+        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "BlockTickScheduler needs a world and a positive tick rate");
+        return false;
+    }
+
+    impl_->world_manager = world_manager;
+    impl_->config = config;
+    impl_->seed = config.seed != 0 ? config.seed : world_manager->get_seed();
+    impl_->tick_dt = 1.0 / config.tick_rate;
+    impl_->accumulator = 0.0;
+
+    world_manager->add_observer(this);
+    {
+        std::lock_guard<std::mutex> lock(impl_->loaded_mutex);
+        impl_->loaded_queue = world_manager->get_loaded_chunk_positions();
+    }
+    impl_->absorb_loaded_chunks();
+
+    impl_->start_workers();
+    impl_->initialized = true;
+
+    REALCRAFT_LOG_INFO(core::log_category::WORLD, "BlockTickScheduler initialized at {} Hz with {} worker threads",
+                       config.tick_rate, impl_->workers.size());
+    return true;
+}
+
+void BlockTickScheduler::shutdown() {
+    if (!impl_->initialized) {
+        return;
+    }
+
+    impl_->world_manager->remove_observer(this);
+    impl_->join_workers();
+
+    // Hand pending ticks to the chunks so the next save keeps them
+    {
+        std::lock_guard<std::mutex> lock(impl_->state_mutex);
+        if (impl_->world_manager->is_initialized()) {
+            for (auto& [pos, state] : impl_->chunks) {
+                if (!state.scheduled.empty()) {
+                    impl_->write_scheduled(state, state.chunk->get_metadata_mut());
+                    state.chunk->mark_dirty();
+                }
+            }
+        }
+        impl_->chunks.clear();
+        impl_->random_chunks.clear();
+        impl_->wheel.clear();
+        impl_->tickable_sections = 0;
+        impl_->pending_scheduled = 0;
+    }
+    {
+        std::lock_guard<std::mutex> lock(impl_->loaded_mutex);
+        impl_->loaded_queue.clear();
+    }
+
+    impl_->jobs.clear();
+    impl_->world_manager = nullptr;
+    impl_->initialized = false;
+}
+
+bool BlockTickScheduler::is_initialized() const {
+    return impl_->initialized;
+}
+
+void BlockTickScheduler::update(double delta_time) {
+    if (!impl_->initialized) {
+        return;
+    }
+
+    impl_->accumulator += delta_time;
+    uint32_t ticks = 0;
+    while (impl_->accumulator >= impl_->tick_dt && ticks < impl_->config.max_ticks_per_update) {
+        tick();
+        impl_->accumulator -= impl_->tick_dt;
+        ++ticks;
+    }
+
+    // Drop time that could not be caught up rather than spiral
+    if (impl_->accumulator >= impl_->tick_dt) {
+        impl_->accumulator = 0.0;
+    }
+}
+
+void BlockTickScheduler::tick() {
+    if (!impl_->initialized) {
+        return;
+    }
+    REALCRAFT_PROFILE_ZONE("BlockTickScheduler::tick");
+    auto start = std::chrono::high_resolution_clock::now();
+
+    impl_->absorb_loaded_chunks();
+    {
+        std::lock_guard<std::mutex> lock(impl_->state_mutex);
+        impl_->collect_jobs();
+    }
+
+    impl_->run_jobs();
+
+    // Apply deferred changes in chunk order; set_block reports back through
+    // on_block_changed, which keeps the section counts current
+    size_t writes = 0;
+    size_t random_ticks = 0;
+    size_t scheduled_ticks = 0;
+    for (TickJob& job : impl_->jobs) {
+        for (const DeferredWrite& write : job.writes) {
+            impl_->world_manager->set_block(write.pos, write.entry.block_id, write.entry.state_id);
+        }
+        if (!job.schedules.empty()) {
+            std::lock_guard<std::mutex> lock(impl_->state_mutex);
+            for (const DeferredSchedule& schedule : job.schedules) {
+                impl_->schedule_locked(schedule.pos, schedule.delay);
+            }
+        }
+        writes += job.writes.size();
+        random_ticks += job.random_ticks;
+        scheduled_ticks += job.scheduled_ticks;
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::lock_guard<std::mutex> lock(impl_->state_mutex);
+    impl_->stats.last_random_ticks = random_ticks;
+    impl_->stats.last_scheduled_ticks = scheduled_ticks;
+    impl_->stats.last_deferred_writes = writes;
+    impl_->stats.last_tick_ms = std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+uint64_t BlockTickScheduler::get_current_tick() const {
+    std::lock_guard<std::mutex> lock(impl_->state_mutex);
+    return impl_->wheel.now();
+}
+
+void BlockTickScheduler::schedule_tick(const WorldBlockPos& pos, uint32_t delay_ticks) {
+    if (t_current_job && t_current_job->owner == impl_.get()) {
+        t_current_job->schedules.push_back({pos, delay_ticks});
+        return;
+    }
+    std::lock_guard<std::mutex> lock(impl_->state_mutex);
+    impl_->schedule_locked(pos, delay_ticks);
+}
+
+bool BlockTickScheduler::has_scheduled_tick(const WorldBlockPos& pos) const {
+    std::lock_guard<std::mutex> lock(impl_->state_mutex);
+    auto it = impl_->chunks.find(world_to_chunk(pos));
+    if (it == impl_->chunks.end()) {
+        return false;
+    }
+    return it->second.scheduled.count(static_cast<uint32_t>(local_to_index(world_to_local(pos)))) > 0;
+}
+
+void BlockTickScheduler::set_block(const WorldBlockPos& pos, BlockId id, BlockStateId state) {
+    if (t_current_job && t_current_job->owner == impl_.get()) {
+        t_current_job->writes.push_back({pos, PaletteEntry{id, state}});
+        return;
+    }
+    if (impl_->world_manager) {
+        impl_->world_manager->set_block(pos, id, state);
+    }
+}
+
+// ============================================================================
+// IWorldObserver Implementation
+// ============================================================================
+
+void BlockTickScheduler::on_chunk_loaded(const ChunkPos& pos, Chunk& chunk) {
+    (void)chunk;
+    std::lock_guard<std::mutex> lock(impl_->loaded_mutex);
+    impl_->loaded_queue.push_back(pos);
+}
+
+void BlockTickScheduler::on_chunk_unloading(const ChunkPos& pos, const Chunk& chunk) {
+    (void)chunk;
+    {
+        std::lock_guard<std::mutex> lock(impl_->loaded_mutex);
+        auto& queue = impl_->loaded_queue;
+        queue.erase(std::remove(queue.begin(), queue.end(), pos), queue.end());
+    }
+
+    // The chunk's wheel entries go stale and are skipped when they come due
+    std::lock_guard<std::mutex> lock(impl_->state_mutex);
+    auto it = impl_->chunks.find(pos);
+    if (it == impl_->chunks.end()) {
+        return;
+    }
+    impl_->tickable_sections -= it->second.tickable_sections;
+    impl_->pending_scheduled -= it->second.scheduled.size();
+    impl_->random_chunks.erase(pos);
+    impl_->chunks.erase(it);
+}
+
+void BlockTickScheduler::on_chunk_saving(const ChunkPos& pos, Chunk& chunk) {
+    std::lock_guard<std::mutex> lock(impl_->state_mutex);
+    auto it = impl_->chunks.find(pos);
+    if (it != impl_->chunks.end()) {
+        impl_->write_scheduled(it->second, chunk.get_metadata_mut());
+    }
+}
+
+void BlockTickScheduler::on_block_changed(const BlockChangeEvent& event) {
+    const BlockRegistry& registry = BlockRegistry::instance();
+    const bool was_tickable = registry.is_tickable(event.old_entry.block_id);
+    const bool is_tickable = registry.is_tickable(event.new_entry.block_id);
+    if (was_tickable == is_tickable) {
+        return;
+    }
+
+    const ChunkPos chunk_pos = world_to_chunk(event.position);
+    std::lock_guard<std::mutex> lock(impl_->state_mutex);
+    auto it = impl_->chunks.find(chunk_pos);
+    if (it == impl_->chunks.end()) {
+        return;  // Counted when the chunk is picked up
+    }
+    const size_t section = section_of(world_to_local(event.position));
+    const uint16_t count = it->second.tickable[section];
+    if (is_tickable) {
+        impl_->set_section_count(chunk_pos, it->second, section, static_cast<uint16_t>(count + 1));
+    } else if (count > 0) {
+        impl_->set_section_count(chunk_pos, it->second, section, static_cast<uint16_t>(count - 1));
+    }
+}
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+BlockTickScheduler::Stats BlockTickScheduler::get_stats() const {
+    std::lock_guard<std::mutex> lock(impl_->state_mutex);
+    Stats stats = impl_->stats;
+    stats.current_tick = impl_->wheel.now();
+    stats.tracked_chunks = impl_->chunks.size();
+    stats.tickable_sections = impl_->tickable_sections;
+    stats.pending_scheduled = impl_->pending_scheduled;
+    return stats;
+}
+
+const BlockTickConfig& BlockTickScheduler::get_config() const {
+    return impl_->config;
+}
+
+}  // namespace realcraft::world
@@ -1,7 +1,8 @@
 // RealCraft World System
 // cave_generator.cpp - Procedural cave generation using Perlin worms and cellular noise
 
-#include <FastNoise/FastNoise.h>
+#include "noise_simd.hpp"
+
 #include <algorithm>
 #include <cmath>
 #include <realcraft/world/cave_generator.hpp>
@@ -45,8 +46,8 @@ struct CaveGenerator::Impl {
     void build_nodes() {
         // Perlin worm noise A (first coordinate in 2D worm space)
         {
-            auto simplex = FastNoise::New<FastNoise::Simplex>();
-            auto fractal = FastNoise::New<FastNoise::FractalFBm>();
+            auto simplex = new_noise_node<FastNoise::Simplex>(config.noise_simd);
+            auto fractal = new_noise_node<FastNoise::FractalFBm>(config.noise_simd);
             fractal->SetSource(simplex);
             fractal->SetOctaveCount(config.worm.octaves);
             fractal->SetGain(0.5f);
@@ -56,8 +57,8 @@ struct CaveGenerator::Impl {
 
         // Perlin worm noise B (second coordinate in 2D worm space)
         {
-            auto simplex = FastNoise::New<FastNoise::Simplex>();
-            auto fractal = FastNoise::New<FastNoise::FractalFBm>();
+            auto simplex = new_noise_node<FastNoise::Simplex>(config.noise_simd);
+            auto fractal = new_noise_node<FastNoise::FractalFBm>(config.noise_simd);
             fractal->SetSource(simplex);
             fractal->SetOctaveCount(config.worm.octaves);
             fractal->SetGain(0.5f);
@@ -67,14 +68,14 @@ struct CaveGenerator::Impl {
 
         // Chamber noise (cellular/Worley noise for organic caverns)
         if (config.chamber.enabled) {
-            auto cellular = FastNoise::New<FastNoise::CellularDistance>();
+            auto cellular = new_noise_node<FastNoise::CellularDistance>(config.noise_simd);
             cellular->SetDistanceFunction(FastNoise::DistanceFunction::Euclidean);
             chamber_node = cellular;
         }
 
         // Decoration noise (for randomizing decoration placement)
         {
-            auto simplex = FastNoise::New<FastNoise::Simplex>();
+            auto simplex = new_noise_node<FastNoise::Simplex>(config.noise_simd);
             decoration_noise = simplex;
         }
     }
@@ -2,17 +2,34 @@
 // chunk.cpp - Chunk class implementation
 
 #include <chrono>
+#include <cstring>
 #include <realcraft/core/logger.hpp>
 #include <realcraft/world/chunk.hpp>
 
 namespace realcraft::world {
 
+namespace {
+
+inline void write_u32(uint8_t* dst, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        dst[i] = static_cast<uint8_t>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+inline uint32_t read_u32(const uint8_t* src) {
+    return static_cast<uint32_t>(src[0]) | (static_cast<uint32_t>(src[1]) << 8) |
+           (static_cast<uint32_t>(src[2]) << 16) | (static_cast<uint32_t>(src[3]) << 24);
+}
+
+}  // namespace
+
 // ============================================================================
 // Chunk Implementation
 // ============================================================================
 
 Chunk::Chunk(const ChunkDesc& desc) : position_(desc.position), storage_() {
     metadata_.generation_seed = desc.seed;
+    version_.store(journal_.version(), std::memory_order_release);
 
     if (!desc.debug_name.empty()) {
         REALCRAFT_LOG_DEBUG(core::log_category::WORLD, "Created chunk {} at ({}, {})", desc.debug_name, position_.x,
@@ -44,7 +61,7 @@ bool Chunk::is_dirty() const {
 }
 
 void Chunk::mark_dirty() {
-    dirty_.store(true, std::memory_order_release);
+    set_dirty_flag(true);
     if (get_state() == ChunkState::Loaded) {
         set_state(ChunkState::Modified);
     }
@@ -54,12 +71,42 @@ void Chunk::mark_dirty() {
 }
 
 void Chunk::mark_clean() {
-    dirty_.store(false, std::memory_order_release);
+    set_dirty_flag(false);
     if (get_state() == ChunkState::Modified) {
         set_state(ChunkState::Loaded);
     }
 }
 
+void Chunk::set_dirty_flag(bool dirty) {
+    // Edits of an already dirty chunk skip the lock
+    if (dirty_.load(std::memory_order_acquire) == dirty) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(dirty_mutex_);
+    if (dirty_.exchange(dirty, std::memory_order_acq_rel) != dirty && dirty_counter_ != nullptr) {
+        if (dirty) {
+            dirty_counter_->fetch_add(1, std::memory_order_relaxed);
+        } else {
+            dirty_counter_->fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void Chunk::attach_dirty_counter(std::atomic<size_t>* counter) {
+    std::lock_guard<std::mutex> lock(dirty_mutex_);
+    if (dirty_counter_ != nullptr && dirty_.load(std::memory_order_relaxed)) {
+        dirty_counter_->fetch_sub(1, std::memory_order_relaxed);
+    }
+    dirty_counter_ = counter;
+    if (dirty_counter_ != nullptr && dirty_.load(std::memory_order_relaxed)) {
+        dirty_counter_->fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void Chunk::detach_dirty_counter() {
+    attach_dirty_counter(nullptr);
+}
+
 BlockId Chunk::get_block(const LocalBlockPos& pos) const {
     std::shared_lock<std::shared_mutex> lock(mutex_);
     return storage_.get_block(pos);
@@ -77,16 +124,69 @@ PaletteEntry Chunk::get_entry(const LocalBlockPos& pos) const {
 
 void Chunk::set_block(const LocalBlockPos& pos, BlockId id, BlockStateId state) {
     std::unique_lock<std::shared_mutex> lock(mutex_);
+    const PaletteEntry old_entry = storage_.get(pos);
     storage_.set_block(pos, id, state);
+    record_change(local_to_index(pos), old_entry, PaletteEntry{id, state});
     mark_dirty();
 }
 
 void Chunk::set_entry(const LocalBlockPos& pos, const PaletteEntry& entry) {
     std::unique_lock<std::shared_mutex> lock(mutex_);
+    const PaletteEntry old_entry = storage_.get(pos);
     storage_.set(pos, entry);
+    record_change(local_to_index(pos), old_entry, entry);
     mark_dirty();
 }
 
+bool Chunk::read_region(const LocalBlockPos& min, const LocalBlockPos& max, std::span<BlockId> out) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return storage_.read_region(min, max, out);
+}
+
+bool Chunk::read_region(const LocalBlockPos& min, const LocalBlockPos& max, std::span<PaletteEntry> out) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return storage_.read_region(min, max, out);
+}
+
+bool Chunk::read_column(int32_t x, int32_t z, std::span<BlockId> out) const {
+    return read_region(LocalBlockPos(x, 0, z), LocalBlockPos(x, CHUNK_SIZE_Y - 1, z), out);
+}
+
+bool Chunk::read_slab(int32_t y, std::span<BlockId> out) const {
+    return read_region(LocalBlockPos(0, y, 0), LocalBlockPos(CHUNK_SIZE_X - 1, y, CHUNK_SIZE_Z - 1), out);
+}
+
+bool Chunk::read_section(int32_t section, std::span<BlockId> out) const {
+    if (section < 0 || section >= STORAGE_SECTION_COUNT) {
+        return false;
+    }
+    const int32_t bottom = section * STORAGE_SECTION_HEIGHT;
+    return read_region(LocalBlockPos(0, bottom, 0),
+                       LocalBlockPos(CHUNK_SIZE_X - 1, bottom + STORAGE_SECTION_HEIGHT - 1, CHUNK_SIZE_Z - 1), out);
+}
+
+uint64_t Chunk::get_version() const {
+    return version_.load(std::memory_order_acquire);
+}
+
+ChunkDelta Chunk::changes_since(uint64_t version) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return journal_.changes_since(version);
+}
+
+void Chunk::record_change(size_t index, const PaletteEntry& old_entry, const PaletteEntry& new_entry) {
+    if (old_entry == new_entry) {
+        return;
+    }
+    journal_.record(static_cast<uint32_t>(index), old_entry, new_entry);
+    version_.store(journal_.version(), std::memory_order_release);
+}
+
+void Chunk::invalidate_journal() {
+    journal_.invalidate();
+    version_.store(journal_.version(), std::memory_order_release);
+}
+
 Chunk::ReadLock Chunk::read_lock() const {
     return ReadLock(*this);
 }
@@ -154,12 +254,49 @@ std::optional<PaletteEntry> Chunk::get_entry_or_neighbor(const LocalBlockPos& po
 
 std::vector<uint8_t> Chunk::serialize() const {
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    return storage_.serialize_rle();
+    std::vector<uint8_t> sections = storage_.serialize_sections();
+
+    // Scheduled ticks go first: a count, then (index, delay) pairs
+    const auto& ticks = metadata_.scheduled_ticks;
+    std::vector<uint8_t> data(4 + ticks.size() * 8 + sections.size());
+    write_u32(data.data(), static_cast<uint32_t>(ticks.size()));
+    uint8_t* dst = data.data() + 4;
+    for (const ScheduledBlockTick& tick : ticks) {
+        write_u32(dst, tick.index);
+        write_u32(dst + 4, tick.delay);
+        dst += 8;
+    }
+    std::memcpy(dst, sections.data(), sections.size());
+    return data;
 }
 
-bool Chunk::deserialize(std::span<const uint8_t> data) {
+bool Chunk::deserialize(std::span<const uint8_t> data, uint32_t format_version) {
     std::unique_lock<std::shared_mutex> lock(mutex_);
-    return storage_.deserialize_rle(data);
+    invalidate_journal();
+    metadata_.scheduled_ticks.clear();
+    if (format_version <= VOXEL_FORMAT_RLE) {
+        return storage_.deserialize_rle(data);
+    }
+    if (format_version >= VOXEL_FORMAT_TICKS) {
+        if (data.size() < 4) {
+            return false;
+        }
+        const uint32_t count = read_u32(data.data());
+        if ((data.size() - 4) / 8 < count) {
+            return false;
+        }
+        metadata_.scheduled_ticks.reserve(count);
+        const uint8_t* src = data.data() + 4;
+        for (uint32_t i = 0; i < count; ++i, src += 8) {
+            ScheduledBlockTick tick{read_u32(src), read_u32(src + 4)};
+            if (tick.index >= static_cast<uint32_t>(CHUNK_VOLUME)) {
+                return false;
+            }
+            metadata_.scheduled_ticks.push_back(tick);
+        }
+        data = data.subspan(4 + static_cast<size_t>(count) * 8);
+    }
+    return storage_.deserialize_sections(data);
 }
 
 size_t Chunk::memory_usage() const {
@@ -218,10 +355,17 @@ const VoxelStorage& Chunk::ReadLock::storage() const {
 
 Chunk::WriteLock::WriteLock(Chunk& chunk) : chunk_(&chunk), lock_(chunk.mutex_) {}
 
-Chunk::WriteLock::~WriteLock() = default;
+Chunk::WriteLock::~WriteLock() {
+    // Bulk edits are not journaled block by block
+    if (chunk_ != nullptr && modified_) {
+        chunk_->invalidate_journal();
+    }
+}
 
-Chunk::WriteLock::WriteLock(WriteLock&& other) noexcept : chunk_(other.chunk_), lock_(std::move(other.lock_)) {
+Chunk::WriteLock::WriteLock(WriteLock&& other) noexcept
+    : chunk_(other.chunk_), lock_(std::move(other.lock_)), modified_(other.modified_) {
     other.chunk_ = nullptr;
+    other.modified_ = false;
 }
 
 BlockId Chunk::WriteLock::get_block(const LocalBlockPos& pos) const {
@@ -234,30 +378,36 @@ PaletteEntry Chunk::WriteLock::get_entry(const LocalBlockPos& pos) const {
 
 void Chunk::WriteLock::set_block(const LocalBlockPos& pos, BlockId id, BlockStateId state) {
     chunk_->storage_.set_block(pos, id, state);
-    chunk_->dirty_.store(true, std::memory_order_release);
+    chunk_->set_dirty_flag(true);
+    modified_ = true;
 }
 
 void Chunk::WriteLock::set_entry(const LocalBlockPos& pos, const PaletteEntry& entry) {
     chunk_->storage_.set(pos, entry);
-    chunk_->dirty_.store(true, std::memory_order_release);
+    chunk_->set_dirty_flag(true);
+    modified_ = true;
 }
 
 void Chunk::WriteLock::set_entry(size_t index, const PaletteEntry& entry) {
     chunk_->storage_.set(index, entry);
-    chunk_->dirty_.store(true, std::memory_order_release);
+    chunk_->set_dirty_flag(true);
+    modified_ = true;
 }
 
 void Chunk::WriteLock::fill(const PaletteEntry& entry) {
     chunk_->storage_.fill(entry);
-    chunk_->dirty_.store(true, std::memory_order_release);
+    chunk_->set_dirty_flag(true);
+    modified_ = true;
 }
 
 void Chunk::WriteLock::fill_region(const LocalBlockPos& min, const LocalBlockPos& max, const PaletteEntry& entry) {
     chunk_->storage_.fill_region(min, max, entry);
-    chunk_->dirty_.store(true, std::memory_order_release);
+    chunk_->set_dirty_flag(true);
+    modified_ = true;
 }
 
 VoxelStorage& Chunk::WriteLock::storage() {
+    modified_ = true;
     return chunk_->storage_;
 }
 
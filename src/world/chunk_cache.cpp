@@ -0,0 +1,120 @@
+// RealCraft World System
+// chunk_cache.cpp - Compressed in-memory chunk tier implementation
+
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <realcraft/world/chunk_cache.hpp>
+#include <unordered_map>
+
+namespace realcraft::world {
+
+// ============================================================================
+// CompressedChunkCache Implementation
+// ============================================================================
+
+struct CompressedChunkCache::Impl {
+    size_t capacity = 256;
+    size_t bytes = 0;
+
+    // Most recently stored at the front
+    std::list<std::pair<ChunkPos, std::vector<uint8_t>>> lru_list;
+    std::unordered_map<ChunkPos, decltype(lru_list)::iterator> index;
+
+    mutable std::mutex mutex;
+
+    // Caller must hold mutex
+    void erase(decltype(lru_list)::iterator it) {
+        bytes -= it->second.size();
+        index.erase(it->first);
+        lru_list.erase(it);
+    }
+
+    // Caller must hold mutex
+    void evict_to(size_t limit) {
+        while (lru_list.size() > limit) {
+            erase(std::prev(lru_list.end()));
+        }
+    }
+};
+
+CompressedChunkCache::CompressedChunkCache(size_t capacity) : impl_(std::make_unique<Impl>()) {
+    impl_->capacity = capacity;
+}
+
+CompressedChunkCache::~CompressedChunkCache() = default;
+
+void CompressedChunkCache::put(const ChunkPos& pos, std::vector<uint8_t> blob) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    if (impl_->capacity == 0) {
+        return;
+    }
+
+    auto it = impl_->index.find(pos);
+    if (it != impl_->index.end()) {
+        impl_->erase(it->second);
+    }
+
+    impl_->evict_to(impl_->capacity - 1);
+
+    impl_->bytes += blob.size();
+    impl_->lru_list.emplace_front(pos, std::move(blob));
+    impl_->index[pos] = impl_->lru_list.begin();
+}
+
+std::optional<std::vector<uint8_t>> CompressedChunkCache::take(const ChunkPos& pos) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    auto it = impl_->index.find(pos);
+    if (it == impl_->index.end()) {
+        return std::nullopt;
+    }
+
+    std::vector<uint8_t> blob = std::move(it->second->second);
+    impl_->bytes -= blob.size();
+    impl_->lru_list.erase(it->second);
+    impl_->index.erase(it);
+    return blob;
+}
+
+bool CompressedChunkCache::contains(const ChunkPos& pos) const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->index.count(pos) > 0;
+}
+
+void CompressedChunkCache::erase(const ChunkPos& pos) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    auto it = impl_->index.find(pos);
+    if (it != impl_->index.end()) {
+        impl_->erase(it->second);
+    }
+}
+
+void CompressedChunkCache::clear() {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->lru_list.clear();
+    impl_->index.clear();
+    impl_->bytes = 0;
+}
+
+void CompressedChunkCache::set_capacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->capacity = capacity;
+    impl_->evict_to(capacity);
+}
+
+size_t CompressedChunkCache::get_capacity() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->capacity;
+}
+
+size_t CompressedChunkCache::size() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->lru_list.size();
+}
+
+size_t CompressedChunkCache::memory_usage() const {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    return impl_->bytes;
+}
+
+}  // namespace realcraft::world
@@ -2,13 +2,181 @@
 // chunk_data.cpp - Palette-based voxel storage implementation
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cstring>
 #include <realcraft/core/logger.hpp>
 #include <realcraft/world/chunk_data.hpp>
 #include <unordered_map>
 
+// The SSSE3 path is compiled for every x86 GCC/Clang build and picked at
+// runtime, since the default x86-64 baseline stops at SSE2
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <tmmintrin.h>
+#define REALCRAFT_PALETTE_SHUFFLE_SSSE3 1
+#define REALCRAFT_SHUFFLE_TARGET __attribute__((target("ssse3")))
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define REALCRAFT_PALETTE_SHUFFLE_NEON 1
+#define REALCRAFT_SHUFFLE_TARGET
+#endif
+
 namespace realcraft::world {
 
+namespace {
+
+// ============================================================================
+// Bulk Palette Decoding
+// ============================================================================
+
+bool shuffle_supported() {
+#if defined(REALCRAFT_PALETTE_SHUFFLE_SSSE3)
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("ssse3") != 0;
+    }();
+    return supported;
+#elif defined(REALCRAFT_PALETTE_SHUFFLE_NEON)
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::atomic<bool> g_shuffle_enabled{true};
+
+// Turns runs of palette indices into block IDs. Built once per bulk read;
+// out-of-range indices decode to air, as in VoxelStorage::get().
+class BlockDecoder {
+public:
+    explicit BlockDecoder(const std::vector<PaletteEntry>& palette) : palette_(palette) {
+        // Small palettes also get byte tables for the shuffle path (unused
+        // slots stay zero, i.e. air)
+        small_ = palette.size() <= SHUFFLE_ENTRIES && g_shuffle_enabled.load(std::memory_order_relaxed) &&
+                 shuffle_supported();
+        if (small_) {
+            for (size_t i = 0; i < palette.size(); ++i) {
+                low_[i] = static_cast<uint8_t>(palette[i].block_id & 0xFF);
+                high_[i] = static_cast<uint8_t>(palette[i].block_id >> 8);
+            }
+        }
+    }
+
+    void decode(const uint16_t* indices, BlockId* out, size_t count) const {
+        if (palette_.size() == 1) {
+            const BlockId id = palette_[0].block_id;
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = indices[i] == 0 ? id : BLOCK_AIR;
+            }
+            return;
+        }
+
+        size_t i = 0;
+#if defined(REALCRAFT_PALETTE_SHUFFLE_SSSE3) || defined(REALCRAFT_PALETTE_SHUFFLE_NEON)
+        if (small_) {
+            i = shuffle_blocks(indices, out, count);
+        }
+#endif
+        const size_t size = palette_.size();
+        for (; i < count; ++i) {
+            out[i] = indices[i] < size ? palette_[indices[i]].block_id : BLOCK_AIR;
+        }
+    }
+
+private:
+    static constexpr size_t SHUFFLE_ENTRIES = 16;
+
+#if defined(REALCRAFT_PALETTE_SHUFFLE_SSSE3) || defined(REALCRAFT_PALETTE_SHUFFLE_NEON)
+    // Whole groups of 16; returns how many voxels were decoded
+    REALCRAFT_SHUFFLE_TARGET size_t shuffle_blocks(const uint16_t* indices, BlockId* out, size_t count) const {
+        size_t i = 0;
+        for (; i + SHUFFLE_ENTRIES <= count; i += SHUFFLE_ENTRIES) {
+            shuffle16(indices + i, out + i);
+        }
+        return i;
+    }
+#endif
+
+#if defined(REALCRAFT_PALETTE_SHUFFLE_SSSE3)
+    // 16 indices -> 16 IDs: narrow to bytes, look up low and high ID bytes, interleave
+    REALCRAFT_SHUFFLE_TARGET void shuffle16(const uint16_t* indices, BlockId* out) const {
+        const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices));
+        const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + 8));
+        // Signed saturation: 256..0x7FFF narrow to 127 and 0x8000.. to 0x80
+        __m128i bytes = _mm_packs_epi16(first, second);
+        // pshufb only zeroes lanes with the top bit set; force that for 16..127
+        bytes = _mm_or_si128(bytes, _mm_cmpgt_epi8(bytes, _mm_set1_epi8(15)));
+
+        const __m128i low = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(low_.data())), bytes);
+        const __m128i high = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(high_.data())), bytes);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(low, high));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpackhi_epi8(low, high));
+    }
+#elif defined(REALCRAFT_PALETTE_SHUFFLE_NEON)
+    // 16 indices -> 16 IDs: narrow to bytes, look up low and high ID bytes, interleave
+    REALCRAFT_SHUFFLE_TARGET void shuffle16(const uint16_t* indices, BlockId* out) const {
+        // Saturating narrow keeps indices >= 256 out of table range (tbl yields 0)
+        const uint8x16_t bytes = vcombine_u8(vqmovn_u16(vld1q_u16(indices)), vqmovn_u16(vld1q_u16(indices + 8)));
+        uint8x16x2_t ids;
+        ids.val[0] = vqtbl1q_u8(vld1q_u8(low_.data()), bytes);
+        ids.val[1] = vqtbl1q_u8(vld1q_u8(high_.data()), bytes);
+        vst2q_u8(reinterpret_cast<uint8_t*>(out), ids);
+    }
+#endif
+
+    const std::vector<PaletteEntry>& palette_;
+    bool small_ = false;
+    alignas(16) std::array<uint8_t, SHUFFLE_ENTRIES> low_{};
+    alignas(16) std::array<uint8_t, SHUFFLE_ENTRIES> high_{};
+};
+
+// Shared by the read_region overloads: checks the box and layout, then hands
+// decode_run one contiguous index range at a time (a whole layer, or the
+// whole box, when rows span the chunk and are packed)
+template <typename T, typename DecodeRun>
+bool read_box(const LocalBlockPos& min, const LocalBlockPos& max, std::span<T> out, size_t row_pitch,
+              size_t slice_pitch, DecodeRun&& decode_run) {
+    if (!is_valid_local(min) || !is_valid_local(max) || min.x > max.x || min.y > max.y || min.z > max.z) {
+        return false;
+    }
+    const auto dx = static_cast<size_t>(max.x - min.x + 1);
+    const auto dy = static_cast<size_t>(max.y - min.y + 1);
+    const auto dz = static_cast<size_t>(max.z - min.z + 1);
+    if (row_pitch == 0) {
+        row_pitch = dx;
+    }
+    if (slice_pitch == 0) {
+        slice_pitch = row_pitch * dz;
+    }
+    if (row_pitch < dx || slice_pitch < row_pitch * dz ||
+        out.size() < (dy - 1) * slice_pitch + (dz - 1) * row_pitch + dx) {
+        return false;
+    }
+
+    const bool full_rows = dx == static_cast<size_t>(CHUNK_SIZE_X) && row_pitch == dx;
+    const bool full_layers = full_rows && dz == static_cast<size_t>(CHUNK_SIZE_Z) && slice_pitch == dx * dz;
+    if (full_layers) {
+        decode_run(local_to_index(LocalBlockPos(0, min.y, 0)), out.data(), dx * dz * dy);
+        return true;
+    }
+
+    T* layer = out.data();
+    for (int32_t y = min.y; y <= max.y; ++y, layer += slice_pitch) {
+        if (full_rows) {
+            decode_run(local_to_index(LocalBlockPos(0, y, min.z)), layer, dx * dz);
+            continue;
+        }
+        T* row = layer;
+        for (int32_t z = min.z; z <= max.z; ++z, row += row_pitch) {
+            decode_run(local_to_index(LocalBlockPos(min.x, y, z)), row, dx);
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
 // ============================================================================
 // VoxelStorage Implementation
 // ============================================================================
@@ -96,6 +264,46 @@ void VoxelStorage::set_block(const LocalBlockPos& pos, BlockId id, BlockStateId
     set(pos, PaletteEntry{id, state});
 }
 
+void VoxelStorage::decode_blocks(size_t first_index, std::span<BlockId> out) const {
+    const size_t available = first_index < CHUNK_VOLUME ? std::min(out.size(), CHUNK_VOLUME - first_index) : 0;
+    BlockDecoder(impl_->palette).decode(impl_->indices.data() + first_index, out.data(), available);
+    std::fill(out.begin() + static_cast<std::ptrdiff_t>(available), out.end(), BLOCK_AIR);
+}
+
+void VoxelStorage::decode_entries(size_t first_index, std::span<PaletteEntry> out) const {
+    const size_t available = first_index < CHUNK_VOLUME ? std::min(out.size(), CHUNK_VOLUME - first_index) : 0;
+    const auto& palette = impl_->palette;
+    const uint16_t* indices = impl_->indices.data() + first_index;
+    for (size_t i = 0; i < available; ++i) {
+        out[i] = indices[i] < palette.size() ? palette[indices[i]] : PaletteEntry::air();
+    }
+    std::fill(out.begin() + static_cast<std::ptrdiff_t>(available), out.end(), PaletteEntry::air());
+}
+
+bool VoxelStorage::shuffle_decode_supported() {
+    return shuffle_supported();
+}
+
+void VoxelStorage::set_shuffle_decode_enabled(bool enabled) {
+    g_shuffle_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool VoxelStorage::read_region(const LocalBlockPos& min, const LocalBlockPos& max, std::span<BlockId> out,
+                               size_t row_pitch, size_t slice_pitch) const {
+    const BlockDecoder decoder(impl_->palette);
+    const uint16_t* indices = impl_->indices.data();
+    return read_box(min, max, out, row_pitch, slice_pitch, [&](size_t first, BlockId* dst, size_t count) {
+        decoder.decode(indices + first, dst, count);
+    });
+}
+
+bool VoxelStorage::read_region(const LocalBlockPos& min, const LocalBlockPos& max, std::span<PaletteEntry> out,
+                               size_t row_pitch, size_t slice_pitch) const {
+    return read_box(min, max, out, row_pitch, slice_pitch, [this](size_t first, PaletteEntry* dst, size_t count) {
+        decode_entries(first, std::span<PaletteEntry>(dst, count));
+    });
+}
+
 void VoxelStorage::fill(const PaletteEntry& entry) {
     impl_->palette.clear();
     impl_->palette.push_back(entry);
@@ -293,6 +501,260 @@ bool VoxelStorage::deserialize_rle(std::span<const uint8_t> data) {
     return true;
 }
 
+namespace {
+
+// Little-endian helpers for the sectioned format
+inline void write_u16(uint8_t* dst, uint16_t value) {
+    dst[0] = static_cast<uint8_t>(value & 0xFF);
+    dst[1] = static_cast<uint8_t>((value >> 8) & 0xFF);
+}
+
+inline uint16_t read_u16(const uint8_t* src) {
+    return static_cast<uint16_t>(static_cast<uint16_t>(src[0]) | (static_cast<uint16_t>(src[1]) << 8));
+}
+
+// Pack local palette indices LSB-first, 8 / Bits voxels per byte
+template <int Bits>
+void pack_section(const uint16_t* indices, const uint16_t* global_to_local, uint8_t* dst) {
+    constexpr int PER_BYTE = 8 / Bits;
+    for (int32_t i = 0; i < STORAGE_SECTION_VOLUME; i += PER_BYTE) {
+        uint32_t byte = 0;
+        for (int k = 0; k < PER_BYTE; ++k) {
+            byte |= static_cast<uint32_t>(global_to_local[indices[i + k]]) << (k * Bits);
+        }
+        *dst++ = static_cast<uint8_t>(byte);
+    }
+}
+
+template <int Bits>
+void unpack_section(const uint8_t* src, const uint16_t* local_to_global, uint16_t* indices) {
+    constexpr int PER_BYTE = 8 / Bits;
+    constexpr uint32_t MASK = (1u << Bits) - 1u;
+    for (int32_t i = 0; i < STORAGE_SECTION_VOLUME; i += PER_BYTE) {
+        uint32_t byte = *src++;
+        for (int k = 0; k < PER_BYTE; ++k) {
+            indices[i + k] = local_to_global[(byte >> (k * Bits)) & MASK];
+        }
+    }
+}
+
+constexpr size_t packed_section_size(uint8_t bits) {
+    return static_cast<size_t>(STORAGE_SECTION_VOLUME) * bits / 8;
+}
+
+}  // namespace
+
+std::vector<uint8_t> VoxelStorage::serialize_sections() const {
+    const auto& palette = impl_->palette;
+    const auto& indices = impl_->indices;
+
+    // Palette header is identical to the RLE format
+    std::vector<uint8_t> data(2 + palette.size() * 4);
+    write_u16(data.data(), static_cast<uint16_t>(palette.size()));
+    for (size_t i = 0; i < palette.size(); ++i) {
+        write_u16(data.data() + 2 + i * 4, palette[i].block_id);
+        write_u16(data.data() + 4 + i * 4, palette[i].state_id);
+    }
+
+    // Scratch tables: global palette index -> section-local index
+    constexpr uint16_t UNUSED = UINT16_MAX;
+    std::vector<uint16_t> global_to_local(palette.size(), UNUSED);
+    std::vector<uint16_t> local_to_global;
+    local_to_global.reserve(palette.size());
+
+    for (int32_t section = 0; section < STORAGE_SECTION_COUNT; ++section) {
+        const uint16_t* section_indices = indices.data() + static_cast<size_t>(section) * STORAGE_SECTION_VOLUME;
+
+        // Build the section-local palette
+        local_to_global.clear();
+        for (int32_t i = 0; i < STORAGE_SECTION_VOLUME; ++i) {
+            uint16_t global = section_indices[i];
+            if (global_to_local[global] == UNUSED) {
+                global_to_local[global] = static_cast<uint16_t>(local_to_global.size());
+                local_to_global.push_back(global);
+            }
+        }
+
+        size_t local_count = local_to_global.size();
+        uint8_t bits = 16;
+        if (local_count == 1) {
+            bits = 0;
+        } else if (local_count <= 2) {
+            bits = 1;
+        } else if (local_count <= 4) {
+            bits = 2;
+        } else if (local_count <= 16) {
+            bits = 4;
+        } else if (local_count <= 256) {
+            bits = 8;
+        }
+
+        size_t offset = data.size();
+        if (bits == 0) {
+            // Uniform section: single palette reference
+            data.resize(offset + 3);
+            data[offset] = 0;
+            write_u16(data.data() + offset + 1, local_to_global[0]);
+        } else if (bits == 16) {
+            // Too many distinct entries to pack: store global indices as-is
+            data.resize(offset + 1 + packed_section_size(16));
+            data[offset] = 16;
+            uint8_t* dst = data.data() + offset + 1;
+            if constexpr (std::endian::native == std::endian::little) {
+                std::memcpy(dst, section_indices, packed_section_size(16));
+            } else {
+                for (int32_t i = 0; i < STORAGE_SECTION_VOLUME; ++i) {
+                    write_u16(dst + static_cast<size_t>(i) * 2, section_indices[i]);
+                }
+            }
+        } else {
+            data.resize(offset + 3 + local_count * 2 + packed_section_size(bits));
+            uint8_t* dst = data.data() + offset;
+            dst[0] = bits;
+            write_u16(dst + 1, static_cast<uint16_t>(local_count));
+            dst += 3;
+            for (uint16_t global : local_to_global) {
+                write_u16(dst, global);
+                dst += 2;
+            }
+
+            switch (bits) {
+                case 1:
+                    pack_section<1>(section_indices, global_to_local.data(), dst);
+                    break;
+                case 2:
+                    pack_section<2>(section_indices, global_to_local.data(), dst);
+                    break;
+                case 4:
+                    pack_section<4>(section_indices, global_to_local.data(), dst);
+                    break;
+                default:
+                    pack_section<8>(section_indices, global_to_local.data(), dst);
+                    break;
+            }
+        }
+
+        // Reset only the entries this section touched
+        for (uint16_t global : local_to_global) {
+            global_to_local[global] = UNUSED;
+        }
+    }
+
+    return data;
+}
+
+bool VoxelStorage::deserialize_sections(std::span<const uint8_t> data) {
+    if (data.size() < 2) {
+        return false;
+    }
+
+    const uint8_t* ptr = data.data();
+    const uint8_t* end = data.data() + data.size();
+
+    uint16_t palette_size_val = read_u16(ptr);
+    ptr += 2;
+
+    if (static_cast<size_t>(end - ptr) < static_cast<size_t>(palette_size_val) * 4 || palette_size_val == 0) {
+        return false;
+    }
+
+    std::vector<PaletteEntry> palette(palette_size_val);
+    for (auto& entry : palette) {
+        entry.block_id = read_u16(ptr);
+        entry.state_id = read_u16(ptr + 2);
+        ptr += 4;
+    }
+
+    std::vector<uint16_t> indices(CHUNK_VOLUME);
+    std::vector<uint16_t> local_to_global;
+
+    for (int32_t section = 0; section < STORAGE_SECTION_COUNT; ++section) {
+        uint16_t* section_indices = indices.data() + static_cast<size_t>(section) * STORAGE_SECTION_VOLUME;
+
+        if (ptr >= end) {
+            return false;
+        }
+        uint8_t bits = *ptr++;
+
+        if (bits == 0) {
+            if (end - ptr < 2) {
+                return false;
+            }
+            uint16_t global = read_u16(ptr);
+            ptr += 2;
+            if (global >= palette_size_val) {
+                return false;
+            }
+            std::fill_n(section_indices, STORAGE_SECTION_VOLUME, global);
+            continue;
+        }
+
+        if (bits == 16) {
+            if (static_cast<size_t>(end - ptr) < packed_section_size(16)) {
+                return false;
+            }
+            if constexpr (std::endian::native == std::endian::little) {
+                std::memcpy(section_indices, ptr, packed_section_size(16));
+            } else {
+                for (int32_t i = 0; i < STORAGE_SECTION_VOLUME; ++i) {
+                    section_indices[i] = read_u16(ptr + static_cast<size_t>(i) * 2);
+                }
+            }
+            ptr += packed_section_size(16);
+            for (int32_t i = 0; i < STORAGE_SECTION_VOLUME; ++i) {
+                if (section_indices[i] >= palette_size_val) {
+                    return false;
+                }
+            }
+            continue;
+        }
+
+        if (bits != 1 && bits != 2 && bits != 4 && bits != 8) {
+            return false;
+        }
+
+        if (end - ptr < 2) {
+            return false;
+        }
+        uint16_t local_count = read_u16(ptr);
+        ptr += 2;
+        if (local_count == 0 || local_count > (1u << bits) ||
+            static_cast<size_t>(end - ptr) < local_count * 2u + packed_section_size(bits)) {
+            return false;
+        }
+
+        // Pad the table to the full code range so corrupt codes stay in bounds
+        local_to_global.assign(size_t{1} << bits, 0);
+        for (uint16_t i = 0; i < local_count; ++i) {
+            local_to_global[i] = read_u16(ptr);
+            ptr += 2;
+            if (local_to_global[i] >= palette_size_val) {
+                return false;
+            }
+        }
+
+        switch (bits) {
+            case 1:
+                unpack_section<1>(ptr, local_to_global.data(), section_indices);
+                break;
+            case 2:
+                unpack_section<2>(ptr, local_to_global.data(), section_indices);
+                break;
+            case 4:
+                unpack_section<4>(ptr, local_to_global.data(), section_indices);
+                break;
+            default:
+                unpack_section<8>(ptr, local_to_global.data(), section_indices);
+                break;
+        }
+        ptr += packed_section_size(bits);
+    }
+
+    impl_->palette = std::move(palette);
+    impl_->indices = std::move(indices);
+    return true;
+}
+
 std::vector<uint8_t> VoxelStorage::serialize_raw() const {
     std::vector<uint8_t> data;
 
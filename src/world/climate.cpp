@@ -1,7 +1,8 @@
 // RealCraft World System
 // climate.cpp - Climate model for biome distribution
 
-#include <FastNoise/FastNoise.h>
+#include "noise_simd.hpp"
+
 #include <algorithm>
 #include <cmath>
 #include <realcraft/world/climate.hpp>
@@ -23,8 +24,8 @@ struct ClimateMap::Impl {
 
     void build_nodes() {
         // Temperature noise (large-scale climate zones)
-        auto temp_simplex = FastNoise::New<FastNoise::Simplex>();
-        auto temp_fractal = FastNoise::New<FastNoise::FractalFBm>();
+        auto temp_simplex = new_noise_node<FastNoise::Simplex>(config.noise_simd);
+        auto temp_fractal = new_noise_node<FastNoise::FractalFBm>(config.noise_simd);
         temp_fractal->SetSource(temp_simplex);
         temp_fractal->SetOctaveCount(config.temperature.octaves);
         temp_fractal->SetGain(config.temperature.gain);
@@ -32,8 +33,8 @@ struct ClimateMap::Impl {
         temperature_node = temp_fractal;
 
         // Humidity noise (rainfall patterns)
-        auto humid_simplex = FastNoise::New<FastNoise::Simplex>();
-        auto humid_fractal = FastNoise::New<FastNoise::FractalFBm>();
+        auto humid_simplex = new_noise_node<FastNoise::Simplex>(config.noise_simd);
+        auto humid_fractal = new_noise_node<FastNoise::FractalFBm>(config.noise_simd);
         humid_fractal->SetSource(humid_simplex);
         humid_fractal->SetOctaveCount(config.humidity.octaves);
         humid_fractal->SetGain(config.humidity.gain);
@@ -0,0 +1,27 @@
+// RealCraft World System
+// noise_simd.hpp - FastNoise2 node creation at a configured SIMD level
+
+#pragma once
+
+#include <FastNoise/FastNoise.h>
+#include <realcraft/world/types.hpp>
+
+namespace realcraft::world {
+
+[[nodiscard]] inline FastSIMD::FeatureSet to_feature_set(NoiseSimdLevel level) {
+    switch (level) {
+        case NoiseSimdLevel::Scalar:
+            return FastSIMD::FeatureSet::SCALAR;
+        case NoiseSimdLevel::Auto:
+        default:
+            return FastSIMD::FeatureSet::Max;
+    }
+}
+
+// FastNoise::New capped at the given level
+template <typename T>
+[[nodiscard]] FastNoise::SmartNode<T> new_noise_node(NoiseSimdLevel level) {
+    return FastNoise::New<T>(to_feature_set(level));
+}
+
+}  // namespace realcraft::world
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <realcraft/core/memory.hpp>
 #include <realcraft/world/block.hpp>
 #include <realcraft/world/ore_generator.hpp>
 #include <unordered_set>
@@ -144,11 +145,13 @@ struct OreGenerator::Impl {
     static constexpr std::array<LocalBlockPos, 6> DIRECTIONS = {
         {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}}};
 
-    // Generate a single ore vein using random walk
-    [[nodiscard]] std::vector<LocalBlockPos> generate_vein(int32_t start_x, int32_t start_y, int32_t start_z,
-                                                           const OreVeinConfig& ore_cfg, uint32_t vein_seed) const {
+    // Generate a single ore vein using random walk. The result and its
+    // scratch set live in the given arena.
+    [[nodiscard]] core::ArenaVector<LocalBlockPos> generate_vein(int32_t start_x, int32_t start_y, int32_t start_z,
+                                                                 const OreVeinConfig& ore_cfg, uint32_t vein_seed,
+                                                                 core::Arena& arena) const {
 
-        std::vector<LocalBlockPos> positions;
+        core::ArenaVector<LocalBlockPos> positions{core::ArenaAllocator<LocalBlockPos>(arena)};
 
         // Determine vein size
         int32_t size_range = ore_cfg.max_vein_size - ore_cfg.min_vein_size + 1;
@@ -158,7 +161,10 @@ struct OreGenerator::Impl {
         }
 
         // Use a set to avoid duplicates (simple hash)
-        std::unordered_set<size_t> visited;
+        std::unordered_set<size_t, std::hash<size_t>, std::equal_to<size_t>, core::ArenaAllocator<size_t>> visited{
+            0, std::hash<size_t>{}, std::equal_to<size_t>{}, core::ArenaAllocator<size_t>(arena)};
+        positions.reserve(static_cast<size_t>(std::max(vein_size, 0)));
+        visited.reserve(static_cast<size_t>(std::max(vein_size, 0)));
         auto pos_hash = [](int32_t x, int32_t y, int32_t z) -> size_t {
             return static_cast<size_t>(x) * 73856093ULL ^ static_cast<size_t>(y) * 19349663ULL ^
                    static_cast<size_t>(z) * 83492791ULL;
@@ -248,8 +254,9 @@ std::vector<OrePosition> OreGenerator::generate_ores(const ChunkPos& chunk_pos,
             int32_t local_z = static_cast<int32_t>((vein_seed >> 5) % static_cast<uint32_t>(CHUNK_SIZE_Z));
             int32_t local_y = ore_cfg.min_y + static_cast<int32_t>((vein_seed >> 10) % static_cast<uint32_t>(y_range));
 
-            // Generate vein
-            auto vein = impl_->generate_vein(local_x, local_y, local_z, ore_cfg, vein_seed);
+            // Generate vein; its scratch memory is released once copied out
+            core::ArenaScope scope(core::get_job_arena());
+            auto vein = impl_->generate_vein(local_x, local_y, local_z, ore_cfg, vein_seed, scope.arena());
 
             // Add valid positions to output
             for (const auto& offset : vein) {
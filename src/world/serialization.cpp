@@ -1,15 +1,33 @@
 // RealCraft World System
 // serialization.cpp - Binary chunk format and region file management
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
 #include <cstring>
 #include <fstream>
 #include <list>
 #include <mutex>
 #include <realcraft/core/logger.hpp>
 #include <realcraft/world/serialization.hpp>
+#include <shared_mutex>
 #include <unordered_map>
+#include <zdict.h>
 #include <zstd.h>
 
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    include <sys/types.h>
+#    include <unistd.h>
+#endif
+
 namespace realcraft::world {
 
 // ============================================================================
@@ -18,18 +36,67 @@ namespace realcraft::world {
 
 namespace {
 
-constexpr int ZSTD_COMPRESSION_LEVEL = 3;  // Good balance of speed and ratio (1-22)
+// zstd contexts are expensive to create (hundreds of KB of tables), so each
+// thread keeps one compression and one decompression context for its lifetime
+// instead of letting one-shot calls allocate a fresh context per chunk.
+struct ZstdThreadContexts {
+    ZSTD_CCtx* cctx = nullptr;
+    ZSTD_DCtx* dctx = nullptr;
+
+    ZstdThreadContexts() = default;
+    ZstdThreadContexts(const ZstdThreadContexts&) = delete;
+    ZstdThreadContexts& operator=(const ZstdThreadContexts&) = delete;
+
+    ~ZstdThreadContexts() {
+        ZSTD_freeCCtx(cctx);
+        ZSTD_freeDCtx(dctx);
+    }
+};
+
+ZstdThreadContexts& thread_contexts() {
+    thread_local ZstdThreadContexts contexts;
+    return contexts;
+}
+
+// Created on first use; nullptr if zstd cannot allocate (retried next call)
+ZSTD_CCtx* thread_cctx() {
+    ZstdThreadContexts& contexts = thread_contexts();
+    if (!contexts.cctx) {
+        contexts.cctx = ZSTD_createCCtx();
+        if (!contexts.cctx) {
+            REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to create zstd compression context");
+        }
+    }
+    return contexts.cctx;
+}
+
+ZSTD_DCtx* thread_dctx() {
+    ZstdThreadContexts& contexts = thread_contexts();
+    if (!contexts.dctx) {
+        contexts.dctx = ZSTD_createDCtx();
+        if (!contexts.dctx) {
+            REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to create zstd decompression context");
+        }
+    }
+    return contexts.dctx;
+}
 
-std::vector<uint8_t> compress_zstd(std::span<const uint8_t> data) {
+std::vector<uint8_t> compress_zstd(std::span<const uint8_t> data, int level, const ZSTD_CDict* cdict) {
     if (data.empty()) {
         return {};
     }
 
+    ZSTD_CCtx* cctx = thread_cctx();
+    if (!cctx) {
+        return {};
+    }
+
     // Estimate compressed size
     size_t bound = ZSTD_compressBound(data.size());
     std::vector<uint8_t> compressed(bound);
 
-    size_t result = ZSTD_compress(compressed.data(), bound, data.data(), data.size(), ZSTD_COMPRESSION_LEVEL);
+    size_t result = cdict ? ZSTD_compress_usingCDict(cctx, compressed.data(), bound, data.data(), data.size(), cdict)
+                          : ZSTD_compressCCtx(cctx, compressed.data(), bound, data.data(), data.size(), level);
 
     if (ZSTD_isError(result)) {
         REALCRAFT_LOG_ERROR(core::log_category::WORLD, "zstd compression failed: {}", ZSTD_getErrorName(result));
@@ -40,14 +107,22 @@ std::vector<uint8_t> compress_zstd(std::span<const uint8_t> data) {
     return compressed;
 }
 
-std::vector<uint8_t> decompress_zstd(std::span<const uint8_t> data, size_t uncompressed_size) {
+std::vector<uint8_t> decompress_zstd(std::span<const uint8_t> data, size_t uncompressed_size,
+                                     const ZSTD_DDict* ddict) {
     if (data.empty()) {
         return {};
     }
 
+    ZSTD_DCtx* dctx = thread_dctx();
+    if (!dctx) {
+        return {};
+    }
+
     std::vector<uint8_t> decompressed(uncompressed_size);
 
-    size_t result = ZSTD_decompress(decompressed.data(), uncompressed_size, data.data(), data.size());
+    size_t result =
+        ddict ? ZSTD_decompress_usingDDict(dctx, decompressed.data(), uncompressed_size, data.data(), data.size(), ddict)
+              : ZSTD_decompressDCtx(dctx, decompressed.data(), uncompressed_size, data.data(), data.size());
 
     if (ZSTD_isError(result)) {
         REALCRAFT_LOG_ERROR(core::log_category::WORLD, "zstd decompression failed: {}", ZSTD_getErrorName(result));
@@ -60,12 +135,194 @@ std::vector<uint8_t> decompress_zstd(std::span<const uint8_t> data, size_t uncom
 
 }  // namespace
 
+// ============================================================================
+// CompressionDictionary Implementation
+// ============================================================================
+
+struct CompressionDictionary::Impl {
+    std::vector<uint8_t> data;
+    uint32_t id = 0;
+    ZSTD_DDict* ddict = nullptr;
+
+    // Digested compression dictionaries are level-specific; build them lazily
+    std::unordered_map<int, ZSTD_CDict*> cdicts;
+    std::mutex cdict_mutex;
+
+    ~Impl() {
+        for (auto& [level, cdict] : cdicts) {
+            ZSTD_freeCDict(cdict);
+        }
+        ZSTD_freeDDict(ddict);
+    }
+
+    // nullptr if zstd cannot build it; only successes are cached, so a
+    // failed level is retried next call
+    const ZSTD_CDict* get_cdict(int level) {
+        std::lock_guard<std::mutex> lock(cdict_mutex);
+        auto it = cdicts.find(level);
+        if (it != cdicts.end()) {
+            return it->second;
+        }
+        ZSTD_CDict* cdict = ZSTD_createCDict(data.data(), data.size(), level);
+        if (!cdict) {
+            REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to create zstd dictionary {} for level {}", id,
+                                level);
+            return nullptr;
+        }
+        cdicts.emplace(level, cdict);
+        return cdict;
+    }
+};
+
+CompressionDictionary::CompressionDictionary() : impl_(std::make_unique<Impl>()) {}
+
+CompressionDictionary::~CompressionDictionary() = default;
+
+std::shared_ptr<CompressionDictionary> CompressionDictionary::create(std::vector<uint8_t> data) {
+    uint32_t id = ZDICT_getDictID(data.data(), data.size());
+    if (id == 0) {
+        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Invalid zstd dictionary ({} bytes)", data.size());
+        return nullptr;
+    }
+
+    std::shared_ptr<CompressionDictionary> dictionary(new CompressionDictionary());
+    dictionary->impl_->data = std::move(data);
+    dictionary->impl_->id = id;
+    dictionary->impl_->ddict = ZSTD_createDDict(dictionary->impl_->data.data(), dictionary->impl_->data.size());
+    if (!dictionary->impl_->ddict) {
+        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to load zstd dictionary {}", id);
+        return nullptr;
+    }
+    return dictionary;
+}
+
+std::shared_ptr<CompressionDictionary> CompressionDictionary::train(std::span<const std::vector<uint8_t>> samples,
+                                                                    size_t max_size) {
+    std::vector<uint8_t> sample_buffer;
+    std::vector<size_t> sample_sizes;
+    sample_sizes.reserve(samples.size());
+    for (const auto& sample : samples) {
+        if (sample.empty()) {
+            continue;
+        }
+        sample_buffer.insert(sample_buffer.end(), sample.begin(), sample.end());
+        sample_sizes.push_back(sample.size());
+    }
+
+    if (sample_sizes.empty()) {
+        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "No samples to train dictionary");
+        return nullptr;
+    }
+
+    std::vector<uint8_t> dict(max_size);
+    size_t result = ZDICT_trainFromBuffer(dict.data(), dict.size(), sample_buffer.data(), sample_sizes.data(),
+                                          static_cast<unsigned>(sample_sizes.size()));
+    if (ZDICT_isError(result)) {
+        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Dictionary training failed: {}",
+                            ZDICT_getErrorName(result));
+        return nullptr;
+    }
+
+    dict.resize(result);
+    REALCRAFT_LOG_INFO(core::log_category::WORLD, "Trained {} byte dictionary from {} samples", result,
+                       sample_sizes.size());
+    return create(std::move(dict));
+}
+
+std::shared_ptr<CompressionDictionary> CompressionDictionary::load(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return nullptr;
+    }
+
+    auto size = file.tellg();
+    file.seekg(0);
+
+    std::vector<uint8_t> data(static_cast<size_t>(size));
+    file.read(reinterpret_cast<char*>(data.data()), size);
+
+    if (!file) {
+        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to read dictionary: {}", path.string());
+        return nullptr;
+    }
+
+    return create(std::move(data));
+}
+
+bool CompressionDictionary::save(const std::filesystem::path& path) const {
+    std::filesystem::create_directories(path.parent_path());
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to open file for writing: {}", path.string());
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(impl_->data.data()), static_cast<std::streamsize>(impl_->data.size()));
+    return file.good();
+}
+
+uint32_t CompressionDictionary::get_id() const {
+    return impl_->id;
+}
+
+std::span<const uint8_t> CompressionDictionary::get_data() const {
+    return impl_->data;
+}
+
+std::filesystem::path CompressionDictionary::directory(const std::filesystem::path& world_directory) {
+    return world_directory / "dictionaries";
+}
+
+std::filesystem::path CompressionDictionary::path_for(const std::filesystem::path& world_directory, uint32_t id) {
+    return directory(world_directory) / fmt::format("{}.zdict", id);
+}
+
+std::filesystem::path CompressionDictionary::active_marker(const std::filesystem::path& world_directory) {
+    return directory(world_directory) / "active";
+}
+
+bool CompressionDictionary::write_active_marker(const std::filesystem::path& world_directory, uint32_t id) {
+    std::filesystem::path path = active_marker(world_directory);
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+
+    // Write beside the marker and rename, so a crash never leaves it empty
+    std::filesystem::path temp_path = path;
+    temp_path += ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::trunc);
+        file << id << '\n';
+        file.flush();
+        if (!file) {
+            REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to write active dictionary marker: {}",
+                                temp_path.string());
+            file.close();
+            std::filesystem::remove(temp_path, ec);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to replace active dictionary marker {}: {}",
+                            path.string(), ec.message());
+        std::filesystem::remove(temp_path, ec);
+        return false;
+    }
+    return true;
+}
+
 // ============================================================================
 // ChunkSerializer Implementation
 // ============================================================================
 
 struct ChunkSerializer::Impl {
     CompressionType compression = CompressionType::Zstd;
+    int compression_level = DEFAULT_COMPRESSION_LEVEL;
+
+    std::unordered_map<uint32_t, std::shared_ptr<const CompressionDictionary>> dictionaries;
+    std::shared_ptr<const CompressionDictionary> active_dictionary;
 };
 
 ChunkSerializer::ChunkSerializer() : impl_(std::make_unique<Impl>()) {}
@@ -80,7 +337,71 @@ CompressionType ChunkSerializer::get_compression() const {
     return impl_->compression;
 }
 
+void ChunkSerializer::set_compression_level(int level) {
+    impl_->compression_level = std::clamp(level, ZSTD_minCLevel(), ZSTD_maxCLevel());
+}
+
+int ChunkSerializer::get_compression_level() const {
+    return impl_->compression_level;
+}
+
+void ChunkSerializer::add_dictionary(std::shared_ptr<const CompressionDictionary> dictionary) {
+    if (dictionary) {
+        impl_->dictionaries[dictionary->get_id()] = std::move(dictionary);
+    }
+}
+
+void ChunkSerializer::set_active_dictionary(std::shared_ptr<const CompressionDictionary> dictionary) {
+    add_dictionary(dictionary);
+    impl_->active_dictionary = std::move(dictionary);
+}
+
+const CompressionDictionary* ChunkSerializer::get_active_dictionary() const {
+    return impl_->active_dictionary.get();
+}
+
+size_t ChunkSerializer::load_dictionaries(const std::filesystem::path& world_directory) {
+    std::filesystem::path dir = CompressionDictionary::directory(world_directory);
+    std::error_code ec;
+    if (!std::filesystem::is_directory(dir, ec)) {
+        return 0;
+    }
+
+    size_t loaded = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        if (entry.path().extension() != ".zdict") {
+            continue;
+        }
+        if (auto dictionary = CompressionDictionary::load(entry.path())) {
+            add_dictionary(std::move(dictionary));
+            ++loaded;
+        }
+    }
+
+    // The active marker holds the ID of the dictionary new chunks should use
+    std::ifstream marker(CompressionDictionary::active_marker(world_directory));
+    uint32_t active_id = 0;
+    if (marker >> active_id) {
+        auto it = impl_->dictionaries.find(active_id);
+        if (it != impl_->dictionaries.end()) {
+            impl_->active_dictionary = it->second;
+        } else {
+            REALCRAFT_LOG_WARN(core::log_category::WORLD, "Active dictionary {} not found", active_id);
+        }
+    }
+
+    if (loaded > 0) {
+        REALCRAFT_LOG_INFO(core::log_category::WORLD, "Loaded {} compression dictionaries (active: {})", loaded,
+                           impl_->active_dictionary ? impl_->active_dictionary->get_id() : 0);
+    }
+    return loaded;
+}
+
 std::vector<uint8_t> ChunkSerializer::serialize(const Chunk& chunk) const {
+    return serialize(chunk, impl_->compression_level);
+}
+
+std::vector<uint8_t> ChunkSerializer::serialize(const Chunk& chunk, int compression_level) const {
     // Get raw chunk data
     std::vector<uint8_t> raw_data = chunk.serialize();
 
@@ -94,10 +415,16 @@ std::vector<uint8_t> ChunkSerializer::serialize(const Chunk& chunk) const {
     // Compress if needed
     std::vector<uint8_t> payload;
     if (impl_->compression == CompressionType::Zstd) {
-        payload = compress_zstd(raw_data);
+        const ZSTD_CDict* cdict = nullptr;
+        if (impl_->active_dictionary) {
+            cdict = impl_->active_dictionary->impl_->get_cdict(compression_level);
+            header.dictionary_id = cdict ? impl_->active_dictionary->get_id() : 0;
+        }
+        payload = compress_zstd(raw_data, compression_level, cdict);
         if (payload.empty() && !raw_data.empty()) {
             // Compression failed, fall back to uncompressed
             header.compression_type = 0;
+            header.dictionary_id = 0;
             payload = std::move(raw_data);
         }
     } else {
@@ -114,10 +441,10 @@ std::vector<uint8_t> ChunkSerializer::serialize(const Chunk& chunk) const {
     return result;
 }
 
-bool ChunkSerializer::deserialize(Chunk& chunk, std::span<const uint8_t> data) const {
+std::optional<std::vector<uint8_t>> ChunkSerializer::decode_payload(std::span<const uint8_t> data) const {
     if (data.size() < sizeof(ChunkFileHeader)) {
         REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Chunk data too small for header");
-        return false;
+        return std::nullopt;
     }
 
     // Read header
@@ -125,31 +452,51 @@ bool ChunkSerializer::deserialize(Chunk& chunk, std::span<const uint8_t> data) c
     std::memcpy(&header, data.data(), sizeof(ChunkFileHeader));
 
     if (!validate_header(data)) {
-        return false;
+        return std::nullopt;
     }
 
     // Extract payload
     if (data.size() < sizeof(ChunkFileHeader) + header.compressed_size) {
         REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Chunk data truncated");
-        return false;
+        return std::nullopt;
     }
 
     std::span<const uint8_t> payload(data.data() + sizeof(ChunkFileHeader), header.compressed_size);
 
     // Decompress if needed
-    std::vector<uint8_t> raw_data;
     if (header.compression_type == static_cast<uint8_t>(CompressionType::Zstd)) {
-        raw_data = decompress_zstd(payload, header.uncompressed_size);
+        const ZSTD_DDict* ddict = nullptr;
+        if (header.dictionary_id != 0) {
+            auto it = impl_->dictionaries.find(header.dictionary_id);
+            if (it == impl_->dictionaries.end()) {
+                REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Chunk requires missing dictionary {}",
+                                    header.dictionary_id);
+                return std::nullopt;
+            }
+            ddict = it->second->impl_->ddict;
+        }
+
+        std::vector<uint8_t> raw_data = decompress_zstd(payload, header.uncompressed_size, ddict);
         if (raw_data.empty() && header.uncompressed_size > 0) {
             REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to decompress chunk data");
-            return false;
+            return std::nullopt;
         }
-    } else {
-        raw_data.assign(payload.begin(), payload.end());
+        return raw_data;
     }
 
-    // Deserialize chunk
-    return chunk.deserialize(raw_data);
+    return std::vector<uint8_t>(payload.begin(), payload.end());
+}
+
+bool ChunkSerializer::deserialize(Chunk& chunk, std::span<const uint8_t> data) const {
+    auto raw_data = decode_payload(data);
+    if (!raw_data) {
+        return false;
+    }
+
+    // Header was validated by decode_payload; its version selects the voxel encoding
+    ChunkFileHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    return chunk.deserialize(*raw_data, header.version);
 }
 
 bool ChunkSerializer::save_to_file(const Chunk& chunk, const std::filesystem::path& path) const {
@@ -212,21 +559,219 @@ bool ChunkSerializer::validate_header(std::span<const uint8_t> data) const {
     return true;
 }
 
+// ============================================================================
+// Positional File I/O
+// ============================================================================
+
+namespace {
+
+// Region files are accessed with positional reads/writes (pread/pwrite) on a
+// native handle rather than a std::fstream, so concurrent readers never share
+// a seek position and do not need to serialize on a lock.
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+using NativeFile = HANDLE;
+const NativeFile INVALID_NATIVE_FILE = INVALID_HANDLE_VALUE;
+#else
+using NativeFile = int;
+constexpr NativeFile INVALID_NATIVE_FILE = -1;
+#endif
+
+// Never truncates: a file another handle has just created and initialised
+// must not be wiped by a racing open.
+NativeFile open_native_file(const std::filesystem::path& path, bool create) {
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+    return CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                       create ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    int flags = O_RDWR | O_CLOEXEC;
+    if (create) {
+        flags |= O_CREAT;
+    }
+    return ::open(path.c_str(), flags, 0644);
+#endif
+}
+
+std::optional<uint64_t> native_file_size(NativeFile file) {
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size)) {
+        return std::nullopt;
+    }
+    return static_cast<uint64_t>(size.QuadPart);
+#else
+    struct stat info {};
+    if (::fstat(file, &info) != 0) {
+        return std::nullopt;
+    }
+    return static_cast<uint64_t>(info.st_size);
+#endif
+}
+
+void close_native_file(NativeFile file) {
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+    CloseHandle(file);
+#else
+    ::close(file);
+#endif
+}
+
+bool read_at(NativeFile file, void* buffer, size_t size, uint64_t offset) {
+    auto* dst = static_cast<uint8_t*>(buffer);
+    while (size > 0) {
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFu);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD bytes_read = 0;
+        DWORD request = static_cast<DWORD>(std::min<size_t>(size, 0x7FFFFFFFu));
+        if (!ReadFile(file, dst, request, &bytes_read, &overlapped) || bytes_read == 0) {
+            return false;
+        }
+        size_t result = bytes_read;
+#else
+        ssize_t count = ::pread(file, dst, size, static_cast<off_t>(offset));
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        size_t result = static_cast<size_t>(count);
+#endif
+        dst += result;
+        size -= result;
+        offset += result;
+    }
+    return true;
+}
+
+bool write_at(NativeFile file, const void* buffer, size_t size, uint64_t offset) {
+    const auto* src = static_cast<const uint8_t*>(buffer);
+    while (size > 0) {
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFu);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD bytes_written = 0;
+        DWORD request = static_cast<DWORD>(std::min<size_t>(size, 0x7FFFFFFFu));
+        if (!WriteFile(file, src, request, &bytes_written, &overlapped) || bytes_written == 0) {
+            return false;
+        }
+        size_t result = bytes_written;
+#else
+        ssize_t count = ::pwrite(file, src, size, static_cast<off_t>(offset));
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            return false;
+        }
+        size_t result = static_cast<size_t>(count);
+#endif
+        src += result;
+        size -= result;
+        offset += result;
+    }
+    return true;
+}
+
+// Push written data through to stable storage
+bool sync_native_file(NativeFile file) {
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+    return FlushFileBuffers(file) != 0;
+#elif defined(REALCRAFT_PLATFORM_MACOS)
+    // fsync() on macOS only reaches the drive cache
+    return ::fcntl(file, F_FULLFSYNC) == 0 || ::fsync(file) == 0;
+#else
+    return ::fdatasync(file) == 0;
+#endif
+}
+
+bool truncate_native_file(NativeFile file, uint64_t size) {
+#if defined(REALCRAFT_PLATFORM_WINDOWS)
+    FILE_END_OF_FILE_INFO info{};
+    info.EndOfFile.QuadPart = static_cast<LONGLONG>(size);
+    return SetFileInformationByHandle(file, FileEndOfFileInfo, &info, sizeof(info)) != 0;
+#else
+    return ::ftruncate(file, static_cast<off_t>(size)) == 0;
+#endif
+}
+
+// ============================================================================
+// Journal Records
+// ============================================================================
+
+constexpr std::array<uint32_t, 256> make_crc32_table() {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1u) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+constexpr std::array<uint32_t, 256> CRC32_TABLE = make_crc32_table();
+
+uint32_t crc32_update(uint32_t crc, const uint8_t* data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        crc = CRC32_TABLE[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+uint32_t record_checksum(JournalRecordHeader header, std::span<const uint8_t> payload) {
+    header.checksum = 0;
+    uint32_t crc = crc32_update(0xFFFFFFFFu, reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    crc = crc32_update(crc, payload.data(), payload.size());
+    return crc ^ 0xFFFFFFFFu;
+}
+
+void append_record(std::vector<uint8_t>& buffer, JournalRecordType type, uint32_t batch, const ChunkPos& chunk,
+                   std::span<const uint8_t> payload) {
+    JournalRecordHeader header;
+    header.type = static_cast<uint32_t>(type);
+    header.batch = batch;
+    header.chunk_x = chunk.x;
+    header.chunk_z = chunk.y;
+    header.size = static_cast<uint32_t>(payload.size());
+    header.checksum = record_checksum(header, payload);
+
+    size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(header) + payload.size());
+    std::memcpy(buffer.data() + offset, &header, sizeof(header));
+    if (!payload.empty()) {
+        std::memcpy(buffer.data() + offset + sizeof(header), payload.data(), payload.size());
+    }
+}
+
+}  // namespace
+
 // ============================================================================
 // RegionFile Implementation
 // ============================================================================
 
 struct RegionFile::Impl {
     std::filesystem::path path;
-    std::fstream file;
+    NativeFile file = INVALID_NATIVE_FILE;
     bool is_open = false;
     glm::ivec2 region_pos{0, 0};
 
+    // Guards the entry table and data_end. Readers hold it shared only while
+    // copying an entry; the positional read itself runs without the lock.
+    mutable std::shared_mutex mutex;
+
     // Chunk offset table (32x32 = 1024 entries)
     std::array<RegionChunkEntry, TOTAL_CHUNKS> entries{};
 
     // Current end of file (for appending new chunks)
     size_t data_end = 0;
+
+    static uint64_t entry_offset(size_t index) {
+        return sizeof(RegionFileHeader) + index * sizeof(RegionChunkEntry);
+    }
 };
 
 RegionFile::RegionFile(const std::filesystem::path& path) : impl_(std::make_unique<Impl>()) {
@@ -249,52 +794,62 @@ RegionFile::~RegionFile() {
 }
 
 bool RegionFile::open(bool create_if_missing) {
+    std::unique_lock<std::shared_mutex> lock(impl_->mutex);
+
     if (impl_->is_open) {
         return true;
     }
 
-    bool exists = std::filesystem::exists(impl_->path);
-
-    if (!exists && !create_if_missing) {
+    if (!create_if_missing && !std::filesystem::exists(impl_->path)) {
         return false;
     }
 
     // Create parent directory
-    std::filesystem::create_directories(impl_->path.parent_path());
+    std::error_code ec;
+    std::filesystem::create_directories(impl_->path.parent_path(), ec);
 
-    if (exists) {
-        impl_->file.open(impl_->path, std::ios::binary | std::ios::in | std::ios::out);
-    } else {
-        impl_->file.open(impl_->path, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+    impl_->file = open_native_file(impl_->path, create_if_missing);
+
+    if (impl_->file == INVALID_NATIVE_FILE) {
+        if (create_if_missing) {
+            REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to open region file: {}", impl_->path.string());
+        }
+        return false;
     }
 
-    if (!impl_->file) {
-        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to open region file: {}", impl_->path.string());
+    auto file_size = native_file_size(impl_->file);
+    if (!file_size) {
+        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to stat region file: {}", impl_->path.string());
+        close_native_file(impl_->file);
+        impl_->file = INVALID_NATIVE_FILE;
         return false;
     }
 
     impl_->is_open = true;
 
-    if (exists) {
+    // Only an empty file is new; anything else must carry a valid header
+    if (*file_size > 0) {
         // Read header and entry table
         RegionFileHeader header;
-        impl_->file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        bool ok = read_at(impl_->file, &header, sizeof(header), 0);
 
-        if (header.magic != REGION_MAGIC) {
+        if (!ok || header.magic != REGION_MAGIC) {
             REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Invalid region file magic: {}", impl_->path.string());
-            close();
+            close_native_file(impl_->file);
+            impl_->file = INVALID_NATIVE_FILE;
+            impl_->is_open = false;
             return false;
         }
 
         impl_->region_pos.x = header.region_x;
         impl_->region_pos.y = header.region_z;
 
-        impl_->file.read(reinterpret_cast<char*>(impl_->entries.data()), sizeof(impl_->entries));
+        read_at(impl_->file, impl_->entries.data(), sizeof(impl_->entries), sizeof(RegionFileHeader));
 
         // Calculate data end
         impl_->data_end = sizeof(RegionFileHeader) + sizeof(impl_->entries);
         for (const auto& entry : impl_->entries) {
-            size_t entry_end = entry.offset + entry.size;
+            size_t entry_end = static_cast<size_t>(entry.offset) + entry.size;
             if (entry_end > impl_->data_end) {
                 impl_->data_end = entry_end;
             }
@@ -306,25 +861,26 @@ bool RegionFile::open(bool create_if_missing) {
         header.region_z = impl_->region_pos.y;
         header.chunk_count = 0;
 
-        impl_->file.write(reinterpret_cast<const char*>(&header), sizeof(header));
-        impl_->file.write(reinterpret_cast<const char*>(impl_->entries.data()), sizeof(impl_->entries));
+        write_at(impl_->file, &header, sizeof(header), 0);
+        write_at(impl_->file, impl_->entries.data(), sizeof(impl_->entries), sizeof(RegionFileHeader));
 
         impl_->data_end = sizeof(RegionFileHeader) + sizeof(impl_->entries);
-        impl_->file.flush();
     }
 
     return true;
 }
 
 void RegionFile::close() {
+    std::unique_lock<std::shared_mutex> lock(impl_->mutex);
     if (impl_->is_open) {
-        flush();
-        impl_->file.close();
+        close_native_file(impl_->file);
+        impl_->file = INVALID_NATIVE_FILE;
         impl_->is_open = false;
     }
 }
 
 bool RegionFile::is_open() const {
+    std::shared_lock<std::shared_mutex> lock(impl_->mutex);
     return impl_->is_open;
 }
 
@@ -346,6 +902,7 @@ size_t RegionFile::chunk_to_index(const ChunkPos& chunk) {
 }
 
 bool RegionFile::has_chunk(const ChunkPos& chunk) const {
+    std::shared_lock<std::shared_mutex> lock(impl_->mutex);
     if (!impl_->is_open) {
         return false;
     }
@@ -354,22 +911,26 @@ bool RegionFile::has_chunk(const ChunkPos& chunk) const {
 }
 
 std::optional<std::vector<uint8_t>> RegionFile::read_chunk(const ChunkPos& chunk) const {
-    if (!impl_->is_open) {
-        return std::nullopt;
+    // Copy the entry under a shared lock. Chunk data is append-only, so the
+    // bytes it points at stay valid even if a writer replaces the entry while
+    // we read; the read itself needs no lock.
+    RegionChunkEntry entry;
+    NativeFile file;
+    {
+        std::shared_lock<std::shared_mutex> lock(impl_->mutex);
+        if (!impl_->is_open) {
+            return std::nullopt;
+        }
+        entry = impl_->entries[chunk_to_index(chunk)];
+        file = impl_->file;
     }
 
-    size_t index = chunk_to_index(chunk);
-    const auto& entry = impl_->entries[index];
-
     if (entry.size == 0) {
         return std::nullopt;
     }
 
     std::vector<uint8_t> data(entry.size);
-    impl_->file.seekg(static_cast<std::streamoff>(entry.offset));
-    impl_->file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(entry.size));
-
-    if (!impl_->file) {
+    if (!read_at(file, data.data(), data.size(), entry.offset)) {
         REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to read chunk from region file");
         return std::nullopt;
     }
@@ -378,37 +939,46 @@ std::optional<std::vector<uint8_t>> RegionFile::read_chunk(const ChunkPos& chunk
 }
 
 bool RegionFile::write_chunk(const ChunkPos& chunk, std::span<const uint8_t> data) {
-    if (!impl_->is_open) {
-        return false;
-    }
-
     size_t index = chunk_to_index(chunk);
-    auto& entry = impl_->entries[index];
-
-    // For simplicity, always append (could optimize by reusing space)
-    size_t offset = impl_->data_end;
 
-    impl_->file.seekp(static_cast<std::streamoff>(offset));
-    impl_->file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    // Reserve space at the end of the file. Concurrent writers get disjoint
+    // ranges and write their payloads in parallel.
+    size_t offset = 0;
+    NativeFile file;
+    {
+        std::unique_lock<std::shared_mutex> lock(impl_->mutex);
+        if (!impl_->is_open) {
+            return false;
+        }
+        // For simplicity, always append (could optimize by reusing space)
+        offset = impl_->data_end;
+        impl_->data_end = offset + data.size();
+        file = impl_->file;
+    }
 
-    if (!impl_->file) {
+    if (!write_at(file, data.data(), data.size(), offset)) {
         REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to write chunk to region file");
         return false;
     }
 
+    // Publish the entry only after the payload is written
+    std::unique_lock<std::shared_mutex> lock(impl_->mutex);
+    auto& entry = impl_->entries[index];
+
+    // A racing write to the same chunk that reserved a later offset wins
+    if (entry.size > 0 && entry.offset > offset) {
+        return true;
+    }
+
     entry.offset = static_cast<uint32_t>(offset);
     entry.size = static_cast<uint32_t>(data.size());
-    impl_->data_end = offset + data.size();
 
     // Update entry in file
-    size_t entry_offset = sizeof(RegionFileHeader) + index * sizeof(RegionChunkEntry);
-    impl_->file.seekp(static_cast<std::streamoff>(entry_offset));
-    impl_->file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
-
-    return impl_->file.good();
+    return write_at(file, &entry, sizeof(entry), Impl::entry_offset(index));
 }
 
 bool RegionFile::delete_chunk(const ChunkPos& chunk) {
+    std::unique_lock<std::shared_mutex> lock(impl_->mutex);
     if (!impl_->is_open) {
         return false;
     }
@@ -420,14 +990,11 @@ bool RegionFile::delete_chunk(const ChunkPos& chunk) {
     entry.size = 0;
 
     // Update entry in file
-    size_t entry_offset = sizeof(RegionFileHeader) + index * sizeof(RegionChunkEntry);
-    impl_->file.seekp(static_cast<std::streamoff>(entry_offset));
-    impl_->file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
-
-    return impl_->file.good();
+    return write_at(impl_->file, &entry, sizeof(entry), Impl::entry_offset(index));
 }
 
 size_t RegionFile::chunk_count() const {
+    std::shared_lock<std::shared_mutex> lock(impl_->mutex);
     size_t count = 0;
     for (const auto& entry : impl_->entries) {
         if (entry.size > 0) {
@@ -438,6 +1005,7 @@ size_t RegionFile::chunk_count() const {
 }
 
 size_t RegionFile::file_size() const {
+    std::shared_lock<std::shared_mutex> lock(impl_->mutex);
     return impl_->data_end;
 }
 
@@ -445,10 +1013,22 @@ glm::ivec2 RegionFile::get_region_pos() const {
     return impl_->region_pos;
 }
 
-void RegionFile::flush() {
-    if (impl_->is_open) {
-        impl_->file.flush();
+bool RegionFile::flush() {
+    // Positional writes go straight to the OS; flushing means syncing them
+    // to stable storage
+    NativeFile file;
+    {
+        std::shared_lock<std::shared_mutex> lock(impl_->mutex);
+        if (!impl_->is_open) {
+            return true;
+        }
+        file = impl_->file;
     }
+    if (!sync_native_file(file)) {
+        REALCRAFT_LOG_WARN(core::log_category::WORLD, "Failed to sync region file: {}", impl_->path.string());
+        return false;
+    }
+    return true;
 }
 
 // ============================================================================
@@ -459,45 +1039,390 @@ struct RegionManager::Impl {
     std::filesystem::path world_dir;
     size_t max_open_files = 8;
 
-    // LRU cache of open region files
-    std::list<std::pair<glm::ivec2, std::unique_ptr<RegionFile>>> lru_list;
+    // LRU cache of open region files. Entries are shared so a region evicted
+    // while another thread is reading from it stays open until that read
+    // completes. lru_mutex only protects the cache itself and is never held
+    // across disk I/O; each RegionFile has its own reader/writer lock.
+    using RegionPtr = std::shared_ptr<RegionFile>;
+    using RegionSet = std::unordered_map<int64_t, RegionPtr>;
+    std::list<std::pair<glm::ivec2, RegionPtr>> lru_list;
     std::unordered_map<int64_t, decltype(lru_list)::iterator> cache;
 
-    mutable std::mutex mutex;
+    mutable std::mutex lru_mutex;
 
     static int64_t region_key(const glm::ivec2& pos) {
         return (static_cast<int64_t>(pos.x) << 32) | static_cast<uint32_t>(pos.y);
     }
 
-    RegionFile* get_or_open_region(const glm::ivec2& region_pos, bool create_if_missing) {
-        int64_t key = region_key(region_pos);
+    std::filesystem::path region_path(const glm::ivec2& region_pos) const {
+        return world_dir / "regions" / fmt::format("r.{}.{}.rcr", region_pos.x, region_pos.y);
+    }
 
+    // Evict least recently used regions down to `limit`. Regions still
+    // referenced by an in-flight operation are skipped, so a region is never
+    // open twice; the cache may briefly exceed its limit instead.
+    // Caller must hold lru_mutex.
+    void evict_to(size_t limit) {
+        auto it = lru_list.end();
+        while (lru_list.size() > limit && it != lru_list.begin()) {
+            --it;
+            if (it->second.use_count() == 1) {
+                cache.erase(region_key(it->first));
+                it = lru_list.erase(it);
+            }
+        }
+    }
+
+    RegionPtr find_region(const glm::ivec2& region_pos) {
+        std::lock_guard<std::mutex> lock(lru_mutex);
+        auto it = cache.find(region_key(region_pos));
+        if (it == cache.end()) {
+            return nullptr;
+        }
+        // Move to front of LRU
+        lru_list.splice(lru_list.begin(), lru_list, it->second);
+        return it->second->second;
+    }
+
+    // Cached region for `region_pos`, inserting an unopened one on a miss so
+    // every thread opens the same RegionFile and each key is opened once
+    RegionPtr find_or_insert_region(const glm::ivec2& region_pos) {
+        std::lock_guard<std::mutex> lock(lru_mutex);
+        int64_t key = region_key(region_pos);
         auto it = cache.find(key);
         if (it != cache.end()) {
-            // Move to front of LRU
             lru_list.splice(lru_list.begin(), lru_list, it->second);
-            return it->second->second.get();
+            return it->second->second;
+        }
+
+        evict_to(max_open_files > 0 ? max_open_files - 1 : 0);
+
+        lru_list.emplace_front(region_pos, std::make_shared<RegionFile>(region_path(region_pos)));
+        cache[key] = lru_list.begin();
+        return lru_list.front().second;
+    }
+
+    RegionPtr get_or_open_region(const glm::ivec2& region_pos, bool create_if_missing) {
+        RegionPtr region = find_or_insert_region(region_pos);
+
+        // Open outside the cache lock so misses on different regions proceed
+        // in parallel. RegionFile::open serializes on the region's own lock
+        // and is a no-op once open, so racing callers share one handle.
+        if (region->is_open() || region->open(create_if_missing)) {
+            return region;
         }
 
-        // Evict if at capacity
-        while (lru_list.size() >= max_open_files) {
-            auto& back = lru_list.back();
-            cache.erase(region_key(back.first));
-            lru_list.pop_back();
+        // Missing on disk: drop the placeholder unless another caller holds
+        // it (and may still create the file)
+        std::lock_guard<std::mutex> lock(lru_mutex);
+        auto it = cache.find(region_key(region_pos));
+        if (it != cache.end() && it->second->second == region && region.use_count() == 2) {
+            lru_list.erase(it->second);
+            cache.erase(it);
         }
+        return nullptr;
+    }
 
-        // Open new region file
-        std::filesystem::path path = world_dir / "regions" / fmt::format("r.{}.{}.rcr", region_pos.x, region_pos.y);
-        auto region = std::make_unique<RegionFile>(path);
+    std::vector<RegionPtr> snapshot() const {
+        std::lock_guard<std::mutex> lock(lru_mutex);
+        std::vector<RegionPtr> regions;
+        regions.reserve(lru_list.size());
+        for (const auto& [pos, region] : lru_list) {
+            regions.push_back(region);
+        }
+        return regions;
+    }
 
-        if (!region->open(create_if_missing)) {
-            return nullptr;
+    // Write straight to the region file, bypassing the journal (empty = delete).
+    // The region is added to `touched`; holding it there keeps it from being
+    // evicted and closed before sync_touched() has made the write durable.
+    bool apply_to_region(const ChunkPos& chunk, std::span<const uint8_t> data, RegionSet& touched) {
+        glm::ivec2 region_pos = chunk_to_region(chunk);
+        auto region = get_or_open_region(region_pos, !data.empty());
+        if (!region) {
+            return data.empty();  // Deleting from a region that doesn't exist
         }
+        touched.try_emplace(region_key(region_pos), region);
+        return data.empty() ? region->delete_chunk(chunk) : region->write_chunk(chunk, data);
+    }
 
-        lru_list.emplace_front(region_pos, std::move(region));
-        cache[key] = lru_list.begin();
+    static bool sync_touched(const RegionSet& touched) {
+        bool ok = true;
+        for (const auto& [key, region] : touched) {
+            ok = region->flush() && ok;
+        }
+        return ok;
+    }
+
+    void sync_regions() {
+        for (const auto& region : snapshot()) {
+            region->flush();
+        }
+    }
+
+    // ========================================================================
+    // Write-Ahead Journal
+    // ========================================================================
+
+    struct JournalEntry {
+        std::vector<uint8_t> data;  // Empty = deleted
+        bool staged = false;        // Not yet committed
+        uint64_t revision = 0;      // Bumped by every stage() of this chunk
+    };
+
+    std::filesystem::path journal_path() const { return world_dir / "journal.rcj"; }
+
+    std::atomic<bool> journal_enabled{false};
+    NativeFile journal_file = INVALID_NATIVE_FILE;
+    std::atomic<uint64_t> journal_end{0};
+    uint32_t journal_batch = 0;
+    std::atomic<size_t> checkpoint_threshold{DEFAULT_CHECKPOINT_THRESHOLD};
+
+    // Latest data for every chunk not yet in its region file. Entries move to
+    // `applying` while a checkpoint copies them out, so reads never miss them.
+    std::unordered_map<ChunkPos, JournalEntry> pending;
+    std::unordered_map<ChunkPos, std::vector<uint8_t>> applying;
+    std::vector<ChunkPos> staged;
+    mutable std::mutex journal_mutex;
+
+    // Serializes journal file writes; held across commit and checkpoint
+    std::mutex journal_io_mutex;
+
+    ~Impl() {
+        if (journal_file != INVALID_NATIVE_FILE) {
+            close_native_file(journal_file);
+        }
+    }
+
+    // Journal view of a chunk: nullopt if the journal has no newer data,
+    // an empty vector if the chunk was deleted
+    std::optional<std::vector<uint8_t>> journal_lookup(const ChunkPos& chunk) const {
+        if (!journal_enabled) {
+            return std::nullopt;
+        }
+        std::lock_guard<std::mutex> lock(journal_mutex);
+        if (auto it = pending.find(chunk); it != pending.end()) {
+            return it->second.data;
+        }
+        if (auto it = applying.find(chunk); it != applying.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<bool> journal_has(const ChunkPos& chunk) const {
+        if (!journal_enabled) {
+            return std::nullopt;
+        }
+        std::lock_guard<std::mutex> lock(journal_mutex);
+        if (auto it = pending.find(chunk); it != pending.end()) {
+            return !it->second.data.empty();
+        }
+        if (auto it = applying.find(chunk); it != applying.end()) {
+            return !it->second.empty();
+        }
+        return std::nullopt;
+    }
+
+    void stage(const ChunkPos& chunk, std::span<const uint8_t> data) {
+        std::lock_guard<std::mutex> lock(journal_mutex);
+        JournalEntry& entry = pending[chunk];
+        entry.data.assign(data.begin(), data.end());
+        ++entry.revision;
+        if (!entry.staged) {
+            entry.staged = true;
+            staged.push_back(chunk);
+        }
+    }
+
+    bool reset_journal() {
+        JournalFileHeader header;
+        bool ok = truncate_native_file(journal_file, 0) && write_at(journal_file, &header, sizeof(header), 0) &&
+                  sync_native_file(journal_file);
+        journal_end = sizeof(header);
+        journal_batch = 0;
+        return ok;
+    }
 
-        return lru_list.front().second.get();
+    // Caller must hold journal_io_mutex. Entries are only unstaged once the
+    // batch is synced, and only if they were not restaged meanwhile.
+    bool commit_locked() {
+        std::vector<uint8_t> buffer;
+        std::vector<std::pair<ChunkPos, uint64_t>> batch_entries;
+        {
+            std::lock_guard<std::mutex> lock(journal_mutex);
+            if (staged.empty()) {
+                return true;
+            }
+            uint32_t batch = ++journal_batch;
+            batch_entries.reserve(staged.size());
+            for (const ChunkPos& chunk : staged) {
+                const JournalEntry& entry = pending[chunk];
+                batch_entries.emplace_back(chunk, entry.revision);
+                append_record(buffer,
+                              entry.data.empty() ? JournalRecordType::ChunkDelete : JournalRecordType::ChunkWrite,
+                              batch, chunk, entry.data);
+            }
+            append_record(buffer, JournalRecordType::Commit, batch,
+                          ChunkPos(static_cast<int32_t>(batch_entries.size()), 0), {});
+        }
+
+        // One append and one sync for the whole batch. A failed append leaves
+        // journal_end in place, so the retry overwrites the torn tail.
+        uint64_t offset = journal_end;
+        if (!write_at(journal_file, buffer.data(), buffer.size(), offset) || !sync_native_file(journal_file)) {
+            REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to commit {} chunks to journal",
+                                batch_entries.size());
+            return false;
+        }
+        journal_end = offset + buffer.size();
+
+        std::lock_guard<std::mutex> lock(journal_mutex);
+        for (const auto& [chunk, revision] : batch_entries) {
+            auto it = pending.find(chunk);
+            if (it != pending.end() && it->second.revision == revision) {
+                it->second.staged = false;
+            }
+        }
+        staged.erase(std::remove_if(staged.begin(), staged.end(),
+                                    [this](const ChunkPos& chunk) {
+                                        auto it = pending.find(chunk);
+                                        return it == pending.end() || !it->second.staged;
+                                    }),
+                     staged.end());
+        return true;
+    }
+
+    // Caller must hold journal_io_mutex
+    bool checkpoint_locked() {
+        bool ok = commit_locked();
+
+        {
+            std::lock_guard<std::mutex> lock(journal_mutex);
+            for (auto it = pending.begin(); it != pending.end();) {
+                if (it->second.staged) {
+                    ++it;
+                    continue;
+                }
+                applying.emplace(it->first, std::move(it->second.data));
+                it = pending.erase(it);
+            }
+        }
+
+        // `applying` is only mutated under journal_io_mutex, so it can be
+        // walked here while readers look entries up concurrently
+        size_t applied = 0;
+        RegionSet touched;
+        for (const auto& [chunk, data] : applying) {
+            if (apply_to_region(chunk, data, touched)) {
+                ++applied;
+            } else {
+                ok = false;
+            }
+        }
+        if (!sync_touched(touched)) {
+            ok = false;
+        }
+
+        // The journal is only reset once every record is safely in a region
+        // file; otherwise it is kept for replay and the data stays pending
+        if (ok) {
+            ok = reset_journal();
+        }
+
+        std::lock_guard<std::mutex> lock(journal_mutex);
+        if (!ok) {
+            for (auto& [chunk, data] : applying) {
+                pending.try_emplace(chunk, JournalEntry{std::move(data), false});
+            }
+        }
+        applying.clear();
+
+        if (applied > 0) {
+            REALCRAFT_LOG_DEBUG(core::log_category::WORLD, "Journal checkpoint wrote {} chunks", applied);
+        }
+        return ok;
+    }
+
+    struct ReplayResult {
+        size_t recovered = 0;
+        size_t failed = 0;  // Records that could not be applied or synced
+    };
+
+    // Apply every fully committed batch in the journal to the region files
+    // and sync them. Stops at the first torn or corrupt record.
+    ReplayResult replay_journal(uint64_t file_size) {
+        ReplayResult result;
+        JournalFileHeader file_header;
+        if (!read_at(journal_file, &file_header, sizeof(file_header), 0) || file_header.magic != JOURNAL_MAGIC ||
+            file_header.version > JOURNAL_FORMAT_VERSION) {
+            REALCRAFT_LOG_WARN(core::log_category::WORLD, "Ignoring invalid journal: {}", journal_path().string());
+            return result;
+        }
+
+        std::vector<std::pair<ChunkPos, std::vector<uint8_t>>> batch_records;
+        uint32_t batch = 0;
+        RegionSet touched;
+        uint64_t offset = sizeof(file_header);
+
+        while (offset + sizeof(JournalRecordHeader) <= file_size) {
+            JournalRecordHeader header;
+            if (!read_at(journal_file, &header, sizeof(header), offset)) {
+                break;
+            }
+            offset += sizeof(header);
+            if (header.size > file_size - offset) {
+                break;
+            }
+
+            std::vector<uint8_t> payload(header.size);
+            if (header.size > 0 && !read_at(journal_file, payload.data(), payload.size(), offset)) {
+                break;
+            }
+            offset += header.size;
+
+            if (record_checksum(header, payload) != header.checksum) {
+                break;
+            }
+
+            // A new batch number means the previous batch never committed
+            if (header.batch != batch) {
+                batch_records.clear();
+                batch = header.batch;
+            }
+
+            auto type = static_cast<JournalRecordType>(header.type);
+            if (type == JournalRecordType::Commit) {
+                if (static_cast<size_t>(header.chunk_x) != batch_records.size()) {
+                    break;
+                }
+                for (const auto& [chunk, data] : batch_records) {
+                    if (apply_to_region(chunk, data, touched)) {
+                        ++result.recovered;
+                    } else {
+                        ++result.failed;
+                    }
+                }
+                batch_records.clear();
+            } else if (type == JournalRecordType::ChunkWrite || type == JournalRecordType::ChunkDelete) {
+                if (type == JournalRecordType::ChunkDelete) {
+                    payload.clear();
+                }
+                batch_records.emplace_back(ChunkPos(header.chunk_x, header.chunk_z), std::move(payload));
+            } else {
+                break;
+            }
+        }
+
+        if (!batch_records.empty()) {
+            REALCRAFT_LOG_WARN(core::log_category::WORLD, "Discarded {} uncommitted journal records",
+                               batch_records.size());
+        }
+        if (!sync_touched(touched)) {
+            result.failed += result.recovered;
+            result.recovered = 0;
+        }
+        return result;
     }
 };
 
@@ -510,9 +1435,10 @@ RegionManager::~RegionManager() {
 }
 
 bool RegionManager::has_chunk(const ChunkPos& chunk) {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
-    glm::ivec2 region_pos = chunk_to_region(chunk);
-    RegionFile* region = impl_->get_or_open_region(region_pos, false);
+    if (auto journaled = impl_->journal_has(chunk)) {
+        return *journaled;
+    }
+    auto region = impl_->get_or_open_region(chunk_to_region(chunk), false);
     if (!region) {
         return false;
     }
@@ -520,9 +1446,13 @@ bool RegionManager::has_chunk(const ChunkPos& chunk) {
 }
 
 std::optional<std::vector<uint8_t>> RegionManager::read_chunk(const ChunkPos& chunk) {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
-    glm::ivec2 region_pos = chunk_to_region(chunk);
-    RegionFile* region = impl_->get_or_open_region(region_pos, false);
+    if (auto journaled = impl_->journal_lookup(chunk)) {
+        if (journaled->empty()) {
+            return std::nullopt;
+        }
+        return journaled;
+    }
+    auto region = impl_->get_or_open_region(chunk_to_region(chunk), false);
     if (!region) {
         return std::nullopt;
     }
@@ -530,9 +1460,14 @@ std::optional<std::vector<uint8_t>> RegionManager::read_chunk(const ChunkPos& ch
 }
 
 bool RegionManager::write_chunk(const ChunkPos& chunk, std::span<const uint8_t> data) {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
-    glm::ivec2 region_pos = chunk_to_region(chunk);
-    RegionFile* region = impl_->get_or_open_region(region_pos, true);
+    if (impl_->journal_enabled) {
+        if (data.empty()) {
+            return false;
+        }
+        impl_->stage(chunk, data);
+        return true;
+    }
+    auto region = impl_->get_or_open_region(chunk_to_region(chunk), true);
     if (!region) {
         return false;
     }
@@ -540,63 +1475,148 @@ bool RegionManager::write_chunk(const ChunkPos& chunk, std::span<const uint8_t>
 }
 
 bool RegionManager::delete_chunk(const ChunkPos& chunk) {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
-    glm::ivec2 region_pos = chunk_to_region(chunk);
-    RegionFile* region = impl_->get_or_open_region(region_pos, false);
+    if (impl_->journal_enabled) {
+        impl_->stage(chunk, {});
+        return true;
+    }
+    auto region = impl_->get_or_open_region(chunk_to_region(chunk), false);
     if (!region) {
         return false;
     }
     return region->delete_chunk(chunk);
 }
 
-void RegionManager::flush() {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
-    for (auto& [pos, region] : impl_->lru_list) {
-        region->flush();
+bool RegionManager::flush() {
+    if (!impl_->journal_enabled) {
+        impl_->sync_regions();
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(impl_->journal_io_mutex);
+    if (!impl_->commit_locked()) {
+        return false;
+    }
+    if (impl_->journal_end >= impl_->checkpoint_threshold) {
+        impl_->checkpoint_locked();
     }
+    return true;
 }
 
 void RegionManager::close_all() {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
-    impl_->lru_list.clear();
-    impl_->cache.clear();
+    if (impl_->journal_enabled) {
+        std::lock_guard<std::mutex> lock(impl_->journal_io_mutex);
+        impl_->checkpoint_locked();
+    }
+
+    // Regions still in use elsewhere stay cached, so a later open of the same
+    // key reuses their handle instead of opening the file a second time
+    std::lock_guard<std::mutex> lock(impl_->lru_mutex);
+    impl_->evict_to(0);
 }
 
 void RegionManager::set_max_open_files(size_t count) {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
+    std::lock_guard<std::mutex> lock(impl_->lru_mutex);
     impl_->max_open_files = count;
 
     // Evict excess
-    while (impl_->lru_list.size() > count) {
-        auto& back = impl_->lru_list.back();
-        impl_->cache.erase(Impl::region_key(back.first));
-        impl_->lru_list.pop_back();
-    }
+    impl_->evict_to(count);
 }
 
 size_t RegionManager::get_max_open_files() const {
+    std::lock_guard<std::mutex> lock(impl_->lru_mutex);
     return impl_->max_open_files;
 }
 
 size_t RegionManager::open_region_count() const {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
+    std::lock_guard<std::mutex> lock(impl_->lru_mutex);
     return impl_->lru_list.size();
 }
 
 size_t RegionManager::total_chunks_on_disk() const {
     // This would require scanning all region files - expensive
     // For now, just return count from open regions
-    std::lock_guard<std::mutex> lock(impl_->mutex);
     size_t count = 0;
-    for (const auto& [pos, region] : impl_->lru_list) {
+    for (const auto& region : impl_->snapshot()) {
         count += region->chunk_count();
     }
     return count;
 }
 
+bool RegionManager::enable_journal() {
+    std::lock_guard<std::mutex> lock(impl_->journal_io_mutex);
+    if (impl_->journal_enabled) {
+        return true;
+    }
+
+    std::filesystem::path path = impl_->journal_path();
+    std::error_code ec;
+    std::filesystem::create_directories(impl_->world_dir, ec);
+    bool exists = std::filesystem::exists(path);
+    uint64_t file_size = exists ? std::filesystem::file_size(path, ec) : 0;
+
+    impl_->journal_file = open_native_file(path, !exists);
+    if (impl_->journal_file == INVALID_NATIVE_FILE) {
+        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to open journal: {}", path.string());
+        return false;
+    }
+
+    if (file_size > sizeof(JournalFileHeader)) {
+        Impl::ReplayResult replay = impl_->replay_journal(file_size);
+        if (replay.failed > 0) {
+            // Keep the journal untouched: it may hold the only copy of these chunks
+            REALCRAFT_LOG_ERROR(core::log_category::WORLD,
+                                "Failed to recover {} journaled chunks; keeping journal for retry: {}",
+                                replay.failed, path.string());
+            close_native_file(impl_->journal_file);
+            impl_->journal_file = INVALID_NATIVE_FILE;
+            return false;
+        }
+        if (replay.recovered > 0) {
+            REALCRAFT_LOG_INFO(core::log_category::WORLD, "Recovered {} chunks from journal", replay.recovered);
+        }
+    }
+
+    if (!impl_->reset_journal()) {
+        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "Failed to initialize journal: {}", path.string());
+        close_native_file(impl_->journal_file);
+        impl_->journal_file = INVALID_NATIVE_FILE;
+        return false;
+    }
+
+    impl_->journal_enabled = true;
+    return true;
+}
+
+bool RegionManager::is_journal_enabled() const {
+    return impl_->journal_enabled;
+}
+
+bool RegionManager::commit() {
+    if (!impl_->journal_enabled) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(impl_->journal_io_mutex);
+    return impl_->commit_locked();
+}
+
+bool RegionManager::checkpoint() {
+    if (!impl_->journal_enabled) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(impl_->journal_io_mutex);
+    return impl_->checkpoint_locked();
+}
+
+void RegionManager::set_checkpoint_threshold(size_t bytes) {
+    impl_->checkpoint_threshold = bytes;
+}
+
+size_t RegionManager::journal_size() const {
+    return static_cast<size_t>(impl_->journal_end.load());
+}
+
 std::filesystem::path RegionManager::get_region_path(const ChunkPos& chunk) const {
-    glm::ivec2 region_pos = chunk_to_region(chunk);
-    return impl_->world_dir / "regions" / fmt::format("r.{}.{}.rcr", region_pos.x, region_pos.y);
+    return impl_->region_path(chunk_to_region(chunk));
 }
 
 }  // namespace realcraft::world
@@ -1,9 +1,13 @@
 // RealCraft World System
 // terrain_generator.cpp - Procedural terrain generation using FastNoise2
 
-#include <FastNoise/FastNoise.h>
+#include "noise_simd.hpp"
+
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <iterator>
+#include <realcraft/core/profiler.hpp>
 #include <realcraft/world/biome.hpp>
 #include <realcraft/world/block.hpp>
 #include <realcraft/world/cave_generator.hpp>
@@ -55,8 +59,8 @@ struct TerrainGenerator::Impl {
 
     void build_nodes() {
         // Continental terrain (large scale shapes using FBm)
-        auto continental_simplex = FastNoise::New<FastNoise::Simplex>();
-        auto continental_fractal = FastNoise::New<FastNoise::FractalFBm>();
+        auto continental_simplex = new_noise_node<FastNoise::Simplex>(config.noise_simd);
+        auto continental_fractal = new_noise_node<FastNoise::FractalFBm>(config.noise_simd);
         continental_fractal->SetSource(continental_simplex);
         continental_fractal->SetOctaveCount(config.continental.octaves);
         continental_fractal->SetGain(config.continental.gain);
@@ -64,8 +68,8 @@ struct TerrainGenerator::Impl {
         continental_node = continental_fractal;
 
         // Mountain/ridge terrain (ridged for sharp peaks)
-        auto mountain_simplex = FastNoise::New<FastNoise::Simplex>();
-        auto mountain_fractal = FastNoise::New<FastNoise::FractalRidged>();
+        auto mountain_simplex = new_noise_node<FastNoise::Simplex>(config.noise_simd);
+        auto mountain_fractal = new_noise_node<FastNoise::FractalRidged>(config.noise_simd);
         mountain_fractal->SetSource(mountain_simplex);
         mountain_fractal->SetOctaveCount(config.mountain.octaves);
         mountain_fractal->SetGain(config.mountain.gain);
@@ -73,8 +77,8 @@ struct TerrainGenerator::Impl {
         mountain_node = mountain_fractal;
 
         // Detail terrain (small scale variation with FBm)
-        auto detail_simplex = FastNoise::New<FastNoise::Simplex>();
-        auto detail_fractal = FastNoise::New<FastNoise::FractalFBm>();
+        auto detail_simplex = new_noise_node<FastNoise::Simplex>(config.noise_simd);
+        auto detail_fractal = new_noise_node<FastNoise::FractalFBm>(config.noise_simd);
         detail_fractal->SetSource(detail_simplex);
         detail_fractal->SetOctaveCount(config.detail.octaves);
         detail_fractal->SetGain(config.detail.gain);
@@ -83,8 +87,8 @@ struct TerrainGenerator::Impl {
 
         // Domain warping (makes terrain more organic)
         if (config.domain_warp.enabled) {
-            auto warp_simplex = FastNoise::New<FastNoise::Simplex>();
-            auto warp_fractal = FastNoise::New<FastNoise::FractalFBm>();
+            auto warp_simplex = new_noise_node<FastNoise::Simplex>(config.noise_simd);
+            auto warp_fractal = new_noise_node<FastNoise::FractalFBm>(config.noise_simd);
             warp_fractal->SetSource(warp_simplex);
             warp_fractal->SetOctaveCount(3);
             warp_fractal->SetGain(0.5f);
@@ -94,8 +98,8 @@ struct TerrainGenerator::Impl {
 
         // 3D density for caves
         if (config.density.enabled) {
-            auto density_simplex = FastNoise::New<FastNoise::Simplex>();
-            auto density_fractal = FastNoise::New<FastNoise::FractalFBm>();
+            auto density_simplex = new_noise_node<FastNoise::Simplex>(config.noise_simd);
+            auto density_fractal = new_noise_node<FastNoise::FractalFBm>(config.noise_simd);
             density_fractal->SetSource(density_simplex);
             density_fractal->SetOctaveCount(config.density.octaves);
             density_fractal->SetGain(config.density.gain);
@@ -107,6 +111,7 @@ struct TerrainGenerator::Impl {
         if (config.biome_system.enabled) {
             ClimateConfig climate_cfg = config.biome_system.climate;
             climate_cfg.seed = config.seed;  // Use same seed as terrain
+            climate_cfg.noise_simd = config.noise_simd;
             climate_map = std::make_unique<ClimateMap>(climate_cfg);
         } else {
             climate_map.reset();
@@ -123,6 +128,7 @@ struct TerrainGenerator::Impl {
         if (config.caves.enabled) {
             CaveConfig cave_cfg = config.caves;
             cave_cfg.seed = config.seed;  // Use same seed as terrain
+            cave_cfg.noise_simd = config.noise_simd;
             cave_generator = std::make_unique<CaveGenerator>(cave_cfg);
         } else {
             cave_generator.reset();
@@ -286,8 +292,34 @@ TerrainGenerator::TerrainGenerator(TerrainGenerator&&) noexcept = default;
 TerrainGenerator& TerrainGenerator::operator=(TerrainGenerator&&) noexcept = default;
 
 void TerrainGenerator::generate(Chunk& chunk) const {
+    generate(chunk, nullptr);
+}
+
+void TerrainGenerator::generate(Chunk& chunk, GenerationStageTimes* times) const {
+    REALCRAFT_PROFILE_ZONE("TerrainGenerator::generate");
     auto lock = chunk.write_lock();
 
+    // Profiler zone per pass, in pass order
+    static constexpr const char* STAGE_ZONES[] = {"Gen: Heightmap",  "Gen: Erosion", "Gen: Terrain",
+                                                  "Gen: Decoration", "Gen: Ores",    "Gen: Structures",
+                                                  "Gen: Trees",      "Gen: Vegetation"};
+    size_t stage = 0;
+    REALCRAFT_PROFILE_BEGIN(STAGE_ZONES[0]);
+
+    // Per-pass timing, only recorded when requested
+    auto stage_start = std::chrono::steady_clock::now();
+    auto end_stage = [&](double GenerationStageTimes::*field) {
+        REALCRAFT_PROFILE_END(STAGE_ZONES[stage]);
+        if (++stage < std::size(STAGE_ZONES)) {
+            REALCRAFT_PROFILE_BEGIN(STAGE_ZONES[stage]);
+        }
+        if (times) {
+            auto now = std::chrono::steady_clock::now();
+            times->*field += std::chrono::duration<double, std::milli>(now - stage_start).count();
+            stage_start = now;
+        }
+    };
+
     const auto& block_registry = BlockRegistry::instance();
     const auto& biome_registry = BiomeRegistry::instance();
 
@@ -329,6 +361,7 @@ void TerrainGenerator::generate(Chunk& chunk) const {
             heights[static_cast<size_t>(z * CHUNK_SIZE_X + x)] = impl_->compute_height(base_x + x, base_z + z);
         }
     }
+    end_stage(&GenerationStageTimes::heightmap_ms);
 
     // Apply erosion if enabled
     // Track sediment for block type selection
@@ -379,6 +412,7 @@ void TerrainGenerator::generate(Chunk& chunk) const {
             }
         }
     }
+    end_stage(&GenerationStageTimes::erosion_ms);
 
     // Track biome at center of chunk for metadata
     BiomeType chunk_biome = BiomeType::Plains;
@@ -522,6 +556,8 @@ void TerrainGenerator::generate(Chunk& chunk) const {
         }
     }
 
+    end_stage(&GenerationStageTimes::terrain_ms);
+
     // Cave decoration pass (place stalactites, stalagmites, crystals, moss, mushrooms)
     if (impl_->cave_generator && impl_->config.caves.decorations.enabled) {
         for (int z = 0; z < CHUNK_SIZE_Z; ++z) {
@@ -591,6 +627,8 @@ void TerrainGenerator::generate(Chunk& chunk) const {
         }
     }
 
+    end_stage(&GenerationStageTimes::decoration_ms);
+
     // ========================================================================
     // Feature Generation (Milestone 4.5)
     // ========================================================================
@@ -607,6 +645,8 @@ void TerrainGenerator::generate(Chunk& chunk) const {
         }
     }
 
+    end_stage(&GenerationStageTimes::ores_ms);
+
     // Structure generation pass (rock spires, boulders)
     if (impl_->structure_generator) {
         for (size_t t = 0; t < static_cast<size_t>(StructureType::Count); ++t) {
@@ -630,6 +670,8 @@ void TerrainGenerator::generate(Chunk& chunk) const {
         }
     }
 
+    end_stage(&GenerationStageTimes::structures_ms);
+
     // Tree generation pass
     if (impl_->tree_generator) {
         for (int z = 0; z < CHUNK_SIZE_Z; ++z) {
@@ -669,6 +711,8 @@ void TerrainGenerator::generate(Chunk& chunk) const {
         }
     }
 
+    end_stage(&GenerationStageTimes::trees_ms);
+
     // Vegetation generation pass (grass, flowers, bushes, cacti)
     if (impl_->vegetation_generator) {
         const auto& registry = BlockRegistry::instance();
@@ -756,6 +800,8 @@ void TerrainGenerator::generate(Chunk& chunk) const {
         }
     }
 
+    end_stage(&GenerationStageTimes::vegetation_ms);
+
     // Store biome in chunk metadata
     chunk.get_metadata_mut().biome_id = static_cast<uint8_t>(chunk_biome);
     chunk.get_metadata_mut().has_been_generated = true;
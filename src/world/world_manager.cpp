@@ -2,11 +2,14 @@
 // world_manager.cpp - World lifecycle management implementation
 
 #include <algorithm>
+#include <cmath>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
 #include <random>
 #include <realcraft/core/logger.hpp>
+#include <realcraft/core/metrics.hpp>
+#include <realcraft/core/profiler.hpp>
 #include <realcraft/platform/file_io.hpp>
 #include <realcraft/world/block.hpp>
 #include <realcraft/world/terrain_generator.hpp>
@@ -17,6 +20,29 @@
 
 namespace realcraft::world {
 
+namespace {
+
+// Process-wide world metrics, resolved once
+struct WorldMetrics {
+    core::Histogram& generation_us = core::MetricsRegistry::instance().histogram("world.chunk_generation_us");
+    core::Histogram& load_us = core::MetricsRegistry::instance().histogram("world.chunk_load_us");
+    core::Counter& generated = core::MetricsRegistry::instance().counter("world.chunks_generated");
+    core::Counter& loaded = core::MetricsRegistry::instance().counter("world.chunks_loaded");
+    core::Counter& saved = core::MetricsRegistry::instance().counter("world.chunks_saved");
+    core::Counter& unloaded = core::MetricsRegistry::instance().counter("world.chunks_unloaded");
+    core::Gauge& loaded_chunks = core::MetricsRegistry::instance().gauge("world.loaded_chunks");
+    core::Gauge& dirty_chunks = core::MetricsRegistry::instance().gauge("world.dirty_chunks");
+    core::Gauge& pending_generation = core::MetricsRegistry::instance().gauge("world.pending_generation");
+    core::Gauge& load_queue = core::MetricsRegistry::instance().gauge("world.load_queue");
+};
+
+WorldMetrics& world_metrics() {
+    static WorldMetrics metrics;
+    return metrics;
+}
+
+}  // namespace
+
 // ============================================================================
 // WorldManager Implementation
 // ============================================================================
@@ -36,6 +62,9 @@ struct WorldManager::Impl {
     std::unique_ptr<ChunkSerializer> serializer;
     std::unique_ptr<RegionManager> region_manager;
 
+    // Cold tier: compressed blobs of recently unloaded chunks
+    CompressedChunkCache chunk_cache;
+
     // Terrain generation
     std::unique_ptr<TerrainGenerator> terrain_generator;
 
@@ -75,8 +104,11 @@ struct WorldManager::Impl {
     // Statistics
     std::atomic<size_t> pending_generation_count{0};
     std::atomic<size_t> pending_load_count{0};
+    std::atomic<size_t> dirty_chunk_count{0};  // Maintained by the chunks themselves
+    std::atomic<size_t> load_queue_size{0};
 
     void worker_thread() {
+        REALCRAFT_PROFILE_THREAD("World Worker");
         while (!should_stop) {
             LoadRequest request;
             {
@@ -93,11 +125,15 @@ struct WorldManager::Impl {
 
                 request = load_queue.top();
                 load_queue.pop();
+                load_queue_size.store(load_queue.size(), std::memory_order_relaxed);
                 queued_chunks.erase(request.pos);
                 processing_chunks.insert(request.pos);  // Mark as processing
             }
 
-            process_load_request(request);
+            {
+                REALCRAFT_PROFILE_ZONE("World: Load Request");
+                process_load_request(request);
+            }
 
             // Remove from processing set
             {
@@ -110,18 +146,28 @@ struct WorldManager::Impl {
     void process_load_request(const LoadRequest& request) {
         // Check if already loaded
         {
-            std::shared_lock<std::shared_mutex> lock(chunks_mutex);
+            std::shared_lock<std::shared_mutex> lock(chunks_mutex, std::defer_lock);
+            REALCRAFT_PROFILE_LOCK(lock, "Wait: chunks_mutex");
             auto it = chunks.find(request.pos);
             if (it != chunks.end() && it->second->is_ready()) {
                 return;
             }
         }
 
-        // Try loading from disk first
+        // Respect the decoded-chunk cap; dropped requests are re-issued by
+        // update_loaded_chunks() once there is room
+        if (request.priority != ChunkLoadPriority::Immediate && at_chunk_limit(request.pos)) {
+            return;
+        }
+
+        // Try the compressed tier, then disk
         bool loaded_from_disk = false;
         std::vector<uint8_t> chunk_data;
 
-        if (region_manager) {
+        if (auto cached = chunk_cache.take(request.pos)) {
+            chunk_data = std::move(*cached);
+            loaded_from_disk = true;
+        } else if (region_manager) {
             pending_load_count++;
             auto data = region_manager->read_chunk(request.pos);
             pending_load_count--;
@@ -135,14 +181,15 @@ struct WorldManager::Impl {
         // Create or update chunk
         std::unique_ptr<Chunk> new_chunk;
         {
-            std::unique_lock<std::shared_mutex> lock(chunks_mutex);
+            std::unique_lock<std::shared_mutex> lock(chunks_mutex, std::defer_lock);
+            REALCRAFT_PROFILE_LOCK(lock, "Wait: chunks_mutex");
             auto it = chunks.find(request.pos);
 
             if (it != chunks.end()) {
                 // Chunk already exists, just update it
                 if (loaded_from_disk) {
                     it->second->set_state(ChunkState::Loading);
-                    serializer->deserialize(*it->second, chunk_data);
+                    deserialize_chunk(*it->second, chunk_data);
                     it->second->set_state(ChunkState::Loaded);
                 } else {
                     it->second->set_state(ChunkState::Generating);
@@ -171,7 +218,7 @@ struct WorldManager::Impl {
 
         // Process outside lock
         if (loaded_from_disk) {
-            serializer->deserialize(*new_chunk, chunk_data);
+            deserialize_chunk(*new_chunk, chunk_data);
             new_chunk->set_state(ChunkState::Loaded);
         } else {
             generate_chunk(*new_chunk);
@@ -179,27 +226,148 @@ struct WorldManager::Impl {
             pending_generation_count--;
         }
 
-        // Insert into map
+        // Insert into map, unless other workers filled the cap meanwhile; the
+        // finished chunk then goes to the compressed tier instead
         Chunk* chunk_ptr = new_chunk.get();
         {
-            std::unique_lock<std::shared_mutex> lock(chunks_mutex);
-            chunks[request.pos] = std::move(new_chunk);
-            update_neighbors(request.pos, chunk_ptr);
+            std::unique_lock<std::shared_mutex> lock(chunks_mutex, std::defer_lock);
+            REALCRAFT_PROFILE_LOCK(lock, "Wait: chunks_mutex");
+            const bool over_cap =
+                request.priority != ChunkLoadPriority::Immediate && chunks.size() >= config.max_loaded_chunks;
+            if (!over_cap) {
+                chunk_ptr->attach_dirty_counter(&dirty_chunk_count);
+                chunks[request.pos] = std::move(new_chunk);
+                update_neighbors(request.pos, chunk_ptr);
+            }
+        }
+
+        // Not in the map, so it can be saved without holding chunks_mutex
+        if (new_chunk) {
+            std::vector<uint8_t> data = serializer->serialize(*new_chunk, config.auto_save_compression_level);
+            if (new_chunk->is_dirty() && region_manager) {
+                region_manager->write_chunk(request.pos, data);
+                world_metrics().saved.add();
+            }
+            chunk_cache.put(request.pos, std::move(data));
+            return;
         }
 
         notify_chunk_loaded(request.pos, *chunk_ptr);
     }
 
+    // Serialize and write a chunk; caller must hold chunks_mutex. The chunk
+    // stays dirty: it is only clean once the write has been committed.
+    bool write_chunk(const ChunkPos& pos, Chunk& chunk, int compression_level) {
+        std::vector<uint8_t> data = serializer->serialize(chunk, compression_level);
+        if (!region_manager->write_chunk(pos, data)) {
+            return false;
+        }
+        world_metrics().saved.add();
+        return true;
+    }
+
+    // Mark chunks clean after their writes were committed, skipping any
+    // edited since they were serialized
+    void mark_committed(const std::vector<std::pair<ChunkPos, uint64_t>>& written) {
+        std::shared_lock<std::shared_mutex> lock(chunks_mutex);
+        for (const auto& [pos, version] : written) {
+            auto it = chunks.find(pos);
+            if (it != chunks.end() && it->second->get_version() == version) {
+                it->second->mark_clean();
+            }
+        }
+    }
+
+    void save_dirty(int compression_level) {
+        if (!region_manager || dirty_chunk_count.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+
+        std::vector<ChunkPos> dirty_positions;
+
+        {
+            std::shared_lock<std::shared_mutex> lock(chunks_mutex);
+            for (const auto& [pos, chunk] : chunks) {
+                if (chunk->is_dirty()) {
+                    dirty_positions.push_back(pos);
+                }
+            }
+        }
+
+        std::vector<std::pair<ChunkPos, uint64_t>> written;
+        written.reserve(dirty_positions.size());
+        for (const auto& pos : dirty_positions) {
+            std::shared_lock<std::shared_mutex> lock(chunks_mutex);
+            auto it = chunks.find(pos);
+            if (it != chunks.end()) {
+                notify_chunk_saving(pos, *it->second);
+                uint64_t version = it->second->get_version();
+                if (write_chunk(pos, *it->second, compression_level)) {
+                    written.emplace_back(pos, version);
+                }
+            }
+        }
+
+        if (!dirty_positions.empty()) {
+            // One journal commit for the whole batch; on failure the chunks
+            // stay dirty and are saved again next time
+            if (!region_manager->flush()) {
+                REALCRAFT_LOG_WARN(core::log_category::WORLD, "Failed to commit {} dirty chunks", written.size());
+                return;
+            }
+            mark_committed(written);
+            REALCRAFT_LOG_DEBUG(core::log_category::WORLD, "Saved {} dirty chunks", written.size());
+        }
+    }
+
+    // True if loading `pos` would add a chunk beyond max_loaded_chunks
+    bool at_chunk_limit(const ChunkPos& pos) const {
+        std::shared_lock<std::shared_mutex> lock(chunks_mutex);
+        return chunks.size() >= config.max_loaded_chunks && chunks.count(pos) == 0;
+    }
+
+    // Chunks stay loaded up to this many rings past the view distance
+    static constexpr int32_t UNLOAD_MARGIN = 2;
+
+    // Largest square of chunks (in chunks per side, odd) that fits the cap
+    int32_t capped_side() const {
+        auto side = static_cast<int32_t>(std::sqrt(static_cast<double>(config.max_loaded_chunks)));
+        return std::max(1, side - (side % 2 == 0 ? 1 : 0));
+    }
+
+    // Largest view distance whose whole retained square, including the
+    // unload margin, fits within the cap; otherwise out-of-view chunks could
+    // fill the cap and starve in-view loads
+    int32_t capped_view_distance() const {
+        const int32_t radius = (capped_side() - 1) / 2;
+        return std::min(config.view_distance, std::max(0, radius - UNLOAD_MARGIN));
+    }
+
+    // Unload margin for the capped view distance (smaller for tiny caps)
+    int32_t capped_unload_distance() const {
+        const int32_t radius = (capped_side() - 1) / 2;
+        const int32_t view = capped_view_distance();
+        return view + std::clamp(radius - view, 0, UNLOAD_MARGIN);
+    }
+
     void generate_chunk(Chunk& chunk) {
         // Use TerrainGenerator for noise-based procedural terrain
         if (terrain_generator) {
+            core::ScopedLatency latency(world_metrics().generation_us);
             terrain_generator->generate(chunk);
+            world_metrics().generated.add();
         } else {
             // Fallback: mark as generated with no blocks (should not happen)
             chunk.get_metadata_mut().has_been_generated = true;
         }
     }
 
+    void deserialize_chunk(Chunk& chunk, std::span<const uint8_t> data) {
+        core::ScopedLatency latency(world_metrics().load_us);
+        serializer->deserialize(chunk, data);
+        world_metrics().loaded.add();
+    }
+
     void update_neighbors(const ChunkPos& pos, Chunk* chunk) {
         // Link to existing neighbors
         for (int i = 0; i < static_cast<int>(HorizontalDirection::Count); ++i) {
@@ -229,6 +397,13 @@ struct WorldManager::Impl {
         }
     }
 
+    void notify_chunk_saving(const ChunkPos& pos, Chunk& chunk) {
+        std::lock_guard<std::mutex> lock(observers_mutex);
+        for (auto* observer : observers) {
+            observer->on_chunk_saving(pos, chunk);
+        }
+    }
+
     void notify_block_changed(const BlockChangeEvent& event) {
         std::lock_guard<std::mutex> lock(observers_mutex);
         for (auto* observer : observers) {
@@ -283,6 +458,7 @@ bool WorldManager::initialize(const WorldConfig& config) {
 
     // Initialize serialization
     impl_->serializer = std::make_unique<ChunkSerializer>();
+    impl_->chunk_cache.set_capacity(config.chunk_cache_size);
 
     if (config.enable_saving) {
         std::filesystem::path save_dir = config.save_directory;
@@ -290,6 +466,14 @@ bool WorldManager::initialize(const WorldConfig& config) {
             save_dir = platform::FileSystem::get_user_saves_directory() / config.name;
         }
         impl_->region_manager = std::make_unique<RegionManager>(save_dir);
+        impl_->serializer->set_compression_level(config.auto_save_compression_level);
+        impl_->serializer->load_dictionaries(save_dir);
+        if (config.enable_journal) {
+            impl_->region_manager->set_checkpoint_threshold(config.journal_checkpoint_bytes);
+            if (!impl_->region_manager->enable_journal()) {
+                REALCRAFT_LOG_WARN(core::log_category::WORLD, "Journal unavailable, writing region files directly");
+            }
+        }
         REALCRAFT_LOG_INFO(core::log_category::WORLD, "World save directory: {}", save_dir.string());
     }
 
@@ -325,7 +509,7 @@ void WorldManager::shutdown() {
     impl_->workers.clear();
 
     // Save dirty chunks
-    save_dirty_chunks();
+    impl_->save_dirty(impl_->config.final_save_compression_level);
 
     // Close region files
     if (impl_->region_manager) {
@@ -337,6 +521,8 @@ void WorldManager::shutdown() {
         std::unique_lock<std::shared_mutex> lock(impl_->chunks_mutex);
         impl_->chunks.clear();
     }
+    impl_->dirty_chunk_count = 0;
+    impl_->chunk_cache.clear();
 
     impl_->initialized = false;
 }
@@ -349,6 +535,7 @@ void WorldManager::update(double delta_time) {
     if (!impl_->initialized) {
         return;
     }
+    REALCRAFT_PROFILE_ZONE("WorldManager::update");
 
     // Update origin shifting
     {
@@ -367,10 +554,22 @@ void WorldManager::update(double delta_time) {
             save_dirty_chunks();
         }
     }
+
+    const size_t loaded = loaded_chunk_count();
+    const size_t pending = impl_->pending_generation_count.load();
+    WorldMetrics& metrics = world_metrics();
+    metrics.loaded_chunks.set(static_cast<int64_t>(loaded));
+    metrics.dirty_chunks.set(static_cast<int64_t>(impl_->dirty_chunk_count.load()));
+    metrics.pending_generation.set(static_cast<int64_t>(pending));
+    metrics.load_queue.set(static_cast<int64_t>(impl_->load_queue_size.load()));
+
+    REALCRAFT_PROFILE_COUNTER("Loaded chunks", loaded);
+    REALCRAFT_PROFILE_COUNTER("Pending generation", pending);
 }
 
 Chunk* WorldManager::get_chunk(const ChunkPos& pos) {
-    std::shared_lock<std::shared_mutex> lock(impl_->chunks_mutex);
+    std::shared_lock<std::shared_mutex> lock(impl_->chunks_mutex, std::defer_lock);
+    REALCRAFT_PROFILE_LOCK(lock, "Wait: chunks_mutex");
     auto it = impl_->chunks.find(pos);
     if (it != impl_->chunks.end()) {
         return it->second.get();
@@ -405,6 +604,7 @@ void WorldManager::request_chunk(const ChunkPos& pos, ChunkLoadPriority priority
         }
         impl_->queued_chunks.insert(pos);
         impl_->load_queue.push({pos, priority});
+        impl_->load_queue_size.store(impl_->load_queue.size(), std::memory_order_relaxed);
     }
 
     impl_->load_cv.notify_one();
@@ -429,20 +629,61 @@ Chunk* WorldManager::load_chunk_sync(const ChunkPos& pos) {
 
 void WorldManager::unload_chunk(const ChunkPos& pos) {
     std::unique_ptr<Chunk> chunk_to_unload;
+    const int level = impl_->config.auto_save_compression_level;
+    const bool keep_blob = impl_->chunk_cache.get_capacity() > 0;
+
+    // Serialize and write while the chunk is still loaded, under the shared
+    // lock only, so loads and lookups are not blocked behind compression and
+    // I/O. The chunk stays in the map, so nothing can reload stale data.
+    std::vector<uint8_t> data;
+    uint64_t saved_version = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(impl_->chunks_mutex);
+        auto it = impl_->chunks.find(pos);
+        if (it == impl_->chunks.end()) {
+            return;
+        }
+        Chunk& chunk = *it->second;
+        impl_->notify_chunk_saving(pos, chunk);
+
+        saved_version = chunk.get_version();
+        const bool save = chunk.is_dirty() && impl_->region_manager;
+        if (save || keep_blob) {
+            data = impl_->serializer->serialize(chunk, level);
+        }
+        if (save) {
+            impl_->region_manager->write_chunk(pos, data);
+            if (chunk.get_version() == saved_version) {
+                chunk.mark_clean();
+            }
+            world_metrics().saved.add();
+        }
+    }
 
     {
-        std::unique_lock<std::shared_mutex> lock(impl_->chunks_mutex);
+        std::unique_lock<std::shared_mutex> lock(impl_->chunks_mutex, std::defer_lock);
+        REALCRAFT_PROFILE_LOCK(lock, "Wait: chunks_mutex");
         auto it = impl_->chunks.find(pos);
         if (it == impl_->chunks.end()) {
             return;
         }
 
+        // Edited since the snapshot above (rare): save again before dropping it
+        if (it->second->get_version() != saved_version || (it->second->is_dirty() && impl_->region_manager)) {
+            impl_->notify_chunk_saving(pos, *it->second);
+            data = impl_->serializer->serialize(*it->second, level);
+            if (impl_->region_manager) {
+                impl_->region_manager->write_chunk(pos, data);
+                it->second->mark_clean();
+                world_metrics().saved.add();
+            }
+        }
+
         impl_->notify_chunk_unloading(pos, *it->second);
 
-        // Save if dirty
-        if (it->second->is_dirty() && impl_->region_manager) {
-            std::vector<uint8_t> data = impl_->serializer->serialize(*it->second);
-            impl_->region_manager->write_chunk(pos, data);
+        // Keep the compressed blob for a quick reload
+        if (keep_blob) {
+            impl_->chunk_cache.put(pos, std::move(data));
         }
 
         // Remove neighbor links
@@ -454,8 +695,10 @@ void WorldManager::unload_chunk(const ChunkPos& pos) {
             }
         }
 
+        it->second->detach_dirty_counter();
         chunk_to_unload = std::move(it->second);
         impl_->chunks.erase(it);
+        world_metrics().unloaded.add();
     }
 
     // Chunk destructor called outside lock
@@ -509,6 +752,57 @@ void WorldManager::set_block(const WorldBlockPos& pos, BlockId id, BlockStateId
     impl_->notify_block_changed(event);
 }
 
+bool WorldManager::read_region(const WorldBlockPos& min, const WorldBlockPos& max, std::span<BlockId> out) const {
+    if (min.x > max.x || min.y > max.y || min.z > max.z) {
+        return false;
+    }
+    const auto width = static_cast<size_t>(max.x - min.x + 1);
+    const auto height = static_cast<size_t>(max.y - min.y + 1);
+    const auto depth = static_cast<size_t>(max.z - min.z + 1);
+    const size_t slice = width * depth;
+    if (out.size() / slice < height) {
+        return false;
+    }
+
+    // Unloaded chunks and layers outside the world stay air
+    std::fill_n(out.begin(), slice * height, BLOCK_AIR);
+    const int64_t y0 = std::max<int64_t>(min.y, 0);
+    const int64_t y1 = std::min<int64_t>(max.y, CHUNK_SIZE_Y - 1);
+    if (y0 > y1) {
+        return true;
+    }
+
+    const ChunkPos first = world_to_chunk(min);
+    const ChunkPos last = world_to_chunk(max);
+    for (int32_t cz = first.y; cz <= last.y; ++cz) {
+        for (int32_t cx = first.x; cx <= last.x; ++cx) {
+            const ChunkPos chunk_pos(cx, cz);
+            const Chunk* chunk = get_chunk(chunk_pos);
+            if (!chunk) {
+                continue;
+            }
+
+            // The part of the box inside this chunk
+            const WorldBlockPos origin = local_to_world(chunk_pos, LocalBlockPos(0, 0, 0));
+            const int64_t x0 = std::max(min.x, origin.x);
+            const int64_t x1 = std::min(max.x, origin.x + CHUNK_SIZE_X - 1);
+            const int64_t z0 = std::max(min.z, origin.z);
+            const int64_t z1 = std::min(max.z, origin.z + CHUNK_SIZE_Z - 1);
+            const size_t offset = static_cast<size_t>(y0 - min.y) * slice + static_cast<size_t>(z0 - min.z) * width +
+                                  static_cast<size_t>(x0 - min.x);
+
+            auto lock = chunk->read_lock();
+            (void)lock.storage().read_region(
+                LocalBlockPos(static_cast<int32_t>(x0 - origin.x), static_cast<int32_t>(y0),
+                              static_cast<int32_t>(z0 - origin.z)),
+                LocalBlockPos(static_cast<int32_t>(x1 - origin.x), static_cast<int32_t>(y1),
+                              static_cast<int32_t>(z1 - origin.z)),
+                out.subspan(offset), width, slice);
+        }
+    }
+    return true;
+}
+
 void WorldManager::set_player_position(const WorldPos& position) {
     std::lock_guard<std::mutex> lock(impl_->player_mutex);
     impl_->player_position = position;
@@ -529,7 +823,7 @@ void WorldManager::update_loaded_chunks() {
     WorldBlockPos player_block = world_to_block(player_pos);
     ChunkPos player_chunk = world_to_chunk(player_block);
 
-    int view_dist = impl_->config.view_distance;
+    int view_dist = impl_->capped_view_distance();
 
     // Request chunks within view distance
     for (int x = -view_dist; x <= view_dist; ++x) {
@@ -545,7 +839,7 @@ void WorldManager::update_loaded_chunks() {
     }
 
     // Unload chunks outside view distance + buffer
-    int unload_dist = view_dist + 2;
+    int unload_dist = impl_->capped_unload_distance();
     std::vector<ChunkPos> to_unload;
 
     {
@@ -563,6 +857,34 @@ void WorldManager::update_loaded_chunks() {
     for (const auto& pos : to_unload) {
         unload_chunk(pos);
     }
+
+    // Enforce the hard cap (e.g. after Immediate loads) by dropping the
+    // chunks farthest from the player
+    std::vector<std::pair<int, ChunkPos>> by_distance;
+    {
+        std::shared_lock<std::shared_mutex> lock(impl_->chunks_mutex);
+        if (impl_->chunks.size() > impl_->config.max_loaded_chunks) {
+            by_distance.reserve(impl_->chunks.size());
+            for (const auto& [pos, chunk] : impl_->chunks) {
+                int dist = std::max(std::abs(pos.x - player_chunk.x), std::abs(pos.y - player_chunk.y));
+                by_distance.emplace_back(dist, pos);
+            }
+        }
+    }
+    if (!by_distance.empty()) {
+        size_t excess = by_distance.size() - impl_->config.max_loaded_chunks;
+        std::partial_sort(by_distance.begin(), by_distance.begin() + static_cast<std::ptrdiff_t>(excess),
+                          by_distance.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+        for (size_t i = 0; i < excess; ++i) {
+            unload_chunk(by_distance[i].second);
+            to_unload.push_back(by_distance[i].second);
+        }
+    }
+
+    // Chunks saved on unload are committed as one batch
+    if (!to_unload.empty() && impl_->region_manager) {
+        impl_->region_manager->commit();
+    }
 }
 
 WorldBlockPos WorldManager::get_origin_offset() const {
@@ -601,9 +923,9 @@ void WorldManager::remove_observer(IWorldObserver* observer) {
 }
 
 void WorldManager::save_all() {
-    save_dirty_chunks();
+    impl_->save_dirty(impl_->config.final_save_compression_level);
     if (impl_->region_manager) {
-        impl_->region_manager->flush();
+        impl_->region_manager->checkpoint();
     }
 }
 
@@ -612,42 +934,31 @@ void WorldManager::save_chunk(const ChunkPos& pos) {
         return;
     }
 
-    std::shared_lock<std::shared_mutex> lock(impl_->chunks_mutex);
-    auto it = impl_->chunks.find(pos);
-    if (it == impl_->chunks.end()) {
-        return;
-    }
-
-    std::vector<uint8_t> data = impl_->serializer->serialize(*it->second);
-    impl_->region_manager->write_chunk(pos, data);
-    it->second->mark_clean();
-}
-
-void WorldManager::save_dirty_chunks() {
-    if (!impl_->region_manager) {
-        return;
-    }
-
-    std::vector<ChunkPos> dirty_positions;
-
+    uint64_t version = 0;
     {
         std::shared_lock<std::shared_mutex> lock(impl_->chunks_mutex);
-        for (const auto& [pos, chunk] : impl_->chunks) {
-            if (chunk->is_dirty()) {
-                dirty_positions.push_back(pos);
-            }
+        auto it = impl_->chunks.find(pos);
+        if (it == impl_->chunks.end()) {
+            return;
         }
-    }
 
-    for (const auto& pos : dirty_positions) {
-        save_chunk(pos);
+        impl_->notify_chunk_saving(pos, *it->second);
+        version = it->second->get_version();
+        if (!impl_->write_chunk(pos, *it->second, impl_->config.auto_save_compression_level)) {
+            return;
+        }
     }
 
-    if (!dirty_positions.empty()) {
-        REALCRAFT_LOG_DEBUG(core::log_category::WORLD, "Saved {} dirty chunks", dirty_positions.size());
+    if (impl_->region_manager->commit()) {
+        impl_->mark_committed({{pos, version}});
     }
 }
 
+void WorldManager::save_dirty_chunks() {
+    REALCRAFT_PROFILE_ZONE("WorldManager::save_dirty_chunks");
+    impl_->save_dirty(impl_->config.auto_save_compression_level);
+}
+
 void WorldManager::for_each_chunk(const std::function<void(const ChunkPos&, Chunk&)>& callback) {
     std::shared_lock<std::shared_mutex> lock(impl_->chunks_mutex);
     for (auto& [pos, chunk] : impl_->chunks) {
@@ -677,6 +988,10 @@ size_t WorldManager::loaded_chunk_count() const {
     return impl_->chunks.size();
 }
 
+size_t WorldManager::cached_chunk_count() const {
+    return impl_->chunk_cache.size();
+}
+
 size_t WorldManager::pending_generation_count() const {
     return impl_->pending_generation_count.load();
 }
@@ -686,14 +1001,7 @@ size_t WorldManager::pending_load_count() const {
 }
 
 size_t WorldManager::dirty_chunk_count() const {
-    std::shared_lock<std::shared_mutex> lock(impl_->chunks_mutex);
-    size_t count = 0;
-    for (const auto& [pos, chunk] : impl_->chunks) {
-        if (chunk->is_dirty()) {
-            ++count;
-        }
-    }
-    return count;
+    return impl_->dirty_chunk_count.load();
 }
 
 size_t WorldManager::total_memory_usage() const {
@@ -702,7 +1010,7 @@ size_t WorldManager::total_memory_usage() const {
     for (const auto& [pos, chunk] : impl_->chunks) {
         total += chunk->memory_usage();
     }
-    return total;
+    return total + impl_->chunk_cache.memory_usage();
 }
 
 const WorldConfig& WorldManager::get_config() const {
@@ -713,6 +1021,10 @@ void WorldManager::set_view_distance(int32_t distance) {
     impl_->config.view_distance = distance;
 }
 
+int32_t WorldManager::get_effective_view_distance() const {
+    return impl_->capped_view_distance();
+}
+
 uint32_t WorldManager::get_seed() const {
     return impl_->config.seed;
 }
@@ -0,0 +1,99 @@
+// RealCraft Benchmarks
+// benchmark_fixtures.cpp - Shared generated-terrain fixtures for micro-benchmarks
+
+#include "benchmark_fixtures.hpp"
+
+#include <realcraft/world/block.hpp>
+#include <realcraft/world/terrain_generator.hpp>
+
+#include <cstdlib>
+#include <cstdio>
+
+namespace realcraft::benchmarks {
+
+// ============================================================================
+// Generated Chunks
+// ============================================================================
+
+GeneratedChunks::GeneratedChunks() {
+    world::BlockRegistry::instance().register_defaults();
+
+    world::TerrainConfig config;
+    config.seed = BENCHMARK_SEED;
+    world::TerrainGenerator generator(config);
+
+    for (int32_t dz = -1; dz <= 1; ++dz) {
+        for (int32_t dx = -1; dx <= 1; ++dx) {
+            world::ChunkDesc desc;
+            desc.position = world::ChunkPos(dx, dz);
+            desc.seed = BENCHMARK_SEED;
+            auto chunk = std::make_unique<world::Chunk>(desc);
+            generator.generate(*chunk);
+            chunks_[static_cast<size_t>((dz + 1) * 3 + (dx + 1))] = std::move(chunk);
+        }
+    }
+}
+
+const GeneratedChunks& GeneratedChunks::instance() {
+    static const GeneratedChunks chunks;
+    return chunks;
+}
+
+int32_t GeneratedChunks::surface_height(int32_t x, int32_t z) const {
+    auto lock = center().read_lock();
+    for (int32_t y = world::CHUNK_SIZE_Y - 1; y >= 0; --y) {
+        if (lock.get_block(world::LocalBlockPos(x, y, z)) != world::BLOCK_AIR) {
+            return y;
+        }
+    }
+    return 0;
+}
+
+world::VoxelStorage copy_storage(const world::Chunk& chunk) {
+    world::VoxelStorage storage;
+    auto lock = chunk.read_lock();
+    if (!storage.deserialize_raw(lock.storage().serialize_raw())) {
+        std::fprintf(stderr, "benchmark fixture: failed to clone chunk storage\n");
+        std::abort();
+    }
+    return storage;
+}
+
+// ============================================================================
+// Benchmark World
+// ============================================================================
+
+BenchmarkWorld::BenchmarkWorld() {
+    world::BlockRegistry::instance().register_defaults();
+
+    world::WorldConfig world_config;
+    world_config.name = "benchmark_world";
+    world_config.seed = BENCHMARK_SEED;
+    world_config.view_distance = WORLD_RADIUS;
+    world_config.enable_saving = false;
+    world_config.generation_threads = 1;
+
+    physics::PhysicsConfig physics_config;
+    if (!world_.initialize(world_config) || !physics_.initialize(&world_, physics_config)) {
+        std::fprintf(stderr, "benchmark fixture: failed to initialize world\n");
+        std::abort();
+    }
+
+    for (int32_t z = -WORLD_RADIUS; z <= WORLD_RADIUS; ++z) {
+        for (int32_t x = -WORLD_RADIUS; x <= WORLD_RADIUS; ++x) {
+            (void)world_.load_chunk_sync(world::ChunkPos(x, z));
+        }
+    }
+}
+
+BenchmarkWorld::~BenchmarkWorld() {
+    physics_.shutdown();
+    world_.shutdown();
+}
+
+BenchmarkWorld& BenchmarkWorld::instance() {
+    static BenchmarkWorld world;
+    return world;
+}
+
+}  // namespace realcraft::benchmarks
@@ -0,0 +1,76 @@
+// RealCraft Benchmarks
+// benchmark_fixtures.hpp - Shared generated-terrain fixtures for micro-benchmarks
+//
+// Everything is built from a fixed seed so results are comparable between runs
+// and between commits. Fixtures are created lazily on first use and shared by
+// all benchmarks in the process.
+
+#pragma once
+
+#include <realcraft/physics/physics_world.hpp>
+#include <realcraft/world/chunk.hpp>
+#include <realcraft/world/chunk_data.hpp>
+#include <realcraft/world/world_manager.hpp>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace realcraft::benchmarks {
+
+inline constexpr uint32_t BENCHMARK_SEED = 12345;
+
+// ============================================================================
+// Generated Chunks (standalone, no WorldManager)
+// ============================================================================
+
+// 3x3 grid of generated chunks centred on chunk (0, 0)
+class GeneratedChunks {
+public:
+    [[nodiscard]] static const GeneratedChunks& instance();
+
+    [[nodiscard]] const world::Chunk& center() const { return *chunks_[4]; }
+
+    // dx, dz in [-1, 1]
+    [[nodiscard]] const world::Chunk& at(int32_t dx, int32_t dz) const { return *chunks_[(dz + 1) * 3 + (dx + 1)]; }
+
+    // Highest non-air y of a column in the center chunk
+    [[nodiscard]] int32_t surface_height(int32_t x, int32_t z) const;
+
+private:
+    GeneratedChunks();
+
+    std::array<std::unique_ptr<world::Chunk>, 9> chunks_;
+};
+
+// VoxelStorage is move-only; clone through the raw format
+[[nodiscard]] world::VoxelStorage copy_storage(const world::Chunk& chunk);
+
+// ============================================================================
+// Benchmark World (WorldManager + PhysicsWorld)
+// ============================================================================
+
+// In-memory world (saving disabled) with the chunks within WORLD_RADIUS of
+// the origin loaded synchronously
+class BenchmarkWorld {
+public:
+    static constexpr int32_t WORLD_RADIUS = 2;
+
+    [[nodiscard]] static BenchmarkWorld& instance();
+
+    ~BenchmarkWorld();
+
+    BenchmarkWorld(const BenchmarkWorld&) = delete;
+    BenchmarkWorld& operator=(const BenchmarkWorld&) = delete;
+
+    [[nodiscard]] world::WorldManager& world() { return world_; }
+    [[nodiscard]] physics::PhysicsWorld& physics() { return physics_; }
+
+private:
+    BenchmarkWorld();
+
+    world::WorldManager world_;
+    physics::PhysicsWorld physics_;
+};
+
+}  // namespace realcraft::benchmarks
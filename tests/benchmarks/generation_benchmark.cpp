@@ -0,0 +1,248 @@
+// RealCraft Benchmarks
+// generation_benchmark.cpp - Throughput of the world generation pipeline
+//
+// Run with --benchmark_out=<file> --benchmark_out_format=json to produce a
+// machine-readable report (the realcraft_run_generation_benchmarks target
+// does this). Pair with GenerationGoldenTest: an optimization must keep the
+// golden hashes unchanged and should move these numbers.
+
+#include <benchmark/benchmark.h>
+
+#include <realcraft/world/biome.hpp>
+#include <realcraft/world/block.hpp>
+#include <realcraft/world/cave_generator.hpp>
+#include <realcraft/world/chunk.hpp>
+#include <realcraft/world/climate.hpp>
+#include <realcraft/world/erosion.hpp>
+#include <realcraft/world/erosion_heightmap.hpp>
+#include <realcraft/world/ore_generator.hpp>
+#include <realcraft/world/structure_generator.hpp>
+#include <realcraft/world/terrain_generator.hpp>
+#include <realcraft/world/tree_generator.hpp>
+#include <realcraft/world/vegetation_generator.hpp>
+
+#include <cstdint>
+
+namespace realcraft::world {
+namespace {
+
+constexpr uint32_t BENCH_SEED = 12345;
+
+// Walk a row of chunks so every iteration generates fresh content
+ChunkPos chunk_at(int64_t iteration) {
+    return ChunkPos(static_cast<int32_t>(iteration % 64), static_cast<int32_t>(iteration / 64));
+}
+
+void ensure_blocks_registered() {
+    static const bool registered = [] {
+        BlockRegistry::instance().register_defaults();
+        return true;
+    }();
+    (void)registered;
+}
+
+// ============================================================================
+// Full Pipeline
+// ============================================================================
+
+void run_terrain_generate(benchmark::State& state, const TerrainConfig& config) {
+    ensure_blocks_registered();
+    TerrainGenerator generator(config);
+
+    int64_t iteration = 0;
+    for (auto _ : state) {
+        ChunkDesc desc;
+        desc.position = chunk_at(iteration++);
+        desc.seed = config.seed;
+        Chunk chunk(desc);
+        generator.generate(chunk);
+        benchmark::DoNotOptimize(chunk.get_metadata().biome_id);
+    }
+    state.counters["chunks_per_s"] = benchmark::Counter(static_cast<double>(iteration), benchmark::Counter::kIsRate);
+}
+
+void BM_TerrainGenerate(benchmark::State& state) {
+    TerrainConfig config;
+    config.seed = BENCH_SEED;
+    run_terrain_generate(state, config);
+}
+BENCHMARK(BM_TerrainGenerate)->Unit(benchmark::kMillisecond);
+
+void BM_TerrainGenerateWithErosion(benchmark::State& state) {
+    TerrainConfig config;
+    config.seed = BENCH_SEED;
+    config.erosion.enabled = true;
+    config.erosion.prefer_gpu = false;
+    run_terrain_generate(state, config);
+}
+BENCHMARK(BM_TerrainGenerateWithErosion)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Terrain Passes
+// ============================================================================
+
+void BM_CaveShouldCarve(benchmark::State& state) {
+    CaveConfig config;
+    config.seed = BENCH_SEED;
+    CaveGenerator caves(config);
+
+    int64_t iteration = 0;
+    for (auto _ : state) {
+        const ChunkPos pos = chunk_at(iteration++);
+        const int64_t base_x = static_cast<int64_t>(pos.x) * CHUNK_SIZE_X;
+        const int64_t base_z = static_cast<int64_t>(pos.y) * CHUNK_SIZE_Z;
+        uint32_t carved = 0;
+        // One column slab of the chunk across the cave band
+        for (int32_t y = config.min_y; y < config.max_y; ++y) {
+            for (int32_t x = 0; x < CHUNK_SIZE_X; ++x) {
+                carved += caves.should_carve(base_x + x, y, base_z, 100) ? 1u : 0u;
+            }
+        }
+        benchmark::DoNotOptimize(carved);
+    }
+    state.SetItemsProcessed(iteration * (config.max_y - config.min_y) * CHUNK_SIZE_X);
+}
+BENCHMARK(BM_CaveShouldCarve)->Unit(benchmark::kMicrosecond);
+
+void BM_ClimateSampleBlended(benchmark::State& state) {
+    ClimateConfig config;
+    config.seed = BENCH_SEED;
+    ClimateMap climate(config);
+
+    int64_t iteration = 0;
+    for (auto _ : state) {
+        const ChunkPos pos = chunk_at(iteration++);
+        const int64_t base_x = static_cast<int64_t>(pos.x) * CHUNK_SIZE_X;
+        const int64_t base_z = static_cast<int64_t>(pos.y) * CHUNK_SIZE_Z;
+        // Every column of one chunk, as the terrain pass samples it
+        for (int32_t z = 0; z < CHUNK_SIZE_Z; ++z) {
+            for (int32_t x = 0; x < CHUNK_SIZE_X; ++x) {
+                BiomeBlend blend = climate.sample_blended(base_x + x, base_z + z);
+                benchmark::DoNotOptimize(blend);
+            }
+        }
+    }
+    state.SetItemsProcessed(iteration * CHUNK_SIZE_X * CHUNK_SIZE_Z);
+    state.counters["chunks_per_s"] = benchmark::Counter(static_cast<double>(iteration), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_ClimateSampleBlended)->Unit(benchmark::kMicrosecond);
+
+void BM_CPUErosion(benchmark::State& state) {
+    TerrainConfig terrain_config;
+    terrain_config.seed = BENCH_SEED;
+    TerrainGenerator generator(terrain_config);
+
+    ErosionConfig config;
+    config.enabled = true;
+    config.particle.droplet_count = static_cast<int32_t>(state.range(0));
+
+    ErosionHeightmap source(CHUNK_SIZE_X, CHUNK_SIZE_Z, config.border_size);
+    source.populate_from_generator(generator, ChunkPos(0, 0));
+
+    CPUErosionEngine engine;
+    for (auto _ : state) {
+        state.PauseTiming();
+        ErosionHeightmap heightmap = source;
+        state.ResumeTiming();
+        engine.erode(heightmap, config, BENCH_SEED);
+        benchmark::DoNotOptimize(heightmap.get(0, 0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CPUErosion)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Feature Generators
+// ============================================================================
+
+void BM_OreGenerate(benchmark::State& state) {
+    ensure_blocks_registered();
+    OreConfig config;
+    config.seed = BENCH_SEED;
+    OreGenerator ores(config);
+
+    int64_t iteration = 0;
+    for (auto _ : state) {
+        auto positions = ores.generate_ores(chunk_at(iteration++), BiomeType::Mountains);
+        benchmark::DoNotOptimize(positions.data());
+    }
+    state.counters["chunks_per_s"] = benchmark::Counter(static_cast<double>(iteration), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_OreGenerate)->Unit(benchmark::kMicrosecond);
+
+void BM_TreePlacement(benchmark::State& state) {
+    ensure_blocks_registered();
+    TreeConfig config;
+    config.seed = BENCH_SEED;
+    TreeGenerator trees(config);
+
+    int64_t iteration = 0;
+    for (auto _ : state) {
+        const ChunkPos pos = chunk_at(iteration++);
+        const int64_t base_x = static_cast<int64_t>(pos.x) * CHUNK_SIZE_X;
+        const int64_t base_z = static_cast<int64_t>(pos.y) * CHUNK_SIZE_Z;
+        size_t blocks = 0;
+        for (int32_t z = 0; z < CHUNK_SIZE_Z; ++z) {
+            for (int32_t x = 0; x < CHUNK_SIZE_X; ++x) {
+                if (trees.should_place_tree(base_x + x, base_z + z, BiomeType::Forest)) {
+                    blocks += trees.generate_tree(base_x + x, base_z + z, BiomeType::Forest, 80).size();
+                }
+            }
+        }
+        benchmark::DoNotOptimize(blocks);
+    }
+    state.counters["chunks_per_s"] = benchmark::Counter(static_cast<double>(iteration), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_TreePlacement)->Unit(benchmark::kMicrosecond);
+
+void BM_VegetationPlacement(benchmark::State& state) {
+    ensure_blocks_registered();
+    VegetationConfig config;
+    config.seed = BENCH_SEED;
+    VegetationGenerator vegetation(config);
+
+    int64_t iteration = 0;
+    for (auto _ : state) {
+        const ChunkPos pos = chunk_at(iteration++);
+        const int64_t base_x = static_cast<int64_t>(pos.x) * CHUNK_SIZE_X;
+        const int64_t base_z = static_cast<int64_t>(pos.y) * CHUNK_SIZE_Z;
+        uint32_t placed = 0;
+        for (int32_t z = 0; z < CHUNK_SIZE_Z; ++z) {
+            for (int32_t x = 0; x < CHUNK_SIZE_X; ++x) {
+                if (vegetation.should_place_grass(base_x + x, base_z + z, BiomeType::Plains)) {
+                    placed += vegetation.get_grass_block(base_x + x, base_z + z, BiomeType::Plains);
+                } else {
+                    placed += vegetation.get_flower_block(base_x + x, base_z + z, BiomeType::Plains);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(placed);
+    }
+    state.counters["chunks_per_s"] = benchmark::Counter(static_cast<double>(iteration), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_VegetationPlacement)->Unit(benchmark::kMicrosecond);
+
+void BM_StructureGenerate(benchmark::State& state) {
+    ensure_blocks_registered();
+    StructureConfig config;
+    config.seed = BENCH_SEED;
+    StructureGenerator structures(config);
+
+    int64_t iteration = 0;
+    for (auto _ : state) {
+        const ChunkPos pos = chunk_at(iteration++);
+        size_t blocks = 0;
+        for (uint8_t type = 0; type < static_cast<uint8_t>(StructureType::Count); ++type) {
+            // Always build, so the timing covers the block generation itself
+            blocks += structures.generate_structure(pos, static_cast<StructureType>(type), 70).size();
+        }
+        benchmark::DoNotOptimize(blocks);
+    }
+    state.counters["chunks_per_s"] = benchmark::Counter(static_cast<double>(iteration), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_StructureGenerate)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace realcraft::world
+
+BENCHMARK_MAIN();
@@ -0,0 +1,42 @@
+// RealCraft Benchmarks
+// mesh_benchmark.cpp - Chunk mesh generation micro-benchmarks
+
+#include "benchmark_fixtures.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <realcraft/rendering/mesh_generator.hpp>
+
+namespace realcraft::benchmarks {
+namespace {
+
+// Args: greedy meshing (0/1), ambient occlusion (0/1)
+void BM_MeshGenerate(benchmark::State& state) {
+    const GeneratedChunks& chunks = GeneratedChunks::instance();
+
+    rendering::MeshGeneratorConfig config;
+    config.enable_greedy_meshing = state.range(0) != 0;
+    config.enable_ambient_occlusion = state.range(1) != 0;
+    rendering::MeshGenerator generator(config);
+
+    rendering::ChunkMeshData data;
+    rendering::ChunkMeshStats stats;
+    for (auto _ : state) {
+        data.clear();
+        bool generated = generator.generate(chunks.center(), &chunks.at(-1, 0), &chunks.at(1, 0), &chunks.at(0, -1),
+                                            &chunks.at(0, 1), data, stats);
+        benchmark::DoNotOptimize(generated);
+    }
+    state.counters["vertices"] = static_cast<double>(stats.opaque_vertex_count + stats.transparent_vertex_count);
+    state.counters["indices"] = static_cast<double>(stats.opaque_index_count + stats.transparent_index_count);
+}
+BENCHMARK(BM_MeshGenerate)
+    ->ArgNames({"greedy", "ao"})
+    ->Args({0, 0})
+    ->Args({0, 1})
+    ->Args({1, 0})
+    ->Args({1, 1})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace realcraft::benchmarks
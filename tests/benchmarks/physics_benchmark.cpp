@@ -0,0 +1,197 @@
+// RealCraft Benchmarks
+// physics_benchmark.cpp - Collider, raycast, support graph and fluid micro-benchmarks
+
+#include "benchmark_fixtures.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <realcraft/physics/chunk_collider.hpp>
+#include <realcraft/physics/fluid_simulation.hpp>
+#include <realcraft/physics/ray_caster.hpp>
+#include <realcraft/physics/support_graph.hpp>
+#include <realcraft/world/block.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace realcraft::benchmarks {
+namespace {
+
+// ============================================================================
+// Chunk Collider
+// ============================================================================
+
+void BM_ChunkColliderRebuild(benchmark::State& state) {
+    const world::Chunk& chunk = GeneratedChunks::instance().center();
+    physics::ChunkCollider collider(chunk.get_position(), chunk);
+    for (auto _ : state) {
+        collider.rebuild(chunk);
+        benchmark::DoNotOptimize(collider.get_collision_object());
+    }
+    state.counters["blocks"] = static_cast<double>(collider.get_block_count());
+}
+BENCHMARK(BM_ChunkColliderRebuild)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Voxel Ray Caster
+// ============================================================================
+
+// Horizontal rays near the build limit: never hit, so the whole length is
+// traversed. Arg: ray length in blocks
+void BM_RayCastTraversal(benchmark::State& state) {
+    BenchmarkWorld& fixture = BenchmarkWorld::instance();
+    physics::VoxelRayCaster caster;
+    caster.set_world_manager(&fixture.world());
+
+    const double length = static_cast<double>(state.range(0));
+    const double y = world::CHUNK_SIZE_Y - 1.5;
+    int32_t lane = 0;
+    for (auto _ : state) {
+        const double z = -60.5 + static_cast<double>(lane++ % 120);
+        physics::Ray ray(glm::dvec3(-60.5, y, z), glm::dvec3(1.0, 0.0, 0.1));
+        auto hit = caster.cast(ray, length);
+        benchmark::DoNotOptimize(hit);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RayCastTraversal)->ArgName("length")->Arg(8)->Arg(32)->Arg(128);
+
+// Downward rays onto generated terrain, as block targeting does
+void BM_RayCastTerrain(benchmark::State& state) {
+    BenchmarkWorld& fixture = BenchmarkWorld::instance();
+    physics::VoxelRayCaster caster;
+    caster.set_world_manager(&fixture.world());
+
+    int64_t hits = 0;
+    int32_t lane = 0;
+    for (auto _ : state) {
+        const double x = -60.5 + static_cast<double>(lane % 120);
+        const double z = -60.5 + static_cast<double>((lane * 7) % 120);
+        ++lane;
+        physics::Ray ray(glm::dvec3(x, world::CHUNK_SIZE_Y - 1.5, z), glm::dvec3(0.2, -1.0, 0.1));
+        auto hit = caster.cast(ray, static_cast<double>(world::CHUNK_SIZE_Y));
+        hits += hit.has_value() ? 1 : 0;
+    }
+    state.counters["hit_rate"] = static_cast<double>(hits) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_RayCastTerrain);
+
+// ============================================================================
+// Support Graph
+// ============================================================================
+
+// Generated chunk with a one-block pillar carrying a square platform. Each
+// iteration cuts the pillar and searches for the collapsing cluster.
+// Arg: platform half-width
+void BM_SupportGraphFindUnsupported(benchmark::State& state) {
+    const GeneratedChunks& chunks = GeneratedChunks::instance();
+    const world::Chunk& chunk = chunks.center();
+    const world::BlockId stone = world::BlockRegistry::instance().stone_id();
+
+    physics::SupportGraph graph;
+    graph.initialize();
+    {
+        auto lock = chunk.read_lock();
+        graph.build_from_chunk(chunk.get_position(), [&lock](const world::WorldBlockPos& pos) {
+            return lock.get_block(world::world_to_local(pos));
+        });
+    }
+
+    constexpr int32_t pillar_x = world::CHUNK_SIZE_X / 2;
+    constexpr int32_t pillar_z = world::CHUNK_SIZE_Z / 2;
+    constexpr int32_t pillar_height = 10;
+    const int32_t base = chunks.surface_height(pillar_x, pillar_z) + 1;
+    const auto half_width = static_cast<int32_t>(state.range(0));
+
+    for (int32_t y = base; y < base + pillar_height; ++y) {
+        graph.add_block(world::WorldBlockPos(pillar_x, y, pillar_z), stone);
+    }
+    for (int32_t dz = -half_width; dz <= half_width; ++dz) {
+        for (int32_t dx = -half_width; dx <= half_width; ++dx) {
+            graph.add_block(world::WorldBlockPos(pillar_x + dx, base + pillar_height, pillar_z + dz), stone);
+        }
+    }
+
+    const world::WorldBlockPos cut(pillar_x, base + pillar_height / 2, pillar_z);
+    size_t cluster_blocks = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<world::WorldBlockPos> affected = graph.remove_block(cut);
+        state.ResumeTiming();
+
+        std::vector<physics::BlockCluster> clusters = graph.find_unsupported_clusters(affected);
+
+        state.PauseTiming();
+        cluster_blocks = 0;
+        for (const auto& cluster : clusters) {
+            cluster_blocks += cluster.size();
+        }
+        graph.add_block(cut, stone);
+        state.ResumeTiming();
+    }
+    state.counters["cluster_blocks"] = static_cast<double>(cluster_blocks);
+    state.counters["tracked_blocks"] = static_cast<double>(graph.tracked_block_count());
+}
+BENCHMARK(BM_SupportGraphFindUnsupported)->ArgName("half_width")->Arg(4)->Arg(16)->Unit(benchmark::kMicrosecond);
+
+// ============================================================================
+// Fluid Simulation
+// ============================================================================
+
+// A walled stone basin above the terrain, flooded from one source block.
+// Each iteration resets the basin and runs the given number of simulation
+// ticks. Arg: ticks
+void BM_FluidFlood(benchmark::State& state) {
+    BenchmarkWorld& fixture = BenchmarkWorld::instance();
+    world::WorldManager& world_manager = fixture.world();
+    physics::FluidSimulation* fluid = fixture.physics().get_fluid_simulation();
+    if (fluid == nullptr) {
+        state.SkipWithError("fluid simulation unavailable");
+        return;
+    }
+
+    constexpr int32_t floor_y = 220;
+    constexpr int32_t wall_height = 4;
+    constexpr int32_t size = world::CHUNK_SIZE_X / 2;
+    const world::BlockId stone = world::BlockRegistry::instance().stone_id();
+
+    for (int32_t z = 0; z < size; ++z) {
+        for (int32_t x = 0; x < size; ++x) {
+            world_manager.set_block(world::WorldBlockPos(x, floor_y, z), stone);
+            const bool edge = x == 0 || z == 0 || x == size - 1 || z == size - 1;
+            for (int32_t y = floor_y + 1; y <= floor_y + wall_height; ++y) {
+                world_manager.set_block(world::WorldBlockPos(x, y, z), edge ? stone : world::BLOCK_AIR);
+            }
+        }
+    }
+
+    const world::WorldBlockPos source(size / 2, floor_y + wall_height, size / 2);
+    const double tick = fluid->get_config().update_interval;
+    const auto ticks = static_cast<int32_t>(state.range(0));
+    size_t water_blocks = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (int32_t z = 1; z < size - 1; ++z) {
+            for (int32_t x = 1; x < size - 1; ++x) {
+                for (int32_t y = floor_y + 1; y <= floor_y + wall_height; ++y) {
+                    world_manager.set_block(world::WorldBlockPos(x, y, z), world::BLOCK_AIR);
+                }
+            }
+        }
+        fluid->place_water(source, fluid->get_config().full_level, true);
+        state.ResumeTiming();
+
+        for (int32_t i = 0; i < ticks; ++i) {
+            fluid->update(tick);
+        }
+
+        state.PauseTiming();
+        water_blocks = fluid->get_stats().active_water_blocks;
+        state.ResumeTiming();
+    }
+    state.counters["active_water_blocks"] = static_cast<double>(water_blocks);
+}
+BENCHMARK(BM_FluidFlood)->ArgName("ticks")->Arg(20)->Arg(100)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace realcraft::benchmarks
@@ -0,0 +1,198 @@
+// RealCraft Benchmarks
+// voxel_benchmark.cpp - VoxelStorage and Chunk access micro-benchmarks
+
+#include "benchmark_fixtures.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <realcraft/world/block.hpp>
+
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace realcraft::benchmarks {
+namespace {
+
+constexpr int64_t VOXELS_PER_CHUNK = static_cast<int64_t>(world::CHUNK_VOLUME);
+
+// Fixed pseudo-random access pattern (same indices every run)
+const std::vector<size_t>& random_indices() {
+    static const std::vector<size_t> indices = [] {
+        std::mt19937 rng(BENCHMARK_SEED);
+        std::uniform_int_distribution<size_t> dist(0, world::CHUNK_VOLUME - 1);
+        std::vector<size_t> result(4096);
+        for (size_t& index : result) {
+            index = dist(rng);
+        }
+        return result;
+    }();
+    return indices;
+}
+
+// ============================================================================
+// VoxelStorage
+// ============================================================================
+
+void BM_VoxelStorageGetSequential(benchmark::State& state) {
+    world::VoxelStorage storage = copy_storage(GeneratedChunks::instance().center());
+    for (auto _ : state) {
+        uint32_t sum = 0;
+        for (size_t i = 0; i < world::CHUNK_VOLUME; ++i) {
+            sum += storage.get(i).block_id;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * VOXELS_PER_CHUNK);
+}
+BENCHMARK(BM_VoxelStorageGetSequential);
+
+void BM_VoxelStorageGetRandom(benchmark::State& state) {
+    world::VoxelStorage storage = copy_storage(GeneratedChunks::instance().center());
+    const std::vector<size_t>& indices = random_indices();
+    for (auto _ : state) {
+        uint32_t sum = 0;
+        for (size_t index : indices) {
+            sum += storage.get(index).block_id;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(indices.size()));
+}
+BENCHMARK(BM_VoxelStorageGetRandom);
+
+void BM_VoxelStorageSetRandom(benchmark::State& state) {
+    world::VoxelStorage storage = copy_storage(GeneratedChunks::instance().center());
+    const std::vector<size_t>& indices = random_indices();
+    const world::PaletteEntry stone = world::PaletteEntry::from_block(world::BlockRegistry::instance().stone_id());
+    const world::PaletteEntry air = world::PaletteEntry::air();
+    bool place = true;
+    for (auto _ : state) {
+        // Alternate so the palette stays stable across iterations
+        const world::PaletteEntry& entry = place ? stone : air;
+        for (size_t index : indices) {
+            storage.set(index, entry);
+        }
+        place = !place;
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(indices.size()));
+}
+BENCHMARK(BM_VoxelStorageSetRandom);
+
+void BM_VoxelStorageFill(benchmark::State& state) {
+    world::VoxelStorage storage;
+    const world::PaletteEntry stone = world::PaletteEntry::from_block(world::BlockRegistry::instance().stone_id());
+    for (auto _ : state) {
+        storage.fill(stone);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * VOXELS_PER_CHUNK);
+}
+BENCHMARK(BM_VoxelStorageFill);
+
+void BM_VoxelStorageSerializeRle(benchmark::State& state) {
+    world::VoxelStorage storage = copy_storage(GeneratedChunks::instance().center());
+    size_t bytes = 0;
+    for (auto _ : state) {
+        std::vector<uint8_t> data = storage.serialize_rle();
+        bytes = data.size();
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.counters["payload_bytes"] = static_cast<double>(bytes);
+}
+BENCHMARK(BM_VoxelStorageSerializeRle)->Unit(benchmark::kMicrosecond);
+
+void BM_VoxelStorageDeserializeRle(benchmark::State& state) {
+    const std::vector<uint8_t> data = copy_storage(GeneratedChunks::instance().center()).serialize_rle();
+    world::VoxelStorage storage;
+    for (auto _ : state) {
+        bool ok = storage.deserialize_rle(data);
+        benchmark::DoNotOptimize(ok);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+BENCHMARK(BM_VoxelStorageDeserializeRle)->Unit(benchmark::kMicrosecond);
+
+void BM_VoxelStorageSerializeSections(benchmark::State& state) {
+    world::VoxelStorage storage = copy_storage(GeneratedChunks::instance().center());
+    size_t bytes = 0;
+    for (auto _ : state) {
+        std::vector<uint8_t> data = storage.serialize_sections();
+        bytes = data.size();
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.counters["payload_bytes"] = static_cast<double>(bytes);
+}
+BENCHMARK(BM_VoxelStorageSerializeSections)->Unit(benchmark::kMicrosecond);
+
+// ============================================================================
+// Chunk Access (per-call locking vs one held lock)
+// ============================================================================
+
+void BM_ChunkGetBlockLocked(benchmark::State& state) {
+    const world::Chunk& chunk = GeneratedChunks::instance().center();
+    for (auto _ : state) {
+        uint32_t sum = 0;
+        for (int32_t y = 0; y < world::CHUNK_SIZE_Y; ++y) {
+            for (int32_t z = 0; z < world::CHUNK_SIZE_Z; ++z) {
+                for (int32_t x = 0; x < world::CHUNK_SIZE_X; ++x) {
+                    sum += chunk.get_block(world::LocalBlockPos(x, y, z));
+                }
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * VOXELS_PER_CHUNK);
+}
+BENCHMARK(BM_ChunkGetBlockLocked)->Unit(benchmark::kMicrosecond);
+
+void BM_ChunkGetBlockBatch(benchmark::State& state) {
+    const world::Chunk& chunk = GeneratedChunks::instance().center();
+    for (auto _ : state) {
+        uint32_t sum = 0;
+        auto lock = chunk.read_lock();
+        for (int32_t y = 0; y < world::CHUNK_SIZE_Y; ++y) {
+            for (int32_t z = 0; z < world::CHUNK_SIZE_Z; ++z) {
+                for (int32_t x = 0; x < world::CHUNK_SIZE_X; ++x) {
+                    sum += lock.get_block(world::LocalBlockPos(x, y, z));
+                }
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * VOXELS_PER_CHUNK);
+}
+BENCHMARK(BM_ChunkGetBlockBatch)->Unit(benchmark::kMicrosecond);
+
+void BM_ChunkReadRegion(benchmark::State& state) {
+    const world::Chunk& chunk = GeneratedChunks::instance().center();
+    std::vector<world::BlockId> blocks(world::CHUNK_VOLUME);
+    const world::LocalBlockPos max(world::CHUNK_SIZE_X - 1, world::CHUNK_SIZE_Y - 1, world::CHUNK_SIZE_Z - 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(chunk.read_region(world::LocalBlockPos(0, 0, 0), max, std::span(blocks)));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * VOXELS_PER_CHUNK);
+}
+BENCHMARK(BM_ChunkReadRegion)->Unit(benchmark::kMicrosecond);
+
+// One column of 16^3 boxes, as a subchunk mesher would read them
+void BM_ChunkReadRegionSubchunk(benchmark::State& state) {
+    const world::Chunk& chunk = GeneratedChunks::instance().center();
+    constexpr int32_t SIZE = world::SUBCHUNK_SIZE;
+    std::vector<world::BlockId> blocks(static_cast<size_t>(SIZE * SIZE * SIZE));
+    for (auto _ : state) {
+        for (int32_t y = 0; y < world::CHUNK_SIZE_Y; y += SIZE) {
+            const world::LocalBlockPos min(SIZE, y, 0);
+            benchmark::DoNotOptimize(
+                chunk.read_region(min, min + world::LocalBlockPos(SIZE - 1, SIZE - 1, SIZE - 1), std::span(blocks)));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * VOXELS_PER_CHUNK / 4);
+}
+BENCHMARK(BM_ChunkReadRegionSubchunk)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace realcraft::benchmarks
@@ -0,0 +1,172 @@
+// RealCraft Engine Core Tests
+// logger_test.cpp - Tests for the asynchronous logger
+
+#include <gtest/gtest.h>
+
+#include <realcraft/core/logger.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace realcraft::core {
+namespace {
+
+constexpr const char* TEST_CATEGORY = "logtest";
+
+class LoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override { log_dir_ = std::filesystem::temp_directory_path() / "realcraft_logger_test"; }
+
+    void TearDown() override {
+        Logger::shutdown();
+        std::error_code ec;
+        std::filesystem::remove_all(log_dir_, ec);
+    }
+
+    void start(LoggerConfig config = {}) {
+        config.log_directory = log_dir_;
+        config.file_level = LogLevel::Trace;
+        Logger::initialize(config);
+
+        // Keep the console quiet; the test category still reaches the file
+        Logger::set_category_level(TEST_CATEGORY, LogLevel::Debug);
+        Logger::set_global_level(LogLevel::Error);
+    }
+
+    std::string read_log() {
+        Logger::flush();
+        std::ifstream file(log_dir_ / "realcraft.log");
+        std::stringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+
+    static size_t count_occurrences(const std::string& text, const std::string& needle) {
+        size_t count = 0;
+        for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) {
+            ++count;
+        }
+        return count;
+    }
+
+    std::filesystem::path log_dir_;
+};
+
+TEST_F(LoggerTest, FormatsDeferredArguments) {
+    start();
+
+    std::string owned = "owned";
+    const char* literal = "literal";
+    Logger::info(TEST_CATEGORY, "ints {} {} floats {:.2f} strings {} {} {}", 42, -7, 3.14159, owned, literal,
+                 std::string_view("view"));
+    // Not byte-encodable; formatted on the calling thread
+    Logger::info(TEST_CATEGORY, "path {}", std::filesystem::path("a/b").string());
+
+    // The argument must be copied, not referenced, before the call returns
+    owned = "changed";
+
+    std::string log = read_log();
+    EXPECT_NE(log.find("[logtest] ints 42 -7 floats 3.14 strings owned literal view"), std::string::npos);
+    EXPECT_NE(log.find("[logtest] path a/b"), std::string::npos);
+}
+
+TEST_F(LoggerTest, FormatsStringLiteralArguments) {
+    start();
+
+    // Literals arrive as char arrays and must be encoded as strings
+    Logger::info(TEST_CATEGORY, "x {} {} {}", "hello", 7, "");
+    char buffer[] = "mutable";
+    Logger::info(TEST_CATEGORY, "buffer {}", buffer);
+
+    std::string log = read_log();
+    EXPECT_NE(log.find("[logtest] x hello 7 "), std::string::npos);
+    EXPECT_NE(log.find("[logtest] buffer mutable"), std::string::npos);
+}
+
+TEST_F(LoggerTest, CategoryLevelsFilter) {
+    start();
+    Logger::set_category_level("quiet", LogLevel::Error);
+
+    Logger::info("quiet", "hidden message");
+    Logger::error("quiet", "shown message");
+    Logger::debug(TEST_CATEGORY, "debug message");
+
+    EXPECT_EQ(Logger::get_category_level("quiet"), LogLevel::Error);
+    EXPECT_EQ(Logger::get_category_level("unconfigured"), LogLevel::Error);
+
+    std::string log = read_log();
+    EXPECT_EQ(log.find("hidden message"), std::string::npos);
+    EXPECT_NE(log.find("shown message"), std::string::npos);
+    EXPECT_NE(log.find("debug message"), std::string::npos);
+}
+
+TEST_F(LoggerTest, BlockPolicyKeepsEveryMessage) {
+    LoggerConfig config;
+    config.thread_buffer_size = 4 * 1024;
+    config.overflow_policy = LogOverflowPolicy::Block;
+    start(config);
+
+    constexpr int thread_count = 4;
+    constexpr int per_thread = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < per_thread; ++i) {
+                Logger::info(TEST_CATEGORY, "worker {} message {}", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::string log = read_log();
+    EXPECT_EQ(count_occurrences(log, "] worker "), static_cast<size_t>(thread_count * per_thread));
+    EXPECT_EQ(Logger::dropped_message_count(), 0u);
+}
+
+TEST_F(LoggerTest, DropPolicyAccountsForEveryMessage) {
+    LoggerConfig config;
+    config.thread_buffer_size = 4 * 1024;
+    config.overflow_policy = LogOverflowPolicy::Drop;
+    start(config);
+
+    constexpr int message_count = 5000;
+    for (int i = 0; i < message_count; ++i) {
+        Logger::info(TEST_CATEGORY, "burst message {}", i);
+    }
+
+    std::string log = read_log();
+    const size_t written = count_occurrences(log, "] burst message ");
+    EXPECT_EQ(written + Logger::dropped_message_count(), static_cast<size_t>(message_count));
+}
+
+TEST_F(LoggerTest, OversizedRecordsAreWrittenDirectly) {
+    LoggerConfig config;
+    config.thread_buffer_size = 4 * 1024;
+    start(config);
+
+    std::string large(8 * 1024, 'x');
+    Logger::info(TEST_CATEGORY, "large {}", large);
+
+    std::string log = read_log();
+    EXPECT_NE(log.find("large " + large), std::string::npos);
+}
+
+TEST_F(LoggerTest, ShutdownDrainsPendingRecords) {
+    start();
+    Logger::info(TEST_CATEGORY, "last words");
+    Logger::shutdown();
+
+    std::ifstream file(log_dir_ / "realcraft.log");
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_NE(contents.str().find("last words"), std::string::npos);
+}
+
+}  // namespace
+}  // namespace realcraft::core
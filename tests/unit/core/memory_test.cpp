@@ -0,0 +1,211 @@
+// RealCraft Engine Core Tests
+// memory_test.cpp - Tests for memory tracking, arenas and pools
+
+#include <gtest/gtest.h>
+
+#include <realcraft/core/memory.hpp>
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace realcraft::core {
+namespace {
+
+bool is_aligned(const void* ptr, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+
+TEST(ArenaTest, AllocationsAreAlignedAndGrow) {
+    Arena arena(1024);
+    EXPECT_EQ(arena.block_count(), 0u);
+
+    void* a = arena.allocate(3, 1);
+    void* b = arena.allocate(16, 64);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_TRUE(is_aligned(b, 64));
+    EXPECT_EQ(arena.block_count(), 1u);
+
+    // Larger than a block gets a block of its own
+    void* big = arena.allocate(4096);
+    ASSERT_NE(big, nullptr);
+    EXPECT_EQ(arena.block_count(), 2u);
+    EXPECT_GE(arena.used(), 4096u);
+}
+
+TEST(ArenaTest, ScopeReleasesAllocations) {
+    Arena arena(1024);
+    (void)arena.allocate(100);
+    const size_t before = arena.used();
+
+    {
+        ArenaScope scope(arena);
+        ArenaVector<int> values{ArenaAllocator<int>(scope.arena())};
+        for (int i = 0; i < 1000; ++i) {
+            values.push_back(i);
+        }
+        EXPECT_EQ(values[999], 999);
+        EXPECT_GT(arena.used(), before);
+    }
+
+    EXPECT_EQ(arena.used(), before);
+}
+
+TEST(ArenaTest, ResetMergesBlocks) {
+    Arena arena(256);
+    for (int i = 0; i < 20; ++i) {
+        (void)arena.allocate(100);
+    }
+    EXPECT_GT(arena.block_count(), 1u);
+
+    // The next frame of the same size fits in one block
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0u);
+    for (int i = 0; i < 20; ++i) {
+        (void)arena.allocate(100);
+    }
+    EXPECT_EQ(arena.block_count(), 1u);
+
+    // A warmed-up arena only rewinds
+    arena.reset();
+    EXPECT_EQ(arena.block_count(), 1u);
+    EXPECT_EQ(arena.used(), 0u);
+}
+
+TEST(ArenaTest, FrameArenaResetsOnNewFrame) {
+    reset_frame_arenas();
+    Arena& arena = get_frame_arena();
+    (void)arena.allocate(64);
+    EXPECT_GT(get_frame_arena().used(), 0u);
+
+    reset_frame_arenas();
+    EXPECT_EQ(get_frame_arena().used(), 0u);
+    EXPECT_EQ(&get_frame_arena(), &arena);
+}
+
+TEST(PoolAllocatorTest, ReusesFreedBlocks) {
+    PoolAllocator pool(24, 4);
+    EXPECT_GE(pool.block_size(), 24u);
+    EXPECT_EQ(pool.block_size() % alignof(std::max_align_t), 0u);
+
+    void* a = pool.allocate();
+    void* b = pool.allocate();
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(pool.in_use(), 2u);
+    EXPECT_EQ(pool.capacity(), 4u);
+
+    pool.deallocate(a);
+    EXPECT_EQ(pool.allocate(), a);
+
+    // Running out of blocks adds a slab
+    for (int i = 0; i < 3; ++i) {
+        (void)pool.allocate();
+    }
+    EXPECT_EQ(pool.capacity(), 8u);
+
+    pool.deallocate(a);
+    pool.deallocate(b);
+    EXPECT_EQ(pool.in_use(), 3u);
+}
+
+TEST(PoolAllocatorTest, ConcurrentAllocation) {
+    PoolAllocator pool(32, 16);
+    constexpr int THREADS = 4;
+    constexpr int PER_THREAD = 500;
+
+    std::vector<std::vector<void*>> results(THREADS);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&pool, &out = results[static_cast<size_t>(t)]] {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                out.push_back(pool.allocate());
+                if (i % 3 == 0) {
+                    pool.deallocate(out.back());
+                    out.pop_back();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::set<void*> unique;
+    for (const auto& out : results) {
+        unique.insert(out.begin(), out.end());
+    }
+    size_t live = 0;
+    for (const auto& out : results) {
+        live += out.size();
+    }
+    EXPECT_EQ(unique.size(), live);
+    EXPECT_EQ(pool.in_use(), live);
+
+    for (const auto& out : results) {
+        for (void* ptr : out) {
+            pool.deallocate(ptr);
+        }
+    }
+    EXPECT_EQ(pool.in_use(), 0u);
+}
+
+TEST(MemoryTrackerTest, CountsAcrossThreads) {
+    MemoryTracker::initialize();
+    MemoryTracker::reset_stats();
+    const auto before = MemoryTracker::get_stats().categories[static_cast<size_t>(MemoryCategory::Gameplay)];
+
+    constexpr int THREADS = 4;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < 1000; ++i) {
+                MemoryTracker::record_allocation(MemoryCategory::Gameplay, 16);
+            }
+            for (int i = 0; i < 400; ++i) {
+                MemoryTracker::record_deallocation(MemoryCategory::Gameplay, 16);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Counts from exited threads are kept
+    const MemoryStats stats = MemoryTracker::get_stats();
+    const auto& gameplay = stats.categories[static_cast<size_t>(MemoryCategory::Gameplay)];
+    EXPECT_EQ(gameplay.total_allocations - before.total_allocations, 4000u);
+    EXPECT_EQ(gameplay.total_deallocations - before.total_deallocations, 1600u);
+    EXPECT_EQ(gameplay.active_allocations - before.active_allocations, 2400u);
+    EXPECT_EQ(gameplay.active_bytes - before.active_bytes, 2400u * 16u);
+    EXPECT_GE(stats.peak_bytes, stats.active_bytes);
+
+    for (int i = 0; i < 2400; ++i) {
+        MemoryTracker::record_deallocation(MemoryCategory::Gameplay, 16);
+    }
+    EXPECT_EQ(MemoryTracker::get_stats().categories[static_cast<size_t>(MemoryCategory::Gameplay)].active_bytes,
+              before.active_bytes);
+    MemoryTracker::shutdown();
+}
+
+TEST(MemoryTrackerTest, ArenaReportsItsBlocks) {
+    MemoryTracker::initialize();
+    const auto arena_bytes = [] {
+        return MemoryTracker::get_stats().categories[static_cast<size_t>(MemoryCategory::Arena)].active_bytes;
+    };
+    const size_t before = arena_bytes();
+
+    {
+        Arena arena(4096);
+        (void)arena.allocate(16);
+        EXPECT_EQ(arena_bytes() - before, 4096u);
+    }
+    EXPECT_EQ(arena_bytes(), before);
+    MemoryTracker::shutdown();
+}
+
+}  // namespace
+}  // namespace realcraft::core
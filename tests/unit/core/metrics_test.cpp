@@ -0,0 +1,123 @@
+// RealCraft Engine Core Tests
+// metrics_test.cpp - Tests for the runtime metrics registry
+
+#include <gtest/gtest.h>
+
+#include <realcraft/core/metrics.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace realcraft::core {
+namespace {
+
+TEST(MetricsTest, CounterAndGauge) {
+    Counter& counter = MetricsRegistry::instance().counter("test.counter");
+    Gauge& gauge = MetricsRegistry::instance().gauge("test.gauge");
+    counter.reset();
+    gauge.reset();
+
+    counter.add();
+    counter.add(4);
+    gauge.set(10);
+    gauge.add(-3);
+
+    EXPECT_EQ(counter.value(), 5u);
+    EXPECT_EQ(gauge.value(), 7);
+
+    // Same name resolves to the same metric
+    EXPECT_EQ(&MetricsRegistry::instance().counter("test.counter"), &counter);
+}
+
+TEST(MetricsTest, HistogramBucketsCoverRange) {
+    EXPECT_EQ(Histogram::bucket_index(0), 0u);
+    EXPECT_EQ(Histogram::bucket_index(7), 7u);
+    EXPECT_EQ(Histogram::bucket_index(UINT64_MAX), Histogram::BUCKET_COUNT - 1);
+    EXPECT_EQ(Histogram::bucket_upper_bound(Histogram::BUCKET_COUNT - 1), UINT64_MAX);
+
+    for (uint64_t value : {8ull, 9ull, 100ull, 1000ull, 123456ull, 1ull << 40}) {
+        const size_t index = Histogram::bucket_index(value);
+        EXPECT_LE(value, Histogram::bucket_upper_bound(index));
+        EXPECT_GT(value, Histogram::bucket_upper_bound(index - 1));
+    }
+}
+
+TEST(MetricsTest, HistogramPercentiles) {
+    Histogram histogram;
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        histogram.record(i);
+    }
+
+    HistogramSummary summary = histogram.summary();
+    EXPECT_EQ(summary.count, 1000u);
+    EXPECT_EQ(summary.min, 1u);
+    EXPECT_EQ(summary.max, 1000u);
+    EXPECT_DOUBLE_EQ(summary.mean(), 500.5);
+
+    // Within one sub-bucket (12.5%) of the exact quantile
+    EXPECT_NEAR(static_cast<double>(summary.p50), 500.0, 500.0 / Histogram::SUB_BUCKETS);
+    EXPECT_NEAR(static_cast<double>(summary.p99), 990.0, 990.0 / Histogram::SUB_BUCKETS);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.summary().count, 0u);
+    EXPECT_EQ(histogram.percentile(0.5), 0u);
+}
+
+TEST(MetricsTest, ConcurrentRecording) {
+    Histogram& histogram = MetricsRegistry::instance().histogram("test.concurrent_us");
+    Counter& counter = MetricsRegistry::instance().counter("test.concurrent");
+    histogram.reset();
+    counter.reset();
+
+    constexpr int thread_count = 4;
+    constexpr int per_thread = 10000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&histogram, &counter] {
+            for (int i = 0; i < per_thread; ++i) {
+                histogram.record(static_cast<uint64_t>(i));
+                counter.add();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter.value(), static_cast<uint64_t>(thread_count * per_thread));
+    HistogramSummary summary = histogram.summary();
+    EXPECT_EQ(summary.count, static_cast<uint64_t>(thread_count * per_thread));
+    EXPECT_EQ(summary.max, static_cast<uint64_t>(per_thread - 1));
+}
+
+TEST(MetricsTest, SnapshotIsSortedAndSearchable) {
+    MetricsRegistry& registry = MetricsRegistry::instance();
+    registry.counter("test.b").add(2);
+    registry.counter("test.a").add(1);
+    registry.histogram("test.latency_us").record(250);
+
+    MetricsSnapshot snapshot = registry.snapshot();
+    for (size_t i = 1; i < snapshot.counters.size(); ++i) {
+        EXPECT_LT(snapshot.counters[i - 1].name, snapshot.counters[i].name);
+    }
+
+    const uint64_t* b = snapshot.find_counter("test.b");
+    ASSERT_NE(b, nullptr);
+    EXPECT_GE(*b, 2u);
+    EXPECT_EQ(snapshot.find_counter("test.missing"), nullptr);
+
+    const HistogramSummary* latency = snapshot.find_histogram("test.latency_us");
+    ASSERT_NE(latency, nullptr);
+    EXPECT_GE(latency->count, 1u);
+
+    std::string text = snapshot.to_text();
+    EXPECT_NE(text.find("counter test.a "), std::string::npos);
+    EXPECT_NE(text.find("histogram test.latency_us count="), std::string::npos);
+
+    registry.reset();
+    EXPECT_EQ(registry.counter("test.b").value(), 0u);
+}
+
+}  // namespace
+}  // namespace realcraft::core
@@ -0,0 +1,104 @@
+// RealCraft Engine Core Tests
+// profiler_test.cpp - Tests for the profiling zone recorder
+
+#include <gtest/gtest.h>
+
+#include <realcraft/core/profiler.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace realcraft::core {
+namespace {
+
+class ProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ProfilerConfig config;
+        config.events_per_thread = 64;
+        Profiler::initialize(config);
+    }
+
+    void TearDown() override { Profiler::shutdown(); }
+};
+
+TEST_F(ProfilerTest, RecordsNestedZones) {
+    {
+        ProfileScope outer("outer");
+        ProfileScope inner("inner");
+    }
+    EXPECT_EQ(Profiler::event_count(), 4u);
+
+    std::string trace = Profiler::to_chrome_trace();
+    EXPECT_NE(trace.find("\"name\":\"outer\",\"ph\":\"B\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"inner\",\"ph\":\"E\""), std::string::npos);
+}
+
+TEST_F(ProfilerTest, CountersAndThreadNames) {
+    Profiler::set_thread_name("Main \"Thread\"");
+    Profiler::counter("loaded_chunks", 42.0);
+
+    std::string trace = Profiler::to_chrome_trace();
+    EXPECT_NE(trace.find("\"args\":{\"name\":\"Main \\\"Thread\\\"\"}"), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"C\""), std::string::npos);
+    EXPECT_NE(trace.find("\"value\":42"), std::string::npos);
+}
+
+TEST_F(ProfilerTest, RingKeepsMostRecentEvents) {
+    for (int i = 0; i < 200; ++i) {
+        Profiler::counter("tick", static_cast<double>(i));
+    }
+    EXPECT_EQ(Profiler::event_count(), 64u);
+
+    std::string trace = Profiler::to_chrome_trace();
+    EXPECT_NE(trace.find("\"value\":199"), std::string::npos);
+    EXPECT_EQ(trace.find("\"value\":100}"), std::string::npos);
+}
+
+TEST_F(ProfilerTest, DropsEndsWhoseBeginWasOverwritten) {
+    Profiler::begin_zone("long");
+    for (int i = 0; i < 100; ++i) {
+        Profiler::counter("tick", 0.0);
+    }
+    Profiler::end_zone("long");
+
+    std::string trace = Profiler::to_chrome_trace();
+    EXPECT_EQ(trace.find("\"name\":\"long\""), std::string::npos);
+}
+
+TEST_F(ProfilerTest, CaptureToggleAndClear) {
+    Profiler::set_capturing(false);
+    Profiler::begin_zone("ignored");
+    EXPECT_EQ(Profiler::event_count(), 0u);
+
+    Profiler::set_capturing(true);
+    Profiler::begin_zone("kept");
+    EXPECT_EQ(Profiler::event_count(), 1u);
+
+    Profiler::clear();
+    EXPECT_EQ(Profiler::event_count(), 0u);
+}
+
+TEST_F(ProfilerTest, RecordsFromManyThreads) {
+    constexpr int thread_count = 4;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([] {
+            Profiler::set_thread_name("Worker");
+            for (int i = 0; i < 10; ++i) {
+                ProfileScope scope("work");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(Profiler::event_count(), static_cast<size_t>(thread_count * 20));
+    std::string trace = Profiler::to_chrome_trace();
+    EXPECT_NE(trace.find("\"tid\":4"), std::string::npos);
+}
+
+}  // namespace
+}  // namespace realcraft::core
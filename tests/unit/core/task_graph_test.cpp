@@ -0,0 +1,187 @@
+// RealCraft Engine Core Tests
+// task_graph_test.cpp - Tests for the frame task graph
+
+#include <gtest/gtest.h>
+
+#include <realcraft/core/metrics.hpp>
+#include <realcraft/core/task_graph.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace realcraft::core {
+namespace {
+
+TaskDesc make_desc(std::string name, std::vector<std::string> reads, std::vector<std::string> writes,
+                   TaskPhase phase = TaskPhase::Update) {
+    TaskDesc desc;
+    desc.name = std::move(name);
+    desc.phase = phase;
+    desc.reads = std::move(reads);
+    desc.writes = std::move(writes);
+    return desc;
+}
+
+class TaskGraphTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TaskGraphConfig config;
+        config.worker_threads = 2;
+        graph_.configure(config);
+    }
+
+    // Thread-safe record of the order tasks ran in
+    void record(const std::string& name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        order_.push_back(name);
+    }
+
+    size_t position(const std::string& name) const {
+        return static_cast<size_t>(std::find(order_.begin(), order_.end(), name) - order_.begin());
+    }
+
+    TaskGraph graph_;
+    std::mutex mutex_;
+    std::vector<std::string> order_;
+};
+
+TEST_F(TaskGraphTest, DerivesDependenciesFromResources) {
+    const TaskId writer = graph_.add_task(make_desc("writer", {}, {"world"}), [](double) {});
+    const TaskId reader_a = graph_.add_task(make_desc("reader_a", {"world"}, {}), [](double) {});
+    const TaskId reader_b = graph_.add_task(make_desc("reader_b", {"world"}, {"hud"}), [](double) {});
+    const TaskId rewriter = graph_.add_task(make_desc("rewriter", {}, {"world"}), [](double) {});
+    const TaskId unrelated = graph_.add_task(make_desc("unrelated", {"audio"}, {"mixer"}), [](double) {});
+
+    EXPECT_TRUE(graph_.get_dependencies(writer).empty());
+    EXPECT_EQ(graph_.get_dependencies(reader_a), (std::vector<std::string>{"writer"}));
+    EXPECT_EQ(graph_.get_dependencies(reader_b), (std::vector<std::string>{"writer"}));  // Readers share
+    EXPECT_EQ(graph_.get_dependencies(rewriter), (std::vector<std::string>{"writer", "reader_a", "reader_b"}));
+    EXPECT_TRUE(graph_.get_dependencies(unrelated).empty());
+}
+
+TEST_F(TaskGraphTest, RunsConflictingTasksInOrder) {
+    for (int round = 0; round < 20; ++round) {
+        order_.clear();
+        graph_.clear();
+        (void)graph_.add_task(make_desc("generate", {}, {"world"}), [this](double) { record("generate"); });
+        (void)graph_.add_task(make_desc("entities", {"world"}, {"entities"}), [this](double) { record("entities"); });
+        (void)graph_.add_task(make_desc("lighting", {"world"}, {"light"}), [this](double) { record("lighting"); });
+        (void)graph_.add_task(make_desc("hud", {"entities", "light"}, {}), [this](double) { record("hud"); });
+
+        graph_.run(TaskPhase::Update, 0.016);
+
+        ASSERT_EQ(order_.size(), 4u);
+        EXPECT_LT(position("generate"), position("entities"));
+        EXPECT_LT(position("generate"), position("lighting"));
+        EXPECT_LT(position("entities"), position("hud"));
+        EXPECT_LT(position("lighting"), position("hud"));
+    }
+}
+
+TEST_F(TaskGraphTest, IndependentTasksOverlap) {
+    // Each task waits until the other has started, which only finishes if they run concurrently
+    std::atomic<int> started{0};
+    auto rendezvous = [&started](double) {
+        started.fetch_add(1);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (started.load() < 2 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    };
+    (void)graph_.add_task(make_desc("physics", {}, {"physics"}), rendezvous);
+    (void)graph_.add_task(make_desc("fluids", {}, {"fluids"}), rendezvous);
+
+    const auto start = std::chrono::steady_clock::now();
+    graph_.run(TaskPhase::Update, 0.016);
+    EXPECT_EQ(started.load(), 2);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(4));
+}
+
+TEST_F(TaskGraphTest, MainThreadTasksRunOnCaller) {
+    const auto caller = std::this_thread::get_id();
+    std::thread::id seen;
+    auto desc = make_desc("upload", {}, {"gpu"});
+    desc.main_thread = true;
+    (void)graph_.add_task(desc, [&seen](double) { seen = std::this_thread::get_id(); });
+    (void)graph_.add_task(make_desc("side", {}, {"other"}), [](double) {});
+
+    graph_.run(TaskPhase::Update, 0.016);
+    EXPECT_EQ(seen, caller);
+}
+
+TEST_F(TaskGraphTest, DeterministicModeRunsInRegistrationOrder) {
+    graph_.set_deterministic(true);
+    const auto caller = std::this_thread::get_id();
+    bool all_on_caller = true;
+    for (const char* name : {"c", "a", "b"}) {
+        (void)graph_.add_task(make_desc(name, {}, {name}), [&, name](double) {
+            record(name);
+            all_on_caller = all_on_caller && std::this_thread::get_id() == caller;
+        });
+    }
+
+    graph_.run(TaskPhase::Update, 0.016);
+    EXPECT_EQ(order_, (std::vector<std::string>{"c", "a", "b"}));
+    EXPECT_TRUE(all_on_caller);
+}
+
+TEST_F(TaskGraphTest, PhasesRunSeparately) {
+    int fixed = 0;
+    int update = 0;
+    (void)graph_.add_task(make_desc("step", {}, {"physics"}, TaskPhase::FixedUpdate), [&fixed](double) { ++fixed; });
+    (void)graph_.add_task(make_desc("frame", {}, {"physics"}), [&update](double) { ++update; });
+
+    EXPECT_EQ(graph_.task_count(TaskPhase::FixedUpdate), 1u);
+    EXPECT_EQ(graph_.task_count(TaskPhase::Update), 1u);
+
+    graph_.run(TaskPhase::FixedUpdate, 1.0 / 60.0);
+    graph_.run(TaskPhase::FixedUpdate, 1.0 / 60.0);
+    EXPECT_EQ(fixed, 2);
+    EXPECT_EQ(update, 0);
+}
+
+TEST_F(TaskGraphTest, RejectsDuplicateNamesAndRemovesTasks) {
+    int runs = 0;
+    const TaskId id = graph_.add_task(make_desc("items", {}, {"items"}), [&runs](double) { ++runs; });
+    ASSERT_NE(id, INVALID_TASK_ID);
+    EXPECT_EQ(graph_.add_task(make_desc("items", {}, {}), [](double) {}), INVALID_TASK_ID);
+    EXPECT_EQ(graph_.add_task(make_desc("", {}, {}), [](double) {}), INVALID_TASK_ID);
+
+    graph_.remove_task(id);
+    graph_.run(TaskPhase::Update, 0.016);
+    EXPECT_EQ(runs, 0);
+    EXPECT_EQ(graph_.task_count(TaskPhase::Update), 0u);
+}
+
+TEST_F(TaskGraphTest, ThrowingTaskDoesNotStallDependents) {
+    bool dependent_ran = false;
+    (void)graph_.add_task(make_desc("broken", {}, {"state"}), [](double) { throw std::runtime_error("boom"); });
+    (void)graph_.add_task(make_desc("after", {"state"}, {}), [&dependent_ran](double) { dependent_ran = true; });
+
+    graph_.run(TaskPhase::Update, 0.016);
+    EXPECT_TRUE(dependent_ran);
+}
+
+TEST_F(TaskGraphTest, ExportsTimings) {
+    Histogram& histogram = MetricsRegistry::instance().histogram("task.timed_us");
+    histogram.reset();
+    (void)graph_.add_task(make_desc("timed", {}, {"x"}),
+                          [](double) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+
+    graph_.run(TaskPhase::Update, 0.016);
+
+    const auto timings = graph_.get_timings();
+    ASSERT_EQ(timings.size(), 1u);
+    EXPECT_EQ(timings[0].name, "timed");
+    EXPECT_GE(timings[0].last_us, 1000u);
+    EXPECT_EQ(histogram.summary().count, 1u);
+}
+
+}  // namespace
+}  // namespace realcraft::core
@@ -0,0 +1,110 @@
+// RealCraft Unit Tests
+// input_recording_test.cpp - Tests for the input recording file format
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <realcraft/gameplay/input_recording.hpp>
+
+namespace realcraft::gameplay {
+namespace {
+
+class InputRecordingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir_ = std::filesystem::temp_directory_path() / "realcraft_input_recording_test";
+        std::filesystem::remove_all(dir_);
+        path_ = dir_ / "session.rcreplay";
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir_); }
+
+    static InputFrame make_frame(int i) {
+        InputFrame frame;
+        frame.move_direction = glm::vec3(static_cast<float>(i), 0.0f, -1.0f);
+        frame.camera_pitch = -20.0f + static_cast<float>(i);
+        frame.camera_yaw = 90.0f;
+        frame.buttons = static_cast<uint8_t>(i % 2 == 0 ? input_button::JUMP | input_button::PRIMARY : 0);
+        frame.hotbar_slot = static_cast<uint8_t>(i % 9);
+        return frame;
+    }
+
+    std::filesystem::path dir_;
+    std::filesystem::path path_;
+};
+
+TEST_F(InputRecordingTest, RoundTrip) {
+    RecordingHeader header;
+    header.world_seed = 12345;
+    header.gameplay_seed = 777;
+    header.view_distance = 4;
+    header.spawn_position = glm::dvec3(1.5, 80.0, -2.25);
+    header.camera_pitch = -20.0f;
+    header.camera_yaw = -90.0f;
+
+    {
+        InputRecorder recorder;
+        ASSERT_TRUE(recorder.start(path_, header));
+        for (int i = 0; i < 150; ++i) {
+            recorder.record(make_frame(i));
+        }
+        EXPECT_EQ(recorder.frame_count(), 150u);
+    }
+
+    auto recording = load_input_recording(path_);
+    ASSERT_TRUE(recording.has_value());
+    EXPECT_EQ(recording->header.world_seed, 12345u);
+    EXPECT_EQ(recording->header.gameplay_seed, 777u);
+    EXPECT_EQ(recording->header.view_distance, 4);
+    EXPECT_DOUBLE_EQ(recording->header.fixed_timestep, 1.0 / 60.0);
+    EXPECT_DOUBLE_EQ(recording->header.spawn_position.z, -2.25);
+    EXPECT_FLOAT_EQ(recording->header.camera_yaw, -90.0f);
+
+    ASSERT_EQ(recording->frames.size(), 150u);
+    for (int i = 0; i < 150; ++i) {
+        const InputFrame expected = make_frame(i);
+        const InputFrame& frame = recording->frames[static_cast<size_t>(i)];
+        EXPECT_FLOAT_EQ(frame.move_direction.x, expected.move_direction.x);
+        EXPECT_FLOAT_EQ(frame.camera_pitch, expected.camera_pitch);
+        EXPECT_EQ(frame.buttons, expected.buttons);
+        EXPECT_EQ(frame.hotbar_slot, expected.hotbar_slot);
+    }
+    EXPECT_TRUE(recording->frames[0].has(input_button::JUMP));
+    EXPECT_FALSE(recording->frames[1].has(input_button::JUMP));
+}
+
+TEST_F(InputRecordingTest, TornTailIsDropped) {
+    {
+        InputRecorder recorder;
+        ASSERT_TRUE(recorder.start(path_, {}));
+        for (int i = 0; i < 3; ++i) {
+            recorder.record(make_frame(i));
+        }
+    }
+
+    // Half a frame, as left by a crash mid-write
+    std::ofstream(path_, std::ios::binary | std::ios::app).write("\x01\x02\x03", 3);
+
+    auto recording = load_input_recording(path_);
+    ASSERT_TRUE(recording.has_value());
+    EXPECT_EQ(recording->frames.size(), 3u);
+}
+
+TEST_F(InputRecordingTest, RejectsOtherFiles) {
+    EXPECT_FALSE(load_input_recording(path_).has_value());
+
+    std::filesystem::create_directories(dir_);
+    std::ofstream(path_, std::ios::binary) << std::string(128, 'x');
+    EXPECT_FALSE(load_input_recording(path_).has_value());
+}
+
+TEST_F(InputRecordingTest, RecordWithoutStartIsIgnored) {
+    InputRecorder recorder;
+    EXPECT_FALSE(recorder.is_recording());
+    recorder.record(make_frame(0));
+    EXPECT_EQ(recorder.frame_count(), 0u);
+}
+
+}  // namespace
+}  // namespace realcraft::gameplay
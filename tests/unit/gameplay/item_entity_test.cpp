@@ -0,0 +1,207 @@
+// RealCraft Unit Tests
+// item_entity_test.cpp - Tests for dropped item entities
+
+#include <gtest/gtest.h>
+
+#include <realcraft/gameplay/item_entity.hpp>
+#include <realcraft/world/block.hpp>
+#include <realcraft/world/world_manager.hpp>
+#include <vector>
+
+namespace realcraft::gameplay {
+namespace {
+
+class ItemEntityTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Ensure blocks and items are registered
+        world::BlockRegistry::instance().register_defaults();
+        ItemRegistry::instance().register_defaults();
+
+        stone_ = ItemRegistry::instance().find_id("realcraft:stone").value_or(ITEM_NONE);
+        dirt_ = ItemRegistry::instance().find_id("realcraft:dirt").value_or(ITEM_NONE);
+        ASSERT_NE(stone_, ITEM_NONE);
+        ASSERT_NE(dirt_, ITEM_NONE);
+
+        inventory_.initialize();
+    }
+
+    void TearDown() override {
+        manager_.shutdown();
+        inventory_.shutdown();
+    }
+
+    // No world or physics: entities stay where they are spawned
+    void init(size_t max_entities = 500) {
+        ItemEntityConfig config;
+        config.max_entities = max_entities;
+        config.enable_physics = false;
+        ASSERT_TRUE(manager_.initialize(nullptr, nullptr, &inventory_, config));
+    }
+
+    static constexpr glm::dvec3 FAR_AWAY{1000.0, 0.0, 1000.0};
+
+    ItemId stone_ = ITEM_NONE;
+    ItemId dirt_ = ITEM_NONE;
+    Inventory inventory_;
+    ItemEntityManager manager_;
+};
+
+TEST_F(ItemEntityTest, SpawnAndFind) {
+    init();
+    uint32_t id = manager_.spawn_item({1.0, 2.0, 3.0}, ItemStack{stone_, 5, 0});
+    ASSERT_NE(id, 0u);
+    EXPECT_EQ(manager_.entity_count(), 1u);
+
+    auto entity = manager_.find_entity(id);
+    ASSERT_TRUE(entity.has_value());
+    EXPECT_EQ(entity->position, glm::dvec3(1.0, 2.0, 3.0));
+    EXPECT_EQ(entity->item.count, 5);
+    EXPECT_FALSE(entity->can_pickup);
+}
+
+TEST_F(ItemEntityTest, RecycledSlotInvalidatesOldId) {
+    init();
+    uint32_t first = manager_.spawn_item({0.0, 0.0, 0.0}, ItemStack{stone_, 1, 0});
+    manager_.remove_entity(first);
+    EXPECT_FALSE(manager_.find_entity(first).has_value());
+
+    uint32_t second = manager_.spawn_item({0.0, 0.0, 0.0}, ItemStack{dirt_, 1, 0});
+    EXPECT_NE(first, second);
+    EXPECT_FALSE(manager_.find_entity(first).has_value());
+    ASSERT_TRUE(manager_.find_entity(second).has_value());
+    EXPECT_EQ(manager_.find_entity(second)->item.item_id, dirt_);
+
+    // Removing through a stale ID must not touch the new entity
+    manager_.remove_entity(first);
+    EXPECT_EQ(manager_.entity_count(), 1u);
+}
+
+TEST_F(ItemEntityTest, EvictsOldestWhenFull) {
+    init(3);
+    std::vector<uint32_t> ids;
+    for (int i = 0; i < 5; ++i) {
+        ids.push_back(manager_.spawn_item({i * 10.0, 0.0, 0.0}, ItemStack{stone_, 1, 0}));
+    }
+
+    EXPECT_EQ(manager_.entity_count(), 3u);
+    EXPECT_FALSE(manager_.find_entity(ids[0]).has_value());
+    EXPECT_FALSE(manager_.find_entity(ids[1]).has_value());
+
+    std::vector<uint32_t> visited;
+    manager_.for_each_entity([&](const ItemEntity& entity) { visited.push_back(entity.id); });
+    EXPECT_EQ(visited, (std::vector<uint32_t>{ids[2], ids[3], ids[4]}));
+}
+
+TEST_F(ItemEntityTest, MergesNearbyIdenticalItems) {
+    init();
+    uint32_t a = manager_.spawn_item({0.0, 0.0, 0.0}, ItemStack{stone_, 3, 0});
+    (void)manager_.spawn_item({0.3, 0.0, 0.0}, ItemStack{stone_, 4, 0});
+    (void)manager_.spawn_item({0.0, 0.0, 0.2}, ItemStack{dirt_, 1, 0});  // Different item
+    (void)manager_.spawn_item({3.0, 0.0, 0.0}, ItemStack{stone_, 1, 0});  // Too far
+
+    // Nothing merges during the pickup delay
+    manager_.update(0.1, FAR_AWAY);
+    EXPECT_EQ(manager_.entity_count(), 4u);
+
+    manager_.update(1.0, FAR_AWAY);
+    EXPECT_EQ(manager_.entity_count(), 3u);
+    ASSERT_TRUE(manager_.find_entity(a).has_value());
+    EXPECT_EQ(manager_.find_entity(a)->item.count, 7);
+}
+
+TEST_F(ItemEntityTest, MergesAcrossCellBoundaries) {
+    init();
+    uint32_t a = manager_.spawn_item({0.9, 0.9, 0.9}, ItemStack{stone_, 1, 0});
+    (void)manager_.spawn_item({1.1, 1.1, 1.1}, ItemStack{stone_, 1, 0});
+    manager_.update(1.0, FAR_AWAY);
+
+    EXPECT_EQ(manager_.entity_count(), 1u);
+    EXPECT_EQ(manager_.find_entity(a)->item.count, 2);
+}
+
+TEST_F(ItemEntityTest, PicksUpNearPlayer) {
+    init();
+    uint32_t near = manager_.spawn_item({1.0, 0.0, 0.0}, ItemStack{stone_, 2, 0});
+    uint32_t far = manager_.spawn_item({10.0, 0.0, 0.0}, ItemStack{dirt_, 2, 0});
+
+    manager_.update(1.0, glm::dvec3(0.0));
+    EXPECT_FALSE(manager_.find_entity(near).has_value());
+    EXPECT_TRUE(manager_.find_entity(far).has_value());
+    EXPECT_EQ(inventory_.count_item(stone_), 2);
+}
+
+TEST_F(ItemEntityTest, ExpiresAfterLifetime) {
+    init();
+    (void)manager_.spawn_item({0.0, 0.0, 0.0}, ItemStack{stone_, 1, 0});
+    manager_.update(200.0, FAR_AWAY);
+    uint32_t young = manager_.spawn_item({5.0, 0.0, 0.0}, ItemStack{stone_, 1, 0});
+
+    manager_.update(150.0, FAR_AWAY);
+    EXPECT_EQ(manager_.entity_count(), 1u);
+    EXPECT_TRUE(manager_.find_entity(young).has_value());
+}
+
+TEST_F(ItemEntityTest, ManyDropsMergePerCluster) {
+    init(10000);
+
+    // 1000 clusters of 4 identical drops, far enough apart not to interact
+    for (int x = 0; x < 10; ++x) {
+        for (int y = 0; y < 10; ++y) {
+            for (int z = 0; z < 10; ++z) {
+                const glm::dvec3 base{x * 4.0, y * 4.0, z * 4.0};
+                for (int i = 0; i < 4; ++i) {
+                    (void)manager_.spawn_item(base + glm::dvec3(i * 0.05), ItemStack{stone_, 1, 0});
+                }
+            }
+        }
+    }
+    EXPECT_EQ(manager_.entity_count(), 4000u);
+
+    manager_.update(1.0, FAR_AWAY);
+    EXPECT_EQ(manager_.entity_count(), 1000u);
+
+    size_t total = 0;
+    manager_.for_each_entity([&](const ItemEntity& entity) { total += entity.item.count; });
+    EXPECT_EQ(total, 4000u);
+}
+
+TEST_F(ItemEntityTest, FallsWhenSupportingBlockIsRemoved) {
+    world::WorldConfig world_config;
+    world_config.name = "item_entity_test";
+    world_config.seed = 42;
+    world_config.view_distance = 1;
+    world_config.enable_saving = false;
+    world_config.generation_threads = 1;
+    world::WorldManager world;
+    ASSERT_TRUE(world.initialize(world_config));
+    ASSERT_NE(world.load_chunk_sync({0, 0}), nullptr);
+
+    // A single block high above the terrain, with an item resting on it
+    const world::WorldBlockPos support{4, 250, 4};
+    world.set_block(support, world::BlockRegistry::instance().stone_id());
+
+    ItemEntityConfig config;
+    config.pickup_delay = 0.0;
+    ASSERT_TRUE(manager_.initialize(nullptr, &world, &inventory_, config));
+    const uint32_t id = manager_.spawn_item({4.5, 251.5, 4.5}, ItemStack{stone_, 1, 0});
+    for (int i = 0; i < 100 && manager_.sleeping_count() == 0; ++i) {
+        manager_.update(0.05, FAR_AWAY);
+    }
+    ASSERT_EQ(manager_.sleeping_count(), 1u);
+    const double resting_y = manager_.find_entity(id)->position.y;
+
+    // Removed through the world, not through block breaking: the observer wakes it
+    world.set_block(support, world::BLOCK_AIR);
+    for (int i = 0; i < 10; ++i) {
+        manager_.update(0.05, FAR_AWAY);
+    }
+    EXPECT_EQ(manager_.sleeping_count(), 0u);
+    EXPECT_LT(manager_.find_entity(id)->position.y, resting_y - 0.5);
+
+    manager_.shutdown();
+    world.shutdown();
+}
+
+}  // namespace
+}  // namespace realcraft::gameplay
@@ -0,0 +1,208 @@
+// RealCraft Graphics Tests
+// shader_cache_test.cpp - Persistent shader cache tests (CPU only)
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <realcraft/graphics/shader_cache.hpp>
+#include <string>
+
+namespace realcraft::graphics {
+namespace {
+
+namespace fs = std::filesystem;
+
+constexpr std::string_view COMPILER_ID = "test-compiler";
+
+CompiledShader make_shader(uint8_t fill, size_t spirv_size = 64) {
+    CompiledShader shader;
+    shader.success = true;
+    shader.spirv_bytecode.assign(spirv_size, fill);
+    shader.msl_source = "fragment float4 main0() { return 1; }";
+    shader.msl_bytecode.assign(shader.msl_source.begin(), shader.msl_source.end());
+    shader.reflection.stage = ShaderStage::Fragment;
+    shader.reflection.entry_point = "main";
+
+    ShaderUniformBuffer ubo;
+    ubo.name = "Uniforms";
+    ubo.binding = 2;
+    ubo.size = 80;
+    ubo.members.push_back({"view_proj", "mat4", 0, 64, 1});
+    ubo.members.push_back({"tint", "vec4", 64, 16, 1});
+    shader.reflection.uniform_buffers.push_back(ubo);
+
+    ShaderSampledImage image;
+    image.name = "atlas";
+    image.binding = 1;
+    image.dimension = TextureType::Texture2DArray;
+    shader.reflection.sampled_images.push_back(image);
+
+    shader.reflection.push_constants.push_back({0, 16, ShaderStage::Fragment, {}});
+    shader.reflection.inputs.push_back({"uv", 0, "vec2"});
+    shader.reflection.outputs.push_back({"color", 0, "vec4"});
+    return shader;
+}
+
+class ShaderCacheTest : public ::testing::Test {
+protected:
+    fs::path dir_;
+
+    void SetUp() override {
+        dir_ = fs::temp_directory_path() / "realcraft_shader_cache_test";
+        fs::remove_all(dir_);
+    }
+
+    void TearDown() override { fs::remove_all(dir_); }
+
+    ShaderCacheConfig config(size_t max_size = 1024 * 1024) const {
+        ShaderCacheConfig result;
+        result.directory = dir_;
+        result.max_size_bytes = max_size;
+        return result;
+    }
+};
+
+TEST_F(ShaderCacheTest, RoundTripsShaderAndReflection) {
+    ShaderCache cache;
+    ASSERT_TRUE(cache.initialize(config()));
+
+    const auto original = make_shader(0xAB);
+    ASSERT_TRUE(cache.store("key", original));
+
+    auto loaded = cache.load("key");
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_TRUE(loaded->success);
+    EXPECT_EQ(loaded->spirv_bytecode, original.spirv_bytecode);
+    EXPECT_EQ(loaded->msl_source, original.msl_source);
+    EXPECT_EQ(loaded->msl_bytecode, original.msl_bytecode);
+
+    const auto& r = loaded->reflection;
+    EXPECT_EQ(r.stage, ShaderStage::Fragment);
+    ASSERT_EQ(r.uniform_buffers.size(), 1u);
+    EXPECT_EQ(r.uniform_buffers[0].binding, 2u);
+    ASSERT_EQ(r.uniform_buffers[0].members.size(), 2u);
+    EXPECT_EQ(r.uniform_buffers[0].members[1].type_name, "vec4");
+    EXPECT_EQ(r.uniform_buffers[0].members[1].offset, 64u);
+    ASSERT_EQ(r.sampled_images.size(), 1u);
+    EXPECT_EQ(r.sampled_images[0].dimension, TextureType::Texture2DArray);
+    ASSERT_EQ(r.push_constants.size(), 1u);
+    EXPECT_EQ(r.push_constants[0].size, 16u);
+    ASSERT_EQ(r.outputs.size(), 1u);
+    EXPECT_EQ(r.outputs[0].name, "color");
+
+    EXPECT_EQ(cache.stats().hits, 1u);
+    EXPECT_FALSE(cache.load("other").has_value());
+    EXPECT_EQ(cache.stats().misses, 1u);
+}
+
+TEST_F(ShaderCacheTest, PersistsAcrossInstances) {
+    {
+        ShaderCache cache;
+        ASSERT_TRUE(cache.initialize(config()));
+        ASSERT_TRUE(cache.store("key", make_shader(1)));
+    }
+
+    ShaderCache reopened;
+    ASSERT_TRUE(reopened.initialize(config()));
+    EXPECT_EQ(reopened.entry_count(), 1u);
+    EXPECT_TRUE(reopened.load("key").has_value());
+}
+
+TEST_F(ShaderCacheTest, DoesNotStoreFailedCompilations) {
+    ShaderCache cache;
+    ASSERT_TRUE(cache.initialize(config()));
+
+    CompiledShader failed;
+    failed.error_message = "syntax error";
+    EXPECT_FALSE(cache.store("key", failed));
+    EXPECT_EQ(cache.entry_count(), 0u);
+}
+
+TEST_F(ShaderCacheTest, DiscardsCorruptEntries) {
+    ShaderCache cache;
+    ASSERT_TRUE(cache.initialize(config()));
+    ASSERT_TRUE(cache.store("key", make_shader(1)));
+
+    {
+        std::ofstream file(dir_ / "key.rcshader", std::ios::binary | std::ios::trunc);
+        file << "garbage";
+    }
+    EXPECT_FALSE(cache.load("key").has_value());
+    EXPECT_EQ(cache.entry_count(), 0u);
+    EXPECT_FALSE(fs::exists(dir_ / "key.rcshader"));
+}
+
+TEST_F(ShaderCacheTest, EvictsLeastRecentlyUsedBeyondBudget) {
+    ShaderCache probe;
+    ASSERT_TRUE(probe.initialize(config()));
+    ASSERT_TRUE(probe.store("probe", make_shader(0, 1024)));
+    const size_t entry_size = probe.size_bytes();
+    probe.clear();
+
+    ShaderCache cache;
+    ASSERT_TRUE(cache.initialize(config(entry_size * 2)));
+    ASSERT_TRUE(cache.store("a", make_shader(1, 1024)));
+    ASSERT_TRUE(cache.store("b", make_shader(2, 1024)));
+
+    // Make "a" clearly the most recently used
+    fs::last_write_time(dir_ / "b.rcshader", fs::file_time_type::clock::now() - std::chrono::hours(1));
+    ASSERT_TRUE(cache.load("a").has_value());
+
+    ASSERT_TRUE(cache.store("c", make_shader(3, 1024)));
+    EXPECT_EQ(cache.entry_count(), 2u);
+    EXPECT_LE(cache.size_bytes(), entry_size * 2);
+    EXPECT_TRUE(cache.load("a").has_value());
+    EXPECT_FALSE(cache.load("b").has_value());
+    EXPECT_TRUE(cache.load("c").has_value());
+    EXPECT_EQ(cache.stats().evictions, 1u);
+}
+
+TEST_F(ShaderCacheTest, KeyCoversSourceOptionsAndCompiler) {
+    ShaderCompileOptions options;
+    options.stage = ShaderStage::Vertex;
+    const std::string base = ShaderCache::compute_key("void main() {}", options, COMPILER_ID);
+
+    EXPECT_EQ(base.size(), 32u);
+    EXPECT_EQ(base, ShaderCache::compute_key("void main() {}", options, COMPILER_ID));
+    EXPECT_NE(base, ShaderCache::compute_key("void main() { }", options, COMPILER_ID));
+    EXPECT_NE(base, ShaderCache::compute_key("void main() {}", options, "other-compiler"));
+
+    auto fragment = options;
+    fragment.stage = ShaderStage::Fragment;
+    EXPECT_NE(base, ShaderCache::compute_key("void main() {}", fragment, COMPILER_ID));
+
+    auto defined = options;
+    defined.defines.push_back("USE_FOG=1");
+    EXPECT_NE(base, ShaderCache::compute_key("void main() {}", defined, COMPILER_ID));
+
+    auto unoptimized = options;
+    unoptimized.optimize = false;
+    EXPECT_NE(base, ShaderCache::compute_key("void main() {}", unoptimized, COMPILER_ID));
+}
+
+TEST_F(ShaderCacheTest, KeyFollowsIncludeClosure) {
+    fs::create_directories(dir_ / "include");
+    auto write = [&](const char* name, const char* text) {
+        std::ofstream file(dir_ / "include" / name, std::ios::trunc);
+        file << text;
+    };
+    write("common.glsl", "#include \"lighting.glsl\"\nfloat a;\n");
+    write("lighting.glsl", "float light;\n");
+
+    ShaderCompileOptions options;
+    options.include_paths.push_back((dir_ / "include").string());
+    const std::string source = "#include \"common.glsl\"\nvoid main() {}\n";
+
+    const std::string before = ShaderCache::compute_key(source, options, COMPILER_ID);
+    write("lighting.glsl", "float light = 1.0;\n");  // Nested include changed
+    const std::string after = ShaderCache::compute_key(source, options, COMPILER_ID);
+    EXPECT_NE(before, after);
+
+    // Cyclic includes terminate
+    write("lighting.glsl", "#include \"common.glsl\"\n");
+    EXPECT_EQ(ShaderCache::compute_key(source, options, COMPILER_ID).size(), 32u);
+}
+
+}  // namespace
+}  // namespace realcraft::graphics
@@ -89,6 +89,11 @@ TEST_F(DebrisSystemTest, SpawnSingleDebris) {
     EXPECT_NE(handle, INVALID_RIGID_BODY);
     EXPECT_TRUE(debris_system->is_debris(handle));
     EXPECT_EQ(debris_system->active_debris_count(), 1u);
+
+    // Contacts classify the body as debris without a lookup
+    const RigidBody* body = physics_world_->get_rigid_body(handle);
+    ASSERT_NE(body, nullptr);
+    EXPECT_TRUE(has_category(body->get_body_categories(), BodyCategory::Debris));
 }
 
 TEST_F(DebrisSystemTest, SpawnDebrisRespectsMaxLimit) {
@@ -3,8 +3,10 @@
 
 #include <gtest/gtest.h>
 
+#include <btBulletDynamicsCommon.h>
 #include <realcraft/physics/physics_world.hpp>
 #include <realcraft/world/block.hpp>
+#include <vector>
 
 namespace realcraft::physics {
 namespace {
@@ -368,5 +370,105 @@ TEST_F(PhysicsWorldTest, CollisionCallback) {
     EXPECT_GE(callback_count, 0);
 }
 
+TEST_F(PhysicsWorldTest, ContactsAreClassified) {
+    PhysicsWorld world;
+    world.initialize(nullptr);
+
+    RigidBodyDesc ground_desc;
+    ground_desc.motion_type = MotionType::Static;
+    ground_desc.half_extents = glm::dvec3(5.0, 0.5, 5.0);
+    RigidBodyHandle ground = world.create_rigid_body(ground_desc);
+
+    RigidBodyDesc box_desc;
+    box_desc.position = glm::dvec3(0.0, 0.95, 0.0);  // Slightly sunk into the ground
+    box_desc.linear_velocity = glm::dvec3(0.0, -2.0, 0.0);
+    RigidBodyHandle box = world.create_rigid_body(box_desc);
+    world.get_rigid_body(box)->add_body_category(BodyCategory::Debris);
+
+    world.fixed_update(1.0 / 60.0);
+
+    auto contacts = world.get_contacts();
+    ASSERT_FALSE(contacts.empty());
+    for (const ContactRecord& contact : contacts) {
+        const bool box_is_a = contact.handle_a == box;
+        const uint32_t box_category = box_is_a ? contact.category_a : contact.category_b;
+        const uint32_t ground_category = box_is_a ? contact.category_b : contact.category_a;
+
+        EXPECT_EQ(box_is_a ? contact.handle_b : contact.handle_a, ground);
+        EXPECT_TRUE(has_category(box_category, BodyCategory::Debris));
+        EXPECT_TRUE(has_category(ground_category, BodyCategory::RigidBody));
+        EXPECT_FALSE(has_category(ground_category, BodyCategory::Debris));
+        EXPECT_GT(contact.penetration_depth, 0.0);
+        EXPECT_GE(contact.normal_velocity, 0.0);
+    }
+
+    // The buffer is rebuilt each step
+    world.destroy_rigid_body(box);
+    world.fixed_update(1.0 / 60.0);
+    EXPECT_TRUE(world.get_contacts().empty());
+}
+
+// ============================================================================
+// Origin Shifting Tests
+// ============================================================================
+
+// True when each body's broadphase leaf still contains its current bounds,
+// so the next step has nothing to refit
+bool broadphase_in_sync(PhysicsWorld& world, const std::vector<RigidBodyHandle>& handles) {
+    const btScalar tolerance = 1e-3f;
+    for (RigidBodyHandle handle : handles) {
+        const btRigidBody* body = world.get_rigid_body(handle)->get_bullet_body();
+        btVector3 min;
+        btVector3 max;
+        body->getCollisionShape()->getAabb(body->getWorldTransform(), min, max);
+
+        const auto* proxy = static_cast<const btDbvtProxy*>(body->getBroadphaseHandle());
+        const btVector3 leaf_min = proxy->leaf->volume.Mins();
+        const btVector3 leaf_max = proxy->leaf->volume.Maxs();
+        for (int axis = 0; axis < 3; ++axis) {
+            if (leaf_min[axis] > min[axis] + tolerance || leaf_max[axis] < max[axis] - tolerance) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+TEST_F(PhysicsWorldTest, OriginShiftNeedsNoBroadphaseRefit) {
+    // The broadphase moves with the bodies however many there are
+    for (int side : {4, 32}) {
+        PhysicsWorld world;
+        world.initialize(nullptr);
+
+        std::vector<RigidBodyHandle> bodies;
+        for (int x = 0; x < side; ++x) {
+            for (int z = 0; z < side; ++z) {
+                RigidBodyDesc desc;
+                desc.motion_type = MotionType::Static;
+                desc.position = glm::dvec3(x * 2.0, 0.0, z * 2.0);
+                bodies.push_back(world.create_rigid_body(desc));
+            }
+        }
+        RigidBodyDesc falling;
+        falling.position = glm::dvec3(0.0, 3.0, 0.0);
+        bodies.push_back(world.create_rigid_body(falling));
+
+        world.fixed_update(1.0 / 60.0);
+        const glm::dvec3 before = world.get_rigid_body(bodies.back())->get_position();
+
+        world.on_origin_shifted(world::WorldBlockPos(0, 0, 0), world::WorldBlockPos(4096, 0, -4096));
+
+        EXPECT_TRUE(broadphase_in_sync(world, bodies)) << side * side << " bodies";
+        const glm::dvec3 after = world.get_rigid_body(bodies.back())->get_position();
+        EXPECT_NEAR(after.x, before.x - 4096.0, 1e-3);
+        EXPECT_NEAR(after.z, before.z + 4096.0, 1e-3);
+        EXPECT_GE(world.get_stats().last_shift_time_ms, 0.0);
+
+        // Simulation carries on in the shifted frame
+        world.fixed_update(1.0 / 60.0);
+        EXPECT_LT(world.get_rigid_body(bodies.back())->get_position().y, before.y);
+    }
+}
+
 }  // namespace
 }  // namespace realcraft::physics
@@ -0,0 +1,135 @@
+// RealCraft Platform Tests
+// asset_archive_test.cpp - Packed asset archive unit tests
+
+#include <gtest/gtest.h>
+
+#include <realcraft/platform/asset_archive.hpp>
+#include <realcraft/platform/file_io.hpp>
+#include <string>
+#include <vector>
+
+using namespace realcraft::platform;
+
+class AssetArchiveTest : public ::testing::Test {
+protected:
+    fs::path test_dir_;
+    fs::path archive_path_;
+
+    void SetUp() override {
+        test_dir_ = FileSystem::get_temp_directory() / "realcraft_archive_test";
+        FileSystem::create_directories(test_dir_);
+        archive_path_ = test_dir_ / "assets.rcpak";
+    }
+
+    void TearDown() override {
+        FileSystem::remove_all(test_dir_);
+    }
+
+    static std::vector<uint8_t> bytes(std::string_view text) {
+        return {text.begin(), text.end()};
+    }
+};
+
+TEST_F(AssetArchiveTest, RoundTripsEntries) {
+    AssetArchiveWriter writer;
+    writer.add("shaders/glsl/basic.vert", bytes("void main() {}"));
+    writer.add("textures/grass.raw", std::vector<uint8_t>(4096, 7));  // Compresses well
+    writer.add("data/empty.json", {});
+    ASSERT_TRUE(writer.write(archive_path_));
+
+    AssetArchive archive;
+    ASSERT_TRUE(archive.open(archive_path_));
+    EXPECT_EQ(archive.entry_count(), 3u);
+
+    auto shader = archive.read("shaders/glsl/basic.vert");
+    ASSERT_TRUE(shader.has_value());
+    EXPECT_EQ(std::string(shader->begin(), shader->end()), "void main() {}");
+
+    auto texture = archive.read("textures/grass.raw");
+    ASSERT_TRUE(texture.has_value());
+    EXPECT_EQ(*texture, std::vector<uint8_t>(4096, 7));
+
+    auto empty = archive.read("data/empty.json");
+    ASSERT_TRUE(empty.has_value());
+    EXPECT_TRUE(empty->empty());
+
+    EXPECT_FALSE(archive.contains("missing.txt"));
+    EXPECT_FALSE(archive.read("missing.txt").has_value());
+}
+
+TEST_F(AssetArchiveTest, ViewsUncompressedEntriesInPlace) {
+    AssetArchiveWriter writer;
+    writer.add("small.txt", bytes("tiny"));
+    writer.add("big.raw", std::vector<uint8_t>(4096, 1));
+    writer.add("raw.bin", std::vector<uint8_t>(4096, 2), false);
+    ASSERT_TRUE(writer.write(archive_path_));
+
+    AssetArchive archive;
+    ASSERT_TRUE(archive.open(archive_path_));
+
+    auto small = archive.view("small.txt");
+    ASSERT_TRUE(small.has_value());
+    EXPECT_EQ(std::string(small->begin(), small->end()), "tiny");
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(small->data()) % ASSET_ARCHIVE_ALIGNMENT, 0u);
+
+    auto info = archive.find("big.raw");
+    ASSERT_TRUE(info.has_value());
+    EXPECT_EQ(info->compression, AssetCompression::Zstd);
+    EXPECT_LT(info->stored_size, info->size);
+    EXPECT_FALSE(archive.view("big.raw").has_value());
+
+    auto raw = archive.view("raw.bin");
+    ASSERT_TRUE(raw.has_value());
+    EXPECT_EQ(raw->size(), 4096u);
+}
+
+TEST_F(AssetArchiveTest, RejectsCorruptArchives) {
+    ASSERT_TRUE(FileSystem::write_binary(archive_path_, std::vector<uint8_t>(64, 0xAB)));
+    AssetArchive archive;
+    EXPECT_FALSE(archive.open(archive_path_));
+    EXPECT_FALSE(archive.is_open());
+    EXPECT_FALSE(archive.open(test_dir_ / "missing.rcpak"));
+}
+
+TEST_F(AssetArchiveTest, PacksDirectories) {
+    auto source = test_dir_ / "source";
+    ASSERT_TRUE(FileSystem::write_text(source / "glsl" / "a.frag", "frag"));
+    ASSERT_TRUE(FileSystem::write_text(source / "b.txt", "b"));
+    ASSERT_TRUE(FileSystem::write_text(source / ".gitkeep", ""));
+
+    AssetArchiveWriter writer;
+    EXPECT_EQ(writer.add_directory(source, "shaders"), 2u);
+    ASSERT_TRUE(writer.write(archive_path_));
+
+    AssetArchive archive;
+    ASSERT_TRUE(archive.open(archive_path_));
+    EXPECT_TRUE(archive.contains("shaders/glsl/a.frag"));
+    EXPECT_TRUE(archive.contains("shaders/b.txt"));
+    EXPECT_FALSE(archive.contains("shaders/.gitkeep"));
+}
+
+TEST_F(AssetArchiveTest, StorePrefersArchiveAndFallsBackToLooseFiles) {
+    auto loose = test_dir_ / "loose";
+    ASSERT_TRUE(FileSystem::write_text(loose / "data" / "blocks.json", "loose"));
+    ASSERT_TRUE(FileSystem::write_text(loose / "data" / "extra.json", "extra"));
+
+    AssetArchiveWriter writer;
+    writer.add("data/blocks.json", bytes("packed"));
+    ASSERT_TRUE(writer.write(archive_path_));
+
+    AssetStoreConfig config;
+    config.archive_path = archive_path_;
+    config.loose_root = loose;
+    config.allow_loose_files = true;
+
+    AssetStore store;
+    ASSERT_TRUE(store.initialize(config));
+    EXPECT_TRUE(store.has_archive());
+    EXPECT_EQ(store.read_text("data/blocks.json"), "packed");
+    EXPECT_EQ(store.read_text("data/extra.json"), "extra");
+
+    config.allow_loose_files = false;
+    ASSERT_TRUE(store.initialize(config));
+    EXPECT_FALSE(store.exists("data/extra.json"));
+    EXPECT_FALSE(store.read_binary("data/extra.json").has_value());
+}
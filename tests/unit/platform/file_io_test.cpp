@@ -4,8 +4,10 @@
 #include <gtest/gtest.h>
 #include <realcraft/platform/file_io.hpp>
 
+#include <atomic>
 #include <cstdlib>
 #include <fstream>
+#include <thread>
 
 using namespace realcraft::platform;
 
@@ -200,3 +202,72 @@ TEST_F(ResourceCacheTest, CurrentSize) {
     cache_.put("key2", data);
     EXPECT_EQ(cache_.current_size(), 200u);
 }
+
+TEST_F(ResourceCacheTest, EvictsLeastRecentlyUsed) {
+    cache_.set_max_size(300);
+    std::vector<uint8_t> data(100, 0);
+    cache_.put("a", data);
+    cache_.put("b", data);
+    cache_.put("c", data);
+
+    // Touch "a" so "b" becomes the oldest entry
+    EXPECT_TRUE(cache_.get("a").has_value());
+    cache_.put("d", data);
+
+    EXPECT_TRUE(cache_.get("a").has_value());
+    EXPECT_FALSE(cache_.get("b").has_value());
+    EXPECT_TRUE(cache_.get("c").has_value());
+    EXPECT_TRUE(cache_.get("d").has_value());
+    EXPECT_EQ(cache_.entry_count(), 3u);
+    EXPECT_EQ(cache_.current_size(), 300u);
+}
+
+TEST_F(ResourceCacheTest, HandleOutlivesEviction) {
+    cache_.put("key1", std::vector<uint8_t>{7, 8, 9});
+    auto handle = cache_.get("key1");
+    ASSERT_TRUE(handle);
+
+    cache_.invalidate("key1");
+    EXPECT_FALSE(cache_.get("key1"));
+    ASSERT_EQ(handle.size(), 3u);
+    EXPECT_EQ(handle.span()[2], 9);
+}
+
+TEST_F(ResourceCacheTest, GetOrLoadRunsLoaderOnce) {
+    std::atomic<int> loads{0};
+    auto loader = [&loads]() -> std::optional<std::vector<uint8_t>> {
+        loads.fetch_add(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return std::vector<uint8_t>(64, 1);
+    };
+
+    std::vector<std::thread> threads;
+    std::atomic<int> hits{0};
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&] {
+            if (cache_.get_or_load("shared", loader).size() == 64) {
+                hits.fetch_add(1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(loads.load(), 1);
+    EXPECT_EQ(hits.load(), 8);
+    EXPECT_EQ(cache_.entry_count(), 1u);
+}
+
+TEST_F(ResourceCacheTest, FailedLoadIsNotCached) {
+    int loads = 0;
+    auto failing = [&loads]() -> std::optional<std::vector<uint8_t>> {
+        ++loads;
+        return std::nullopt;
+    };
+
+    EXPECT_FALSE(cache_.get_or_load("missing", failing));
+    EXPECT_FALSE(cache_.get_or_load("missing", failing));
+    EXPECT_EQ(loads, 2);
+    EXPECT_EQ(cache_.entry_count(), 0u);
+}
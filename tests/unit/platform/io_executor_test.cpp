@@ -0,0 +1,165 @@
+// RealCraft Platform Tests
+// io_executor_test.cpp - I/O thread pool unit tests
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <realcraft/platform/file_io.hpp>
+#include <realcraft/platform/io_executor.hpp>
+#include <thread>
+#include <vector>
+
+using namespace realcraft::platform;
+
+TEST(IoExecutorTest, RunsSubmittedTasks) {
+    IoExecutor executor(IoExecutorConfig{2});
+    EXPECT_EQ(executor.thread_count(), 2u);
+
+    std::atomic<int> ran{0};
+    for (int i = 0; i < 50; ++i) {
+        executor.submit([&ran] { ran.fetch_add(1); });
+    }
+    executor.wait_idle();
+    EXPECT_EQ(ran.load(), 50);
+    EXPECT_EQ(executor.queued_count(), 0u);
+}
+
+TEST(IoExecutorTest, HigherPriorityRunsFirst) {
+    IoExecutor executor(IoExecutorConfig{1});
+
+    // Hold the only worker so everything else queues up behind it
+    std::promise<void> started;
+    std::promise<void> gate;
+    std::shared_future<void> gate_future = gate.get_future().share();
+    executor.submit([&started, gate_future] {
+        started.set_value();
+        gate_future.wait();
+    });
+    started.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<int> order;
+    auto record = [&](int value) {
+        return [&, value] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(value);
+        };
+    };
+    executor.submit(record(3), IoPriority::Low);
+    executor.submit(record(2), IoPriority::Normal);
+    executor.submit(record(1), IoPriority::High);
+
+    gate.set_value();
+    executor.wait_idle();
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(IoExecutorTest, CancelledTasksAreDropped) {
+    IoExecutor executor(IoExecutorConfig{1});
+
+    std::promise<void> started;
+    std::promise<void> gate;
+    std::shared_future<void> gate_future = gate.get_future().share();
+    executor.submit([&started, gate_future] {
+        started.set_value();
+        gate_future.wait();
+    });
+    started.get_future().wait();
+
+    auto token = CancellationToken::create();
+    std::atomic<int> ran{0};
+    std::vector<IoExecutor::Task> batch(10, [&ran] { ran.fetch_add(1); });
+    executor.submit_batch(std::move(batch), IoPriority::Normal, token);
+    EXPECT_EQ(executor.queued_count(), 10u);
+
+    token.cancel();
+    gate.set_value();
+    executor.wait_idle();
+    EXPECT_EQ(ran.load(), 0);
+}
+
+TEST(IoExecutorTest, DefaultTokenIsNeverCancelled) {
+    CancellationToken token;
+    token.cancel();
+    EXPECT_FALSE(token.is_cancelled());
+
+    auto cancellable = CancellationToken::create();
+    auto copy = cancellable;
+    copy.cancel();
+    EXPECT_TRUE(cancellable.is_cancelled());
+}
+
+TEST(IoExecutorTest, CompletionQueueRunsOnDrainingThread) {
+    CompletionQueue queue;
+    std::thread::id callback_thread;
+    queue.post([&callback_thread] { callback_thread = std::this_thread::get_id(); });
+
+    EXPECT_EQ(queue.pending(), 1u);
+    EXPECT_EQ(queue.drain(), 1u);
+    EXPECT_EQ(callback_thread, std::this_thread::get_id());
+    EXPECT_EQ(queue.pending(), 0u);
+}
+
+class FileSystemAsyncTest : public ::testing::Test {
+protected:
+    fs::path test_dir_;
+
+    void SetUp() override {
+        test_dir_ = FileSystem::get_temp_directory() / "realcraft_io_test";
+        FileSystem::create_directories(test_dir_);
+    }
+
+    void TearDown() override {
+        FileSystem::remove_all(test_dir_);
+    }
+};
+
+TEST_F(FileSystemAsyncTest, FutureRead) {
+    auto path = test_dir_ / "data.txt";
+    ASSERT_TRUE(FileSystem::write_text(path, "hello"));
+
+    auto result = FileSystem::read_text_async(path).get();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, "hello");
+}
+
+TEST_F(FileSystemAsyncTest, CancelledReadCompletesEmpty) {
+    auto path = test_dir_ / "data.bin";
+    ASSERT_TRUE(FileSystem::write_binary(path, std::vector<uint8_t>{1, 2, 3}));
+
+    IoRequestOptions options;
+    options.token = CancellationToken::create();
+    options.token.cancel();
+    EXPECT_FALSE(FileSystem::read_binary_async(path, options).get().has_value());
+}
+
+TEST_F(FileSystemAsyncTest, BatchDeliversThroughCompletionQueue) {
+    std::vector<fs::path> paths;
+    for (int i = 0; i < 16; ++i) {
+        paths.push_back(test_dir_ / ("file_" + std::to_string(i) + ".bin"));
+        ASSERT_TRUE(FileSystem::write_binary(paths.back(), std::vector<uint8_t>(static_cast<size_t>(i + 1), 0)));
+    }
+
+    CompletionQueue queue;
+    IoRequestOptions options;
+    options.completion_queue = &queue;
+
+    size_t delivered = 0;
+    size_t total_bytes = 0;
+    FileSystem::read_binary_batch_async(
+        paths,
+        [&](const fs::path&, FileSystem::BinaryResult result) {
+            ++delivered;
+            total_bytes += result ? result->size() : 0;
+        },
+        options);
+
+    IoExecutor::shared().wait_idle();
+    EXPECT_EQ(delivered, 0u);  // Nothing runs until the owner drains
+
+    EXPECT_EQ(queue.drain(), 16u);
+    EXPECT_EQ(delivered, 16u);
+    EXPECT_EQ(total_bytes, 136u);
+}
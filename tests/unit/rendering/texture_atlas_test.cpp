@@ -0,0 +1,198 @@
+// RealCraft Rendering Tests
+// texture_atlas_test.cpp - Unit tests for TextureAtlas baking and the baked cache
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <realcraft/rendering/texture_atlas.hpp>
+#include <string>
+#include <vector>
+
+namespace realcraft::rendering::test {
+
+class TextureAtlasTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        desc_.atlas_size = 64;
+        desc_.tile_size = 4;
+        desc_.padding = 2;
+        desc_.max_layers = 2;
+
+        test_dir_ = std::filesystem::temp_directory_path() / "realcraft_atlas_test";
+        std::filesystem::remove_all(test_dir_);
+        std::filesystem::create_directories(test_dir_);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(test_dir_); }
+
+    // Texel (x, y) of a layer at the given mip level
+    static const uint8_t* texel(const TextureAtlas& atlas, uint32_t level, uint32_t layer, uint32_t x, uint32_t y) {
+        const uint32_t size = atlas.get_atlas_size() >> level;
+        const size_t offset = ((static_cast<size_t>(layer) * size + y) * size + x) * 4;
+        return atlas.get_baked_level(level).data() + offset;
+    }
+
+    // 4x4 tile with a distinct colour per texel
+    static std::vector<uint8_t> gradient_tile() {
+        std::vector<uint8_t> data(4 * 4 * 4);
+        for (size_t i = 0; i < 16; i++) {
+            data[i * 4 + 0] = static_cast<uint8_t>(i * 16);
+            data[i * 4 + 1] = static_cast<uint8_t>(255 - i * 16);
+            data[i * 4 + 2] = 7;
+            data[i * 4 + 3] = 255;
+        }
+        return data;
+    }
+
+    TextureAtlasDesc desc_;
+    std::filesystem::path test_dir_;
+};
+
+TEST_F(TextureAtlasTest, BakesWithoutDevice) {
+    TextureAtlas atlas(nullptr, desc_);
+    EXPECT_NE(atlas.add_solid_color("red", 255, 0, 0), UINT16_MAX);
+    EXPECT_NE(atlas.add_solid_color("green", 0, 255, 0), UINT16_MAX);
+
+    ASSERT_TRUE(atlas.bake());
+    EXPECT_TRUE(atlas.is_baked());
+    EXPECT_FALSE(atlas.is_built());
+    EXPECT_EQ(atlas.get_texture_count(), 2u);
+    EXPECT_EQ(atlas.get_layer_count(), 1u);
+
+    // Padding of 2 keeps tiles texel aligned for exactly one extra level
+    EXPECT_EQ(atlas.get_mip_levels(), 2u);
+    EXPECT_EQ(atlas.get_baked_level(0).size(), 64u * 64u * 4u);
+    EXPECT_EQ(atlas.get_baked_level(1).size(), 32u * 32u * 4u);
+    EXPECT_TRUE(atlas.get_baked_level(2).empty());
+
+    // Cannot add textures once baked
+    EXPECT_EQ(atlas.add_solid_color("blue", 0, 0, 255), UINT16_MAX);
+}
+
+TEST_F(TextureAtlasTest, PaddingRepeatsEdgeTexels) {
+    TextureAtlas atlas(nullptr, desc_);
+    const auto tile = gradient_tile();
+    ASSERT_EQ(atlas.add_texture("gradient", 4, 4, tile), 0);
+    ASSERT_TRUE(atlas.bake());
+
+    // The tile sits at (2, 2); the whole padded block repeats its edges
+    const uint8_t* corner = texel(atlas, 0, 0, 0, 0);
+    EXPECT_EQ(corner[0], tile[0]);
+    EXPECT_EQ(corner[1], tile[1]);
+
+    const uint8_t* right_edge = texel(atlas, 0, 0, 7, 3);
+    const size_t source = (1 * 4 + 3) * 4;  // Texel (3, 1) of the tile
+    EXPECT_EQ(right_edge[0], tile[source]);
+    EXPECT_EQ(right_edge[1], tile[source + 1]);
+
+    const uint8_t* inside = texel(atlas, 0, 0, 3, 4);
+    const size_t inside_source = (2 * 4 + 1) * 4;  // Texel (1, 2) of the tile
+    EXPECT_EQ(inside[0], tile[inside_source]);
+}
+
+TEST_F(TextureAtlasTest, MipsAverageInLinearSpace) {
+    TextureAtlas atlas(nullptr, desc_);
+
+    // Black and white checkerboard at texel granularity
+    std::vector<uint8_t> checker(4 * 4 * 4);
+    for (size_t y = 0; y < 4; y++) {
+        for (size_t x = 0; x < 4; x++) {
+            const uint8_t value = (x + y) % 2 == 0 ? 255 : 0;
+            const size_t i = (y * 4 + x) * 4;
+            checker[i + 0] = checker[i + 1] = checker[i + 2] = value;
+            checker[i + 3] = 255;
+        }
+    }
+    ASSERT_EQ(atlas.add_texture("checker", 4, 4, checker), 0);
+    ASSERT_EQ(atlas.add_solid_color("solid", 200, 100, 50, 128), 1);
+    ASSERT_TRUE(atlas.bake());
+
+    // 50% linear coverage is ~188 in sRGB, not 128
+    const uint8_t* grey = texel(atlas, 1, 0, 1, 1);
+    EXPECT_NEAR(grey[0], 188, 1);
+    EXPECT_EQ(grey[3], 255);
+
+    // The second tile starts at x = 10, i.e. 5 at level 1; solid colours survive
+    const uint8_t* solid = texel(atlas, 1, 0, 5, 1);
+    EXPECT_NEAR(solid[0], 200, 1);
+    EXPECT_NEAR(solid[1], 100, 1);
+    EXPECT_NEAR(solid[2], 50, 1);
+    EXPECT_EQ(solid[3], 128);
+}
+
+TEST_F(TextureAtlasTest, OverflowingLayersFails) {
+    desc_.atlas_size = 16;
+    desc_.max_layers = 1;
+    TextureAtlas atlas(nullptr, desc_);
+    for (int i = 0; i < 5; i++) {  // Four padded tiles fit per layer
+        (void)atlas.add_solid_color("tile" + std::to_string(i), 0, 0, 0);
+    }
+    EXPECT_FALSE(atlas.bake());
+    EXPECT_FALSE(atlas.is_baked());
+}
+
+TEST_F(TextureAtlasTest, BakedRoundTrip) {
+    const auto path = test_dir_ / "atlas.rcatlas";
+    {
+        TextureAtlas atlas(nullptr, desc_);
+        (void)atlas.add_texture("gradient", 4, 4, gradient_tile());
+        (void)atlas.add_solid_color("blue", 0, 0, 255);
+        ASSERT_TRUE(atlas.bake());
+        ASSERT_TRUE(atlas.save_baked(path, 42));
+    }
+
+    TextureAtlas source(nullptr, desc_);
+    (void)source.add_texture("gradient", 4, 4, gradient_tile());
+    (void)source.add_solid_color("blue", 0, 0, 255);
+    ASSERT_TRUE(source.bake());
+
+    TextureAtlas loaded(nullptr, desc_);
+    ASSERT_TRUE(loaded.load_baked(path, 42));
+    EXPECT_TRUE(loaded.is_baked());
+    EXPECT_EQ(loaded.get_texture_count(), 2u);
+    EXPECT_EQ(loaded.get_layer_count(), 1u);
+    EXPECT_EQ(loaded.get_mip_levels(), source.get_mip_levels());
+    EXPECT_EQ(loaded.find_index("blue"), std::optional<uint16_t>(1));
+
+    for (uint32_t level = 0; level < source.get_mip_levels(); level++) {
+        const auto expected = source.get_baked_level(level);
+        const auto actual = loaded.get_baked_level(level);
+        ASSERT_EQ(actual.size(), expected.size());
+        EXPECT_TRUE(std::equal(actual.begin(), actual.end(), expected.begin()));
+    }
+
+    const auto expected_uv = source.get_uv_rect(1);
+    const auto actual_uv = loaded.get_uv_rect(1);
+    EXPECT_FLOAT_EQ(actual_uv.x, expected_uv.x);
+    EXPECT_FLOAT_EQ(actual_uv.w, expected_uv.w);
+}
+
+TEST_F(TextureAtlasTest, LoadRejectsStaleOrMismatchedFiles) {
+    const auto path = test_dir_ / "atlas.rcatlas";
+    {
+        TextureAtlas atlas(nullptr, desc_);
+        (void)atlas.add_solid_color("red", 255, 0, 0);
+        ASSERT_TRUE(atlas.bake());
+        ASSERT_TRUE(atlas.save_baked(path, 1));
+    }
+
+    TextureAtlas wrong_key(nullptr, desc_);
+    EXPECT_FALSE(wrong_key.load_baked(path, 2));
+    EXPECT_FALSE(wrong_key.is_baked());
+
+    auto other_desc = desc_;
+    other_desc.tile_size = 8;
+    TextureAtlas wrong_settings(nullptr, other_desc);
+    EXPECT_FALSE(wrong_settings.load_baked(path, 1));
+
+    TextureAtlas missing(nullptr, desc_);
+    EXPECT_FALSE(missing.load_baked(test_dir_ / "missing.rcatlas", 1));
+
+    // Truncated file
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+    TextureAtlas truncated(nullptr, desc_);
+    EXPECT_FALSE(truncated.load_baked(path, 1));
+}
+
+}  // namespace realcraft::rendering::test
@@ -0,0 +1,164 @@
+// RealCraft World System Tests
+// block_change_journal_test.cpp - Tests for BlockChangeJournal
+
+#include <gtest/gtest.h>
+
+#include <realcraft/world/block_change_journal.hpp>
+
+namespace realcraft::world {
+namespace {
+
+PaletteEntry entry(BlockId id, BlockStateId state = 0) {
+    return PaletteEntry{id, state};
+}
+
+TEST(BlockChangeJournalTest, StartsEmptyAndUpToDate) {
+    BlockChangeJournal journal;
+    const uint64_t start = journal.version();
+
+    ChunkDelta delta = journal.changes_since(start);
+    EXPECT_FALSE(delta.snapshot_required);
+    EXPECT_TRUE(delta.changes.empty());
+    EXPECT_EQ(delta.version, start);
+    EXPECT_EQ(journal.size(), 0u);
+}
+
+TEST(BlockChangeJournalTest, ReturnsChangesInOrder) {
+    BlockChangeJournal journal;
+    const uint64_t start = journal.version();
+
+    journal.record(10, entry(0), entry(1));
+    const uint64_t middle = journal.version();
+    journal.record(20, entry(2), entry(3));
+    EXPECT_GT(journal.version(), middle);
+    EXPECT_GT(middle, start);
+
+    ChunkDelta all = journal.changes_since(start);
+    ASSERT_FALSE(all.snapshot_required);
+    ASSERT_EQ(all.changes.size(), 2u);
+    EXPECT_EQ(all.changes[0].index, 10u);
+    EXPECT_EQ(all.changes[0].old_entry, entry(0));
+    EXPECT_EQ(all.changes[0].new_entry, entry(1));
+    EXPECT_EQ(all.changes[1].index, 20u);
+    EXPECT_EQ(all.version, journal.version());
+
+    ChunkDelta later = journal.changes_since(middle);
+    ASSERT_EQ(later.changes.size(), 1u);
+    EXPECT_EQ(later.changes[0].index, 20u);
+}
+
+TEST(BlockChangeJournalTest, CoalescesRepeatedWrites) {
+    BlockChangeJournal journal;
+    const uint64_t start = journal.version();
+
+    journal.record(5, entry(0), entry(1));
+    journal.record(6, entry(0), entry(7));
+    const uint64_t between = journal.version();
+    journal.record(5, entry(1), entry(2));
+    journal.record(5, entry(2), entry(3));
+
+    // One entry per block, keeping the state before the first write
+    ChunkDelta delta = journal.changes_since(start);
+    ASSERT_EQ(delta.changes.size(), 2u);
+    EXPECT_EQ(delta.changes[0].index, 6u);
+    EXPECT_EQ(delta.changes[1].index, 5u);
+    EXPECT_EQ(delta.changes[1].old_entry, entry(0));
+    EXPECT_EQ(delta.changes[1].new_entry, entry(3));
+
+    // A caller between the writes still sees the latest state
+    ChunkDelta recent = journal.changes_since(between);
+    ASSERT_EQ(recent.changes.size(), 1u);
+    EXPECT_EQ(recent.changes[0].index, 5u);
+    EXPECT_EQ(recent.changes[0].new_entry, entry(3));
+}
+
+TEST(BlockChangeJournalTest, HotBlockDoesNotEvictOthers) {
+    BlockChangeJournal journal(4);
+    const uint64_t start = journal.version();
+
+    journal.record(1, entry(0), entry(1));
+    journal.record(2, entry(0), entry(1));
+    for (int i = 0; i < 100; ++i) {
+        journal.record(3, entry(static_cast<BlockId>(i)), entry(static_cast<BlockId>(i + 1)));
+    }
+
+    ChunkDelta delta = journal.changes_since(start);
+    ASSERT_FALSE(delta.snapshot_required);
+    ASSERT_EQ(delta.changes.size(), 3u);
+    EXPECT_EQ(delta.changes[2].old_entry, entry(0));
+    EXPECT_EQ(delta.changes[2].new_entry, entry(100));
+}
+
+TEST(BlockChangeJournalTest, AlternatingWritesDoNotEvictOthers) {
+    BlockChangeJournal journal(4);
+    const uint64_t start = journal.version();
+
+    journal.record(7, entry(0), entry(9));
+    for (int i = 0; i < 50; ++i) {
+        journal.record(1, entry(static_cast<BlockId>(i)), entry(static_cast<BlockId>(i + 1)));
+        journal.record(2, entry(static_cast<BlockId>(i)), entry(static_cast<BlockId>(i + 1)));
+    }
+    EXPECT_LE(journal.size(), journal.capacity());
+
+    ChunkDelta delta = journal.changes_since(start);
+    ASSERT_FALSE(delta.snapshot_required);
+    ASSERT_EQ(delta.changes.size(), 3u);
+    EXPECT_EQ(delta.changes[0].index, 7u);
+    EXPECT_EQ(delta.changes[0].new_entry, entry(9));
+    EXPECT_EQ(delta.changes[1].index, 1u);
+    EXPECT_EQ(delta.changes[1].old_entry, entry(0));
+    EXPECT_EQ(delta.changes[1].new_entry, entry(50));
+    EXPECT_EQ(delta.changes[2].index, 2u);
+    EXPECT_EQ(delta.changes[2].new_entry, entry(50));
+}
+
+TEST(BlockChangeJournalTest, OverflowRequiresSnapshot) {
+    BlockChangeJournal journal(4);
+    const uint64_t start = journal.version();
+
+    journal.record(0, entry(0), entry(1));
+    const uint64_t after_first = journal.version();
+    for (uint32_t i = 1; i < 5; ++i) {
+        journal.record(i, entry(0), entry(1));
+    }
+    EXPECT_EQ(journal.size(), 4u);
+
+    EXPECT_TRUE(journal.changes_since(start).snapshot_required);
+
+    // Versions from the dropped entry on are still answerable
+    EXPECT_EQ(journal.oldest_version(), after_first);
+    ChunkDelta delta = journal.changes_since(after_first);
+    ASSERT_FALSE(delta.snapshot_required);
+    EXPECT_EQ(delta.changes.size(), 4u);
+}
+
+TEST(BlockChangeJournalTest, InvalidateRequiresSnapshot) {
+    BlockChangeJournal journal;
+    journal.record(1, entry(0), entry(1));
+    const uint64_t before = journal.version();
+
+    journal.invalidate();
+    EXPECT_GT(journal.version(), before);
+    EXPECT_TRUE(journal.changes_since(before).snapshot_required);
+    EXPECT_EQ(journal.size(), 0u);
+
+    // Recording resumes from the new version
+    const uint64_t fresh = journal.version();
+    journal.record(2, entry(0), entry(1));
+    EXPECT_EQ(journal.changes_since(fresh).changes.size(), 1u);
+}
+
+TEST(BlockChangeJournalTest, VersionsAreUniqueAcrossJournals) {
+    BlockChangeJournal first;
+    first.record(1, entry(0), entry(1));
+    const uint64_t old_version = first.version();
+
+    // A new journal (e.g. a reloaded chunk) never answers an old version
+    BlockChangeJournal second;
+    EXPECT_GT(second.version(), old_version);
+    EXPECT_TRUE(second.changes_since(old_version).snapshot_required);
+    EXPECT_TRUE(second.changes_since(second.version() + 1).snapshot_required);
+}
+
+}  // namespace
+}  // namespace realcraft::world
@@ -0,0 +1,287 @@
+// RealCraft World System Tests
+// block_tick_scheduler_test.cpp - Tests for scheduled and random block ticks
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <realcraft/world/block.hpp>
+#include <realcraft/world/block_tick_scheduler.hpp>
+#include <realcraft/world/world_manager.hpp>
+#include <vector>
+
+namespace realcraft::world {
+namespace {
+
+BlockId ticker_block() {
+    BlockTypeDesc desc;
+    desc.name = "test:ticker";
+    desc.display_name = "Ticker";
+    desc.flags = BlockFlags::Solid | BlockFlags::FullCube;
+    return BlockRegistry::instance().register_block(desc);  // Returns the existing ID on repeat calls
+}
+
+class BlockTickSchedulerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        BlockRegistry::instance().register_defaults();
+        ticker = ticker_block();
+
+        WorldConfig config;
+        config.name = "block_tick_test";
+        config.seed = 42;
+        config.view_distance = 1;
+        config.enable_saving = false;
+        config.generation_threads = 1;
+        ASSERT_TRUE(world.initialize(config));
+        ASSERT_NE(world.load_chunk_sync({0, 0}), nullptr);
+    }
+
+    void TearDown() override {
+        BlockRegistry::instance().set_tick_callback(ticker, {});
+        world.shutdown();
+    }
+
+    // Count ticks and remember where they happened
+    void record_ticks() {
+        BlockRegistry::instance().set_tick_callback(ticker, [this](const WorldBlockPos& pos, BlockId, double) {
+            std::lock_guard<std::mutex> lock(ticked_mutex);
+            ticked.push_back(pos);
+        });
+    }
+
+    size_t tick_count() {
+        std::lock_guard<std::mutex> lock(ticked_mutex);
+        return ticked.size();
+    }
+
+    // Fill the 16^3 section at chunk-local section origin (sx, sy, sz)
+    void fill_section(const ChunkPos& chunk, int sx, int sy, int sz, BlockId id) {
+        for (int y = 0; y < 16; ++y) {
+            for (int z = 0; z < 16; ++z) {
+                for (int x = 0; x < 16; ++x) {
+                    world.set_block(local_to_world(chunk, {sx * 16 + x, sy * 16 + y, sz * 16 + z}), id);
+                }
+            }
+        }
+    }
+
+    WorldManager world;
+    BlockId ticker = BLOCK_INVALID;
+    std::mutex ticked_mutex;
+    std::vector<WorldBlockPos> ticked;
+};
+
+TEST_F(BlockTickSchedulerTest, ScheduledTickFiresAfterDelay) {
+    record_ticks();
+    BlockTickConfig config;
+    config.random_ticks_per_section = 0;
+    BlockTickScheduler scheduler;
+    ASSERT_TRUE(scheduler.initialize(&world, config));
+
+    const WorldBlockPos pos(5, 200, 7);
+    world.set_block(pos, ticker);
+    scheduler.schedule_tick(pos, 3);
+    EXPECT_TRUE(scheduler.has_scheduled_tick(pos));
+
+    scheduler.tick();
+    scheduler.tick();
+    EXPECT_EQ(tick_count(), 0u);
+    scheduler.tick();
+    ASSERT_EQ(tick_count(), 1u);
+    EXPECT_EQ(ticked[0], pos);
+    EXPECT_EQ(scheduler.get_stats().last_scheduled_ticks, 1u);
+    EXPECT_FALSE(scheduler.has_scheduled_tick(pos));
+    EXPECT_EQ(scheduler.get_stats().pending_scheduled, 0u);
+}
+
+TEST_F(BlockTickSchedulerTest, LongDelaysCascadeThroughWheelLevels) {
+    BlockTickConfig config;
+    config.random_ticks_per_section = 0;
+    BlockTickScheduler scheduler;
+    ASSERT_TRUE(scheduler.initialize(&world, config));
+
+    const std::vector<uint32_t> delays = {1, 63, 64, 65, 4095, 4096, 4097, 300000};
+    std::vector<uint64_t> expected;
+    for (size_t i = 0; i < delays.size(); ++i) {
+        const WorldBlockPos pos(static_cast<int64_t>(i), 200, 0);
+        world.set_block(pos, ticker);
+        scheduler.schedule_tick(pos, delays[i]);
+        expected.push_back(scheduler.get_current_tick() + delays[i]);
+    }
+
+    std::vector<uint64_t> fired;
+    BlockRegistry::instance().set_tick_callback(
+        ticker, [&](const WorldBlockPos&, BlockId, double) { fired.push_back(scheduler.get_current_tick()); });
+
+    while (scheduler.get_current_tick() < expected.back()) {
+        scheduler.tick();
+    }
+    EXPECT_EQ(fired, expected);
+    EXPECT_EQ(scheduler.get_stats().pending_scheduled, 0u);
+}
+
+TEST_F(BlockTickSchedulerTest, EarlierScheduleWins) {
+    record_ticks();
+    BlockTickConfig config;
+    config.random_ticks_per_section = 0;
+    BlockTickScheduler scheduler;
+    ASSERT_TRUE(scheduler.initialize(&world, config));
+
+    const WorldBlockPos pos(1, 200, 1);
+    world.set_block(pos, ticker);
+    scheduler.schedule_tick(pos, 10);
+    scheduler.schedule_tick(pos, 2);
+    scheduler.schedule_tick(pos, 5);
+    EXPECT_EQ(scheduler.get_stats().pending_scheduled, 1u);
+
+    for (int i = 0; i < 12; ++i) {
+        scheduler.tick();
+    }
+    EXPECT_EQ(tick_count(), 1u);
+}
+
+TEST_F(BlockTickSchedulerTest, RandomTicksOnlySampleTickableSections) {
+    record_ticks();
+    BlockTickScheduler scheduler;
+    ASSERT_TRUE(scheduler.initialize(&world));
+
+    EXPECT_EQ(scheduler.get_stats().tracked_chunks, 1u);
+    EXPECT_EQ(scheduler.get_stats().tickable_sections, 0u);
+    EXPECT_EQ(scheduler.get_stats().last_random_ticks, 0u);
+
+    // A full section is hit by every sample
+    fill_section({0, 0}, 1, 12, 0, ticker);
+    EXPECT_EQ(scheduler.get_stats().tickable_sections, 1u);
+    scheduler.tick();
+    EXPECT_EQ(scheduler.get_stats().last_random_ticks, 3u);
+    for (const WorldBlockPos& pos : ticked) {
+        EXPECT_GE(pos.x, 16);
+        EXPECT_GE(pos.y, 192);
+        EXPECT_LT(pos.y, 208);
+        EXPECT_LT(pos.z, 16);
+    }
+
+    fill_section({0, 0}, 1, 12, 0, BLOCK_AIR);
+    EXPECT_EQ(scheduler.get_stats().tickable_sections, 0u);
+    scheduler.tick();
+    EXPECT_EQ(scheduler.get_stats().last_random_ticks, 0u);
+}
+
+TEST_F(BlockTickSchedulerTest, CountsTickableBlocksInLoadedChunks) {
+    // Blocks placed before the scheduler exists are found by the load scan
+    fill_section({0, 0}, 0, 13, 1, ticker);
+    record_ticks();
+
+    BlockTickScheduler scheduler;
+    ASSERT_TRUE(scheduler.initialize(&world));
+    EXPECT_EQ(scheduler.get_stats().tickable_sections, 1u);
+    scheduler.tick();
+    EXPECT_EQ(scheduler.get_stats().last_random_ticks, 3u);
+}
+
+TEST_F(BlockTickSchedulerTest, WritesAreDeferredUntilAfterTheTick) {
+    BlockTickConfig config;
+    config.random_ticks_per_section = 0;
+    BlockTickScheduler scheduler;
+    ASSERT_TRUE(scheduler.initialize(&world, config));
+
+    const WorldBlockPos pos(3, 200, 3);
+    world.set_block(pos, ticker);
+    scheduler.schedule_tick(pos, 1);
+
+    BlockId seen_during_tick = BLOCK_INVALID;
+    BlockRegistry::instance().set_tick_callback(ticker, [&](const WorldBlockPos& at, BlockId, double) {
+        scheduler.set_block(at, BLOCK_AIR);
+        scheduler.schedule_tick(at, 4);
+        seen_during_tick = world.get_block(at);
+    });
+
+    scheduler.tick();
+    EXPECT_EQ(seen_during_tick, ticker);
+    EXPECT_EQ(world.get_block(pos), BLOCK_AIR);
+    EXPECT_EQ(scheduler.get_stats().last_deferred_writes, 1u);
+    EXPECT_EQ(scheduler.get_stats().tickable_sections, 0u);
+    EXPECT_TRUE(scheduler.has_scheduled_tick(pos));
+}
+
+TEST_F(BlockTickSchedulerTest, ScheduledTicksSurviveUnloadAndReload) {
+    record_ticks();
+    BlockTickConfig config;
+    config.random_ticks_per_section = 0;
+    BlockTickScheduler scheduler;
+    ASSERT_TRUE(scheduler.initialize(&world, config));
+
+    const WorldBlockPos pos(9, 200, 9);
+    world.set_block(pos, ticker);
+    scheduler.schedule_tick(pos, 10);  // Due on tick 10
+    for (int i = 0; i < 4; ++i) {
+        scheduler.tick();
+    }
+
+    // The compressed chunk cache round-trips the chunk through serialization
+    world.unload_chunk({0, 0});
+    EXPECT_FALSE(scheduler.has_scheduled_tick(pos));
+    Chunk* chunk = world.load_chunk_sync({0, 0});
+    ASSERT_NE(chunk, nullptr);
+    ASSERT_EQ(chunk->get_metadata().scheduled_ticks.size(), 1u);
+    EXPECT_EQ(chunk->get_metadata().scheduled_ticks[0].delay, 6u);
+
+    while (scheduler.get_current_tick() < 9) {
+        scheduler.tick();
+    }
+    EXPECT_TRUE(scheduler.has_scheduled_tick(pos));
+    EXPECT_EQ(tick_count(), 0u);
+    scheduler.tick();
+    EXPECT_EQ(tick_count(), 1u);
+}
+
+TEST_F(BlockTickSchedulerTest, ParallelTicksMatchSerialTicks) {
+    std::vector<ChunkPos> chunks;
+    for (int x = -1; x <= 1; ++x) {
+        for (int z = -1; z <= 1; ++z) {
+            ASSERT_NE(world.load_chunk_sync({x, z}), nullptr);
+            chunks.emplace_back(x, z);
+        }
+    }
+    for (const ChunkPos& chunk : chunks) {
+        fill_section(chunk, 0, 12, 0, ticker);
+    }
+    record_ticks();
+
+    auto run = [&](const BlockTickConfig& config) {
+        {
+            std::lock_guard<std::mutex> lock(ticked_mutex);
+            ticked.clear();
+        }
+        BlockTickScheduler scheduler;
+        EXPECT_TRUE(scheduler.initialize(&world, config));
+        for (int i = 0; i < 5; ++i) {
+            scheduler.tick();
+        }
+        EXPECT_EQ(scheduler.get_stats().last_random_ticks, chunks.size() * config.random_ticks_per_section);
+        scheduler.shutdown();
+
+        std::lock_guard<std::mutex> lock(ticked_mutex);
+        std::vector<WorldBlockPos> result = ticked;
+        std::sort(result.begin(), result.end(), [](const WorldBlockPos& a, const WorldBlockPos& b) {
+            return a.x != b.x ? a.x < b.x : (a.y != b.y ? a.y < b.y : a.z < b.z);
+        });
+        return result;
+    };
+
+    BlockTickConfig serial;
+    serial.min_parallel_chunks = 1000;
+    BlockTickConfig parallel;
+    parallel.worker_threads = 3;
+    parallel.min_parallel_chunks = 1;
+
+    const auto serial_ticks = run(serial);
+    const auto parallel_ticks = run(parallel);
+    EXPECT_EQ(serial_ticks.size(), chunks.size() * 3 * 5);
+    EXPECT_EQ(serial_ticks, parallel_ticks);
+}
+
+}  // namespace
+}  // namespace realcraft::world
@@ -0,0 +1,62 @@
+// RealCraft World System Tests
+// chunk_cache_test.cpp - Tests for CompressedChunkCache
+
+#include <gtest/gtest.h>
+
+#include <realcraft/world/chunk_cache.hpp>
+
+namespace realcraft::world {
+namespace {
+
+std::vector<uint8_t> make_blob(uint8_t value, size_t size = 16) {
+    return std::vector<uint8_t>(size, value);
+}
+
+TEST(CompressedChunkCacheTest, PutAndTake) {
+    CompressedChunkCache cache(4);
+    cache.put(ChunkPos(1, 2), make_blob(7));
+
+    EXPECT_TRUE(cache.contains(ChunkPos(1, 2)));
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_EQ(cache.memory_usage(), 16u);
+
+    auto blob = cache.take(ChunkPos(1, 2));
+    ASSERT_TRUE(blob.has_value());
+    EXPECT_EQ(*blob, make_blob(7));
+
+    // Taking removes the entry
+    EXPECT_FALSE(cache.contains(ChunkPos(1, 2)));
+    EXPECT_FALSE(cache.take(ChunkPos(1, 2)).has_value());
+    EXPECT_EQ(cache.memory_usage(), 0u);
+}
+
+TEST(CompressedChunkCacheTest, EvictsLeastRecentlyStored) {
+    CompressedChunkCache cache(2);
+    cache.put(ChunkPos(0, 0), make_blob(1));
+    cache.put(ChunkPos(1, 0), make_blob(2));
+    cache.put(ChunkPos(2, 0), make_blob(3));
+
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_FALSE(cache.contains(ChunkPos(0, 0)));
+    EXPECT_TRUE(cache.contains(ChunkPos(1, 0)));
+    EXPECT_TRUE(cache.contains(ChunkPos(2, 0)));
+
+    // Replacing an entry refreshes it instead of growing the cache
+    cache.put(ChunkPos(1, 0), make_blob(4, 8));
+    cache.put(ChunkPos(3, 0), make_blob(5));
+    EXPECT_FALSE(cache.contains(ChunkPos(2, 0)));
+    EXPECT_EQ(cache.memory_usage(), 24u);
+}
+
+TEST(CompressedChunkCacheTest, ZeroCapacityDisables) {
+    CompressedChunkCache cache(2);
+    cache.put(ChunkPos(0, 0), make_blob(1));
+    cache.set_capacity(0);
+    EXPECT_EQ(cache.size(), 0u);
+
+    cache.put(ChunkPos(0, 0), make_blob(1));
+    EXPECT_FALSE(cache.contains(ChunkPos(0, 0)));
+}
+
+}  // namespace
+}  // namespace realcraft::world
@@ -5,6 +5,9 @@
 
 #include <realcraft/world/chunk_data.hpp>
 
+#include <iterator>
+#include <random>
+
 namespace realcraft::world {
 namespace {
 
@@ -172,6 +175,221 @@ TEST_F(VoxelStorageTest, RLECompressionEfficiency) {
     EXPECT_LT(rle_data.size(), raw_data.size() / 10);
 }
 
+TEST_F(VoxelStorageTest, SectionsRoundTrip) {
+    VoxelStorage storage;
+    std::mt19937 rng(7);
+
+    // Section 0: uniform stone; 1: two blocks; 2: 12 blocks; 3: 200 blocks;
+    // 4: >256 blocks (raw 16-bit path); remaining sections stay air
+    auto fill_section = [&](int32_t section, int32_t distinct) {
+        std::uniform_int_distribution<int32_t> dist(0, distinct - 1);
+        for (int32_t i = 0; i < STORAGE_SECTION_VOLUME; ++i) {
+            auto id = static_cast<BlockId>(1 + dist(rng));
+            storage.set(static_cast<size_t>(section) * STORAGE_SECTION_VOLUME + static_cast<size_t>(i),
+                        PaletteEntry{id, static_cast<BlockStateId>(id % 3)});
+        }
+    };
+    fill_section(0, 1);
+    fill_section(1, 2);
+    fill_section(2, 12);
+    fill_section(3, 200);
+    fill_section(4, 400);
+
+    std::vector<uint8_t> data = storage.serialize_sections();
+    ASSERT_FALSE(data.empty());
+
+    VoxelStorage storage2;
+    ASSERT_TRUE(storage2.deserialize_sections(data));
+    for (size_t i = 0; i < CHUNK_VOLUME; ++i) {
+        ASSERT_EQ(storage2.get(i), storage.get(i)) << "Mismatch at index " << i;
+    }
+}
+
+TEST_F(VoxelStorageTest, SectionsUniformIsCompact) {
+    VoxelStorage storage;
+    storage.fill(PaletteEntry{1, 0});
+
+    // Palette header + one palette reference per section
+    std::vector<uint8_t> data = storage.serialize_sections();
+    EXPECT_LE(data.size(), 2u + 4u + static_cast<size_t>(STORAGE_SECTION_COUNT) * 3u);
+
+    VoxelStorage storage2;
+    ASSERT_TRUE(storage2.deserialize_sections(data));
+    EXPECT_EQ(storage2.get_block(LocalBlockPos(31, 255, 31)), 1);
+}
+
+TEST_F(VoxelStorageTest, SectionsRejectsCorruptData) {
+    VoxelStorage storage;
+    storage.set_block(LocalBlockPos(1, 1, 1), 42);
+    std::vector<uint8_t> data = storage.serialize_sections();
+
+    VoxelStorage target;
+    std::vector<uint8_t> truncated(data.begin(), data.end() - 1);
+    EXPECT_FALSE(target.deserialize_sections(truncated));
+
+    // Point the last (uniform) section past the end of the palette
+    std::vector<uint8_t> bad_index = data;
+    bad_index[bad_index.size() - 2] = 0xFF;
+    EXPECT_FALSE(target.deserialize_sections(bad_index));
+
+    // Target is left untouched on failure
+    EXPECT_TRUE(target.is_empty());
+}
+
+TEST_F(VoxelStorageTest, DecodeBlocksMatchesGet) {
+    std::mt19937 rng(11);
+
+    // Palette sizes on both sides of the 16-entry shuffle path; IDs straddle
+    // 256 so both bytes matter
+    for (int32_t distinct : {1, 5, 15, 16, 40, 300}) {
+        VoxelStorage storage;
+        std::uniform_int_distribution<int32_t> dist(0, distinct - 1);
+        for (size_t i = 0; i < CHUNK_VOLUME; ++i) {
+            storage.set(i, PaletteEntry{static_cast<BlockId>(250 + dist(rng)), 0});
+        }
+
+        std::vector<BlockId> blocks(CHUNK_VOLUME);
+        storage.decode_blocks(0, blocks);
+        for (size_t i = 0; i < CHUNK_VOLUME; ++i) {
+            ASSERT_EQ(blocks[i], storage.get(i).block_id) << "palette " << distinct << ", index " << i;
+        }
+
+        // Unaligned start and a length that leaves a scalar tail
+        std::vector<BlockId> run(1003);
+        storage.decode_blocks(77, run);
+        for (size_t i = 0; i < run.size(); ++i) {
+            ASSERT_EQ(run[i], storage.get(77 + i).block_id) << "palette " << distinct << ", offset " << i;
+        }
+    }
+
+    // Uniform storage
+    VoxelStorage stone;
+    stone.fill(PaletteEntry{1, 0});
+    std::vector<BlockId> blocks(64);
+    stone.decode_blocks(CHUNK_VOLUME - 32, blocks);
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        EXPECT_EQ(blocks[i], i < 32 ? 1 : BLOCK_AIR) << "Past the end reads as air";
+    }
+}
+
+TEST_F(VoxelStorageTest, ReadRegionLayout) {
+    VoxelStorage storage;
+    for (size_t i = 0; i < CHUNK_VOLUME; ++i) {
+        storage.set(i, PaletteEntry{static_cast<BlockId>(i % 7), static_cast<BlockStateId>(i % 3)});
+    }
+
+    const LocalBlockPos min(3, 10, 4);
+    const LocalBlockPos max(8, 12, 9);
+    std::vector<BlockId> blocks(6 * 3 * 6);
+    std::vector<PaletteEntry> entries(blocks.size());
+    ASSERT_TRUE(storage.read_region(min, max, std::span<BlockId>(blocks)));
+    ASSERT_TRUE(storage.read_region(min, max, std::span<PaletteEntry>(entries)));
+
+    size_t i = 0;
+    for (int32_t y = min.y; y <= max.y; ++y) {
+        for (int32_t z = min.z; z <= max.z; ++z) {
+            for (int32_t x = min.x; x <= max.x; ++x, ++i) {
+                const PaletteEntry expected = storage.get(LocalBlockPos(x, y, z));
+                EXPECT_EQ(blocks[i], expected.block_id);
+                EXPECT_EQ(entries[i], expected);
+            }
+        }
+    }
+
+    // Full layers read as one run and match the index order
+    std::vector<BlockId> layers(static_cast<size_t>(CHUNK_SIZE_X * CHUNK_SIZE_Z) * 2);
+    ASSERT_TRUE(storage.read_region(LocalBlockPos(0, 5, 0), LocalBlockPos(CHUNK_SIZE_X - 1, 6, CHUNK_SIZE_Z - 1),
+                                    std::span<BlockId>(layers)));
+    for (size_t j = 0; j < layers.size(); ++j) {
+        ASSERT_EQ(layers[j], storage.get(local_to_index(LocalBlockPos(0, 5, 0)) + j).block_id);
+    }
+}
+
+TEST_F(VoxelStorageTest, ReadRegionPitch) {
+    VoxelStorage storage;
+    storage.set_block(LocalBlockPos(1, 0, 0), 5);
+    storage.set_block(LocalBlockPos(0, 1, 1), 6);
+
+    // 2x2x2 box written into a 4-wide, 12-per-layer buffer
+    std::vector<BlockId> out(24, 99);
+    ASSERT_TRUE(storage.read_region(LocalBlockPos(0, 0, 0), LocalBlockPos(1, 1, 1), std::span<BlockId>(out), 4, 12));
+    EXPECT_EQ(out[0], BLOCK_AIR);
+    EXPECT_EQ(out[1], 5);
+    EXPECT_EQ(out[2], 99);  // Outside the box: untouched
+    EXPECT_EQ(out[12 + 4], 6);
+}
+
+TEST_F(VoxelStorageTest, ReadRegionRejectsBadRequests) {
+    VoxelStorage storage;
+    std::vector<BlockId> out(8, 99);
+
+    EXPECT_FALSE(storage.read_region(LocalBlockPos(0, 0, 0), LocalBlockPos(2, 1, 1), std::span<BlockId>(out)));
+    EXPECT_FALSE(storage.read_region(LocalBlockPos(1, 0, 0), LocalBlockPos(0, 0, 0), std::span<BlockId>(out)));
+    EXPECT_FALSE(storage.read_region(LocalBlockPos(-1, 0, 0), LocalBlockPos(0, 0, 0), std::span<BlockId>(out)));
+    EXPECT_FALSE(storage.read_region(LocalBlockPos(0, 0, 0), LocalBlockPos(0, CHUNK_SIZE_Y, 0),
+                                     std::span<BlockId>(out)));
+    EXPECT_FALSE(storage.read_region(LocalBlockPos(0, 0, 0), LocalBlockPos(1, 0, 0), std::span<BlockId>(out), 1));
+    EXPECT_EQ(out[0], 99);
+}
+
+TEST_F(VoxelStorageTest, ShuffleDecodeMatchesScalar) {
+    if (!VoxelStorage::shuffle_decode_supported()) {
+        GTEST_SKIP() << "No byte shuffle on this CPU";
+    }
+
+    std::mt19937 rng(75);
+    // Palettes around the 16-entry shuffle limit, with IDs that use the high byte
+    for (uint32_t distinct : {1u, 2u, 7u, 15u, 16u, 17u}) {
+        VoxelStorage storage;
+        for (size_t i = 0; i < CHUNK_VOLUME; i += 1 + rng() % 5) {
+            storage.set(i, PaletteEntry{static_cast<BlockId>(300 + 257 * (rng() % distinct)), 0});
+        }
+
+        // Odd offset and length so the scalar tail runs too
+        constexpr size_t first = 37;
+        std::vector<BlockId> shuffled(CHUNK_VOLUME - 100);
+        std::vector<BlockId> scalar(shuffled.size());
+        VoxelStorage::set_shuffle_decode_enabled(true);
+        storage.decode_blocks(first, shuffled);
+        VoxelStorage::set_shuffle_decode_enabled(false);
+        storage.decode_blocks(first, scalar);
+        VoxelStorage::set_shuffle_decode_enabled(true);
+
+        ASSERT_EQ(shuffled, scalar) << "Palette of " << distinct << " blocks";
+        for (size_t i = 0; i < scalar.size(); ++i) {
+            ASSERT_EQ(scalar[i], storage.get(first + i).block_id);
+        }
+    }
+
+    // Out-of-range indices (as from corrupt data) decode to air on both paths
+    VoxelStorage storage;
+    storage.set(0, PaletteEntry{300, 0});
+    storage.set(1, PaletteEntry{557, 0});
+    std::vector<uint8_t> raw = storage.serialize_raw();
+    const size_t indices_offset = 2 + storage.palette_size() * 4;
+    const uint16_t bad[] = {3, 16, 127, 255, 256, 0x7FFF, 0x8000, 0xFFFF};
+    for (size_t i = 0; i < std::size(bad); ++i) {
+        const size_t at = indices_offset + (2 + i * 3) * 2;
+        raw[at] = static_cast<uint8_t>(bad[i] & 0xFF);
+        raw[at + 1] = static_cast<uint8_t>(bad[i] >> 8);
+    }
+    ASSERT_TRUE(storage.deserialize_raw(raw));
+
+    std::vector<BlockId> shuffled(64);
+    std::vector<BlockId> scalar(shuffled.size());
+    storage.decode_blocks(0, shuffled);
+    VoxelStorage::set_shuffle_decode_enabled(false);
+    storage.decode_blocks(0, scalar);
+    VoxelStorage::set_shuffle_decode_enabled(true);
+
+    EXPECT_EQ(shuffled, scalar);
+    EXPECT_EQ(shuffled[0], 300);
+    EXPECT_EQ(shuffled[1], 557);
+    for (size_t i = 0; i < std::size(bad); ++i) {
+        EXPECT_EQ(shuffled[2 + i * 3], BLOCK_AIR) << "Index " << bad[i];
+    }
+}
+
 TEST_F(VoxelStorageTest, MoveConstructor) {
     VoxelStorage storage1;
     storage1.set_block(LocalBlockPos(5, 5, 5), 42);
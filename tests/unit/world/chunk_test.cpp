@@ -5,6 +5,7 @@
 
 #include <realcraft/world/block.hpp>
 #include <realcraft/world/chunk.hpp>
+#include <realcraft/world/world_manager.hpp>
 #include <thread>
 #include <vector>
 
@@ -376,5 +377,149 @@ TEST_F(ChunkTest, ConcurrentReadsAndWrites) {
     EXPECT_GT(read_count.load(), 0);
 }
 
+// ============================================================================
+// Dirty Tracking
+// ============================================================================
+
+TEST_F(ChunkTest, BulkReads) {
+    ChunkDesc desc;
+    Chunk chunk(desc);
+    chunk.set_block(LocalBlockPos(3, 0, 4), 1);
+    chunk.set_block(LocalBlockPos(3, 100, 4), 2);
+    chunk.set_block(LocalBlockPos(7, 20, 9), 3);
+
+    std::vector<BlockId> column(CHUNK_SIZE_Y);
+    ASSERT_TRUE(chunk.read_column(3, 4, column));
+    EXPECT_EQ(column[0], 1);
+    EXPECT_EQ(column[100], 2);
+    EXPECT_EQ(column[1], BLOCK_AIR);
+
+    std::vector<BlockId> slab(static_cast<size_t>(CHUNK_SIZE_X * CHUNK_SIZE_Z));
+    ASSERT_TRUE(chunk.read_slab(20, slab));
+    EXPECT_EQ(slab[9 * CHUNK_SIZE_X + 7], 3);
+
+    std::vector<BlockId> section(STORAGE_SECTION_VOLUME);
+    ASSERT_TRUE(chunk.read_section(1, section));
+    EXPECT_EQ(section[local_to_index(LocalBlockPos(7, 20 - STORAGE_SECTION_HEIGHT, 9))], 3);
+
+    // Requests outside the chunk or into a short buffer fail
+    EXPECT_FALSE(chunk.read_section(STORAGE_SECTION_COUNT, section));
+    EXPECT_FALSE(chunk.read_column(CHUNK_SIZE_X, 0, column));
+    std::vector<BlockId> short_column(CHUNK_SIZE_Y - 1);
+    EXPECT_FALSE(chunk.read_column(3, 4, short_column));
+}
+
+TEST_F(ChunkTest, ChangesSinceVersion) {
+    ChunkDesc desc;
+    Chunk chunk(desc);
+    const uint64_t start = chunk.get_version();
+
+    chunk.set_block(LocalBlockPos(1, 2, 3), 7);
+    chunk.set_block(LocalBlockPos(1, 2, 3), 7);  // No-op writes are not journaled
+    chunk.set_entry(LocalBlockPos(4, 5, 6), PaletteEntry{9, 2});
+    EXPECT_GT(chunk.get_version(), start);
+
+    ChunkDelta delta = chunk.changes_since(start);
+    ASSERT_FALSE(delta.snapshot_required);
+    ASSERT_EQ(delta.changes.size(), 2u);
+    EXPECT_EQ(delta.changes[0].index, local_to_index(LocalBlockPos(1, 2, 3)));
+    EXPECT_EQ(delta.changes[0].old_entry, PaletteEntry::air());
+    EXPECT_EQ(delta.changes[0].new_entry.block_id, 7);
+    EXPECT_EQ(delta.changes[1].new_entry, (PaletteEntry{9, 2}));
+    EXPECT_EQ(delta.version, chunk.get_version());
+
+    EXPECT_TRUE(chunk.changes_since(chunk.get_version()).changes.empty());
+}
+
+TEST_F(ChunkTest, BulkWritesRequireSnapshot) {
+    ChunkDesc desc;
+    Chunk chunk(desc);
+    const uint64_t start = chunk.get_version();
+
+    // Reading through a write lock does not invalidate
+    {
+        auto lock = chunk.write_lock();
+        (void)lock.get_block(LocalBlockPos(0, 0, 0));
+    }
+    EXPECT_EQ(chunk.get_version(), start);
+
+    {
+        auto lock = chunk.write_lock();
+        lock.fill(PaletteEntry{1, 0});
+    }
+    EXPECT_GT(chunk.get_version(), start);
+    EXPECT_TRUE(chunk.changes_since(start).snapshot_required);
+
+    const uint64_t filled = chunk.get_version();
+    ASSERT_TRUE(chunk.deserialize(chunk.serialize()));
+    EXPECT_TRUE(chunk.changes_since(filled).snapshot_required);
+}
+
+TEST_F(ChunkTest, WorldManagerTracksDirtyChunks) {
+    WorldConfig config;
+    config.name = "dirty_tracking_test";
+    config.view_distance = 1;
+    config.enable_saving = false;
+    config.generation_threads = 1;
+
+    WorldManager world;
+    ASSERT_TRUE(world.initialize(config));
+
+    Chunk* chunk = world.load_chunk_sync({0, 0});
+    ASSERT_NE(chunk, nullptr);
+    const size_t after_load = world.dirty_chunk_count();
+    EXPECT_EQ(after_load, chunk->is_dirty() ? 1u : 0u);
+
+    chunk->mark_clean();
+    EXPECT_EQ(world.dirty_chunk_count(), 0u);
+
+    // Repeated edits count the chunk once
+    chunk->set_block(LocalBlockPos(1, 200, 1), BLOCK_AIR);
+    chunk->set_block(LocalBlockPos(2, 200, 2), BLOCK_AIR);
+    EXPECT_EQ(world.dirty_chunk_count(), 1u);
+
+    world.unload_chunk({0, 0});
+    EXPECT_EQ(world.dirty_chunk_count(), 0u);
+
+    world.shutdown();
+}
+
+TEST_F(ChunkTest, WorldManagerReadRegionSpansChunks) {
+    WorldConfig config;
+    config.name = "read_region_test";
+    config.view_distance = 1;
+    config.enable_saving = false;
+    config.generation_threads = 1;
+
+    WorldManager world;
+    ASSERT_TRUE(world.initialize(config));
+    ASSERT_NE(world.load_chunk_sync({0, 0}), nullptr);
+    ASSERT_NE(world.load_chunk_sync({-1, 0}), nullptr);
+    world.set_block(WorldBlockPos(1, 60, 2), 7);
+
+    // Crosses x = 0 and reaches into the unloaded chunk at z = 32, and above the world
+    const WorldBlockPos min(-3, 58, 30);
+    const WorldBlockPos max(2, CHUNK_SIZE_Y, 33);
+    std::vector<BlockId> out(6 * static_cast<size_t>(CHUNK_SIZE_Y - 57) * 4);
+    ASSERT_TRUE(world.read_region(min, max, out));
+
+    size_t i = 0;
+    for (int64_t y = min.y; y <= max.y; ++y) {
+        for (int64_t z = min.z; z <= max.z; ++z) {
+            for (int64_t x = min.x; x <= max.x; ++x, ++i) {
+                const BlockId expected = (z >= CHUNK_SIZE_Z || y >= CHUNK_SIZE_Y)
+                                             ? BLOCK_AIR
+                                             : world.get_block(WorldBlockPos(x, y, z));
+                ASSERT_EQ(out[i], expected) << x << "," << y << "," << z;
+            }
+        }
+    }
+
+    std::vector<BlockId> small(1);
+    EXPECT_FALSE(world.read_region(min, max, small));
+
+    world.shutdown();
+}
+
 }  // namespace
 }  // namespace realcraft::world
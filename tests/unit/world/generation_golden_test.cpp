@@ -0,0 +1,181 @@
+// RealCraft World System Tests
+// generation_golden_test.cpp - Bit-exact determinism guard for terrain generation
+//
+// Hashes the voxel content of a fixed seed/chunk grid and compares it with
+// tests/data/generation_golden.txt. Generation optimizations must leave every
+// hash unchanged. After an intentional output change, re-record with
+//     REALCRAFT_UPDATE_GOLDEN=1 ./realcraft_world_tests --gtest_filter='GenerationGolden*'
+// Hashes are recorded with noise pinned to NoiseSimdLevel::Scalar, so they do
+// not depend on the SIMD level of the recording or the testing machine.
+
+#include <gtest/gtest.h>
+
+#include <realcraft/world/block.hpp>
+#include <realcraft/world/chunk.hpp>
+#include <realcraft/world/terrain_generator.hpp>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace realcraft::world {
+namespace {
+
+constexpr uint32_t GOLDEN_SEEDS[] = {1, 12345, 0xC0FFEE};
+constexpr NoiseSimdLevel GOLDEN_SIMD_LEVEL = NoiseSimdLevel::Scalar;
+
+using GoldenKey = std::tuple<uint32_t, int32_t, int32_t>;
+
+std::vector<ChunkPos> golden_positions() {
+    std::vector<ChunkPos> positions;
+    for (int32_t z = -1; z <= 1; ++z) {
+        for (int32_t x = -1; x <= 1; ++x) {
+            positions.emplace_back(x, z);
+        }
+    }
+    // Far from the origin, where precision issues would show first
+    positions.emplace_back(1000, -1000);
+    positions.emplace_back(-25000, 31000);
+    return positions;
+}
+
+// FNV-1a over every voxel in index order plus the chunk's biome
+uint64_t hash_chunk(const Chunk& chunk) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    auto mix = [&hash](uint32_t value) {
+        for (int i = 0; i < 4; ++i) {
+            hash ^= (value >> (i * 8)) & 0xFFu;
+            hash *= 0x100000001B3ull;
+        }
+    };
+
+    auto lock = chunk.read_lock();
+    const VoxelStorage& storage = lock.storage();
+    for (size_t i = 0; i < CHUNK_VOLUME; ++i) {
+        PaletteEntry entry = storage.get(i);
+        mix(static_cast<uint32_t>(entry.block_id) | (static_cast<uint32_t>(entry.state_id) << 16));
+    }
+    mix(chunk.get_metadata().biome_id);
+    return hash;
+}
+
+uint64_t generate_hash(const TerrainGenerator& generator, uint32_t seed, const ChunkPos& pos) {
+    ChunkDesc desc;
+    desc.position = pos;
+    desc.seed = seed;
+    Chunk chunk(desc);
+    generator.generate(chunk);
+    return hash_chunk(chunk);
+}
+
+std::filesystem::path golden_path() {
+    return std::filesystem::path(REALCRAFT_TEST_DATA_DIR) / "generation_golden.txt";
+}
+
+std::map<GoldenKey, uint64_t> load_golden() {
+    std::map<GoldenKey, uint64_t> golden;
+    std::ifstream file(golden_path());
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        uint32_t seed = 0;
+        int32_t x = 0;
+        int32_t z = 0;
+        std::string hex;
+        if (fields >> seed >> x >> z >> hex) {
+            golden[{seed, x, z}] = std::strtoull(hex.c_str(), nullptr, 16);
+        }
+    }
+    return golden;
+}
+
+class GenerationGoldenTest : public ::testing::Test {
+protected:
+    void SetUp() override { BlockRegistry::instance().register_defaults(); }
+};
+
+TEST_F(GenerationGoldenTest, MatchesGoldenHashes) {
+    std::map<GoldenKey, uint64_t> actual;
+    for (uint32_t seed : GOLDEN_SEEDS) {
+        TerrainConfig config;
+        config.seed = seed;
+        config.noise_simd = GOLDEN_SIMD_LEVEL;
+        TerrainGenerator generator(config);
+        for (const ChunkPos& pos : golden_positions()) {
+            actual[{seed, pos.x, pos.y}] = generate_hash(generator, seed, pos);
+        }
+    }
+
+    if (const char* update = std::getenv("REALCRAFT_UPDATE_GOLDEN"); update && std::string(update) == "1") {
+        std::ofstream file(golden_path(), std::ios::trunc);
+        file << "# Terrain generation golden hashes (see generation_golden_test.cpp)\n";
+        file << "# Noise SIMD level: scalar\n";
+        file << "# seed chunk_x chunk_z fnv1a64\n";
+        for (const auto& [key, hash] : actual) {
+            char hex[17];
+            std::snprintf(hex, sizeof(hex), "%016" PRIx64, hash);
+            file << std::get<0>(key) << ' ' << std::get<1>(key) << ' ' << std::get<2>(key) << ' ' << hex << '\n';
+        }
+        ASSERT_TRUE(file.good()) << "Failed to write " << golden_path();
+        return;
+    }
+
+    std::map<GoldenKey, uint64_t> golden = load_golden();
+    ASSERT_FALSE(golden.empty()) << "No golden hashes recorded in " << golden_path()
+                                 << "; run with REALCRAFT_UPDATE_GOLDEN=1 to record them";
+
+    for (const auto& [key, hash] : actual) {
+        auto it = golden.find(key);
+        ASSERT_NE(it, golden.end()) << "Missing golden hash for seed " << std::get<0>(key) << " chunk ("
+                                    << std::get<1>(key) << ", " << std::get<2>(key) << ")";
+        EXPECT_EQ(hash, it->second) << "Generation output changed for seed " << std::get<0>(key) << " chunk ("
+                                    << std::get<1>(key) << ", " << std::get<2>(key) << ")";
+    }
+}
+
+TEST_F(GenerationGoldenTest, DeterministicAcrossInstancesAndThreads) {
+    constexpr uint32_t seed = GOLDEN_SEEDS[1];
+    std::vector<ChunkPos> positions = golden_positions();
+
+    TerrainConfig config;
+    config.seed = seed;
+    TerrainGenerator reference(config);
+    std::vector<uint64_t> expected;
+    for (const ChunkPos& pos : positions) {
+        expected.push_back(generate_hash(reference, seed, pos));
+    }
+
+    // A second generator shared by several threads, visiting in reverse
+    TerrainGenerator generator(config);
+    std::vector<uint64_t> actual(positions.size());
+    std::vector<std::thread> threads;
+    constexpr size_t thread_count = 4;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            for (size_t i = positions.size(); i-- > 0;) {
+                if (i % thread_count == t) {
+                    actual[i] = generate_hash(generator, seed, positions[i]);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(actual, expected);
+}
+
+}  // namespace
+}  // namespace realcraft::world
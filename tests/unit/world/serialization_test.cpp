@@ -8,8 +8,12 @@
 #include <realcraft/world/chunk.hpp>
 #include <realcraft/world/serialization.hpp>
 
+#include <atomic>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
 #include <random>
+#include <thread>
 
 namespace realcraft::world {
 namespace {
@@ -203,6 +207,30 @@ TEST_F(ChunkSerializerTest, SerializeDeserialize_AllBlockTypes) {
     });
 }
 
+TEST_F(ChunkSerializerTest, Deserialize_LegacyRleFormat) {
+    BlockId stone = BlockRegistry::instance().stone_id();
+    VoxelStorage storage;
+    storage.set_block(LocalBlockPos(3, 10, 7), stone);
+    std::vector<uint8_t> payload = storage.serialize_rle();
+
+    // Hand-build a version 1 blob with an uncompressed RLE payload
+    ChunkFileHeader header;
+    header.version = VOXEL_FORMAT_RLE;
+    header.compression_type = static_cast<uint8_t>(CompressionType::None);
+    header.compressed_size = static_cast<uint32_t>(payload.size());
+    header.uncompressed_size = static_cast<uint32_t>(payload.size());
+
+    std::vector<uint8_t> data(sizeof(header) + payload.size());
+    std::memcpy(data.data(), &header, sizeof(header));
+    std::memcpy(data.data() + sizeof(header), payload.data(), payload.size());
+
+    ChunkDesc desc;
+    Chunk chunk(desc);
+    ASSERT_TRUE(serializer.deserialize(chunk, data));
+    EXPECT_EQ(chunk.get_block(LocalBlockPos(3, 10, 7)), stone);
+    EXPECT_EQ(chunk.get_block(LocalBlockPos(3, 11, 7)), BLOCK_AIR);
+}
+
 // ============================================================================
 // Compression Tests
 // ============================================================================
@@ -287,6 +315,105 @@ TEST_F(ChunkSerializerTest, Compression_EmptyData) {
     EXPECT_TRUE(serializer.deserialize(chunk2, data));
 }
 
+TEST_F(ChunkSerializerTest, Compression_LevelRoundTrip) {
+    ChunkDesc desc;
+    Chunk chunk(desc);
+    for (int y = 0; y < 64; ++y) {
+        chunk.set_block(LocalBlockPos(y % CHUNK_SIZE_X, y, 3), BlockRegistry::instance().dirt_id());
+    }
+
+    for (int level : {1, DEFAULT_COMPRESSION_LEVEL, DEFAULT_FINAL_SAVE_COMPRESSION_LEVEL, 19}) {
+        std::vector<uint8_t> data = serializer.serialize(chunk, level);
+
+        ChunkDesc desc2;
+        Chunk chunk2(desc2);
+        ASSERT_TRUE(serializer.deserialize(chunk2, data)) << "level " << level;
+        EXPECT_EQ(chunk2.get_block(LocalBlockPos(5, 5, 3)), BlockRegistry::instance().dirt_id());
+    }
+}
+
+// Build a set of similar but distinct chunk payloads for dictionary training
+std::vector<std::vector<uint8_t>> make_dictionary_samples(size_t count) {
+    const BlockRegistry& registry = BlockRegistry::instance();
+    BlockId blocks[] = {registry.stone_id(), registry.dirt_id(), registry.grass_id(), registry.sand_id()};
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> height_dist(40, 80);
+    std::uniform_int_distribution<int> block_dist(0, 3);
+
+    std::vector<std::vector<uint8_t>> samples;
+    for (size_t i = 0; i < count; ++i) {
+        ChunkDesc desc;
+        desc.position = ChunkPos(static_cast<int>(i), 0);
+        Chunk chunk(desc);
+        for (int x = 0; x < CHUNK_SIZE_X; x += 2) {
+            for (int z = 0; z < CHUNK_SIZE_Z; z += 2) {
+                int height = height_dist(rng);
+                chunk.set_block(LocalBlockPos(x, height, z), blocks[block_dist(rng)]);
+                chunk.set_block(LocalBlockPos(x, height - 1, z), registry.stone_id());
+            }
+        }
+        samples.push_back(chunk.serialize());
+    }
+    return samples;
+}
+
+TEST_F(ChunkSerializerTest, Dictionary_TrainAndRoundTrip) {
+    auto samples = make_dictionary_samples(128);
+    auto dictionary = CompressionDictionary::train(samples, 16 * 1024);
+    ASSERT_NE(dictionary, nullptr);
+    EXPECT_NE(dictionary->get_id(), 0u);
+
+    serializer.set_active_dictionary(dictionary);
+    ASSERT_EQ(serializer.get_active_dictionary(), dictionary.get());
+
+    ChunkDesc desc;
+    Chunk chunk(desc);
+    chunk.set_block(LocalBlockPos(4, 60, 4), BlockRegistry::instance().grass_id());
+
+    std::vector<uint8_t> data = serializer.serialize(chunk);
+    ChunkFileHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    EXPECT_EQ(header.dictionary_id, dictionary->get_id());
+
+    ChunkDesc desc2;
+    Chunk chunk2(desc2);
+    ASSERT_TRUE(serializer.deserialize(chunk2, data));
+    EXPECT_EQ(chunk2.get_block(LocalBlockPos(4, 60, 4)), BlockRegistry::instance().grass_id());
+
+    // A serializer without the dictionary must refuse rather than misdecode
+    ChunkSerializer plain;
+    ChunkDesc desc3;
+    Chunk chunk3(desc3);
+    EXPECT_FALSE(plain.deserialize(chunk3, data));
+}
+
+TEST_F(RegionFileTest, Dictionary_LoadFromWorldDirectory) {
+    auto samples = make_dictionary_samples(128);
+    auto dictionary = CompressionDictionary::train(samples, 16 * 1024);
+    ASSERT_NE(dictionary, nullptr);
+
+    ASSERT_TRUE(dictionary->save(CompressionDictionary::path_for(test_dir_, dictionary->get_id())));
+    ASSERT_TRUE(CompressionDictionary::write_active_marker(test_dir_, dictionary->get_id()));
+    EXPECT_FALSE(std::filesystem::exists(CompressionDictionary::active_marker(test_dir_).string() + ".tmp"));
+
+    ChunkSerializer serializer;
+    EXPECT_EQ(serializer.load_dictionaries(test_dir_), 1u);
+    ASSERT_NE(serializer.get_active_dictionary(), nullptr);
+    EXPECT_EQ(serializer.get_active_dictionary()->get_id(), dictionary->get_id());
+
+    // Old dictionary-free chunks stay readable
+    ChunkDesc desc;
+    Chunk chunk(desc);
+    chunk.set_block(LocalBlockPos(1, 1, 1), BlockRegistry::instance().stone_id());
+    std::vector<uint8_t> legacy = serializer_.serialize(chunk);
+
+    ChunkDesc desc2;
+    Chunk chunk2(desc2);
+    ASSERT_TRUE(serializer.deserialize(chunk2, legacy));
+    EXPECT_EQ(chunk2.get_block(LocalBlockPos(1, 1, 1)), BlockRegistry::instance().stone_id());
+}
+
 // ============================================================================
 // Header Validation Tests
 // ============================================================================
@@ -539,5 +666,277 @@ TEST_F(RegionManagerTest, RegionManager_HasChunk) {
     EXPECT_TRUE(manager.has_chunk(ChunkPos(50, 50)));
 }
 
+TEST_F(RegionManagerTest, RegionManager_ConcurrentReadWrite) {
+    RegionManager manager(test_dir_);
+    manager.set_max_open_files(2);
+
+    // Seed chunks across four regions so workers contend on eviction as well
+    constexpr int kChunksPerRegion = 8;
+    std::vector<ChunkPos> positions;
+    for (int r = 0; r < 4; ++r) {
+        for (int i = 0; i < kChunksPerRegion; ++i) {
+            positions.emplace_back(r * REGION_SIZE + i, i);
+        }
+    }
+
+    for (size_t i = 0; i < positions.size(); ++i) {
+        ChunkDesc desc;
+        desc.position = positions[i];
+        Chunk chunk(desc);
+        chunk.set_block(LocalBlockPos(1, 2, 3), static_cast<BlockId>(i % 10 + 1));
+        std::vector<uint8_t> data = serializer_.serialize(chunk);
+        ASSERT_TRUE(manager.write_chunk(positions[i], data));
+    }
+
+    std::atomic<int> failures{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            ChunkSerializer serializer;
+            for (int iter = 0; iter < 50; ++iter) {
+                size_t i = static_cast<size_t>(iter * 4 + t) % positions.size();
+
+                // Rewrite some chunks while others are being read
+                if (iter % 5 == 0) {
+                    ChunkDesc desc;
+                    desc.position = positions[i];
+                    Chunk chunk(desc);
+                    chunk.set_block(LocalBlockPos(1, 2, 3), static_cast<BlockId>(i % 10 + 1));
+                    if (!manager.write_chunk(positions[i], serializer.serialize(chunk))) {
+                        ++failures;
+                    }
+                    continue;
+                }
+
+                auto data = manager.read_chunk(positions[i]);
+                ChunkDesc desc;
+                desc.position = positions[i];
+                Chunk chunk(desc);
+                if (!data.has_value() || !serializer.deserialize(chunk, *data) ||
+                    chunk.get_block(LocalBlockPos(1, 2, 3)) != static_cast<BlockId>(i % 10 + 1)) {
+                    ++failures;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0);
+
+    // Regions pinned by in-flight reads may overshoot the limit; once idle they evict
+    manager.set_max_open_files(2);
+    EXPECT_LE(manager.open_region_count(), 2u);
+}
+
+TEST_F(RegionManagerTest, RegionManager_ConcurrentFirstOpen) {
+    RegionManager manager(test_dir_);
+
+    // Every thread's first write lands in the same, not yet existing region
+    constexpr int kThreads = 8;
+    std::atomic<int> failures{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            ChunkSerializer serializer;
+            ChunkDesc desc;
+            desc.position = ChunkPos(t, 0);
+            Chunk chunk(desc);
+            chunk.set_block(LocalBlockPos(1, 2, 3), static_cast<BlockId>(t + 1));
+            if (!manager.write_chunk(desc.position, serializer.serialize(chunk))) {
+                ++failures;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_EQ(manager.open_region_count(), 1u);
+
+    // No racing open truncated the file under another thread's writes
+    RegionManager reopened(test_dir_);
+    for (int t = 0; t < kThreads; ++t) {
+        auto data = reopened.read_chunk(ChunkPos(t, 0));
+        ASSERT_TRUE(data.has_value()) << "chunk " << t;
+
+        ChunkDesc desc;
+        desc.position = ChunkPos(t, 0);
+        Chunk chunk(desc);
+        ASSERT_TRUE(serializer_.deserialize(chunk, *data));
+        EXPECT_EQ(chunk.get_block(LocalBlockPos(1, 2, 3)), static_cast<BlockId>(t + 1));
+    }
+}
+
+TEST_F(RegionFileTest, RegionFile_OpenWithCreateKeepsExistingData) {
+    std::filesystem::path path = test_dir_ / "r.0.0.rcr";
+    ChunkDesc desc;
+    Chunk chunk(desc);
+    chunk.set_block(LocalBlockPos(0, 0, 0), BlockRegistry::instance().dirt_id());
+    {
+        RegionFile region(path);
+        ASSERT_TRUE(region.open(true));
+        ASSERT_TRUE(region.write_chunk(ChunkPos(0, 0), serializer_.serialize(chunk)));
+    }
+
+    RegionFile region(path);
+    ASSERT_TRUE(region.open(true));
+    EXPECT_TRUE(region.has_chunk(ChunkPos(0, 0)));
+}
+
+// ============================================================================
+// Journal Tests
+// ============================================================================
+
+TEST_F(RegionManagerTest, Journal_CheckpointWritesRegions) {
+    RegionManager manager(test_dir_);
+    ASSERT_TRUE(manager.enable_journal());
+
+    ChunkDesc desc;
+    Chunk chunk(desc);
+    chunk.set_block(LocalBlockPos(4, 5, 6), BlockRegistry::instance().stone_id());
+    std::vector<uint8_t> data = serializer_.serialize(chunk);
+    ASSERT_TRUE(manager.write_chunk(ChunkPos(3, 4), data));
+
+    // Staged writes are visible before they reach a region file
+    EXPECT_TRUE(manager.has_chunk(ChunkPos(3, 4)));
+    EXPECT_FALSE(std::filesystem::exists(manager.get_region_path(ChunkPos(3, 4))));
+
+    ASSERT_TRUE(manager.commit());
+    EXPECT_GT(manager.journal_size(), sizeof(JournalFileHeader) + data.size());
+
+    ASSERT_TRUE(manager.checkpoint());
+    EXPECT_EQ(manager.journal_size(), sizeof(JournalFileHeader));
+
+    RegionFile region(manager.get_region_path(ChunkPos(3, 4)));
+    ASSERT_TRUE(region.open(false));
+    auto read_data = region.read_chunk(ChunkPos(3, 4));
+    ASSERT_TRUE(read_data.has_value());
+    EXPECT_EQ(*read_data, data);
+
+    // Deletes are journaled too
+    ASSERT_TRUE(manager.delete_chunk(ChunkPos(3, 4)));
+    EXPECT_FALSE(manager.has_chunk(ChunkPos(3, 4)));
+    EXPECT_FALSE(manager.read_chunk(ChunkPos(3, 4)).has_value());
+}
+
+TEST_F(RegionManagerTest, Journal_RecoversCommittedBatches) {
+    std::filesystem::path journal = test_dir_ / "journal.rcj";
+    std::filesystem::path backup = test_dir_ / "journal.bak";
+
+    ChunkDesc desc;
+    Chunk chunk(desc);
+    chunk.set_block(LocalBlockPos(1, 1, 1), BlockRegistry::instance().dirt_id());
+    std::vector<uint8_t> committed = serializer_.serialize(chunk);
+    chunk.set_block(LocalBlockPos(2, 2, 2), BlockRegistry::instance().sand_id());
+    std::vector<uint8_t> uncommitted = serializer_.serialize(chunk);
+
+    {
+        RegionManager manager(test_dir_);
+        ASSERT_TRUE(manager.enable_journal());
+        ASSERT_TRUE(manager.write_chunk(ChunkPos(0, 0), committed));
+        ASSERT_TRUE(manager.write_chunk(ChunkPos(40, 0), committed));
+        ASSERT_TRUE(manager.commit());
+
+        // Capture the journal as a crash would leave it, before checkpointing
+        std::filesystem::copy_file(journal, backup);
+    }
+
+    // Simulate the crash: region files never got the data, and the journal
+    // ends in a torn batch
+    std::filesystem::remove_all(test_dir_ / "regions");
+    std::filesystem::rename(backup, journal);
+    {
+        JournalRecordHeader torn;
+        torn.type = static_cast<uint32_t>(JournalRecordType::ChunkWrite);
+        torn.batch = 2;
+        torn.chunk_x = 1;
+        torn.size = static_cast<uint32_t>(uncommitted.size());
+        std::ofstream file(journal, std::ios::binary | std::ios::app);
+        file.write(reinterpret_cast<const char*>(&torn), sizeof(torn));
+        file.write(reinterpret_cast<const char*>(uncommitted.data()), 16);
+    }
+
+    RegionManager manager(test_dir_);
+    ASSERT_TRUE(manager.enable_journal());
+    EXPECT_EQ(manager.journal_size(), sizeof(JournalFileHeader));
+
+    // Recovered chunks are in the region files themselves
+    RegionFile region(manager.get_region_path(ChunkPos(0, 0)));
+    ASSERT_TRUE(region.open(false));
+    auto read_data = region.read_chunk(ChunkPos(0, 0));
+    ASSERT_TRUE(read_data.has_value());
+    EXPECT_EQ(*read_data, committed);
+    EXPECT_TRUE(manager.has_chunk(ChunkPos(40, 0)));
+    EXPECT_FALSE(manager.has_chunk(ChunkPos(1, 0)));
+}
+
+TEST_F(RegionManagerTest, Journal_CheckpointAcrossMoreRegionsThanOpenLimit) {
+    RegionManager manager(test_dir_);
+    manager.set_max_open_files(1);
+    ASSERT_TRUE(manager.enable_journal());
+
+    ChunkDesc desc;
+    Chunk chunk(desc);
+    chunk.set_block(LocalBlockPos(3, 3, 3), BlockRegistry::instance().stone_id());
+    std::vector<uint8_t> data = serializer_.serialize(chunk);
+
+    const ChunkPos chunks[] = {ChunkPos(0, 0), ChunkPos(40, 0), ChunkPos(0, 40), ChunkPos(-40, -40)};
+    for (const ChunkPos& pos : chunks) {
+        ASSERT_TRUE(manager.write_chunk(pos, data));
+    }
+    ASSERT_TRUE(manager.checkpoint());
+    EXPECT_EQ(manager.journal_size(), sizeof(JournalFileHeader));
+
+    for (const ChunkPos& pos : chunks) {
+        RegionFile region(manager.get_region_path(pos));
+        ASSERT_TRUE(region.open(false));
+        auto read_data = region.read_chunk(pos);
+        ASSERT_TRUE(read_data.has_value());
+        EXPECT_EQ(*read_data, data);
+    }
+}
+
+TEST_F(RegionManagerTest, Journal_FailedReplayKeepsJournal) {
+    std::filesystem::path journal = test_dir_ / "journal.rcj";
+    std::filesystem::path backup = test_dir_ / "journal.bak";
+
+    ChunkDesc desc;
+    Chunk chunk(desc);
+    chunk.set_block(LocalBlockPos(1, 1, 1), BlockRegistry::instance().dirt_id());
+    std::vector<uint8_t> data = serializer_.serialize(chunk);
+
+    {
+        RegionManager manager(test_dir_);
+        ASSERT_TRUE(manager.enable_journal());
+        ASSERT_TRUE(manager.write_chunk(ChunkPos(0, 0), data));
+        ASSERT_TRUE(manager.commit());
+        std::filesystem::copy_file(journal, backup);
+    }
+
+    // Crash, then the region directory cannot be created on recovery
+    std::filesystem::remove_all(test_dir_ / "regions");
+    std::filesystem::rename(backup, journal);
+    std::ofstream(test_dir_ / "regions") << "not a directory";
+    uintmax_t journal_bytes = std::filesystem::file_size(journal);
+
+    {
+        RegionManager manager(test_dir_);
+        EXPECT_FALSE(manager.enable_journal());
+        EXPECT_FALSE(manager.is_journal_enabled());
+    }
+    EXPECT_EQ(std::filesystem::file_size(journal), journal_bytes);
+
+    // Once the region directory is usable again the journal replays
+    std::filesystem::remove(test_dir_ / "regions");
+    RegionManager manager(test_dir_);
+    ASSERT_TRUE(manager.enable_journal());
+    auto read_data = manager.read_chunk(ChunkPos(0, 0));
+    ASSERT_TRUE(read_data.has_value());
+    EXPECT_EQ(*read_data, data);
+}
+
 }  // namespace
 }  // namespace realcraft::world
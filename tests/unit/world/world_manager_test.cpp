@@ -0,0 +1,112 @@
+// RealCraft World System Tests
+// world_manager_test.cpp - Tests for WorldManager's loaded-chunk cap and compressed tier
+
+#include <gtest/gtest.h>
+
+#include <realcraft/world/block.hpp>
+#include <realcraft/world/world_manager.hpp>
+
+#include <vector>
+
+namespace realcraft::world {
+namespace {
+
+class WorldManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override { BlockRegistry::instance().register_defaults(); }
+
+    static WorldConfig make_config(size_t max_loaded_chunks) {
+        WorldConfig config;
+        config.name = "world_manager_test";
+        config.seed = 4242;
+        config.view_distance = 8;
+        config.enable_saving = false;
+        config.generation_threads = 1;
+        config.max_loaded_chunks = max_loaded_chunks;
+        config.chunk_cache_size = 64;
+        return config;
+    }
+
+    // Every voxel of a chunk, packed as block_id | state_id << 16
+    static std::vector<uint32_t> snapshot(const Chunk& chunk) {
+        std::vector<uint32_t> voxels(CHUNK_VOLUME);
+        auto lock = chunk.read_lock();
+        const VoxelStorage& storage = lock.storage();
+        for (size_t i = 0; i < CHUNK_VOLUME; ++i) {
+            PaletteEntry entry = storage.get(i);
+            voxels[i] = static_cast<uint32_t>(entry.block_id) | (static_cast<uint32_t>(entry.state_id) << 16);
+        }
+        return voxels;
+    }
+};
+
+TEST_F(WorldManagerTest, EffectiveViewDistanceFitsCap) {
+    auto effective = [](size_t cap, int32_t view_distance) {
+        WorldConfig config = make_config(cap);
+        config.view_distance = view_distance;
+        WorldManager world;
+        EXPECT_TRUE(world.initialize(config));
+        int32_t distance = world.get_effective_view_distance();
+        world.shutdown();
+        return distance;
+    };
+
+    // 31x31 fits the cap; minus the unload margin leaves room for 8
+    EXPECT_EQ(effective(1024, 8), 8);
+    // 7x7 retained square: view 1 plus a margin of 2
+    EXPECT_EQ(effective(49, 8), 1);
+    EXPECT_EQ(effective(49, 0), 0);
+    // Non-square caps round down to the largest odd square
+    EXPECT_EQ(effective(80, 8), 1);
+    EXPECT_EQ(effective(1, 8), 0);
+}
+
+TEST_F(WorldManagerTest, EnforcesMaxLoadedChunks) {
+    constexpr size_t cap = 12;
+    WorldManager world;
+    ASSERT_TRUE(world.initialize(make_config(cap)));
+
+    // Immediate loads may overshoot the cap until the next update
+    for (int32_t z = -2; z <= 2; ++z) {
+        for (int32_t x = -2; x <= 2; ++x) {
+            ASSERT_NE(world.load_chunk_sync(ChunkPos(x, z)), nullptr);
+        }
+    }
+    EXPECT_EQ(world.loaded_chunk_count(), 25u);
+
+    world.update_loaded_chunks();
+    EXPECT_LE(world.loaded_chunk_count(), cap);
+    EXPECT_NE(world.get_chunk(ChunkPos(0, 0)), nullptr);
+    EXPECT_EQ(world.cached_chunk_count(), 25u - world.loaded_chunk_count());
+
+    world.shutdown();
+}
+
+TEST_F(WorldManagerTest, EvictedChunkReloadsFromCompressedTier) {
+    WorldManager world;
+    ASSERT_TRUE(world.initialize(make_config(9)));
+
+    const ChunkPos far(2, -2);
+    Chunk* chunk = world.load_chunk_sync(far);
+    ASSERT_NE(chunk, nullptr);
+    ASSERT_NE(world.load_chunk_sync(ChunkPos(0, 0)), nullptr);
+
+    // An edit that regeneration could not reproduce
+    chunk->set_block(LocalBlockPos(5, 250, 7), BlockRegistry::instance().stone_id());
+    const std::vector<uint32_t> expected = snapshot(*chunk);
+
+    // Outside the capped view, so the update moves it to the compressed tier
+    world.update_loaded_chunks();
+    ASSERT_EQ(world.get_chunk(far), nullptr);
+    EXPECT_EQ(world.cached_chunk_count(), 1u);
+
+    Chunk* reloaded = world.load_chunk_sync(far);
+    ASSERT_NE(reloaded, nullptr);
+    EXPECT_EQ(world.cached_chunk_count(), 0u);
+    EXPECT_EQ(snapshot(*reloaded), expected);
+
+    world.shutdown();
+}
+
+}  // namespace
+}  // namespace realcraft::world
@@ -0,0 +1,91 @@
+// RealCraft Tools
+// pack_assets.cpp - Bundle loose asset directories into a single archive
+//
+// Usage: realcraft_pack_assets <output.rcpak> <dir>[=prefix]... [--level L] [--store-only]
+//
+// Every file under each directory is added as "<prefix>/<relative path>",
+// where the prefix defaults to the directory's own name (so "shaders" packs
+// "shaders/glsl/basic.vert"). Entries that shrink under zstd are stored
+// compressed; the rest are stored raw and served zero-copy at runtime.
+
+#include <realcraft/platform/asset_archive.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::filesystem::path output;
+    std::vector<std::pair<std::filesystem::path, std::string>> inputs;  // Directory, prefix
+    int compression_level = realcraft::platform::AssetArchiveWriterConfig{}.compression_level;
+    bool store_only = false;
+};
+
+void print_usage() {
+    std::fprintf(stderr, "Usage: realcraft_pack_assets <output.rcpak> <dir>[=prefix]... [--level L] [--store-only]\n");
+}
+
+bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--level" && i + 1 < argc) {
+            options.compression_level = static_cast<int>(std::strtol(argv[++i], nullptr, 10));
+        } else if (arg == "--store-only") {
+            options.store_only = true;
+        } else if (!arg.empty() && arg[0] != '-' && options.output.empty()) {
+            options.output = arg;
+        } else if (!arg.empty() && arg[0] != '-') {
+            const auto equals = arg.find('=');
+            std::filesystem::path dir = arg.substr(0, equals);
+            std::string prefix =
+                equals == std::string::npos ? dir.lexically_normal().filename().string() : arg.substr(equals + 1);
+            options.inputs.emplace_back(std::move(dir), std::move(prefix));
+        } else {
+            return false;
+        }
+    }
+    return !options.output.empty() && !options.inputs.empty();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    using namespace realcraft;
+
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage();
+        return 1;
+    }
+
+    platform::AssetArchiveWriterConfig config;
+    config.compression_level = options.compression_level;
+    if (options.store_only) {
+        config.min_compress_size = SIZE_MAX;
+    }
+
+    platform::AssetArchiveWriter writer(config);
+    for (const auto& [dir, prefix] : options.inputs) {
+        if (!std::filesystem::is_directory(dir)) {
+            std::fprintf(stderr, "Not a directory: %s\n", dir.string().c_str());
+            return 1;
+        }
+        const size_t added = writer.add_directory(dir, prefix);
+        std::printf("%-40s %6zu files -> %s/\n", dir.string().c_str(), added, prefix.c_str());
+    }
+
+    if (!writer.write(options.output)) {
+        return 1;
+    }
+
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(options.output, ec);
+    std::printf("Wrote %s: %zu entries, %llu bytes\n", options.output.string().c_str(), writer.entry_count(),
+                static_cast<unsigned long long>(ec ? 0 : size));
+    return 0;
+}
@@ -0,0 +1,401 @@
+// RealCraft Tools
+// replay.cpp - Headless input replay and whole-engine benchmark
+//
+// Usage: realcraft_replay <recording> [--frames N] [--threads N] [--deterministic]
+//                         [--expect-hash HEX]
+//
+// Replays a file written by `realcraft --record <file>` without a window:
+// the world is regenerated from the recorded seed, and GameLoop, WorldManager,
+// PhysicsWorld, gameplay and CPU meshing run one fixed step per frame on
+// simulated time. Chunks around the player are loaded synchronously before
+// each step, so results do not depend on background generation timing.
+//
+// Prints per-frame and per-task timing distributions and a hash of the final
+// world and player state. With --expect-hash the exit code reports whether
+// the hash matched, for use as a regression test.
+
+#include <realcraft/core/game_loop.hpp>
+#include <realcraft/core/logger.hpp>
+#include <realcraft/core/metrics.hpp>
+#include <realcraft/gameplay/block_interaction.hpp>
+#include <realcraft/gameplay/input_recording.hpp>
+#include <realcraft/gameplay/inventory.hpp>
+#include <realcraft/gameplay/item.hpp>
+#include <realcraft/gameplay/item_entity.hpp>
+#include <realcraft/gameplay/session_config.hpp>
+#include <realcraft/physics/physics_world.hpp>
+#include <realcraft/physics/player_controller.hpp>
+#include <realcraft/rendering/camera.hpp>
+#include <realcraft/rendering/mesh_generator.hpp>
+#include <realcraft/world/chunk.hpp>
+#include <realcraft/world/world_manager.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace realcraft;
+using Clock = std::chrono::steady_clock;
+
+// Chunks loaded synchronously around the player before every step
+constexpr int32_t SIMULATION_RADIUS = 1;
+// Chunks around the final player position included in the world hash
+constexpr int32_t HASH_RADIUS = 2;
+
+struct Options {
+    std::filesystem::path recording;
+    size_t max_frames = 0;  // 0 = whole recording
+    uint32_t threads = 0;
+    bool deterministic = false;
+    bool check_hash = false;
+    uint64_t expected_hash = 0;
+};
+
+void print_usage() {
+    std::fprintf(stderr, "Usage: realcraft_replay <recording> [--frames N] [--threads N] [--deterministic]\n"
+                         "                        [--expect-hash HEX]\n");
+}
+
+bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) {
+            options.max_frames = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            options.threads = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--deterministic") {
+            options.deterministic = true;
+        } else if (arg == "--expect-hash" && i + 1 < argc) {
+            options.check_hash = true;
+            options.expected_hash = std::strtoull(argv[++i], nullptr, 16);
+        } else if (!arg.empty() && arg[0] != '-' && options.recording.empty()) {
+            options.recording = arg;
+        } else {
+            return false;
+        }
+    }
+    return !options.recording.empty();
+}
+
+// ============================================================================
+// State Hash
+// ============================================================================
+
+// FNV-1a
+class StateHasher {
+public:
+    template <typename T>
+    void add(const T& value) {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        for (unsigned char byte : bytes) {
+            hash_ = (hash_ ^ byte) * 0x100000001b3ull;
+        }
+    }
+
+    [[nodiscard]] uint64_t value() const { return hash_; }
+
+private:
+    uint64_t hash_ = 14695981039346656037ull;
+};
+
+// Records player edits for the hash and queues chunks for meshing
+class ReplayObserver : public world::IWorldObserver {
+public:
+    void on_chunk_loaded(const world::ChunkPos& pos, world::Chunk& /*chunk*/) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        dirty_.insert({pos.x, pos.y});
+    }
+
+    void on_chunk_unloading(const world::ChunkPos& pos, const world::Chunk& /*chunk*/) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        dirty_.erase({pos.x, pos.y});
+    }
+
+    void on_block_changed(const world::BlockChangeEvent& event) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const world::ChunkPos chunk = world::world_to_chunk(event.position);
+        dirty_.insert({chunk.x, chunk.y});
+        if (!event.from_generation) {
+            edits_.add(event.position.x);
+            edits_.add(event.position.y);
+            edits_.add(event.position.z);
+            edits_.add(event.new_entry.block_id);
+            edits_.add(event.new_entry.state_id);
+            ++edit_count_;
+        }
+    }
+
+    std::vector<world::ChunkPos> take_dirty() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<world::ChunkPos> positions;
+        positions.reserve(dirty_.size());
+        for (const auto& [x, z] : dirty_) {
+            positions.emplace_back(x, z);
+        }
+        dirty_.clear();
+        return positions;
+    }
+
+    [[nodiscard]] uint64_t edit_hash() const { return edits_.value(); }
+    [[nodiscard]] size_t edit_count() const { return edit_count_; }
+
+private:
+    std::mutex mutex_;
+    std::set<std::pair<int32_t, int32_t>> dirty_;  // Ordered, so meshing order is stable
+    StateHasher edits_;
+    size_t edit_count_ = 0;
+};
+
+void load_chunks_around(world::WorldManager& world_manager, const world::WorldPos& position, int32_t radius) {
+    const world::ChunkPos center = world::world_to_chunk(world::world_to_block(position));
+    for (int32_t dz = -radius; dz <= radius; ++dz) {
+        for (int32_t dx = -radius; dx <= radius; ++dx) {
+            const world::ChunkPos pos(center.x + dx, center.y + dz);
+            if (world_manager.get_chunk(pos) == nullptr) {
+                (void)world_manager.load_chunk_sync(pos);
+            }
+        }
+    }
+}
+
+uint64_t hash_final_state(world::WorldManager& world_manager, const physics::PlayerController& player,
+                          const gameplay::Inventory& inventory, const gameplay::ItemEntityManager& items,
+                          const ReplayObserver& observer) {
+    StateHasher hasher;
+
+    const glm::dvec3 position = player.get_position();
+    const glm::dvec3 velocity = player.get_velocity();
+    hasher.add(position.x);
+    hasher.add(position.y);
+    hasher.add(position.z);
+    hasher.add(velocity.x);
+    hasher.add(velocity.y);
+    hasher.add(velocity.z);
+
+    hasher.add(observer.edit_hash());
+    for (size_t i = 0; i < inventory.slot_count(); ++i) {
+        const auto& slot = inventory.get_slot(i);
+        hasher.add(slot.item_id);
+        hasher.add(slot.count);
+    }
+    hasher.add(static_cast<uint64_t>(items.entity_count()));
+
+    load_chunks_around(world_manager, position, HASH_RADIUS);
+    const world::ChunkPos center = world::world_to_chunk(world::world_to_block(position));
+    for (int32_t dz = -HASH_RADIUS; dz <= HASH_RADIUS; ++dz) {
+        for (int32_t dx = -HASH_RADIUS; dx <= HASH_RADIUS; ++dx) {
+            const world::Chunk* chunk = world_manager.get_chunk({center.x + dx, center.y + dz});
+            if (chunk == nullptr) {
+                continue;
+            }
+            auto lock = chunk->read_lock();
+            for (size_t i = 0; i < static_cast<size_t>(world::CHUNK_VOLUME); ++i) {
+                const world::PaletteEntry entry = lock.get_entry(i);
+                hasher.add(entry.block_id);
+                hasher.add(entry.state_id);
+            }
+        }
+    }
+    return hasher.value();
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+
+void print_distribution(const char* name, const core::HistogramSummary& s) {
+    std::printf("  %-18s %8llu  mean %8.3f  p50 %8.3f  p90 %8.3f  p99 %8.3f  max %8.3f ms\n", name,
+                static_cast<unsigned long long>(s.count), s.mean() / 1000.0, static_cast<double>(s.p50) / 1000.0,
+                static_cast<double>(s.p90) / 1000.0, static_cast<double>(s.p99) / 1000.0,
+                static_cast<double>(s.max) / 1000.0);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage();
+        return 1;
+    }
+
+    core::LoggerConfig log_config;
+    log_config.log_directory = std::filesystem::temp_directory_path() / "realcraft_replay" / "logs";
+    log_config.console_level = core::LogLevel::Warn;
+    core::Logger::initialize(log_config);
+
+    auto recording = gameplay::load_input_recording(options.recording);
+    if (!recording) {
+        std::fprintf(stderr, "Cannot read recording %s\n", options.recording.string().c_str());
+        core::Logger::shutdown();
+        return 1;
+    }
+    const gameplay::RecordingHeader& header = recording->header;
+    size_t frame_total = recording->frames.size();
+    if (options.max_frames != 0) {
+        frame_total = std::min(frame_total, options.max_frames);
+    }
+
+    // Same setup as the game, minus anything that needs a window or GPU
+    world::WorldConfig world_config;
+    world_config.name = "replay";
+    world_config.seed = header.world_seed;
+    world_config.view_distance = header.view_distance;
+    world_config.enable_saving = false;
+
+    world::WorldManager world_manager;
+    physics::PhysicsWorld physics_world;
+    physics::PlayerController player_controller;
+    rendering::Camera camera;
+    gameplay::BlockInteractionSystem block_interaction;
+    gameplay::Inventory inventory;
+    gameplay::ItemEntityManager item_entity_manager;
+
+    gameplay::SessionConfig session_config = gameplay::default_session_config();
+    session_config.physics.fixed_timestep = header.fixed_timestep;
+    session_config.item_entity.seed = header.gameplay_seed;
+
+    gameplay::ItemRegistry::instance().register_defaults();
+    if (!world_manager.initialize(world_config) || !physics_world.initialize(&world_manager, session_config.physics) ||
+        !player_controller.initialize(&physics_world, &world_manager, session_config.player) ||
+        !block_interaction.initialize(&physics_world, &player_controller, &world_manager, &camera,
+                                      session_config.interaction) ||
+        !inventory.initialize(session_config.inventory) ||
+        !item_entity_manager.initialize(&physics_world, &world_manager, &inventory, session_config.item_entity)) {
+        std::fprintf(stderr, "Failed to initialize the simulation\n");
+        core::Logger::shutdown();
+        return 1;
+    }
+    inventory.fill_hotbar_defaults();
+    block_interaction.set_inventory(&inventory);
+    block_interaction.set_item_entity_manager(&item_entity_manager);
+
+    ReplayObserver observer;
+    world_manager.add_observer(&observer);
+
+    player_controller.set_position(header.spawn_position);
+    camera.set_rotation(header.camera_pitch, header.camera_yaw);
+    world_manager.set_player_position(header.spawn_position);
+    load_chunks_around(world_manager, header.spawn_position, SIMULATION_RADIUS);
+
+    core::GameLoopConfig loop_config;
+    loop_config.fixed_timestep = header.fixed_timestep;
+    loop_config.simulated_frame_time = header.fixed_timestep;
+    loop_config.vsync = false;
+    loop_config.tasks.worker_threads = options.threads;
+    loop_config.tasks.deterministic = options.deterministic;
+
+    core::GameLoop loop;
+    loop.configure(loop_config);
+
+    // Fixed step: apply the recorded input, then simulate
+    size_t next_frame = 0;
+    physics::PlayerInput player_input;
+    loop.set_fixed_update([&](double dt) {
+        if (next_frame >= frame_total) {
+            return;
+        }
+        const gameplay::InputFrame& frame = recording->frames[next_frame++];
+        namespace button = gameplay::input_button;
+
+        camera.set_rotation(frame.camera_pitch, frame.camera_yaw);
+        player_input.move_direction = frame.move_direction;
+        player_input.jump_pressed = frame.has(button::JUMP);
+        player_input.jump_just_pressed = frame.has(button::JUMP_JUST_PRESSED);
+        player_input.sprint_pressed = frame.has(button::SPRINT);
+        player_input.crouch_pressed = frame.has(button::CROUCH);
+        inventory.select_slot(frame.hotbar_slot);
+
+        load_chunks_around(world_manager, player_controller.get_position(), SIMULATION_RADIUS);
+
+        player_controller.store_previous_state();
+        player_controller.fixed_update(dt, player_input);
+        physics_world.fixed_update(dt);
+        camera.set_position(player_controller.get_eye_position());
+
+        block_interaction.on_primary_action(frame.has(button::PRIMARY));
+        block_interaction.on_secondary_action(frame.has(button::SECONDARY_JUST_PRESSED));
+        block_interaction.update(dt);
+        item_entity_manager.update(dt, player_controller.get_position());
+    });
+
+    // Per frame: world streaming, then CPU meshing of every changed chunk
+    core::TaskGraph& tasks = loop.get_task_graph();
+    (void)tasks.add_task({.name = "world_streaming", .writes = {"chunks"}, .main_thread = true},
+                         [&world_manager, &player_controller](double dt) {
+                             world_manager.set_player_position(player_controller.get_position());
+                             world_manager.update(dt);
+                         });
+
+    rendering::MeshGenerator mesh_generator;
+    size_t meshes_built = 0;
+    (void)tasks.add_task({.name = "meshing", .reads = {"chunks"}, .writes = {"meshes"}}, [&](double /*dt*/) {
+        for (const world::ChunkPos& pos : observer.take_dirty()) {
+            const world::Chunk* chunk = world_manager.get_chunk(pos);
+            if (chunk == nullptr || !chunk->is_ready()) {
+                continue;
+            }
+            rendering::ChunkMeshData data;
+            rendering::ChunkMeshStats stats;
+            mesh_generator.generate(
+                *chunk, chunk->get_neighbor(world::HorizontalDirection::NegX),
+                chunk->get_neighbor(world::HorizontalDirection::PosX),
+                chunk->get_neighbor(world::HorizontalDirection::NegZ),
+                chunk->get_neighbor(world::HorizontalDirection::PosZ), data, stats);
+            ++meshes_built;
+        }
+    });
+
+    std::printf("Replaying %zu of %zu frames (world seed %u, gameplay seed %u)\n", frame_total,
+                recording->frames.size(), header.world_seed, header.gameplay_seed);
+
+    core::Histogram frame_us;
+    const auto start = Clock::now();
+    while (next_frame < frame_total) {
+        const auto frame_start = Clock::now();
+        loop.run_frame();
+        frame_us.record_duration(Clock::now() - frame_start);
+    }
+    const double wall_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+    const uint64_t hash = hash_final_state(world_manager, player_controller, inventory, item_entity_manager,
+                                           observer);
+
+    std::printf("\nSimulated %.1f s in %.2f s (%.1fx real time), %zu block edits, %zu meshes built\n",
+                static_cast<double>(frame_total) * header.fixed_timestep, wall_s,
+                wall_s > 0.0 ? static_cast<double>(frame_total) * header.fixed_timestep / wall_s : 0.0,
+                observer.edit_count(), meshes_built);
+    std::printf("Timing (%s tasks):\n", options.deterministic ? "sequential" : "parallel");
+    print_distribution("frame", frame_us.summary());
+    for (const auto& timing : tasks.get_timings()) {
+        print_distribution(timing.name.c_str(),
+                           core::MetricsRegistry::instance().histogram("task." + timing.name + "_us").summary());
+    }
+    std::printf("World state hash: %016llx\n", static_cast<unsigned long long>(hash));
+
+    world_manager.remove_observer(&observer);
+    item_entity_manager.shutdown();
+    inventory.shutdown();
+    block_interaction.shutdown();
+    player_controller.shutdown();
+    physics_world.shutdown();
+    world_manager.shutdown();
+
+    int result = 0;
+    if (options.check_hash && hash != options.expected_hash) {
+        std::printf("Hash mismatch: expected %016llx\n", static_cast<unsigned long long>(options.expected_hash));
+        result = 1;
+    }
+    core::Logger::shutdown();
+    return result;
+}
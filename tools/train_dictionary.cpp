@@ -0,0 +1,155 @@
+// RealCraft Tools
+// train_dictionary.cpp - Retrain the chunk compression dictionary for a world
+//
+// Usage: realcraft_train_dict <world_dir> [--samples N] [--size BYTES]
+//
+// Samples raw chunk payloads from the world's region files, trains a zstd
+// dictionary, stores it as <world>/dictionaries/<id>.zdict and marks it
+// active. Existing chunks keep referencing the dictionary they were written
+// with, so older dictionaries are left in place.
+
+#include <realcraft/core/logger.hpp>
+#include <realcraft/world/serialization.hpp>
+
+#include <glm/vec2.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::filesystem::path world_dir;
+    size_t max_samples = 4096;
+    size_t dictionary_size = realcraft::world::CompressionDictionary::DEFAULT_MAX_SIZE;
+};
+
+void print_usage() {
+    std::fprintf(stderr, "Usage: realcraft_train_dict <world_dir> [--samples N] [--size BYTES]\n");
+}
+
+bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--samples" && i + 1 < argc) {
+            options.max_samples = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--size" && i + 1 < argc) {
+            options.dictionary_size = std::strtoull(argv[++i], nullptr, 10);
+        } else if (!arg.empty() && arg[0] != '-' && options.world_dir.empty()) {
+            options.world_dir = arg;
+        } else {
+            return false;
+        }
+    }
+    return !options.world_dir.empty() && options.max_samples > 0 && options.dictionary_size > 0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    using namespace realcraft;
+
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage();
+        return 1;
+    }
+
+    core::LoggerConfig log_config;
+    log_config.log_directory = options.world_dir / "logs";
+    core::Logger::initialize(log_config);
+
+    // Decoding needs every dictionary existing chunks may reference
+    world::ChunkSerializer serializer;
+    serializer.load_dictionaries(options.world_dir);
+
+    std::vector<std::filesystem::path> region_paths;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(options.world_dir / "regions", ec)) {
+        if (entry.path().extension() == ".rcr") {
+            region_paths.push_back(entry.path());
+        }
+    }
+
+    if (region_paths.empty()) {
+        REALCRAFT_LOG_ERROR(core::log_category::WORLD, "No region files in {}", options.world_dir.string());
+        core::Logger::shutdown();
+        return 1;
+    }
+
+    // Visit chunk slots in random order so the sample spans the whole world
+    struct Slot {
+        size_t region;
+        int32_t index;
+    };
+    std::vector<Slot> slots;
+    slots.reserve(region_paths.size() * world::CHUNKS_PER_REGION);
+    for (size_t r = 0; r < region_paths.size(); ++r) {
+        for (int32_t i = 0; i < world::CHUNKS_PER_REGION; ++i) {
+            slots.push_back({r, i});
+        }
+    }
+    std::mt19937 rng(0x52435644);
+    std::shuffle(slots.begin(), slots.end(), rng);
+
+    std::vector<std::unique_ptr<world::RegionFile>> regions(region_paths.size());
+    std::vector<std::vector<uint8_t>> samples;
+
+    for (const Slot& slot : slots) {
+        if (samples.size() >= options.max_samples) {
+            break;
+        }
+
+        auto& region = regions[slot.region];
+        if (!region) {
+            region = std::make_unique<world::RegionFile>(region_paths[slot.region]);
+            if (!region->open(false)) {
+                continue;
+            }
+        }
+
+        glm::ivec2 region_pos = region->get_region_pos();
+        world::ChunkPos chunk_pos(region_pos.x * world::REGION_SIZE + slot.index % world::REGION_SIZE,
+                                  region_pos.y * world::REGION_SIZE + slot.index / world::REGION_SIZE);
+
+        auto data = region->read_chunk(chunk_pos);
+        if (!data) {
+            continue;
+        }
+
+        if (auto payload = serializer.decode_payload(*data)) {
+            samples.push_back(std::move(*payload));
+        }
+    }
+
+    REALCRAFT_LOG_INFO(core::log_category::WORLD, "Collected {} chunk samples from {} regions", samples.size(),
+                       region_paths.size());
+
+    auto dictionary = world::CompressionDictionary::train(samples, options.dictionary_size);
+    if (!dictionary) {
+        core::Logger::shutdown();
+        return 1;
+    }
+
+    uint32_t id = dictionary->get_id();
+    if (!dictionary->save(world::CompressionDictionary::path_for(options.world_dir, id))) {
+        core::Logger::shutdown();
+        return 1;
+    }
+
+    if (!world::CompressionDictionary::write_active_marker(options.world_dir, id)) {
+        core::Logger::shutdown();
+        return 1;
+    }
+
+    REALCRAFT_LOG_INFO(core::log_category::WORLD, "Dictionary {} ({} bytes) is now active", id,
+                       dictionary->get_data().size());
+    core::Logger::shutdown();
+    return 0;
+}